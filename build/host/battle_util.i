@@ -0,0 +1,9713 @@
+# 0 "src/battle_util.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "src/battle_util.c"
+# 1 "include/global.h" 1
+
+
+
+# 1 "include/config.h" 1
+
+
+
+# 1 "include/global.h" 1
+# 5 "include/config.h" 2
+# 5 "include/global.h" 2
+# 1 "include/gba/gba.h" 1
+
+
+
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 5 "include/gba/gba.h" 2
+# 1 "include/gba/defines.h" 1
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 5 "include/gba/defines.h" 2
+# 35 "include/gba/defines.h"
+# 1 "include/gba/host.h" 1
+
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 9 "include/gba/host.h" 2
+
+
+# 10 "include/gba/host.h"
+extern unsigned char gHostEwram[0x40000];
+extern unsigned char gHostIwram[0x8000];
+extern unsigned char gHostIoRegs[0x400];
+extern unsigned char gHostPltt[0x400];
+extern unsigned char gHostVram[0x18000];
+extern unsigned char gHostOam[0x400];
+
+
+
+
+void HostDmaSet(int dmaNum, uintptr_t src, uintptr_t dest, uint32_t control);
+
+
+
+void HostDmaTrigger(uint16_t timing);
+
+
+
+
+
+void HostSetDmaTiming(int enable);
+
+
+
+uint32_t HostCycleCount(void);
+# 36 "include/gba/defines.h" 2
+# 6 "include/gba/gba.h" 2
+# 1 "include/gba/io_reg.h" 1
+# 7 "include/gba/gba.h" 2
+# 1 "include/gba/types.h" 1
+
+
+
+
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+
+typedef volatile u8 vu8;
+typedef volatile u16 vu16;
+typedef volatile u32 vu32;
+typedef volatile u64 vu64;
+typedef volatile s8 vs8;
+typedef volatile s16 vs16;
+typedef volatile s32 vs32;
+typedef volatile s64 vs64;
+
+typedef float f32;
+typedef double f64;
+
+typedef u8 bool8;
+typedef u16 bool16;
+typedef u32 bool32;
+typedef vu8 vbool8;
+typedef vu16 vbool16;
+typedef vu32 vbool32;
+
+struct BgCnt
+{
+    u16 priority:2;
+    u16 charBaseBlock:2;
+    u16 dummy:2;
+    u16 mosaic:1;
+    u16 palettes:1;
+    u16 screenBaseBlock:5;
+    u16 areaOverflowMode:1;
+    u16 screenSize:2;
+};
+typedef volatile struct BgCnt vBgCnt;
+
+struct PlttData
+{
+    u16 r:5;
+    u16 g:5;
+    u16 b:5;
+    u16 unused_15:1;
+};
+
+struct OamData
+{
+             u32 y:8;
+             u32 affineMode:2;
+             u32 objMode:2;
+             u32 mosaic:1;
+             u32 bpp:1;
+             u32 shape:2;
+
+             u32 x:9;
+             u32 matrixNum:5;
+             u32 size:2;
+
+             u16 tileNum:10;
+             u16 priority:2;
+             u16 paletteNum:4;
+             u16 affineParam;
+};
+# 120 "include/gba/types.h"
+struct BgAffineSrcData
+{
+    s32 texX;
+    s32 texY;
+    s16 scrX;
+    s16 scrY;
+    s16 sx;
+    s16 sy;
+    u16 alpha;
+};
+
+struct BgAffineDstData
+{
+    s16 pa;
+    s16 pb;
+    s16 pc;
+    s16 pd;
+    s32 dx;
+    s32 dy;
+};
+
+struct ObjAffineSrcData
+{
+    s16 xScale;
+    s16 yScale;
+    u16 rotation;
+};
+
+
+struct SioMultiCnt
+{
+    u16 baudRate:2;
+    u16 si:1;
+    u16 sd:1;
+    u16 id:2;
+    u16 error:1;
+    u16 enable:1;
+    u16 unused_11_8:4;
+    u16 mode:2;
+    u16 intrEnable:1;
+    u16 unused_15:1;
+    u16 data;
+};
+# 8 "include/gba/gba.h" 2
+# 1 "include/gba/multiboot.h" 1
+# 9 "include/gba/multiboot.h"
+struct MultiBootParam
+{
+    u32 system_work[5];
+    u8 handshake_data;
+    u8 padding;
+    u16 handshake_timeout;
+    u8 probe_count;
+    u8 client_data[3];
+    u8 palette_data;
+    u8 response_bit;
+    u8 client_bit;
+    u8 reserved1;
+    const u8 *boot_srcp;
+    const u8 *boot_endp;
+    const u8 *masterp;
+    u8 *reserved2[3];
+    u32 system_work2[4];
+    u8 sendflag;
+    u8 probe_target_bit;
+    u8 check_wait;
+    u8 server_type;
+};
+# 9 "include/gba/gba.h" 2
+# 1 "include/gba/syscall.h" 1
+# 14 "include/gba/syscall.h"
+void SoftReset(u32 resetFlags);
+
+void RegisterRamReset(u32 resetFlags);
+
+void VBlankIntrWait(void);
+
+u16 Sqrt(u32 num);
+
+u16 ArcTan2(s16 x, s16 y);
+
+
+
+
+
+void CpuSet(const void *src, void *dest, u32 control);
+
+
+
+void CpuFastSet(const void *src, void *dest, u32 control);
+
+void BgAffineSet(struct BgAffineSrcData *src, struct BgAffineDstData *dest, s32 count);
+
+void ObjAffineSet(struct ObjAffineSrcData *src, void *dest, s32 count, s32 offset);
+
+void LZ77UnCompWram(const void *src, void *dest);
+
+void LZ77UnCompVram(const void *src, void *dest);
+
+void RLUnCompWram(const void *src, void *dest);
+
+void RLUnCompVram(const void *src, void *dest);
+
+int MultiBoot(struct MultiBootParam *mp);
+
+s32 Div(s32 num, s32 denom);
+# 10 "include/gba/gba.h" 2
+# 1 "include/gba/macro.h" 1
+# 11 "include/gba/gba.h" 2
+# 1 "include/gba/isagbprint.h" 1
+
+
+
+# 1 "include/gba/types.h" 1
+# 5 "include/gba/isagbprint.h" 2
+# 21 "include/gba/isagbprint.h"
+bool32 MgbaOpen(void);
+void MgbaClose(void);
+void MgbaPrintf(s32 level, const char *pBuf, ...);
+void MgbaAssert(const char *pFile, s32 nLine, const char *pExpression, bool32 nStopProgram);
+void NoCashGBAPrintf(const char *pBuf, ...);
+void NoCashGBAAssert(const char *pFile, s32 nLine, const char *pExpression, bool32 nStopProgram);
+void AGBPrintf(const char *pBuf, ...);
+void AGBAssert(const char *pFile, int nLine, const char *pExpression, int nStopProgram);
+void AGBPrintInit(void);
+# 12 "include/gba/gba.h" 2
+# 6 "include/global.h" 2
+
+# 1 "include/constants/global.h" 1
+# 8 "include/global.h" 2
+# 1 "include/constants/flags.h" 1
+
+
+
+# 1 "include/constants/trainers.h" 1
+
+
+
+# 1 "include/constants/opponents.h" 1
+# 5 "include/constants/trainers.h" 2
+# 5 "include/constants/flags.h" 2
+# 9 "include/global.h" 2
+# 1 "include/constants/vars.h" 1
+# 10 "include/global.h" 2
+# 1 "include/constants/species.h" 1
+# 11 "include/global.h" 2
+# 1 "include/constants/pokedex.h" 1
+
+
+
+
+enum {
+    NATIONAL_DEX_NONE,
+
+    NATIONAL_DEX_BULBASAUR,
+    NATIONAL_DEX_IVYSAUR,
+    NATIONAL_DEX_VENUSAUR,
+    NATIONAL_DEX_CHARMANDER,
+    NATIONAL_DEX_CHARMELEON,
+    NATIONAL_DEX_CHARIZARD,
+    NATIONAL_DEX_SQUIRTLE,
+    NATIONAL_DEX_WARTORTLE,
+    NATIONAL_DEX_BLASTOISE,
+    NATIONAL_DEX_CATERPIE,
+    NATIONAL_DEX_METAPOD,
+    NATIONAL_DEX_BUTTERFREE,
+    NATIONAL_DEX_WEEDLE,
+    NATIONAL_DEX_KAKUNA,
+    NATIONAL_DEX_BEEDRILL,
+    NATIONAL_DEX_PIDGEY,
+    NATIONAL_DEX_PIDGEOTTO,
+    NATIONAL_DEX_PIDGEOT,
+    NATIONAL_DEX_RATTATA,
+    NATIONAL_DEX_RATICATE,
+    NATIONAL_DEX_SPEAROW,
+    NATIONAL_DEX_FEAROW,
+    NATIONAL_DEX_EKANS,
+    NATIONAL_DEX_ARBOK,
+    NATIONAL_DEX_PIKACHU,
+    NATIONAL_DEX_RAICHU,
+    NATIONAL_DEX_SANDSHREW,
+    NATIONAL_DEX_SANDSLASH,
+    NATIONAL_DEX_NIDORAN_F,
+    NATIONAL_DEX_NIDORINA,
+    NATIONAL_DEX_NIDOQUEEN,
+    NATIONAL_DEX_NIDORAN_M,
+    NATIONAL_DEX_NIDORINO,
+    NATIONAL_DEX_NIDOKING,
+    NATIONAL_DEX_CLEFAIRY,
+    NATIONAL_DEX_CLEFABLE,
+    NATIONAL_DEX_VULPIX,
+    NATIONAL_DEX_NINETALES,
+    NATIONAL_DEX_JIGGLYPUFF,
+    NATIONAL_DEX_WIGGLYTUFF,
+    NATIONAL_DEX_ZUBAT,
+    NATIONAL_DEX_GOLBAT,
+    NATIONAL_DEX_ODDISH,
+    NATIONAL_DEX_GLOOM,
+    NATIONAL_DEX_VILEPLUME,
+    NATIONAL_DEX_PARAS,
+    NATIONAL_DEX_PARASECT,
+    NATIONAL_DEX_VENONAT,
+    NATIONAL_DEX_VENOMOTH,
+    NATIONAL_DEX_DIGLETT,
+    NATIONAL_DEX_DUGTRIO,
+    NATIONAL_DEX_MEOWTH,
+    NATIONAL_DEX_PERSIAN,
+    NATIONAL_DEX_PSYDUCK,
+    NATIONAL_DEX_GOLDUCK,
+    NATIONAL_DEX_MANKEY,
+    NATIONAL_DEX_PRIMEAPE,
+    NATIONAL_DEX_GROWLITHE,
+    NATIONAL_DEX_ARCANINE,
+    NATIONAL_DEX_POLIWAG,
+    NATIONAL_DEX_POLIWHIRL,
+    NATIONAL_DEX_POLIWRATH,
+    NATIONAL_DEX_ABRA,
+    NATIONAL_DEX_KADABRA,
+    NATIONAL_DEX_ALAKAZAM,
+    NATIONAL_DEX_MACHOP,
+    NATIONAL_DEX_MACHOKE,
+    NATIONAL_DEX_MACHAMP,
+    NATIONAL_DEX_BELLSPROUT,
+    NATIONAL_DEX_WEEPINBELL,
+    NATIONAL_DEX_VICTREEBEL,
+    NATIONAL_DEX_TENTACOOL,
+    NATIONAL_DEX_TENTACRUEL,
+    NATIONAL_DEX_GEODUDE,
+    NATIONAL_DEX_GRAVELER,
+    NATIONAL_DEX_GOLEM,
+    NATIONAL_DEX_PONYTA,
+    NATIONAL_DEX_RAPIDASH,
+    NATIONAL_DEX_SLOWPOKE,
+    NATIONAL_DEX_SLOWBRO,
+    NATIONAL_DEX_MAGNEMITE,
+    NATIONAL_DEX_MAGNETON,
+    NATIONAL_DEX_FARFETCHD,
+    NATIONAL_DEX_DODUO,
+    NATIONAL_DEX_DODRIO,
+    NATIONAL_DEX_SEEL,
+    NATIONAL_DEX_DEWGONG,
+    NATIONAL_DEX_GRIMER,
+    NATIONAL_DEX_MUK,
+    NATIONAL_DEX_SHELLDER,
+    NATIONAL_DEX_CLOYSTER,
+    NATIONAL_DEX_GASTLY,
+    NATIONAL_DEX_HAUNTER,
+    NATIONAL_DEX_GENGAR,
+    NATIONAL_DEX_ONIX,
+    NATIONAL_DEX_DROWZEE,
+    NATIONAL_DEX_HYPNO,
+    NATIONAL_DEX_KRABBY,
+    NATIONAL_DEX_KINGLER,
+    NATIONAL_DEX_VOLTORB,
+    NATIONAL_DEX_ELECTRODE,
+    NATIONAL_DEX_EXEGGCUTE,
+    NATIONAL_DEX_EXEGGUTOR,
+    NATIONAL_DEX_CUBONE,
+    NATIONAL_DEX_MAROWAK,
+    NATIONAL_DEX_HITMONLEE,
+    NATIONAL_DEX_HITMONCHAN,
+    NATIONAL_DEX_LICKITUNG,
+    NATIONAL_DEX_KOFFING,
+    NATIONAL_DEX_WEEZING,
+    NATIONAL_DEX_RHYHORN,
+    NATIONAL_DEX_RHYDON,
+    NATIONAL_DEX_CHANSEY,
+    NATIONAL_DEX_TANGELA,
+    NATIONAL_DEX_KANGASKHAN,
+    NATIONAL_DEX_HORSEA,
+    NATIONAL_DEX_SEADRA,
+    NATIONAL_DEX_GOLDEEN,
+    NATIONAL_DEX_SEAKING,
+    NATIONAL_DEX_STARYU,
+    NATIONAL_DEX_STARMIE,
+    NATIONAL_DEX_MR_MIME,
+    NATIONAL_DEX_SCYTHER,
+    NATIONAL_DEX_JYNX,
+    NATIONAL_DEX_ELECTABUZZ,
+    NATIONAL_DEX_MAGMAR,
+    NATIONAL_DEX_PINSIR,
+    NATIONAL_DEX_TAUROS,
+    NATIONAL_DEX_MAGIKARP,
+    NATIONAL_DEX_GYARADOS,
+    NATIONAL_DEX_LAPRAS,
+    NATIONAL_DEX_DITTO,
+    NATIONAL_DEX_EEVEE,
+    NATIONAL_DEX_VAPOREON,
+    NATIONAL_DEX_JOLTEON,
+    NATIONAL_DEX_FLAREON,
+    NATIONAL_DEX_PORYGON,
+    NATIONAL_DEX_OMANYTE,
+    NATIONAL_DEX_OMASTAR,
+    NATIONAL_DEX_KABUTO,
+    NATIONAL_DEX_KABUTOPS,
+    NATIONAL_DEX_AERODACTYL,
+    NATIONAL_DEX_SNORLAX,
+    NATIONAL_DEX_ARTICUNO,
+    NATIONAL_DEX_ZAPDOS,
+    NATIONAL_DEX_MOLTRES,
+    NATIONAL_DEX_DRATINI,
+    NATIONAL_DEX_DRAGONAIR,
+    NATIONAL_DEX_DRAGONITE,
+    NATIONAL_DEX_MEWTWO,
+    NATIONAL_DEX_MEW,
+
+    NATIONAL_DEX_CHIKORITA,
+    NATIONAL_DEX_BAYLEEF,
+    NATIONAL_DEX_MEGANIUM,
+    NATIONAL_DEX_CYNDAQUIL,
+    NATIONAL_DEX_QUILAVA,
+    NATIONAL_DEX_TYPHLOSION,
+    NATIONAL_DEX_TOTODILE,
+    NATIONAL_DEX_CROCONAW,
+    NATIONAL_DEX_FERALIGATR,
+    NATIONAL_DEX_SENTRET,
+    NATIONAL_DEX_FURRET,
+    NATIONAL_DEX_HOOTHOOT,
+    NATIONAL_DEX_NOCTOWL,
+    NATIONAL_DEX_LEDYBA,
+    NATIONAL_DEX_LEDIAN,
+    NATIONAL_DEX_SPINARAK,
+    NATIONAL_DEX_ARIADOS,
+    NATIONAL_DEX_CROBAT,
+    NATIONAL_DEX_CHINCHOU,
+    NATIONAL_DEX_LANTURN,
+    NATIONAL_DEX_PICHU,
+    NATIONAL_DEX_CLEFFA,
+    NATIONAL_DEX_IGGLYBUFF,
+    NATIONAL_DEX_TOGEPI,
+    NATIONAL_DEX_TOGETIC,
+    NATIONAL_DEX_NATU,
+    NATIONAL_DEX_XATU,
+    NATIONAL_DEX_MAREEP,
+    NATIONAL_DEX_FLAAFFY,
+    NATIONAL_DEX_AMPHAROS,
+    NATIONAL_DEX_BELLOSSOM,
+    NATIONAL_DEX_MARILL,
+    NATIONAL_DEX_AZUMARILL,
+    NATIONAL_DEX_SUDOWOODO,
+    NATIONAL_DEX_POLITOED,
+    NATIONAL_DEX_HOPPIP,
+    NATIONAL_DEX_SKIPLOOM,
+    NATIONAL_DEX_JUMPLUFF,
+    NATIONAL_DEX_AIPOM,
+    NATIONAL_DEX_SUNKERN,
+    NATIONAL_DEX_SUNFLORA,
+    NATIONAL_DEX_YANMA,
+    NATIONAL_DEX_WOOPER,
+    NATIONAL_DEX_QUAGSIRE,
+    NATIONAL_DEX_ESPEON,
+    NATIONAL_DEX_UMBREON,
+    NATIONAL_DEX_MURKROW,
+    NATIONAL_DEX_SLOWKING,
+    NATIONAL_DEX_MISDREAVUS,
+    NATIONAL_DEX_UNOWN,
+    NATIONAL_DEX_WOBBUFFET,
+    NATIONAL_DEX_GIRAFARIG,
+    NATIONAL_DEX_PINECO,
+    NATIONAL_DEX_FORRETRESS,
+    NATIONAL_DEX_DUNSPARCE,
+    NATIONAL_DEX_GLIGAR,
+    NATIONAL_DEX_STEELIX,
+    NATIONAL_DEX_SNUBBULL,
+    NATIONAL_DEX_GRANBULL,
+    NATIONAL_DEX_QWILFISH,
+    NATIONAL_DEX_SCIZOR,
+    NATIONAL_DEX_SHUCKLE,
+    NATIONAL_DEX_HERACROSS,
+    NATIONAL_DEX_SNEASEL,
+    NATIONAL_DEX_TEDDIURSA,
+    NATIONAL_DEX_URSARING,
+    NATIONAL_DEX_SLUGMA,
+    NATIONAL_DEX_MAGCARGO,
+    NATIONAL_DEX_SWINUB,
+    NATIONAL_DEX_PILOSWINE,
+    NATIONAL_DEX_CORSOLA,
+    NATIONAL_DEX_REMORAID,
+    NATIONAL_DEX_OCTILLERY,
+    NATIONAL_DEX_DELIBIRD,
+    NATIONAL_DEX_MANTINE,
+    NATIONAL_DEX_SKARMORY,
+    NATIONAL_DEX_HOUNDOUR,
+    NATIONAL_DEX_HOUNDOOM,
+    NATIONAL_DEX_KINGDRA,
+    NATIONAL_DEX_PHANPY,
+    NATIONAL_DEX_DONPHAN,
+    NATIONAL_DEX_PORYGON2,
+    NATIONAL_DEX_STANTLER,
+    NATIONAL_DEX_SMEARGLE,
+    NATIONAL_DEX_TYROGUE,
+    NATIONAL_DEX_HITMONTOP,
+    NATIONAL_DEX_SMOOCHUM,
+    NATIONAL_DEX_ELEKID,
+    NATIONAL_DEX_MAGBY,
+    NATIONAL_DEX_MILTANK,
+    NATIONAL_DEX_BLISSEY,
+    NATIONAL_DEX_RAIKOU,
+    NATIONAL_DEX_ENTEI,
+    NATIONAL_DEX_SUICUNE,
+    NATIONAL_DEX_LARVITAR,
+    NATIONAL_DEX_PUPITAR,
+    NATIONAL_DEX_TYRANITAR,
+    NATIONAL_DEX_LUGIA,
+    NATIONAL_DEX_HO_OH,
+    NATIONAL_DEX_CELEBI,
+
+    NATIONAL_DEX_TREECKO,
+    NATIONAL_DEX_GROVYLE,
+    NATIONAL_DEX_SCEPTILE,
+    NATIONAL_DEX_TORCHIC,
+    NATIONAL_DEX_COMBUSKEN,
+    NATIONAL_DEX_BLAZIKEN,
+    NATIONAL_DEX_MUDKIP,
+    NATIONAL_DEX_MARSHTOMP,
+    NATIONAL_DEX_SWAMPERT,
+    NATIONAL_DEX_POOCHYENA,
+    NATIONAL_DEX_MIGHTYENA,
+    NATIONAL_DEX_ZIGZAGOON,
+    NATIONAL_DEX_LINOONE,
+    NATIONAL_DEX_WURMPLE,
+    NATIONAL_DEX_SILCOON,
+    NATIONAL_DEX_BEAUTIFLY,
+    NATIONAL_DEX_CASCOON,
+    NATIONAL_DEX_DUSTOX,
+    NATIONAL_DEX_LOTAD,
+    NATIONAL_DEX_LOMBRE,
+    NATIONAL_DEX_LUDICOLO,
+    NATIONAL_DEX_SEEDOT,
+    NATIONAL_DEX_NUZLEAF,
+    NATIONAL_DEX_SHIFTRY,
+    NATIONAL_DEX_TAILLOW,
+    NATIONAL_DEX_SWELLOW,
+    NATIONAL_DEX_WINGULL,
+    NATIONAL_DEX_PELIPPER,
+    NATIONAL_DEX_RALTS,
+    NATIONAL_DEX_KIRLIA,
+    NATIONAL_DEX_GARDEVOIR,
+    NATIONAL_DEX_SURSKIT,
+    NATIONAL_DEX_MASQUERAIN,
+    NATIONAL_DEX_SHROOMISH,
+    NATIONAL_DEX_BRELOOM,
+    NATIONAL_DEX_SLAKOTH,
+    NATIONAL_DEX_VIGOROTH,
+    NATIONAL_DEX_SLAKING,
+    NATIONAL_DEX_NINCADA,
+    NATIONAL_DEX_NINJASK,
+    NATIONAL_DEX_SHEDINJA,
+    NATIONAL_DEX_WHISMUR,
+    NATIONAL_DEX_LOUDRED,
+    NATIONAL_DEX_EXPLOUD,
+    NATIONAL_DEX_MAKUHITA,
+    NATIONAL_DEX_HARIYAMA,
+    NATIONAL_DEX_AZURILL,
+    NATIONAL_DEX_NOSEPASS,
+    NATIONAL_DEX_SKITTY,
+    NATIONAL_DEX_DELCATTY,
+    NATIONAL_DEX_SABLEYE,
+    NATIONAL_DEX_MAWILE,
+    NATIONAL_DEX_ARON,
+    NATIONAL_DEX_LAIRON,
+    NATIONAL_DEX_AGGRON,
+    NATIONAL_DEX_MEDITITE,
+    NATIONAL_DEX_MEDICHAM,
+    NATIONAL_DEX_ELECTRIKE,
+    NATIONAL_DEX_MANECTRIC,
+    NATIONAL_DEX_PLUSLE,
+    NATIONAL_DEX_MINUN,
+    NATIONAL_DEX_VOLBEAT,
+    NATIONAL_DEX_ILLUMISE,
+    NATIONAL_DEX_ROSELIA,
+    NATIONAL_DEX_GULPIN,
+    NATIONAL_DEX_SWALOT,
+    NATIONAL_DEX_CARVANHA,
+    NATIONAL_DEX_SHARPEDO,
+    NATIONAL_DEX_WAILMER,
+    NATIONAL_DEX_WAILORD,
+    NATIONAL_DEX_NUMEL,
+    NATIONAL_DEX_CAMERUPT,
+    NATIONAL_DEX_TORKOAL,
+    NATIONAL_DEX_SPOINK,
+    NATIONAL_DEX_GRUMPIG,
+    NATIONAL_DEX_SPINDA,
+    NATIONAL_DEX_TRAPINCH,
+    NATIONAL_DEX_VIBRAVA,
+    NATIONAL_DEX_FLYGON,
+    NATIONAL_DEX_CACNEA,
+    NATIONAL_DEX_CACTURNE,
+    NATIONAL_DEX_SWABLU,
+    NATIONAL_DEX_ALTARIA,
+    NATIONAL_DEX_ZANGOOSE,
+    NATIONAL_DEX_SEVIPER,
+    NATIONAL_DEX_LUNATONE,
+    NATIONAL_DEX_SOLROCK,
+    NATIONAL_DEX_BARBOACH,
+    NATIONAL_DEX_WHISCASH,
+    NATIONAL_DEX_CORPHISH,
+    NATIONAL_DEX_CRAWDAUNT,
+    NATIONAL_DEX_BALTOY,
+    NATIONAL_DEX_CLAYDOL,
+    NATIONAL_DEX_LILEEP,
+    NATIONAL_DEX_CRADILY,
+    NATIONAL_DEX_ANORITH,
+    NATIONAL_DEX_ARMALDO,
+    NATIONAL_DEX_FEEBAS,
+    NATIONAL_DEX_MILOTIC,
+    NATIONAL_DEX_CASTFORM,
+    NATIONAL_DEX_KECLEON,
+    NATIONAL_DEX_SHUPPET,
+    NATIONAL_DEX_BANETTE,
+    NATIONAL_DEX_DUSKULL,
+    NATIONAL_DEX_DUSCLOPS,
+    NATIONAL_DEX_TROPIUS,
+    NATIONAL_DEX_CHIMECHO,
+    NATIONAL_DEX_ABSOL,
+    NATIONAL_DEX_WYNAUT,
+    NATIONAL_DEX_SNORUNT,
+    NATIONAL_DEX_GLALIE,
+    NATIONAL_DEX_SPHEAL,
+    NATIONAL_DEX_SEALEO,
+    NATIONAL_DEX_WALREIN,
+    NATIONAL_DEX_CLAMPERL,
+    NATIONAL_DEX_HUNTAIL,
+    NATIONAL_DEX_GOREBYSS,
+    NATIONAL_DEX_RELICANTH,
+    NATIONAL_DEX_LUVDISC,
+    NATIONAL_DEX_BAGON,
+    NATIONAL_DEX_SHELGON,
+    NATIONAL_DEX_SALAMENCE,
+    NATIONAL_DEX_BELDUM,
+    NATIONAL_DEX_METANG,
+    NATIONAL_DEX_METAGROSS,
+    NATIONAL_DEX_REGIROCK,
+    NATIONAL_DEX_REGICE,
+    NATIONAL_DEX_REGISTEEL,
+    NATIONAL_DEX_LATIAS,
+    NATIONAL_DEX_LATIOS,
+    NATIONAL_DEX_KYOGRE,
+    NATIONAL_DEX_GROUDON,
+    NATIONAL_DEX_RAYQUAZA,
+    NATIONAL_DEX_JIRACHI,
+    NATIONAL_DEX_DEOXYS,
+
+    NATIONAL_DEX_OLD_UNOWN_B,
+    NATIONAL_DEX_OLD_UNOWN_C,
+    NATIONAL_DEX_OLD_UNOWN_D,
+    NATIONAL_DEX_OLD_UNOWN_E,
+    NATIONAL_DEX_OLD_UNOWN_F,
+    NATIONAL_DEX_OLD_UNOWN_G,
+    NATIONAL_DEX_OLD_UNOWN_H,
+    NATIONAL_DEX_OLD_UNOWN_I,
+    NATIONAL_DEX_OLD_UNOWN_J,
+    NATIONAL_DEX_OLD_UNOWN_K,
+    NATIONAL_DEX_OLD_UNOWN_L,
+    NATIONAL_DEX_OLD_UNOWN_M,
+    NATIONAL_DEX_OLD_UNOWN_N,
+    NATIONAL_DEX_OLD_UNOWN_O,
+    NATIONAL_DEX_OLD_UNOWN_P,
+    NATIONAL_DEX_OLD_UNOWN_Q,
+    NATIONAL_DEX_OLD_UNOWN_R,
+    NATIONAL_DEX_OLD_UNOWN_S,
+    NATIONAL_DEX_OLD_UNOWN_T,
+    NATIONAL_DEX_OLD_UNOWN_U,
+    NATIONAL_DEX_OLD_UNOWN_V,
+    NATIONAL_DEX_OLD_UNOWN_W,
+    NATIONAL_DEX_OLD_UNOWN_X,
+    NATIONAL_DEX_OLD_UNOWN_Y,
+    NATIONAL_DEX_OLD_UNOWN_Z,
+};
+
+
+
+
+
+
+enum {
+    HOENN_DEX_NONE,
+    HOENN_DEX_TREECKO,
+    HOENN_DEX_GROVYLE,
+    HOENN_DEX_SCEPTILE,
+    HOENN_DEX_TORCHIC,
+    HOENN_DEX_COMBUSKEN,
+    HOENN_DEX_BLAZIKEN,
+    HOENN_DEX_MUDKIP,
+    HOENN_DEX_MARSHTOMP,
+    HOENN_DEX_SWAMPERT,
+    HOENN_DEX_POOCHYENA,
+    HOENN_DEX_MIGHTYENA,
+    HOENN_DEX_ZIGZAGOON,
+    HOENN_DEX_LINOONE,
+    HOENN_DEX_WURMPLE,
+    HOENN_DEX_SILCOON,
+    HOENN_DEX_BEAUTIFLY,
+    HOENN_DEX_CASCOON,
+    HOENN_DEX_DUSTOX,
+    HOENN_DEX_LOTAD,
+    HOENN_DEX_LOMBRE,
+    HOENN_DEX_LUDICOLO,
+    HOENN_DEX_SEEDOT,
+    HOENN_DEX_NUZLEAF,
+    HOENN_DEX_SHIFTRY,
+    HOENN_DEX_TAILLOW,
+    HOENN_DEX_SWELLOW,
+    HOENN_DEX_WINGULL,
+    HOENN_DEX_PELIPPER,
+    HOENN_DEX_RALTS,
+    HOENN_DEX_KIRLIA,
+    HOENN_DEX_GARDEVOIR,
+    HOENN_DEX_SURSKIT,
+    HOENN_DEX_MASQUERAIN,
+    HOENN_DEX_SHROOMISH,
+    HOENN_DEX_BRELOOM,
+    HOENN_DEX_SLAKOTH,
+    HOENN_DEX_VIGOROTH,
+    HOENN_DEX_SLAKING,
+    HOENN_DEX_ABRA,
+    HOENN_DEX_KADABRA,
+    HOENN_DEX_ALAKAZAM,
+    HOENN_DEX_NINCADA,
+    HOENN_DEX_NINJASK,
+    HOENN_DEX_SHEDINJA,
+    HOENN_DEX_WHISMUR,
+    HOENN_DEX_LOUDRED,
+    HOENN_DEX_EXPLOUD,
+    HOENN_DEX_MAKUHITA,
+    HOENN_DEX_HARIYAMA,
+    HOENN_DEX_GOLDEEN,
+    HOENN_DEX_SEAKING,
+    HOENN_DEX_MAGIKARP,
+    HOENN_DEX_GYARADOS,
+    HOENN_DEX_AZURILL,
+    HOENN_DEX_MARILL,
+    HOENN_DEX_AZUMARILL,
+    HOENN_DEX_GEODUDE,
+    HOENN_DEX_GRAVELER,
+    HOENN_DEX_GOLEM,
+    HOENN_DEX_NOSEPASS,
+    HOENN_DEX_SKITTY,
+    HOENN_DEX_DELCATTY,
+    HOENN_DEX_ZUBAT,
+    HOENN_DEX_GOLBAT,
+    HOENN_DEX_CROBAT,
+    HOENN_DEX_TENTACOOL,
+    HOENN_DEX_TENTACRUEL,
+    HOENN_DEX_SABLEYE,
+    HOENN_DEX_MAWILE,
+    HOENN_DEX_ARON,
+    HOENN_DEX_LAIRON,
+    HOENN_DEX_AGGRON,
+    HOENN_DEX_MACHOP,
+    HOENN_DEX_MACHOKE,
+    HOENN_DEX_MACHAMP,
+    HOENN_DEX_MEDITITE,
+    HOENN_DEX_MEDICHAM,
+    HOENN_DEX_ELECTRIKE,
+    HOENN_DEX_MANECTRIC,
+    HOENN_DEX_PLUSLE,
+    HOENN_DEX_MINUN,
+    HOENN_DEX_MAGNEMITE,
+    HOENN_DEX_MAGNETON,
+    HOENN_DEX_VOLTORB,
+    HOENN_DEX_ELECTRODE,
+    HOENN_DEX_VOLBEAT,
+    HOENN_DEX_ILLUMISE,
+    HOENN_DEX_ODDISH,
+    HOENN_DEX_GLOOM,
+    HOENN_DEX_VILEPLUME,
+    HOENN_DEX_BELLOSSOM,
+    HOENN_DEX_DODUO,
+    HOENN_DEX_DODRIO,
+    HOENN_DEX_ROSELIA,
+    HOENN_DEX_GULPIN,
+    HOENN_DEX_SWALOT,
+    HOENN_DEX_CARVANHA,
+    HOENN_DEX_SHARPEDO,
+    HOENN_DEX_WAILMER,
+    HOENN_DEX_WAILORD,
+    HOENN_DEX_NUMEL,
+    HOENN_DEX_CAMERUPT,
+    HOENN_DEX_SLUGMA,
+    HOENN_DEX_MAGCARGO,
+    HOENN_DEX_TORKOAL,
+    HOENN_DEX_GRIMER,
+    HOENN_DEX_MUK,
+    HOENN_DEX_KOFFING,
+    HOENN_DEX_WEEZING,
+    HOENN_DEX_SPOINK,
+    HOENN_DEX_GRUMPIG,
+    HOENN_DEX_SANDSHREW,
+    HOENN_DEX_SANDSLASH,
+    HOENN_DEX_SPINDA,
+    HOENN_DEX_SKARMORY,
+    HOENN_DEX_TRAPINCH,
+    HOENN_DEX_VIBRAVA,
+    HOENN_DEX_FLYGON,
+    HOENN_DEX_CACNEA,
+    HOENN_DEX_CACTURNE,
+    HOENN_DEX_SWABLU,
+    HOENN_DEX_ALTARIA,
+    HOENN_DEX_ZANGOOSE,
+    HOENN_DEX_SEVIPER,
+    HOENN_DEX_LUNATONE,
+    HOENN_DEX_SOLROCK,
+    HOENN_DEX_BARBOACH,
+    HOENN_DEX_WHISCASH,
+    HOENN_DEX_CORPHISH,
+    HOENN_DEX_CRAWDAUNT,
+    HOENN_DEX_BALTOY,
+    HOENN_DEX_CLAYDOL,
+    HOENN_DEX_LILEEP,
+    HOENN_DEX_CRADILY,
+    HOENN_DEX_ANORITH,
+    HOENN_DEX_ARMALDO,
+    HOENN_DEX_IGGLYBUFF,
+    HOENN_DEX_JIGGLYPUFF,
+    HOENN_DEX_WIGGLYTUFF,
+    HOENN_DEX_FEEBAS,
+    HOENN_DEX_MILOTIC,
+    HOENN_DEX_CASTFORM,
+    HOENN_DEX_STARYU,
+    HOENN_DEX_STARMIE,
+    HOENN_DEX_KECLEON,
+    HOENN_DEX_SHUPPET,
+    HOENN_DEX_BANETTE,
+    HOENN_DEX_DUSKULL,
+    HOENN_DEX_DUSCLOPS,
+    HOENN_DEX_TROPIUS,
+    HOENN_DEX_CHIMECHO,
+    HOENN_DEX_ABSOL,
+    HOENN_DEX_VULPIX,
+    HOENN_DEX_NINETALES,
+    HOENN_DEX_PICHU,
+    HOENN_DEX_PIKACHU,
+    HOENN_DEX_RAICHU,
+    HOENN_DEX_PSYDUCK,
+    HOENN_DEX_GOLDUCK,
+    HOENN_DEX_WYNAUT,
+    HOENN_DEX_WOBBUFFET,
+    HOENN_DEX_NATU,
+    HOENN_DEX_XATU,
+    HOENN_DEX_GIRAFARIG,
+    HOENN_DEX_PHANPY,
+    HOENN_DEX_DONPHAN,
+    HOENN_DEX_PINSIR,
+    HOENN_DEX_HERACROSS,
+    HOENN_DEX_RHYHORN,
+    HOENN_DEX_RHYDON,
+    HOENN_DEX_SNORUNT,
+    HOENN_DEX_GLALIE,
+    HOENN_DEX_SPHEAL,
+    HOENN_DEX_SEALEO,
+    HOENN_DEX_WALREIN,
+    HOENN_DEX_CLAMPERL,
+    HOENN_DEX_HUNTAIL,
+    HOENN_DEX_GOREBYSS,
+    HOENN_DEX_RELICANTH,
+    HOENN_DEX_CORSOLA,
+    HOENN_DEX_CHINCHOU,
+    HOENN_DEX_LANTURN,
+    HOENN_DEX_LUVDISC,
+    HOENN_DEX_HORSEA,
+    HOENN_DEX_SEADRA,
+    HOENN_DEX_KINGDRA,
+    HOENN_DEX_BAGON,
+    HOENN_DEX_SHELGON,
+    HOENN_DEX_SALAMENCE,
+    HOENN_DEX_BELDUM,
+    HOENN_DEX_METANG,
+    HOENN_DEX_METAGROSS,
+    HOENN_DEX_REGIROCK,
+    HOENN_DEX_REGICE,
+    HOENN_DEX_REGISTEEL,
+    HOENN_DEX_LATIAS,
+    HOENN_DEX_LATIOS,
+    HOENN_DEX_KYOGRE,
+    HOENN_DEX_GROUDON,
+    HOENN_DEX_RAYQUAZA,
+    HOENN_DEX_JIRACHI,
+    HOENN_DEX_DEOXYS,
+
+
+    HOENN_DEX_BULBASAUR,
+    HOENN_DEX_IVYSAUR,
+    HOENN_DEX_VENUSAUR,
+    HOENN_DEX_CHARMANDER,
+    HOENN_DEX_CHARMELEON,
+    HOENN_DEX_CHARIZARD,
+    HOENN_DEX_SQUIRTLE,
+    HOENN_DEX_WARTORTLE,
+    HOENN_DEX_BLASTOISE,
+    HOENN_DEX_CATERPIE,
+    HOENN_DEX_METAPOD,
+    HOENN_DEX_BUTTERFREE,
+    HOENN_DEX_WEEDLE,
+    HOENN_DEX_KAKUNA,
+    HOENN_DEX_BEEDRILL,
+    HOENN_DEX_PIDGEY,
+    HOENN_DEX_PIDGEOTTO,
+    HOENN_DEX_PIDGEOT,
+    HOENN_DEX_RATTATA,
+    HOENN_DEX_RATICATE,
+    HOENN_DEX_SPEAROW,
+    HOENN_DEX_FEAROW,
+    HOENN_DEX_EKANS,
+    HOENN_DEX_ARBOK,
+    HOENN_DEX_NIDORAN_F,
+    HOENN_DEX_NIDORINA,
+    HOENN_DEX_NIDOQUEEN,
+    HOENN_DEX_NIDORAN_M,
+    HOENN_DEX_NIDORINO,
+    HOENN_DEX_NIDOKING,
+    HOENN_DEX_CLEFAIRY,
+    HOENN_DEX_CLEFABLE,
+    HOENN_DEX_PARAS,
+    HOENN_DEX_PARASECT,
+    HOENN_DEX_VENONAT,
+    HOENN_DEX_VENOMOTH,
+    HOENN_DEX_DIGLETT,
+    HOENN_DEX_DUGTRIO,
+    HOENN_DEX_MEOWTH,
+    HOENN_DEX_PERSIAN,
+    HOENN_DEX_MANKEY,
+    HOENN_DEX_PRIMEAPE,
+    HOENN_DEX_GROWLITHE,
+    HOENN_DEX_ARCANINE,
+    HOENN_DEX_POLIWAG,
+    HOENN_DEX_POLIWHIRL,
+    HOENN_DEX_POLIWRATH,
+    HOENN_DEX_BELLSPROUT,
+    HOENN_DEX_WEEPINBELL,
+    HOENN_DEX_VICTREEBEL,
+    HOENN_DEX_PONYTA,
+    HOENN_DEX_RAPIDASH,
+    HOENN_DEX_SLOWPOKE,
+    HOENN_DEX_SLOWBRO,
+    HOENN_DEX_FARFETCHD,
+    HOENN_DEX_SEEL,
+    HOENN_DEX_DEWGONG,
+    HOENN_DEX_SHELLDER,
+    HOENN_DEX_CLOYSTER,
+    HOENN_DEX_GASTLY,
+    HOENN_DEX_HAUNTER,
+    HOENN_DEX_GENGAR,
+    HOENN_DEX_ONIX,
+    HOENN_DEX_DROWZEE,
+    HOENN_DEX_HYPNO,
+    HOENN_DEX_KRABBY,
+    HOENN_DEX_KINGLER,
+    HOENN_DEX_EXEGGCUTE,
+    HOENN_DEX_EXEGGUTOR,
+    HOENN_DEX_CUBONE,
+    HOENN_DEX_MAROWAK,
+    HOENN_DEX_HITMONLEE,
+    HOENN_DEX_HITMONCHAN,
+    HOENN_DEX_LICKITUNG,
+    HOENN_DEX_CHANSEY,
+    HOENN_DEX_TANGELA,
+    HOENN_DEX_KANGASKHAN,
+    HOENN_DEX_MR_MIME,
+    HOENN_DEX_SCYTHER,
+    HOENN_DEX_JYNX,
+    HOENN_DEX_ELECTABUZZ,
+    HOENN_DEX_MAGMAR,
+    HOENN_DEX_TAUROS,
+    HOENN_DEX_LAPRAS,
+    HOENN_DEX_DITTO,
+    HOENN_DEX_EEVEE,
+    HOENN_DEX_VAPOREON,
+    HOENN_DEX_JOLTEON,
+    HOENN_DEX_FLAREON,
+    HOENN_DEX_PORYGON,
+    HOENN_DEX_OMANYTE,
+    HOENN_DEX_OMASTAR,
+    HOENN_DEX_KABUTO,
+    HOENN_DEX_KABUTOPS,
+    HOENN_DEX_AERODACTYL,
+    HOENN_DEX_SNORLAX,
+    HOENN_DEX_ARTICUNO,
+    HOENN_DEX_ZAPDOS,
+    HOENN_DEX_MOLTRES,
+    HOENN_DEX_DRATINI,
+    HOENN_DEX_DRAGONAIR,
+    HOENN_DEX_DRAGONITE,
+    HOENN_DEX_MEWTWO,
+    HOENN_DEX_MEW,
+    HOENN_DEX_CHIKORITA,
+    HOENN_DEX_BAYLEEF,
+    HOENN_DEX_MEGANIUM,
+    HOENN_DEX_CYNDAQUIL,
+    HOENN_DEX_QUILAVA,
+    HOENN_DEX_TYPHLOSION,
+    HOENN_DEX_TOTODILE,
+    HOENN_DEX_CROCONAW,
+    HOENN_DEX_FERALIGATR,
+    HOENN_DEX_SENTRET,
+    HOENN_DEX_FURRET,
+    HOENN_DEX_HOOTHOOT,
+    HOENN_DEX_NOCTOWL,
+    HOENN_DEX_LEDYBA,
+    HOENN_DEX_LEDIAN,
+    HOENN_DEX_SPINARAK,
+    HOENN_DEX_ARIADOS,
+    HOENN_DEX_CLEFFA,
+    HOENN_DEX_TOGEPI,
+    HOENN_DEX_TOGETIC,
+    HOENN_DEX_MAREEP,
+    HOENN_DEX_FLAAFFY,
+    HOENN_DEX_AMPHAROS,
+    HOENN_DEX_SUDOWOODO,
+    HOENN_DEX_POLITOED,
+    HOENN_DEX_HOPPIP,
+    HOENN_DEX_SKIPLOOM,
+    HOENN_DEX_JUMPLUFF,
+    HOENN_DEX_AIPOM,
+    HOENN_DEX_SUNKERN,
+    HOENN_DEX_SUNFLORA,
+    HOENN_DEX_YANMA,
+    HOENN_DEX_WOOPER,
+    HOENN_DEX_QUAGSIRE,
+    HOENN_DEX_ESPEON,
+    HOENN_DEX_UMBREON,
+    HOENN_DEX_MURKROW,
+    HOENN_DEX_SLOWKING,
+    HOENN_DEX_MISDREAVUS,
+    HOENN_DEX_UNOWN,
+    HOENN_DEX_PINECO,
+    HOENN_DEX_FORRETRESS,
+    HOENN_DEX_DUNSPARCE,
+    HOENN_DEX_GLIGAR,
+    HOENN_DEX_STEELIX,
+    HOENN_DEX_SNUBBULL,
+    HOENN_DEX_GRANBULL,
+    HOENN_DEX_QWILFISH,
+    HOENN_DEX_SCIZOR,
+    HOENN_DEX_SHUCKLE,
+    HOENN_DEX_SNEASEL,
+    HOENN_DEX_TEDDIURSA,
+    HOENN_DEX_URSARING,
+    HOENN_DEX_SWINUB,
+    HOENN_DEX_PILOSWINE,
+    HOENN_DEX_REMORAID,
+    HOENN_DEX_OCTILLERY,
+    HOENN_DEX_DELIBIRD,
+    HOENN_DEX_MANTINE,
+    HOENN_DEX_HOUNDOUR,
+    HOENN_DEX_HOUNDOOM,
+    HOENN_DEX_PORYGON2,
+    HOENN_DEX_STANTLER,
+    HOENN_DEX_SMEARGLE,
+    HOENN_DEX_TYROGUE,
+    HOENN_DEX_HITMONTOP,
+    HOENN_DEX_SMOOCHUM,
+    HOENN_DEX_ELEKID,
+    HOENN_DEX_MAGBY,
+    HOENN_DEX_MILTANK,
+    HOENN_DEX_BLISSEY,
+    HOENN_DEX_RAIKOU,
+    HOENN_DEX_ENTEI,
+    HOENN_DEX_SUICUNE,
+    HOENN_DEX_LARVITAR,
+    HOENN_DEX_PUPITAR,
+    HOENN_DEX_TYRANITAR,
+    HOENN_DEX_LUGIA,
+    HOENN_DEX_HO_OH,
+    HOENN_DEX_CELEBI,
+    HOENN_DEX_OLD_UNOWN_B,
+    HOENN_DEX_OLD_UNOWN_C,
+    HOENN_DEX_OLD_UNOWN_D,
+    HOENN_DEX_OLD_UNOWN_E,
+    HOENN_DEX_OLD_UNOWN_F,
+    HOENN_DEX_OLD_UNOWN_G,
+    HOENN_DEX_OLD_UNOWN_H,
+    HOENN_DEX_OLD_UNOWN_I,
+    HOENN_DEX_OLD_UNOWN_J,
+    HOENN_DEX_OLD_UNOWN_K,
+    HOENN_DEX_OLD_UNOWN_L,
+    HOENN_DEX_OLD_UNOWN_M,
+    HOENN_DEX_OLD_UNOWN_N,
+    HOENN_DEX_OLD_UNOWN_O,
+    HOENN_DEX_OLD_UNOWN_P,
+    HOENN_DEX_OLD_UNOWN_Q,
+    HOENN_DEX_OLD_UNOWN_R,
+    HOENN_DEX_OLD_UNOWN_S,
+    HOENN_DEX_OLD_UNOWN_T,
+    HOENN_DEX_OLD_UNOWN_U,
+    HOENN_DEX_OLD_UNOWN_V,
+    HOENN_DEX_OLD_UNOWN_W,
+    HOENN_DEX_OLD_UNOWN_X,
+    HOENN_DEX_OLD_UNOWN_Y,
+    HOENN_DEX_OLD_UNOWN_Z,
+};
+# 12 "include/global.h" 2
+# 1 "include/constants/easy_chat.h" 1
+# 13 "include/global.h" 2
+# 1 "include/constants/rgb.h" 1
+# 14 "include/global.h" 2
+# 121 "include/global.h"
+extern u8 gStringVar1[];
+extern u8 gStringVar2[];
+extern u8 gStringVar3[];
+extern u8 gStringVar4[];
+# 138 "include/global.h"
+struct Coords8
+{
+    s8 x;
+    s8 y;
+};
+
+struct UCoords8
+{
+    u8 x;
+    u8 y;
+};
+
+struct Coords16
+{
+    s16 x;
+    s16 y;
+};
+
+struct UCoords16
+{
+    u16 x;
+    u16 y;
+};
+
+struct Coords32
+{
+    s32 x;
+    s32 y;
+};
+
+struct UCoords32
+{
+    u32 x;
+    u32 y;
+};
+
+struct Time
+{
+             s16 days;
+             s8 hours;
+             s8 minutes;
+             s8 seconds;
+};
+
+struct Pokedex
+{
+             u8 order;
+             u8 mode;
+             u8 unused;
+             u8 nationalMagic;
+             u32 unownPersonality;
+             u32 spindaPersonality;
+             u32 unknown3;
+             u8 owned[(((412) / (8)) + (((412) % (8)) ? 1 : 0))];
+             u8 seen[(((412) / (8)) + (((412) % (8)) ? 1 : 0))];
+};
+
+struct PokemonJumpRecords
+{
+    u16 jumpsInRow;
+    u16 unused1;
+    u16 excellentsInRow;
+    u16 gamesWithMaxPlayers;
+    u32 unused2;
+    u32 bestJumpScore;
+};
+
+struct BerryPickingResults
+{
+    u32 bestScore;
+    u16 berriesPicked;
+    u16 berriesPickedInRow;
+    u8 field_8;
+    u8 field_9;
+    u8 field_A;
+    u8 field_B;
+    u8 field_C;
+    u8 field_D;
+    u8 field_E;
+    u8 field_F;
+};
+
+struct BerryCrush
+{
+    u16 pressingSpeeds[4];
+    u32 berryPowderAmount;
+    u32 unk;
+};
+
+
+
+struct LinkBattleRecord
+{
+    u8 name[7 + 1];
+    u16 trainerId;
+    u16 wins;
+    u16 losses;
+    u16 draws;
+};
+
+struct LinkBattleRecords
+{
+    struct LinkBattleRecord entries[5];
+    u8 languages[5];
+};
+
+struct RecordMixingGiftData
+{
+    u8 unk0;
+    u8 quantity;
+    u16 itemId;
+    u8 filler4[8];
+};
+
+struct RecordMixingGift
+{
+    int checksum;
+    struct RecordMixingGiftData data;
+};
+
+# 1 "include/constants/game_stat.h" 1
+# 259 "include/global.h" 2
+# 1 "include/global.fieldmap.h" 1
+# 16 "include/global.fieldmap.h"
+enum {
+    METATILE_LAYER_TYPE_NORMAL,
+    METATILE_LAYER_TYPE_COVERED,
+    METATILE_LAYER_TYPE_SPLIT,
+};
+
+
+
+enum
+{
+    METATILE_ATTRIBUTE_BEHAVIOR,
+    METATILE_ATTRIBUTE_TERRAIN,
+    METATILE_ATTRIBUTE_2,
+    METATILE_ATTRIBUTE_3,
+    METATILE_ATTRIBUTE_ENCOUNTER_TYPE,
+    METATILE_ATTRIBUTE_5,
+    METATILE_ATTRIBUTE_LAYER_TYPE,
+    METATILE_ATTRIBUTE_7,
+    METATILE_ATTRIBUTE_COUNT,
+    METATILE_ATTRIBUTES_ALL = 255
+};
+
+enum
+{
+    TILE_ENCOUNTER_NONE,
+    TILE_ENCOUNTER_LAND,
+    TILE_ENCOUNTER_WATER,
+};
+
+enum
+{
+    TILE_TERRAIN_NORMAL,
+    TILE_TERRAIN_GRASS,
+    TILE_TERRAIN_WATER,
+    TILE_TERRAIN_WATERFALL,
+};
+
+
+enum
+{
+    HIDDEN_ITEM_ITEM,
+    HIDDEN_ITEM_FLAG,
+    HIDDEN_ITEM_QUANTITY,
+    HIDDEN_ITEM_UNDERFOOT
+};
+# 78 "include/global.fieldmap.h"
+typedef void (*TilesetCB)(void);
+
+struct Tileset
+{
+             bool8 isCompressed;
+             bool8 isSecondary;
+             const u32 *tiles;
+             const u16 (*palettes)[16];
+             const u16 *metatiles;
+             TilesetCB callback;
+             const u32 *metatileAttributes;
+};
+
+struct MapLayout
+{
+             s32 width;
+             s32 height;
+             const u16 *border;
+             const u16 *map;
+             const struct Tileset *primaryTileset;
+             const struct Tileset *secondaryTileset;
+             u8 borderWidth;
+             u8 borderHeight;
+};
+
+struct BackupMapLayout
+{
+    s32 Xsize;
+    s32 Ysize;
+    u16 *map;
+};
+
+struct ObjectEventTemplate
+{
+    u8 localId;
+    u8 graphicsId;
+    u8 kind;
+    s16 x, y;
+    union {
+        struct {
+            u8 elevation;
+            u8 movementType;
+            u16 movementRangeX:4;
+            u16 movementRangeY:4;
+            u16 trainerType;
+            u16 trainerRange_berryTreeId;
+        } normal;
+        struct {
+            u8 targetLocalId;
+            u8 padding[3];
+            u16 targetMapNum;
+            u16 targetMapGroup;
+        } clone;
+    } objUnion;
+    const u8 *script;
+    u16 flagId;
+};
+
+struct WarpEvent
+{
+    s16 x, y;
+    u8 elevation;
+    u8 warpId;
+    u8 mapNum;
+    u8 mapGroup;
+};
+
+struct CoordEvent
+{
+    u16 x, y;
+    u8 elevation;
+    u16 trigger;
+    u16 index;
+    const u8 *script;
+};
+
+struct BgEvent
+{
+    u16 x, y;
+    u8 elevation;
+    u8 kind;
+    union {
+        const u8 *script;
+        u32 hiddenItem;
+    } bgUnion;
+};
+
+struct MapEvents
+{
+    u8 objectEventCount;
+    u8 warpCount;
+    u8 coordEventCount;
+    u8 bgEventCount;
+    const struct ObjectEventTemplate *objectEvents;
+    const struct WarpEvent *warps;
+    const struct CoordEvent *coordEvents;
+    const struct BgEvent *bgEvents;
+};
+
+struct MapConnection
+{
+          u8 direction;
+          u32 offset;
+          u8 mapGroup;
+          u8 mapNum;
+};
+
+struct MapConnections
+{
+    s32 count;
+    const struct MapConnection *connections;
+};
+
+struct MapHeader
+{
+               const struct MapLayout *mapLayout;
+               const struct MapEvents *events;
+               const u8 *mapScripts;
+               const struct MapConnections *connections;
+               u16 music;
+               u16 mapLayoutId;
+               u8 regionMapSectionId;
+               u8 cave;
+               u8 weather;
+               u8 mapType;
+
+               bool8 bikingAllowed;
+               bool8 allowEscaping:1;
+               bool8 allowRunning:1;
+               bool8 showMapName:6;
+               s8 floorNum;
+               u8 battleType;
+};
+
+struct ObjectEvent
+{
+                    u32 active:1;
+                    u32 singleMovementActive:1;
+                    u32 triggerGroundEffectsOnMove:1;
+                    u32 triggerGroundEffectsOnStop:1;
+                    u32 disableCoveringGroundEffects:1;
+                    u32 landingJump:1;
+                    u32 heldMovementActive:1;
+                    u32 heldMovementFinished:1;
+                    u32 frozen:1;
+                    u32 facingDirectionLocked:1;
+                    u32 disableAnim:1;
+                    u32 enableAnim:1;
+                    u32 inanimate:1;
+                    u32 invisible:1;
+                    u32 offScreen:1;
+                    u32 trackedByCamera:1;
+                    u32 isPlayer:1;
+                    u32 hasReflection:1;
+                    u32 inShortGrass:1;
+                    u32 inShallowFlowingWater:1;
+                    u32 inSandPile:1;
+                    u32 inHotSprings:1;
+                    u32 hasShadow:1;
+                    u32 spriteAnimPausedBackup:1;
+                    u32 spriteAffineAnimPausedBackup:1;
+                    u32 disableJumpLandingGroundEffect:1;
+                    u32 fixedPriority:1;
+                    u32 hideReflection:1;
+                    u8 spriteId;
+                    u8 graphicsId;
+                    u8 movementType;
+                    u8 trainerType;
+                    u8 localId;
+                    u8 mapNum;
+                    u8 mapGroup;
+                    u8 currentElevation:4;
+                    u8 previousElevation:4;
+                    struct Coords16 initialCoords;
+                    struct Coords16 currentCoords;
+                    struct Coords16 previousCoords;
+                    u8 facingDirection:4;
+                    u8 movementDirection:4;
+                    u16 rangeX:4;
+                    u16 rangeY:4;
+                    u8 fieldEffectSpriteId;
+                    u8 warpArrowSpriteId;
+                    u8 movementActionId;
+                    u8 trainerRange_berryTreeId;
+                    u8 currentMetatileBehavior;
+                    u8 previousMetatileBehavior;
+                    u8 previousMovementDirection;
+                    u8 directionSequenceIndex;
+                    u8 playerCopyableMovement;
+
+};
+
+struct ObjectEventGraphicsInfo
+{
+             u16 tileTag;
+             u16 paletteTag;
+             u16 reflectionPaletteTag;
+             u16 size;
+             s16 width;
+             s16 height;
+             u8 paletteSlot:4;
+             u8 shadowSize:2;
+             u8 inanimate:1;
+             u8 disableReflectionPaletteLoad:1;
+             u8 tracks;
+             const struct OamData *oam;
+             const struct SubspriteTable *subspriteTables;
+             const union AnimCmd *const *anims;
+             const struct SpriteFrameImage *images;
+             const union AffineAnimCmd *const *affineAnims;
+};
+
+enum {
+    PLAYER_AVATAR_STATE_NORMAL,
+    PLAYER_AVATAR_STATE_MACH_BIKE,
+    PLAYER_AVATAR_STATE_ACRO_BIKE,
+    PLAYER_AVATAR_STATE_SURFING,
+    PLAYER_AVATAR_STATE_UNDERWATER,
+    PLAYER_AVATAR_STATE_CONTROLLABLE,
+    PLAYER_AVATAR_STATE_FORCED,
+    PLAYER_AVATAR_STATE_DASH,
+};
+# 310 "include/global.fieldmap.h"
+enum {
+    PLAYER_AVATAR_GFX_NORMAL,
+    PLAYER_AVATAR_GFX_BIKE,
+    PLAYER_AVATAR_GFX_RIDE,
+    PLAYER_AVATAR_GFX_FIELD_MOVE,
+    PLAYER_AVATAR_GFX_FISH,
+    PLAYER_AVATAR_GFX_VSSEEKER,
+};
+
+enum
+{
+    ACRO_BIKE_NORMAL,
+    ACRO_BIKE_TURNING,
+    ACRO_BIKE_WHEELIE_STANDING,
+    ACRO_BIKE_BUNNY_HOP,
+    ACRO_BIKE_WHEELIE_MOVING,
+    ACRO_BIKE_STATE5,
+    ACRO_BIKE_STATE6,
+};
+
+enum
+{
+    COLLISION_NONE,
+    COLLISION_OUTSIDE_RANGE,
+    COLLISION_IMPASSABLE,
+    COLLISION_ELEVATION_MISMATCH,
+    COLLISION_OBJECT_EVENT,
+    COLLISION_STOP_SURFING,
+    COLLISION_LEDGE_JUMP,
+    COLLISION_PUSHED_BOULDER,
+    COLLISION_DIRECTIONAL_STAIR_WARP,
+    COLLISION_WHEELIE_HOP,
+    COLLISION_ISOLATED_VERTICAL_RAIL,
+    COLLISION_ISOLATED_HORIZONTAL_RAIL,
+    COLLISION_VERTICAL_RAIL,
+    COLLISION_HORIZONTAL_RAIL,
+    COLLISION_COUNT
+};
+
+
+enum
+{
+    NOT_MOVING,
+    TURN_DIRECTION,
+    MOVING,
+};
+
+
+enum
+{
+    T_NOT_MOVING,
+    T_TILE_TRANSITION,
+    T_TILE_CENTER,
+};
+
+struct PlayerAvatar
+{
+             u8 flags;
+             u8 transitionFlags;
+             u8 runningState;
+             u8 tileTransitionState;
+             u8 spriteId;
+             u8 objectEventId;
+             bool8 preventStep;
+             u8 gender;
+
+    u8 acroBikeState;
+    u8 newDirBackup;
+    u8 bikeFrameCounter;
+    u8 bikeSpeed;
+    u32 directionHistory;
+    u32 abStartSelectHistory;
+    u8 dirTimerHistory[8];
+
+    u16 lastSpinTile;
+};
+
+struct Camera
+{
+    bool8 active:1;
+    s32 x;
+    s32 y;
+};
+
+extern struct ObjectEvent gObjectEvents[16];
+extern u8 gSelectedObjectEvent;
+extern struct MapHeader gMapHeader;
+extern struct PlayerAvatar gPlayerAvatar;
+extern struct Camera gCamera;
+# 260 "include/global.h" 2
+# 1 "include/global.berry.h" 1
+
+
+
+
+
+
+
+struct Berry
+{
+    const u8 name[7];
+    u8 firmness;
+    u16 size;
+    u8 maxYield;
+    u8 minYield;
+    const u8 *description1;
+    const u8 *description2;
+    u8 stageDuration;
+    u8 spicy;
+    u8 dry;
+    u8 sweet;
+    u8 bitter;
+    u8 sour;
+    u8 smoothness;
+};
+
+
+
+struct Berry2
+{
+    u8 name[7];
+    u8 firmness;
+    u16 size;
+    u8 maxYield;
+    u8 minYield;
+    u8 *description1;
+    u8 *description2;
+    u8 stageDuration;
+    u8 spicy;
+    u8 dry;
+    u8 sweet;
+    u8 bitter;
+    u8 sour;
+    u8 smoothness;
+};
+
+struct EnigmaBerry
+{
+    struct Berry2 berry;
+    u8 itemEffect[18];
+    u8 holdEffect;
+    u8 holdEffectParam;
+    u32 checksum;
+};
+
+struct BattleEnigmaBerry
+{
+             u8 name[7];
+             u8 holdEffect;
+             u8 itemEffect[18];
+             u8 holdEffectParam;
+};
+
+struct BerryTree
+{
+    u8 berry;
+    u8 stage:7;
+    u8 growthSparkle:1;
+    u16 minutesUntilNextStage;
+    u8 berryYield;
+    u8 regrowthCount:4;
+    u8 watered1:1;
+    u8 watered2:1;
+    u8 watered3:1;
+    u8 watered4:1;
+};
+# 261 "include/global.h" 2
+# 1 "include/pokemon.h" 1
+
+
+
+
+# 1 "include/sprite.h" 1
+# 13 "include/sprite.h"
+struct SpriteSheet
+{
+    const void *data;
+    u16 size;
+    u16 tag;
+};
+
+struct CompressedSpriteSheet
+{
+    const u32 *data;
+    u16 size;
+    u16 tag;
+};
+
+struct SpriteFrameImage
+{
+    const void *data;
+    u16 size;
+};
+
+
+
+
+struct SpritePalette
+{
+    const u16 *data;
+    u16 tag;
+};
+
+struct CompressedSpritePalette
+{
+    const u32 *data;
+    u16 tag;
+};
+
+struct AnimFrameCmd
+{
+
+
+    u32 imageValue:16;
+
+    u32 duration:6;
+    u32 hFlip:1;
+    u32 vFlip:1;
+};
+
+struct AnimLoopCmd
+{
+    u32 type:16;
+    u32 count:6;
+};
+
+struct AnimJumpCmd
+{
+    u32 type:16;
+    u32 target:6;
+};
+
+
+
+
+union AnimCmd
+{
+    s16 type;
+    struct AnimFrameCmd frame;
+    struct AnimLoopCmd loop;
+    struct AnimJumpCmd jump;
+};
+# 91 "include/sprite.h"
+struct AffineAnimFrameCmd
+{
+    s16 xScale;
+    s16 yScale;
+    u8 rotation;
+    u8 duration;
+};
+
+struct AffineAnimLoopCmd
+{
+    s16 type;
+    s16 count;
+};
+
+struct AffineAnimJumpCmd
+{
+    s16 type;
+    u16 target;
+};
+
+struct AffineAnimEndCmdAlt
+{
+    s16 type;
+    u16 val;
+};
+
+union AffineAnimCmd
+{
+    s16 type;
+    struct AffineAnimFrameCmd frame;
+    struct AffineAnimLoopCmd loop;
+    struct AffineAnimJumpCmd jump;
+    struct AffineAnimEndCmdAlt end;
+};
+# 145 "include/sprite.h"
+struct AffineAnimState
+{
+    u8 animNum;
+    u8 animCmdIndex;
+    u8 delayCounter;
+    u8 loopCounter;
+    s16 xScale;
+    s16 yScale;
+    u16 rotation;
+};
+
+enum
+{
+    SUBSPRITES_OFF,
+    SUBSPRITES_ON,
+    SUBSPRITES_IGNORE_PRIORITY,
+};
+
+struct Subsprite
+{
+    s8 x;
+    s8 y;
+    u16 shape:2;
+    u16 size:2;
+    u16 tileOffset:10;
+    u16 priority:2;
+};
+
+struct SubspriteTable
+{
+    u8 subspriteCount;
+    const struct Subsprite *subsprites;
+};
+
+struct Sprite;
+
+typedef void (*SpriteCallback)(struct Sprite *);
+
+struct SpriteTemplate
+{
+    u16 tileTag;
+    u16 paletteTag;
+    const struct OamData *oam;
+    const union AnimCmd *const *anims;
+    const struct SpriteFrameImage *images;
+    const union AffineAnimCmd *const *affineAnims;
+    SpriteCallback callback;
+};
+
+struct Sprite
+{
+             struct OamData oam;
+             const union AnimCmd *const *anims;
+             const struct SpriteFrameImage *images;
+             const union AffineAnimCmd *const *affineAnims;
+             const struct SpriteTemplate *template;
+             const struct SubspriteTable *subspriteTables;
+             SpriteCallback callback;
+
+             s16 x, y;
+             s16 x2, y2;
+             s8 centerToCornerVecX;
+             s8 centerToCornerVecY;
+
+             u8 animNum;
+             u8 animCmdIndex;
+             u8 animDelayCounter:6;
+             u8 animPaused:1;
+             u8 affineAnimPaused:1;
+             u8 animLoopCounter;
+
+
+             s16 data[8];
+
+             u16 inUse:1;
+             u16 coordOffsetEnabled:1;
+             u16 invisible:1;
+             u16 flags_3:1;
+             u16 flags_4:1;
+             u16 flags_5:1;
+             u16 flags_6:1;
+             u16 flags_7:1;
+             u16 hFlip:1;
+             u16 vFlip:1;
+             u16 animBeginning:1;
+             u16 affineAnimBeginning:1;
+             u16 animEnded:1;
+             u16 affineAnimEnded:1;
+             u16 usingSheet:1;
+             u16 anchored:1;
+
+             u16 sheetTileStart;
+
+             u8 subspriteTableNum:6;
+             u8 subspriteMode:2;
+
+             u8 subpriority;
+};
+
+struct OamMatrix
+{
+    s16 a;
+    s16 b;
+    s16 c;
+    s16 d;
+};
+
+
+
+
+struct SpriteTileAllocStats
+{
+    u16 freeTiles;
+    u16 freeRuns;
+    u16 largestFreeRun;
+    u8 fragmentation;
+};
+
+
+extern const struct OamData gDummyOamData;
+extern const union AnimCmd *const gDummySpriteAnimTable[];
+extern const union AffineAnimCmd *const gDummySpriteAffineAnimTable[];
+extern s16 gSpriteCoordOffsetX;
+extern s16 gSpriteCoordOffsetY;
+extern const struct SpriteTemplate gDummySpriteTemplate;
+extern struct Sprite gSprites[];
+extern struct OamMatrix gOamMatrices[];
+extern bool8 gAffineAnimsDisabled;
+extern u16 gReservedSpriteTileCount;
+
+void ResetSpriteData(void);
+void AnimateSprites(void);
+void BuildOamBuffer(void);
+u8 CreateSprite(const struct SpriteTemplate *template, s16 x, s16 y, u8 subpriority);
+u8 CreateSpriteAtEnd(const struct SpriteTemplate *template, s16 x, s16 y, u8 subpriority);
+u8 CreateInvisibleSprite(void (*callback)(struct Sprite *));
+u8 CreateSpriteAndAnimate(const struct SpriteTemplate *template, s16 x, s16 y, u8 subpriority);
+void DestroySprite(struct Sprite *sprite);
+void ResetOamRange(u8 a, u8 b);
+void LoadOam(void);
+void SetOamMatrix(u8 matrixNum, u16 a, u16 b, u16 c, u16 d);
+void CalcCenterToCornerVec(struct Sprite *sprite, u8 shape, u8 size, u8 affineMode);
+void SpriteCallbackDummy(struct Sprite *sprite);
+void ProcessSpriteCopyRequests(void);
+void RequestSpriteCopy(const u8 *src, u8 *dest, u16 size);
+void FreeSpriteTiles(struct Sprite *sprite);
+void FreeSpritePalette(struct Sprite *sprite);
+void FreeSpriteOamMatrix(struct Sprite *sprite);
+void DestroySpriteAndFreeResources(struct Sprite *sprite);
+void AnimateSprite(struct Sprite *sprite);
+void StartSpriteAnim(struct Sprite *sprite, u8 animNum);
+void StartSpriteAnimIfDifferent(struct Sprite *sprite, u8 animNum);
+void SeekSpriteAnim(struct Sprite *sprite, u8 animCmdIndex);
+void StartSpriteAffineAnim(struct Sprite *sprite, u8 animNum);
+void StartSpriteAffineAnimIfDifferent(struct Sprite *sprite, u8 animNum);
+void ChangeSpriteAffineAnim(struct Sprite *sprite, u8 animNum);
+void ChangeSpriteAffineAnimIfDifferent(struct Sprite *sprite, u8 animNum);
+void SetSpriteSheetFrameTileNum(struct Sprite *sprite);
+u8 AllocOamMatrix(void);
+void FreeOamMatrix(u8 matrixNum);
+void InitSpriteAffineAnim(struct Sprite *sprite);
+void SetOamMatrixRotationScaling(u8 matrixNum, s16 xScale, s16 yScale, u16 rotation);
+u16 LoadSpriteSheet(const struct SpriteSheet *sheet);
+void LoadSpriteSheets(const struct SpriteSheet *sheets);
+u16 AllocTilesForSpriteSheet(struct SpriteSheet *sheet);
+void AllocTilesForSpriteSheets(struct SpriteSheet *sheets);
+void FreeSpriteTilesByTag(u16 tag);
+void FreeSpriteTileRanges(void);
+u16 GetSpriteTileStartByTag(u16 tag);
+u16 GetSpriteTileTagByTileStart(u16 start);
+void RequestSpriteSheetCopy(const struct SpriteSheet *sheet);
+u16 LoadSpriteSheetDeferred(const struct SpriteSheet *sheet);
+void FreeAllSpritePalettes(void);
+u8 LoadSpritePalette(const struct SpritePalette *palette);
+void LoadSpritePalettes(const struct SpritePalette *palettes);
+u8 AllocSpritePalette(u16 tag);
+u8 IndexOfSpritePaletteTag(u16 tag);
+u16 GetSpritePaletteTagByPaletteNum(u8 paletteNum);
+void FreeSpritePaletteByTag(u16 tag);
+void SetSubspriteTables(struct Sprite *sprite, const struct SubspriteTable *subspriteTables);
+bool8 AddSpriteToOamBuffer(struct Sprite *object, u8 *oamIndex);
+bool8 AddSubspritesToOamBuffer(struct Sprite *sprite, struct OamData *destOam, u8 *oamIndex);
+void CopyToSprites(u8 *src);
+
+
+void RegisterCopiedSprite(u8 spriteId);
+
+
+
+void CopyFromSprites(u8 *dest);
+u8 SpriteTileAllocBitmapOp(u16 bit, u8 op);
+void ClearSpriteCopyRequests(void);
+void ResetAffineAnimData(void);
+void FreeSpriteTilesIfNotUsingSheet(struct Sprite *sprite);
+s16 AllocSpriteTiles(u16 tileCount);
+
+void GetSpriteTileAllocStats(struct SpriteTileAllocStats *stats);
+
+void SetSpriteMatrixAnchor(struct Sprite* sprite, s16 xmod, s16 ymod);
+# 6 "include/pokemon.h" 2
+# 1 "include/constants/pokemon.h" 1
+# 7 "include/pokemon.h" 2
+
+struct PokemonSubstruct0
+{
+    u16 species;
+    u16 heldItem;
+    u32 experience;
+    u8 ppBonuses;
+    u8 friendship;
+    u16 filler;
+};
+
+struct PokemonSubstruct1
+{
+    u16 moves[4];
+    u8 pp[4];
+};
+
+struct PokemonSubstruct2
+{
+    u8 hpEV;
+    u8 attackEV;
+    u8 defenseEV;
+    u8 speedEV;
+    u8 spAttackEV;
+    u8 spDefenseEV;
+    u8 cool;
+    u8 beauty;
+    u8 cute;
+    u8 smart;
+    u8 tough;
+    u8 sheen;
+};
+
+struct PokemonSubstruct3
+{
+            u8 pokerus;
+            u8 metLocation;
+
+            u16 metLevel:7;
+            u16 metGame:4;
+            u16 pokeball:4;
+            u16 otGender:1;
+
+            u32 hpIV:5;
+            u32 attackIV:5;
+            u32 defenseIV:5;
+            u32 speedIV:5;
+            u32 spAttackIV:5;
+            u32 spDefenseIV:5;
+            u32 isEgg:1;
+            u32 abilityNum:1;
+
+            u32 coolRibbon:3;
+            u32 beautyRibbon:3;
+            u32 cuteRibbon:3;
+            u32 smartRibbon:3;
+            u32 toughRibbon:3;
+            u32 championRibbon:1;
+            u32 winningRibbon:1;
+            u32 victoryRibbon:1;
+            u32 artistRibbon:1;
+            u32 effortRibbon:1;
+            u32 marineRibbon:1;
+            u32 landRibbon:1;
+            u32 skyRibbon:1;
+            u32 countryRibbon:1;
+            u32 nationalRibbon:1;
+            u32 earthRibbon:1;
+            u32 worldRibbon:1;
+            u32 unusedRibbons:4;
+
+
+
+
+
+
+
+            u32 modernFatefulEncounter:1;
+};
+# 96 "include/pokemon.h"
+union PokemonSubstruct
+{
+    struct PokemonSubstruct0 type0;
+    struct PokemonSubstruct1 type1;
+    struct PokemonSubstruct2 type2;
+    struct PokemonSubstruct3 type3;
+    u16 raw[(((sizeof(struct PokemonSubstruct0)) >= (((sizeof(struct PokemonSubstruct1)) >= (((sizeof(struct PokemonSubstruct2)) >= (sizeof(struct PokemonSubstruct3)) ? (sizeof(struct PokemonSubstruct2)) : (sizeof(struct PokemonSubstruct3)))) ? (sizeof(struct PokemonSubstruct1)) : (((sizeof(struct PokemonSubstruct2)) >= (sizeof(struct PokemonSubstruct3)) ? (sizeof(struct PokemonSubstruct2)) : (sizeof(struct PokemonSubstruct3)))))) ? (sizeof(struct PokemonSubstruct0)) : (((sizeof(struct PokemonSubstruct1)) >= (((sizeof(struct PokemonSubstruct2)) >= (sizeof(struct PokemonSubstruct3)) ? (sizeof(struct PokemonSubstruct2)) : (sizeof(struct PokemonSubstruct3)))) ? (sizeof(struct PokemonSubstruct1)) : (((sizeof(struct PokemonSubstruct2)) >= (sizeof(struct PokemonSubstruct3)) ? (sizeof(struct PokemonSubstruct2)) : (sizeof(struct PokemonSubstruct3)))))))) / 2];
+};
+
+struct BoxPokemon
+{
+    u32 personality;
+    u32 otId;
+    u8 nickname[10];
+    u8 language;
+    u8 isBadEgg:1;
+    u8 hasSpecies:1;
+    u8 isEgg:1;
+    u8 unused:5;
+    u8 otName[7];
+    u8 markings;
+    u16 checksum;
+    u16 unknown;
+
+    union
+    {
+        u32 raw[((((sizeof(struct PokemonSubstruct0)) >= (((sizeof(struct PokemonSubstruct1)) >= (((sizeof(struct PokemonSubstruct2)) >= (sizeof(struct PokemonSubstruct3)) ? (sizeof(struct PokemonSubstruct2)) : (sizeof(struct PokemonSubstruct3)))) ? (sizeof(struct PokemonSubstruct1)) : (((sizeof(struct PokemonSubstruct2)) >= (sizeof(struct PokemonSubstruct3)) ? (sizeof(struct PokemonSubstruct2)) : (sizeof(struct PokemonSubstruct3)))))) ? (sizeof(struct PokemonSubstruct0)) : (((sizeof(struct PokemonSubstruct1)) >= (((sizeof(struct PokemonSubstruct2)) >= (sizeof(struct PokemonSubstruct3)) ? (sizeof(struct PokemonSubstruct2)) : (sizeof(struct PokemonSubstruct3)))) ? (sizeof(struct PokemonSubstruct1)) : (((sizeof(struct PokemonSubstruct2)) >= (sizeof(struct PokemonSubstruct3)) ? (sizeof(struct PokemonSubstruct2)) : (sizeof(struct PokemonSubstruct3)))))))) * 4) / 4];
+        union PokemonSubstruct substructs[4];
+    } secure;
+};
+
+struct Pokemon
+{
+    struct BoxPokemon box;
+    u32 status;
+    u8 level;
+    u8 mail;
+    u16 hp;
+    u16 maxHP;
+    u16 attack;
+    u16 defense;
+    u16 speed;
+    u16 spAttack;
+    u16 spDefense;
+};
+
+struct BattleTowerPokemon
+{
+             u16 species;
+             u16 heldItem;
+             u16 moves[4];
+             u8 level;
+             u8 ppBonuses;
+             u8 hpEV;
+             u8 attackEV;
+             u8 defenseEV;
+             u8 speedEV;
+             u8 spAttackEV;
+             u8 spDefenseEV;
+             u32 otId;
+             u32 hpIV:5;
+             u32 attackIV:5;
+             u32 defenseIV:5;
+             u32 speedIV:5;
+             u32 spAttackIV:5;
+             u32 spDefenseIV:5;
+             u32 gap:1;
+             u32 abilityNum:1;
+             u32 personality;
+             u8 nickname[10 + 1];
+             u8 friendship;
+};
+
+struct BattlePokemon
+{
+             u16 species;
+             u16 attack;
+             u16 defense;
+             u16 speed;
+             u16 spAttack;
+             u16 spDefense;
+             u16 moves[4];
+             u32 hpIV:5;
+             u32 attackIV:5;
+             u32 defenseIV:5;
+             u32 speedIV:5;
+             u32 spAttackIV:5;
+             u32 spDefenseIV:5;
+             u32 isEgg:1;
+             u32 abilityNum:1;
+             s8 statStages[(6 + 2)];
+             u8 ability;
+             u8 type1;
+             u8 type2;
+             u8 unknown;
+             u8 pp[4];
+             u16 hp;
+             u8 level;
+             u8 friendship;
+             u16 maxHP;
+             u16 item;
+             u8 nickname[10 + 1];
+             u8 ppBonuses;
+             u8 otName[7 + 1];
+             u32 experience;
+             u32 personality;
+             u32 status1;
+             u32 status2;
+             u32 otId;
+};
+
+struct SpeciesInfo
+{
+            u8 baseHP;
+            u8 baseAttack;
+            u8 baseDefense;
+            u8 baseSpeed;
+            u8 baseSpAttack;
+            u8 baseSpDefense;
+            u8 types[2];
+            u8 catchRate;
+            u8 expYield;
+            u16 evYield_HP:2;
+            u16 evYield_Attack:2;
+            u16 evYield_Defense:2;
+            u16 evYield_Speed:2;
+            u16 evYield_SpAttack:2;
+            u16 evYield_SpDefense:2;
+            u16 itemCommon;
+            u16 itemRare;
+            u8 genderRatio;
+            u8 eggCycles;
+            u8 friendship;
+            u8 growthRate;
+            u8 eggGroups[2];
+            u8 abilities[2];
+            u8 safariZoneFleeRate;
+            u8 bodyColor : 7;
+            u8 noFlip : 1;
+};
+
+struct BattleMove
+{
+    u8 effect;
+    u8 power;
+    u8 type;
+    u8 accuracy;
+    u8 pp;
+    u8 secondaryEffectChance;
+    u8 target;
+    s8 priority;
+    u8 flags;
+};
+
+
+
+
+struct SpindaSpot
+{
+    u8 x, y;
+    u16 image[16];
+};
+
+struct __attribute__((packed)) LevelUpMove
+{
+    u16 move:9;
+    u16 level:7;
+};
+
+struct Evolution
+{
+    u16 method;
+    u16 param;
+    u16 targetSpecies;
+};
+# 283 "include/pokemon.h"
+extern const struct BattleMove gBattleMoves[];
+extern u8 gPlayerPartyCount;
+extern struct Pokemon gPlayerParty[6];
+extern u8 gEnemyPartyCount;
+extern struct Pokemon gEnemyParty[6];
+extern const struct SpeciesInfo gSpeciesInfo[];
+extern const u8 *const gItemEffectTable[];
+extern const u8 gStatStageRatios[][2];
+extern struct SpriteTemplate gMultiuseSpriteTemplate;
+extern struct PokemonStorage* gPokemonStoragePtr;
+extern const u32 gExperienceTables[][100 + 1];
+extern const u16 *const gLevelUpLearnsets[];
+extern const u8 gFacilityClassToPicIndex[];
+extern const u8 gFacilityClassToTrainerClass[];
+extern const struct SpriteTemplate gSpriteTemplates_Battlers[];
+extern const u8 gPPUpGetMask[];
+
+void ZeroBoxMonData(struct BoxPokemon *boxMon);
+void ZeroMonData(struct Pokemon *mon);
+void ZeroPlayerPartyMons(void);
+void ZeroEnemyPartyMons(void);
+void CreateMon(struct Pokemon *mon, u16 species, u8 level, u8 fixedIV, u8 hasFixedPersonality, u32 fixedPersonality, u8 otIdType, u32 fixedOtId);
+void CreateBoxMon(struct BoxPokemon *boxMon, u16 species, u8 level, u8 fixedIV, u8 hasFixedPersonality, u32 fixedPersonality, u8 otIdType, u32 fixedOtId);
+void CreateMonWithNature(struct Pokemon *mon, u16 species, u8 level, u8 fixedIV, u8 nature);
+void CreateMonWithGenderNatureLetter(struct Pokemon *mon, u16 species, u8 level, u8 fixedIV, u8 gender, u8 nature, u8 unownLetter);
+void CreateMaleMon(struct Pokemon *mon, u16 species, u8 level);
+void CreateMonWithIVsPersonality(struct Pokemon *mon, u16 species, u8 level, u32 ivs, u32 personality);
+void CreateMonWithEVSpread(struct Pokemon *mon, u16 species, u8 level, u8 fixedIV, u8 evSpread);
+void CreateBattleTowerMon(struct Pokemon *mon, struct BattleTowerPokemon *src);
+void ConvertPokemonToBattleTowerPokemon(struct Pokemon *mon, struct BattleTowerPokemon *dest);
+void CalculateMonStats(struct Pokemon *mon);
+void BoxMonToMon(struct BoxPokemon *src, struct Pokemon *dest);
+u8 GetLevelFromBoxMonExp(struct BoxPokemon *boxMon);
+u16 GiveMoveToMon(struct Pokemon *mon, u16 move);
+u16 GiveMoveToBattleMon(struct BattlePokemon *mon, u16 move);
+void SetMonMoveSlot(struct Pokemon *mon, u16 move, u8 slot);
+void SetBattleMonMoveSlot(struct BattlePokemon *mon, u16 move, u8 slot);
+u16 MonTryLearningNewMove(struct Pokemon *mon, bool8 firstMove);
+void DeleteFirstMoveAndGiveMoveToMon(struct Pokemon *mon, u16 move);
+s32 CalculateBaseDamage(struct BattlePokemon *attacker, struct BattlePokemon *defender, u32 move, u16 sideStatus, u16 powerOverride, u8 typeOverride, u8 battlerIdAtk, u8 battlerIdDef);
+
+
+
+
+
+u8 CountAliveMonsInBattle(u8 caseId);
+
+u8 GetDefaultMoveTarget(u8 battlerId);
+u8 GetMonGender(struct Pokemon *mon);
+u8 GetBoxMonGender(struct BoxPokemon *boxMon);
+u8 GetGenderFromSpeciesAndPersonality(u16 species, u32 personality);
+void SetMultiuseSpriteTemplateToPokemon(u16 speciesTag, u8 battlerPosition);
+void SetMultiuseSpriteTemplateToTrainerBack(u16 trainerSpriteId, u8 battlerPosition);
+# 346 "include/pokemon.h"
+u32 GetMonData();
+u32 GetBoxMonData();
+
+
+void SetMonData(struct Pokemon *mon, s32 field, const void *dataArg);
+void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg);
+void CopyMon(void *dest, void *src, size_t size);
+u8 GiveMonToPlayer(struct Pokemon *mon);
+u8 CalculatePlayerPartyCount(void);
+u8 CalculateEnemyPartyCount(void);
+u8 GetMonsStateToDoubles(void);
+u8 GetAbilityBySpecies(u16 species, bool8 abilityNum);
+u8 GetMonAbility(struct Pokemon *mon);
+u8 GetSecretBaseTrainerPicIndex(void);
+u8 GetSecretBaseTrainerNameIndex(void);
+bool8 IsPlayerPartyAndPokemonStorageFull(void);
+void GetSpeciesName(u8 *name, u16 species);
+u8 CalculatePPWithBonus(u16 move, u8 ppBonuses, u8 moveIndex);
+void RemoveMonPPBonus(struct Pokemon *mon, u8 moveIndex);
+void RemoveBattleMonPPBonus(struct BattlePokemon *mon, u8 moveIndex);
+bool8 ExecuteTableBasedItemEffect(struct Pokemon *mon, u16 item, u8 partyIndex, u8 moveIndex);
+bool8 PokemonUseItemEffects(struct Pokemon *mon, u16 item, u8 partyIndex, u8 moveIndex, bool8 usedByAI);
+bool8 PokemonItemUseNoEffect(struct Pokemon *mon, u16 item, u8 partyIndex, u8 moveIndex);
+u8 GetItemEffectParamOffset(u16 itemId, u8 effectByte, u8 effectBit);
+const u8 *Battle_PrintStatBoosterEffectMessage(u16 itemId);
+u8 GetNature(struct Pokemon *mon);
+u16 GetEvolutionTargetSpecies(struct Pokemon *mon, u8 type, u16 evolutionItem);
+u16 NationalPokedexNumToSpecies(u16 nationalNum);
+u16 SpeciesToNationalPokedexNum(u16 species);
+u16 HoennToNationalOrder(u16 hoennNum);
+u16 SpeciesToCryId(u16 species);
+void DrawSpindaSpots(u16 species, u32 personality, u8 *dest, bool8 isFrontPic);
+void EvolutionRenameMon(struct Pokemon *mon, u16 oldSpecies, u16 newSpecies);
+bool8 GetPlayerFlankId(void);
+bool16 GetLinkTrainerFlankId(u8 linkPlayerId);
+s32 GetBattlerMultiplayerId(u16 a1);
+u8 GetTrainerEncounterMusicId(u16 trainer);
+void AdjustFriendship(struct Pokemon *mon, u8 event);
+void MonGainEVs(struct Pokemon *mon, u16 defeatedSpecies);
+u16 GetMonEVCount(struct Pokemon *mon);
+void RandomlyGivePartyPokerus(struct Pokemon *party);
+u8 CheckPartyPokerus(struct Pokemon *party, u8 party_bm);
+u8 CheckPartyHasHadPokerus(struct Pokemon *party, u8 selection);
+void PartySpreadPokerus(struct Pokemon *party);
+bool8 TryIncrementMonLevel(struct Pokemon *mon);
+u32 CanMonLearnTMHM(struct Pokemon *mon, u8 tm);
+u8 GetMoveRelearnerMoves(struct Pokemon *mon, u16 *moves);
+u8 GetLevelUpMovesBySpecies(u16 species, u16 *moves);
+u8 GetNumberOfRelearnableMoves(struct Pokemon *mon);
+u16 SpeciesToPokedexNum(u16 species);
+void ClearBattleMonForms(void);
+void PlayBattleBGM(void);
+void PlayMapChosenOrBattleBGM(u16 songId);
+const u32 *GetMonFrontSpritePal(struct Pokemon *mon);
+const u32 *GetMonSpritePalFromSpeciesAndPersonality(u16 species, u32 otId, u32 personality);
+const struct CompressedSpritePalette *GetMonSpritePalStruct(struct Pokemon *mon);
+const struct CompressedSpritePalette *GetMonSpritePalStructFromOtIdPersonality(u16 species, u32 otId , u32 personality);
+bool32 IsHMMove2(u16 move);
+bool8 IsMonSpriteNotFlipped(u16 species);
+s8 GetFlavorRelationByPersonality(u32 personality, u8 flavor);
+bool8 IsTradedMon(struct Pokemon *mon);
+bool8 IsOtherTrainer(u32 otId, u8 *otName);
+void MonRestorePP(struct Pokemon *mon);
+void BoxMonRestorePP(struct BoxPokemon *boxMon);
+void SetMonPreventsSwitchingString(void);
+void SetWildMonHeldItem(void);
+bool8 IsMonShiny(struct Pokemon *mon);
+u8 *GetTrainerPartnerName(void);
+u8 GetPlayerPartyHighestLevel(void);
+u16 FacilityClassToPicIndex(u16 facilityClass);
+bool8 ShouldIgnoreDeoxysForm(u8 caseId, u8 battlerId);
+void SetDeoxysStats(void);
+u16 GetUnionRoomTrainerPic(void);
+u16 GetUnionRoomTrainerClass(void);
+void CreateEnemyEventMon(void);
+void HandleSetPokedexFlag(u16 nationalNum, u8 caseId, u32 personality);
+bool8 CheckBattleTypeGhost(struct Pokemon *mon, u8 bank);
+struct MonSpritesGfxManager *CreateMonSpritesGfxManager(u8 battlePosition, u8 mode);
+void DestroyMonSpritesGfxManager(void);
+u8 *MonSpritesGfxManager_GetSpritePtr(u8 bufferId);
+# 262 "include/global.h" 2
+
+struct BattleTowerRecord
+{
+             u8 battleTowerLevelType;
+             u8 trainerClass;
+             u16 winStreak;
+             u8 name[7 + 1];
+             u8 trainerId[4];
+             u16 greeting[6];
+             struct BattleTowerPokemon party[3];
+             u32 checksum;
+};
+
+struct BattleTowerEReaderTrainer
+{
+                         u8 unk0;
+                         u8 trainerClass;
+                         u16 winStreak;
+                         u8 name[8];
+                         u8 trainerId[4];
+                         u16 greeting[6];
+                         u16 farewellPlayerLost[6];
+                         u16 farewellPlayerWon[6];
+                         struct BattleTowerPokemon party[3];
+                         u32 checksum;
+};
+
+struct BattleTowerData
+{
+                       struct BattleTowerRecord playerRecord;
+                       struct BattleTowerRecord records[5];
+                       u16 firstMonSpecies;
+                       u16 defeatedBySpecies;
+                       u8 defeatedByTrainerName[8];
+                       u8 firstMonNickname[10];
+                       struct BattleTowerEReaderTrainer ereaderTrainer;
+                       u8 battleTowerLevelType:1;
+                       u8 unk_554:1;
+                       u8 battleOutcome;
+                       u8 var_4AE[2];
+                       u16 curChallengeBattleNum[2];
+                       u16 curStreakChallengesNum[2];
+                       u16 recordWinStreaks[2];
+                       u8 battleTowerTrainerId;
+                       u8 selectedPartyMons[0x3];
+                       u16 prizeItem;
+                       u8 battledTrainerIds[6];
+                       u16 totalBattleTowerWins;
+                       u16 bestBattleTowerWinStreak;
+                       u16 currentWinStreaks[2];
+                       u8 lastStreakLevelType;
+                       u8 filler_4D1[0x317];
+};
+
+struct SaveBlock2
+{
+              u8 playerName[7 + 1];
+              u8 playerGender;
+              u8 specialSaveWarpFlags;
+              u8 playerTrainerId[4];
+              u16 playTimeHours;
+              u8 playTimeMinutes;
+              u8 playTimeSeconds;
+              u8 playTimeVBlanks;
+              u8 optionsButtonMode;
+              u16 optionsTextSpeed:3;
+              u16 optionsWindowFrameType:5;
+              u16 optionsSound:1;
+              u16 optionsBattleStyle:1;
+              u16 optionsBattleSceneOff:1;
+              u16 regionMapZoom:1;
+              struct Pokedex pokedex;
+              u8 filler_90[0x8];
+              struct Time localTimeOffset;
+              struct Time lastBerryTreeUpdate;
+              u32 gcnLinkFlags;
+              bool8 unkFlag1;
+              bool8 unkFlag2;
+              struct BattleTowerData battleTower;
+              u16 mapView[0x100];
+              struct LinkBattleRecords linkBattleRecords;
+              struct BerryCrush berryCrush;
+              struct PokemonJumpRecords pokeJump;
+              struct BerryPickingResults berryPick;
+              u8 filler_B20[0x400];
+              u32 encryptionKey;
+};
+
+extern struct SaveBlock2 *gSaveBlock2Ptr;
+
+struct SecretBaseParty
+{
+    u32 personality[6];
+    u16 moves[6 * 4];
+    u16 species[6];
+    u16 heldItems[6];
+    u8 levels[6];
+    u8 EVs[6];
+};
+
+
+struct SecretBaseRecord
+{
+               u8 secretBaseId;
+               u8 toRegister:4;
+               u8 gender:1;
+               u8 battledOwnerToday:1;
+               u8 registryStatus:2;
+               u8 trainerName[7];
+               u8 trainerId[4];
+               u8 language;
+               u16 numSecretBasesReceived;
+               u8 numTimesEntered;
+               u8 unused;
+               u8 decorations[16];
+               u8 decorationPos[16];
+               struct SecretBaseParty party;
+};
+
+struct WarpData
+{
+    s8 mapGroup;
+    s8 mapNum;
+    s8 warpId;
+    s16 x, y;
+};
+
+struct ItemSlot
+{
+    u16 itemId;
+    u16 quantity;
+};
+
+struct Pokeblock
+{
+    u8 color;
+    u8 spicy;
+    u8 dry;
+    u8 sweet;
+    u8 bitter;
+    u8 sour;
+    u8 feel;
+};
+
+struct Roamer
+{
+             u32 ivs;
+             u32 personality;
+             u16 species;
+             u16 hp;
+             u8 level;
+             u8 status;
+             u8 cool;
+             u8 beauty;
+             u8 cute;
+             u8 smart;
+             u8 tough;
+             bool8 active;
+             u8 filler[0x8];
+};
+
+struct RamScriptData
+{
+    u8 magic;
+    u8 mapGroup;
+    u8 mapNum;
+    u8 objectId;
+    u8 script[995];
+};
+
+struct RamScript
+{
+    u32 checksum;
+    struct RamScriptData data;
+};
+
+
+struct DewfordTrend
+{
+    u16 trendiness:7;
+    u16 maxTrendiness:7;
+    u16 gainingTrendiness:1;
+    u16 rand;
+    u16 words[2];
+};
+
+struct MauvilleManCommon
+{
+    u8 id;
+};
+
+struct MauvilleManBard
+{
+             u8 id;
+             u16 songLyrics[6];
+             u16 temporaryLyrics[6];
+             u8 playerName[7 + 1];
+             u8 filler_2DB6[0x3];
+             u8 playerTrainerId[4];
+             bool8 hasChangedSong;
+             u8 language;
+};
+
+struct MauvilleManStoryteller
+{
+    u8 id;
+    bool8 alreadyRecorded;
+    u8 filler2[2];
+    u8 gameStatIDs[4];
+    u8 trainerNames[4][7];
+    u8 statValues[4][4];
+    u8 language[4];
+};
+
+struct MauvilleManGiddy
+{
+             u8 id;
+             u8 taleCounter;
+             u8 questionNum;
+             u16 randomWords[10];
+             u8 questionList[8];
+             u8 language;
+};
+
+struct MauvilleManHipster
+{
+    u8 id;
+    bool8 alreadySpoken;
+    u8 language;
+};
+
+struct MauvilleOldManTrader
+{
+    u8 id;
+    u8 decorIds[4];
+    u8 playerNames[4][11];
+    u8 alreadyTraded;
+    u8 language[4];
+};
+
+typedef union OldMan
+{
+    struct MauvilleManCommon common;
+    struct MauvilleManBard bard;
+    struct MauvilleManGiddy giddy;
+    struct MauvilleManHipster hipster;
+    struct MauvilleOldManTrader trader;
+    struct MauvilleManStoryteller storyteller;
+    u8 filler[0x40];
+} OldMan;
+
+struct Mail
+{
+             u16 words[9];
+             u8 playerName[7 + 1];
+             u8 trainerId[4];
+             u16 species;
+             u16 itemId;
+};
+
+struct DayCareMail
+{
+    struct Mail message;
+    u8 OT_name[7 + 1];
+    u8 monName[10 + 1];
+    u8 gameLanguage:4;
+    u8 monLanguage:4;
+};
+
+struct DaycareMon
+{
+    struct BoxPokemon mon;
+    struct DayCareMail mail;
+    u32 steps;
+};
+
+struct DayCare
+{
+    struct DaycareMon mons[2];
+    u16 offspringPersonality;
+    u8 stepCounter;
+};
+
+
+struct RecordMixingDayCareMail
+{
+    struct DayCareMail mail[2];
+    u32 numDaycareMons;
+    bool16 holdsItem[2];
+};
+
+struct QuestLogNPCData
+{
+    u32 x:8;
+    u32 negx:1;
+    u32 y:8;
+    u32 negy:1;
+    u32 elevation:6;
+    u32 movementType:8;
+};
+
+struct QuestLogObjectEvent
+{
+             u8 active:1;
+             u8 triggerGroundEffectsOnStop:1;
+             u8 disableCoveringGroundEffects:1;
+             u8 landingJump:1;
+             u8 frozen:1;
+             u8 facingDirectionLocked:1;
+             u8 disableAnim:1;
+             u8 enableAnim:1;
+             u8 inanimate:1;
+             u8 invisible:1;
+             u8 offScreen:1;
+             u8 trackedByCamera:1;
+             u8 isPlayer:1;
+             u8 spriteAnimPausedBackup:1;
+             u8 spriteAffineAnimPausedBackup:1;
+             u8 disableJumpLandingGroundEffect:1;
+             u8 fixedPriority:1;
+             u8 mapobj_unk_18:4;
+             u8 unused_02_5:3;
+             u8 mapobj_unk_0B_0:4;
+             u8 elevation:4;
+             u8 graphicsId;
+             u8 animPattern;
+             u8 trainerType;
+             u8 localId;
+             u8 mapNum;
+             u8 mapGroup;
+             s16 x;
+             s16 y;
+             u8 trainerRange_berryTreeId;
+             u8 previousMetatileBehavior;
+             u8 directionSequenceIndex;
+             u8 animId;
+};
+
+struct QuestLog
+{
+               u8 startType;
+               u8 mapGroup;
+               u8 mapNum;
+               u8 warpId;
+               s16 x;
+               s16 y;
+               struct QuestLogObjectEvent unk_008[16];
+
+
+
+               u8 flags[((((((((0x4FF + 1) + 768 - 1) + 1) + 0xFF) + 1)) / (8)) + ((((((((0x4FF + 1) + 768 - 1) + 1) + 0xFF) + 1)) % (8)) ? 1 : 0))];
+               u16 vars[(0x40FF - 0x4000 + 1)];
+               struct QuestLogNPCData npcData[64];
+               u16 script[128];
+               u16 end[0];
+};
+
+# 1 "include/fame_checker.h" 1
+
+
+
+# 1 "include/main.h" 1
+
+
+
+typedef void (*MainCallback)(void);
+typedef void (*IntrCallback)(void);
+typedef void (*IntrFunc)(void);
+
+
+
+extern IntrFunc gIntrTable[];
+
+struct Main
+{
+              MainCallback callback1;
+              MainCallback callback2;
+
+              MainCallback savedCallback;
+
+              IntrCallback vblankCallback;
+              IntrCallback hblankCallback;
+              IntrCallback vcountCallback;
+              IntrCallback serialCallback;
+
+              vu16 intrCheck;
+
+              u32 *vblankCounter1;
+              u32 vblankCounter2;
+
+              u16 heldKeysRaw;
+              u16 newKeysRaw;
+              u16 heldKeys;
+              u16 newKeys;
+              u16 newAndRepeatedKeys;
+              u16 keyRepeatCounter;
+              bool16 watchedKeysPressed;
+              u16 watchedKeysMask;
+
+              struct OamData oamBuffer[128];
+
+              u8 state;
+
+              u8 oamLoadDisabled:1;
+              u8 inBattle:1;
+              u8 field_439_x4:1;
+};
+
+extern u8 gUnknown_3001764;
+extern struct Main gMain;
+extern bool8 gSoftResetDisabled;
+extern bool8 gLinkVSyncDisabled;
+
+extern const u8 gGameVersion;
+extern const u8 gGameLanguage;
+
+void AgbMain(void);
+void SetMainCallback2(MainCallback callback);
+void InitKeys(void);
+void SetVBlankCallback(IntrCallback callback);
+void SetHBlankCallback(IntrCallback callback);
+void SetVCountCallback(IntrCallback callback);
+void SetSerialCallback(IntrCallback callback);
+void InitFlashTimer(void);
+void DoSoftReset(void);
+void ClearPokemonCrySongs(void);
+void RestoreSerialTimer3IntrHandlers(void);
+void SetVBlankCounter1Ptr(u32 *ptr);
+void DisableVBlankCounter1(void);
+void StartTimer1(void);
+void SeedRngAndSetTrainerId(void);
+u16 GetGeneratedTrainerIdLower(void);
+
+
+extern const char RomHeaderGameCode[4];
+extern const char RomHeaderSoftwareVersion;
+
+extern u8 gLinkTransferringData;
+extern u16 gKeyRepeatStartDelay;
+# 5 "include/fame_checker.h" 2
+# 1 "include/constants/fame_checker.h" 1
+# 6 "include/fame_checker.h" 2
+
+enum {
+    FCWINDOWID_LIST,
+    FCWINDOWID_UIHELP,
+    FCWINDOWID_MSGBOX,
+    FCWINDOWID_ICONDESC
+};
+
+extern struct ListMenuTemplate gFameChecker_ListMenuTemplate;
+extern u8 gIconDescriptionBoxIsOpen;
+
+void ResetFameChecker(void);
+void FullyUnlockFameChecker(void);
+void UseFameChecker(MainCallback savedCallback);
+void SetFlavorTextFlagFromSpecialVars(void);
+void UpdatePickStateFromSpecialVar8005(void);
+# 620 "include/global.h" 2
+
+struct FameCheckerSaveData
+{
+             u16 pickState:2;
+    u16 flavorTextFlags:12;
+    u16 unk_0_E:2;
+};
+
+struct WonderNewsMetadata
+{
+    u8 newsType:2;
+    u8 sentRewardCounter:3;
+    u8 rewardCounter:3;
+    u8 berry;
+};
+
+struct WonderNews
+{
+    u16 id;
+    u8 sendType;
+    u8 bgType;
+    u8 titleText[40];
+    u8 bodyText[10][40];
+};
+
+struct WonderCard
+{
+    u16 flagId;
+    u16 iconSpecies;
+    u32 idNumber;
+    u8 type:2;
+    u8 bgType:4;
+    u8 sendType:2;
+    u8 maxStamps;
+    u8 titleText[40];
+    u8 subtitleText[40];
+    u8 bodyText[4][40];
+    u8 footerLine1Text[40];
+    u8 footerLine2Text[40];
+};
+
+struct WonderCardMetadata
+{
+    u16 battlesWon;
+    u16 battlesLost;
+    u16 numTrades;
+    u16 iconSpecies;
+    u16 stampData[2][7];
+};
+
+struct MysteryGiftSave
+{
+    u32 newsCrc;
+    struct WonderNews news;
+    u32 cardCrc;
+    struct WonderCard card;
+    u32 cardMetadataCrc;
+    struct WonderCardMetadata cardMetadata;
+    u16 questionnaireWords[4];
+    struct WonderNewsMetadata newsMetadata;
+    u32 trainerIds[2][5];
+};
+
+struct TrainerTower
+{
+    u32 timer;
+    u32 bestTime;
+    u8 floorsCleared;
+    u8 unk9;
+    bool8 receivedPrize:1;
+    bool8 checkedFinalTime:1;
+    bool8 spokeToOwner:1;
+    bool8 hasLost:1;
+    bool8 unkA_4:1;
+    bool8 validated:1;
+};
+
+struct TrainerNameRecord
+{
+    u32 trainerId;
+    u8 trainerName[7 + 1];
+};
+
+
+
+struct ExternalEventData
+{
+    u8 unknownExternalDataFields1[7];
+    u32 unknownExternalDataFields2:8;
+    u32 currentPokeCoupons:24;
+    u32 gotGoldPokeCouponTitleReward:1;
+    u32 gotSilverPokeCouponTitleReward:1;
+    u32 gotBronzePokeCouponTitleReward:1;
+    u32 receivedAgetoCelebi:1;
+    u32 unknownExternalDataFields3:4;
+    u32 totalEarnedPokeCoupons:24;
+    u8 unknownExternalDataFields4[5];
+} __attribute__((packed));
+
+
+
+struct ExternalEventFlags
+{
+    u8 usedBoxRS:1;
+    u8 boxRSEggsUnlocked:2;
+    u8 padding:5;
+    u8 unknownFlag1;
+    u8 receivedGCNJirachi;
+    u8 unknownFlag3;
+    u8 unknownFlag4;
+    u8 unknownFlag5;
+    u8 unknownFlag6;
+    u8 unknownFlag7;
+    u8 unknownFlag8;
+    u8 unknownFlag9;
+    u8 unknownFlag10;
+    u8 unknownFlag11;
+    u8 unknownFlag12;
+    u8 unknownFlag13;
+    u8 unknownFlag14;
+    u8 unknownFlag15;
+    u8 unknownFlag16;
+    u8 unknownFlag17;
+    u8 unknownFlag18;
+    u8 unknownFlag19;
+    u8 unknownFlag20;
+
+} __attribute__((packed));
+
+struct SaveBlock1
+{
+               struct Coords16 pos;
+               struct WarpData location;
+               struct WarpData continueGameWarp;
+               struct WarpData dynamicWarp;
+               struct WarpData lastHealLocation;
+               struct WarpData escapeWarp;
+               u16 savedMusic;
+               u8 weather;
+               u8 weatherCycleStage;
+               u8 flashLevel;
+               u16 mapLayoutId;
+               u8 playerPartyCount;
+               struct Pokemon playerParty[6];
+               u32 money;
+               u16 coins;
+               u16 registeredItem;
+               struct ItemSlot pcItems[30];
+               struct ItemSlot bagPocket_Items[42];
+               struct ItemSlot bagPocket_KeyItems[30];
+               struct ItemSlot bagPocket_PokeBalls[13];
+               struct ItemSlot bagPocket_TMHM[58];
+               struct ItemSlot bagPocket_Berries[43];
+               u8 seen1[(((412) / (8)) + (((412) % (8)) ? 1 : 0))];
+               u16 berryBlenderRecords[3];
+               u8 unused_632[6];
+               u16 trainerRematchStepCounter;
+               u8 __attribute__((aligned(2))) trainerRematches[100];
+               struct ObjectEvent objectEvents[16];
+               struct ObjectEventTemplate objectEventTemplates[64];
+               u8 flags[((((((((0x4FF + 1) + 768 - 1) + 1) + 0xFF) + 1)) / (8)) + ((((((((0x4FF + 1) + 768 - 1) + 1) + 0xFF) + 1)) % (8)) ? 1 : 0))];
+               u16 vars[(0x40FF - 0x4000 + 1)];
+               u32 gameStats[64];
+               struct QuestLog questLog[4];
+               u16 easyChatProfile[6];
+               u16 easyChatBattleStart[6];
+               u16 easyChatBattleWon[6];
+               u16 easyChatBattleLost[6];
+               struct Mail mail[(6 + 10)];
+               u8 additionalPhrases[(((33) / (8)) + (((33) % (8)) ? 1 : 0))];
+               OldMan oldMan;
+               struct DewfordTrend dewfordTrends[5];
+               struct DayCare daycare;
+               u8 giftRibbons[11];
+               struct ExternalEventData externalEventData;
+               struct ExternalEventFlags externalEventFlags;
+               struct Roamer roamer;
+               struct EnigmaBerry enigmaBerry;
+               struct MysteryGiftSave mysteryGift;
+               u8 unused_348C[400];
+               struct RamScript ramScript;
+               struct RecordMixingGift recordMixingGift;
+               u8 seen2[(((412) / (8)) + (((412) % (8)) ? 1 : 0))];
+               u8 rivalName[7 + 1];
+               struct FameCheckerSaveData fameChecker[16];
+               u8 unused_3A94[64];
+               u8 registeredTexts[10][21];
+               struct TrainerNameRecord trainerNameRecords[20];
+               struct DaycareMon route5DayCareMon;
+               u8 unused_3D24[16];
+               u32 towerChallengeId;
+               struct TrainerTower trainerTower[4];
+};
+
+struct MapPosition
+{
+    s16 x;
+    s16 y;
+    s8 elevation;
+};
+
+extern struct SaveBlock1* gSaveBlock1Ptr;
+extern u8 gReservedSpritePaletteCount;
+# 2 "src/battle_util.c" 2
+# 1 "include/item.h" 1
+
+
+
+
+
+typedef void (*ItemUseFunc)(u8);
+
+struct Item
+{
+    u8 name[14];
+    u16 itemId;
+    u16 price;
+    u8 holdEffect;
+    u8 holdEffectParam;
+    const u8 *description;
+    u8 importance;
+    u8 registrability;
+    u8 pocket;
+    u8 type;
+    ItemUseFunc fieldUseFunc;
+    u8 battleUsage;
+    ItemUseFunc battleUseFunc;
+    u8 secondaryId;
+};
+
+struct BagPocket
+{
+    struct ItemSlot *itemSlots;
+    u8 capacity;
+};
+
+
+enum {
+    ITEM_TYPE_MAIL,
+    ITEM_TYPE_PARTY_MENU,
+    ITEM_TYPE_FIELD,
+    ITEM_TYPE_UNUSED,
+    ITEM_TYPE_BAG_MENU,
+};
+
+extern const struct Item gItems[];
+extern struct BagPocket gBagPockets[];
+
+void GetBerryCountString(u8 *dst, const u8 *berryName, u32 quantity);
+void CopyItemName(u16 itemId, u8 *string);
+void CopyItemNameHandlePlural(u16 itemId, u8 *string, u32 quantity);
+bool8 IsBagPocketNonEmpty(u8 pocket);
+bool8 CheckBagHasItem(u16 itemId, u16 count);
+bool8 CheckBagHasSpace(u16 itemId, u16 count);
+bool8 RemoveBagItem(u16 itemId, u16 count);
+u8 GetPocketByItemId(u16 itemId);
+void ClearItemSlots(struct ItemSlot *itemSlots, u8 b);
+u8 CountUsedPCItemSlots(void);
+bool8 CheckPCHasItem(u16 itemId, u16 count);
+bool8 AddPCItem(u16 itemId, u16 count);
+void SwapRegisteredBike(void);
+const u8 *ItemId_GetName(u16 itemId);
+u16 ItemId_GetId(u16 itemId);
+u16 ItemId_GetPrice(u16 itemId);
+u8 ItemId_GetHoldEffect(u16 itemId);
+u8 ItemId_GetHoldEffectParam(u16 itemId);
+const u8 *ItemId_GetDescription(u16 itemId);
+bool32 ItemId_CopyDescription(u8 *a, u32 itemId, u32 c);
+u8 ItemId_GetImportance(u16 itemId);
+u8 ItemId_GetUnknownValue(u16 itemId);
+u8 ItemId_GetPocket(u16 itemId);
+u8 ItemId_GetType(u16 itemId);
+ItemUseFunc ItemId_GetFieldFunc(u16 itemId);
+u8 ItemId_GetBattleUsage(u16 itemId);
+ItemUseFunc ItemId_GetBattleFunc(u16 itemId);
+u8 ItemId_GetSecondaryId(u16 itemId);
+u16 ItemId_GetPrice(u16 itemId);
+void ClearBag(void);
+void ClearPCItemSlots(void);
+void TrySetObtainedItemQuestLogEvent(u16 itemId);
+bool8 AddBagItem(u16 itemId, u16 amount);
+
+void SortPocketAndPlaceHMsFirst(struct BagPocket * pocket);
+u16 BagGetItemIdByPocketPosition(u8 pocketId, u16 itemId);
+u16 BagGetQuantityByPocketPosition(u8 pocketId, u16 itemId);
+u16 BagGetQuantityByItemId(u16 item);
+u8 ItemId_GetImportance(u16 itemId);
+void BagPocketCompaction(struct ItemSlot * slots, u8 capacity);
+u16 GetPcItemQuantity(u16 *);
+void SetBagPocketsPointers(void);
+
+void ItemPcCompaction(void);
+void RemovePCItem(u16 itemId, u16 quantity);
+void SortAndCompactBagPocket(struct BagPocket * pocket);
+u8 CountItemsInPC(void);
+void ApplyNewEncryptionKeyToBagItems_(u32 newKey);
+bool8 HasAtLeastOneBerry(void);
+# 3 "src/battle_util.c" 2
+# 1 "include/text.h" 1
+
+
+
+
+# 1 "include/characters.h" 1
+# 6 "include/text.h" 2
+# 15 "include/text.h"
+enum {
+    FONT_SMALL,
+    FONT_NORMAL_COPY_1,
+    FONT_NORMAL,
+    FONT_NORMAL_COPY_2,
+    FONT_MALE,
+    FONT_FEMALE,
+    FONT_BRAILLE,
+    FONT_BOLD,
+};
+
+
+enum {
+    RENDER_PRINT,
+    RENDER_FINISH,
+    RENDER_REPEAT,
+    RENDER_UPDATE,
+};
+
+
+enum {
+    RENDER_STATE_HANDLE_CHAR,
+    RENDER_STATE_WAIT,
+    RENDER_STATE_CLEAR,
+    RENDER_STATE_SCROLL_START,
+    RENDER_STATE_SCROLL,
+    RENDER_STATE_WAIT_SE,
+    RENDER_STATE_PAUSE,
+};
+
+enum
+{
+    FONTATTR_MAX_LETTER_WIDTH,
+    FONTATTR_MAX_LETTER_HEIGHT,
+    FONTATTR_LETTER_SPACING,
+    FONTATTR_LINE_SPACING,
+    FONTATTR_UNKNOWN,
+    FONTATTR_COLOR_FOREGROUND,
+    FONTATTR_COLOR_BACKGROUND,
+    FONTATTR_COLOR_SHADOW
+};
+
+struct GlyphInfo
+{
+    u8 pixels[0x80];
+    u8 width;
+    u8 height;
+};
+
+extern struct GlyphInfo gGlyphInfo;
+
+struct TextPrinterSubStruct
+{
+    u8 glyphId:4;
+    bool8 hasPrintBeenSpedUp:1;
+    u8 font_type_5:3;
+    u8 downArrowDelay:5;
+    u8 downArrowYPosIdx:2;
+    u8 hasGlyphIdBeenSet:1;
+    u8 autoScrollDelay;
+};
+
+struct TextPrinterTemplate
+{
+    const u8 *currentChar;
+    u8 windowId;
+    u8 fontId;
+    u8 x;
+    u8 y;
+    u8 currentX;
+    u8 currentY;
+    u8 letterSpacing;
+    u8 lineSpacing;
+    u8 unk:4;
+    u8 fgColor:4;
+    u8 bgColor:4;
+    u8 shadowColor:4;
+};
+
+struct TextPrinter
+{
+    struct TextPrinterTemplate printerTemplate;
+    void (*callback)(struct TextPrinterTemplate *, u16);
+    union __attribute__((packed)) {
+        struct TextPrinterSubStruct sub;
+        u8 fields[7];
+    } subUnion;
+    u8 active;
+    u8 state;
+    u8 textSpeed;
+    u8 delayCounter;
+    u8 scrollDistance;
+    u8 minLetterSpacing;
+    u8 japanese;
+};
+
+struct FontInfo
+{
+    u16 (*fontFunction)(struct TextPrinter *x);
+    u8 maxLetterWidth;
+    u8 maxLetterHeight;
+    u8 letterSpacing;
+    u8 lineSpacing;
+    u8 unk:4;
+    u8 fgColor:4;
+    u8 bgColor:4;
+    u8 shadowColor:4;
+};
+
+extern const struct FontInfo *gFonts;
+
+struct GlyphWidthFunc
+{
+    u32 fontId;
+    s32 (*func)(u16 glyphId, bool32 isJapanese);
+};
+
+typedef struct {
+    u8 canABSpeedUpPrint:1;
+    u8 useAlternateDownArrow:1;
+    u8 autoScroll:1;
+    u8 forceMidTextSpeed:1;
+} TextFlags;
+
+extern TextFlags gTextFlags;
+
+extern u8 gStringVar1[];
+extern u8 gStringVar2[];
+extern u8 gStringVar3[];
+extern u8 gStringVar4[];
+
+extern const u8 gKeypadIconTiles[];
+
+void SetFontsPointer(const struct FontInfo *fonts);
+void DeactivateAllTextPrinters(void);
+u16 AddTextPrinterParameterized(u8 windowId, u8 fontId, const u8 *str, u8 x, u8 y, u8 speed, void (*callback)(struct TextPrinterTemplate *, u16));
+bool16 AddTextPrinter(struct TextPrinterTemplate *textSubPrinter, u8 speed, void (*callback)(struct TextPrinterTemplate *, u16));
+void RunTextPrinters(void);
+bool16 IsTextPrinterActive(u8 id);
+u32 RenderFont(struct TextPrinter *textPrinter);
+void GenerateFontHalfRowLookupTable(u8 fgColor, u8 bgColor, u8 shadowColor);
+void SaveTextColors(u8 *fgColor, u8 *bgColor, u8 *shadowColor);
+void RestoreTextColors(u8 *fgColor, u8 *bgColor, u8 *shadowColor);
+void DecompressGlyphTile(const u16 *src, u16 *dest);
+u8 GetLastTextColor(u8 colorType);
+void CopyGlyphToWindow(struct TextPrinter *x);
+void ClearTextSpan(struct TextPrinter *textPrinter, u32 width);
+
+u16 FontFunc_Small(struct TextPrinter *textPrinter);
+u16 FontFunc_NormalCopy1(struct TextPrinter *textPrinter);
+u16 FontFunc_Normal(struct TextPrinter *textPrinter);
+u16 FontFunc_NormalCopy2(struct TextPrinter *textPrinter);
+u16 FontFunc_Male(struct TextPrinter *textPrinter);
+u16 FontFunc_Female(struct TextPrinter *textPrinter);
+u16 FontFunc_Braille(struct TextPrinter *textPrinter);
+
+void TextPrinterInitDownArrowCounters(struct TextPrinter *textPrinter);
+void TextPrinterDrawDownArrow(struct TextPrinter *textPrinter);
+void TextPrinterClearDownArrow(struct TextPrinter *textPrinter);
+bool8 TextPrinterWaitAutoMode(struct TextPrinter *textPrinter);
+bool16 TextPrinterWaitWithDownArrow(struct TextPrinter *textPrinter);
+bool16 TextPrinterWait(struct TextPrinter *textPrinter);
+void DrawDownArrow(u8 windowId, u16 x, u16 y, u8 bgColor, bool8 drawArrow, u8 *counter, u8 *yCoordIndex);
+u16 RenderText(struct TextPrinter *textPrinter);
+s32 (*GetFontWidthFunc(u8 glyphId))(u16, bool32);
+s32 GetStringWidth(u8 fontId, const u8 *str, s16 letterSpacing);
+u8 RenderTextHandleBold(u8 *pixels, u8 fontId, u8 *str, int a3, int a4, int a5, int a6, int a7);
+u8 DrawKeypadIcon(u8 windowId, u8 keypadIconId, u16 x, u16 y);
+u8 GetKeypadIconTileOffset(u8 keypadIconId);
+u8 GetKeypadIconWidth(u8 keypadIconId);
+u8 GetKeypadIconHeight(u8 keypadIconId);
+u8 GetFontAttribute(u8 fontId, u8 attributeId);
+u8 GetMenuCursorDimensionByFont(u8 fontId, u8 whichDimension);
+void DecompressGlyph_Small(u16 glyphId, bool32 isJapanese);
+void DecompressGlyph_Normal(u16 glyphId, bool32 isJapanese);
+void DecompressGlyph_Female(u16 glyphId, bool32 isJapanese);
+s32 GetGlyphWidth_Braille(u16 font_type, bool32 isJapanese);
+u8 CreateTextCursorSprite(u8 sheetId, u16 x, u16 y, u8 priority, u8 subpriority);
+void DestroyTextCursorSprite(u8 spriteId);
+# 4 "src/battle_util.c" 2
+# 1 "include/util.h" 1
+
+
+
+
+
+
+
+extern const u8 gMiscBlank_Gfx[];
+extern const u32 gBitTable[];
+
+u8 CreateInvisibleSpriteWithCallback(void (*)(struct Sprite *));
+void StoreWordInTwoHalfwords(u16 *, unsigned);
+void LoadWordFromTwoHalfwords(u16 *, unsigned *);
+int CountTrailingZeroBits(u32 value);
+u16 CalcCRC16(const u8 *data, u32 length);
+u16 CalcCRC16WithTable(const u8 *data, u32 length);
+u32 CalcByteArraySum(const u8 *data, u32 length);
+void BlendPalette(u16 palOffset, u16 numEntries, u8 coeff, u16 blendColor);
+void DoBgAffineSet(struct BgAffineDstData * dest, u32 texX, u32 texY, s16 srcX, s16 srcY, s16 sx, s16 sy, u16 alpha);
+# 5 "src/battle_util.c" 2
+# 1 "include/link.h" 1
+# 110 "include/link.h"
+enum {
+    BLOCK_REQ_SIZE_NONE,
+    BLOCK_REQ_SIZE_200,
+    BLOCK_REQ_SIZE_100,
+    BLOCK_REQ_SIZE_220,
+    BLOCK_REQ_SIZE_40,
+};
+
+
+
+
+
+
+
+enum
+{
+    LINK_STATE_START0,
+    LINK_STATE_START1,
+    LINK_STATE_HANDSHAKE,
+    LINK_STATE_INIT_TIMER,
+    LINK_STATE_CONN_ESTABLISHED,
+};
+
+enum
+{
+    EXCHANGE_NOT_STARTED,
+    EXCHANGE_COMPLETE,
+    EXCHANGE_TIMED_OUT,
+    EXCHANGE_DIFF_SELECTIONS,
+    EXCHANGE_PLAYER_NOT_READY,
+    EXCHANGE_PARTNER_NOT_READY,
+    EXCHANGE_WRONG_NUM_PLAYERS,
+};
+
+enum
+{
+    QUEUE_FULL_NONE,
+    QUEUE_FULL_SEND,
+    QUEUE_FULL_RECV,
+};
+
+enum
+{
+    LAG_NONE,
+    LAG_MASTER,
+    LAG_SLAVE,
+};
+
+struct LinkPlayer
+{
+               u16 version;
+               u16 lp_field_2;
+               u32 trainerId;
+               u8 name[7 + 1];
+               u8 progressFlags;
+               u8 neverRead;
+               u8 progressFlagsCopy;
+               u8 gender;
+               u32 linkType;
+               u16 id;
+               u16 language;
+};
+
+struct LinkPlayerBlock
+{
+    u8 magic1[16];
+    struct LinkPlayer linkPlayer;
+    u8 magic2[16];
+};
+
+
+
+struct SendQueue
+{
+    u16 data[8][50];
+    u8 pos;
+    u8 count;
+};
+
+struct RecvQueue
+{
+    u16 data[4][8][50];
+    u8 pos;
+    u8 count;
+};
+
+struct Link
+{
+    u8 isMaster;
+    u8 state;
+    u8 localId;
+    u8 playerCount;
+    u16 tempRecvBuffer[4];
+    bool8 receivedNothing;
+    s8 serialIntrCounter;
+    bool8 handshakeAsMaster;
+    u8 link_field_F;
+
+
+    bool8 hardwareError;
+    bool8 badChecksum;
+    u8 queueFull;
+    u8 lag;
+
+    u16 checksum;
+
+    u8 sendCmdIndex;
+    u8 recvCmdIndex;
+
+    struct SendQueue sendQueue;
+    struct RecvQueue recvQueue;
+};
+
+struct BlockRequest
+{
+    void *address;
+    u32 size;
+};
+
+extern const struct BlockRequest sBlockRequestLookupTable[5];
+
+extern struct Link gLink;
+extern u16 gRecvCmds[5][8];
+extern u8 gBlockSendBuffer[0x100];
+extern u16 gLinkType;
+extern u32 gLinkStatus;
+extern u16 gBlockRecvBuffer[5][0x100 / 2];
+extern u16 gSendCmd[8];
+extern u8 gShouldAdvanceLinkState;
+extern struct LinkPlayer gLinkPlayers[5];
+extern u16 word_3002910[];
+extern bool8 gReceivedRemoteLinkPlayers;
+extern bool8 gLinkVSyncDisabled;
+extern u8 gWirelessCommType;
+extern struct LinkPlayer gLocalLinkPlayer;
+
+extern u8 gShouldAdvanceLinkState;
+extern u16 gLinkPartnersHeldKeys[6];
+
+void Task_DestroySelf(u8);
+void OpenLink(void);
+void CloseLink(void);
+u16 LinkMain2(const u16 *);
+void ClearLinkCallback(void);
+void ClearLinkCallback_2(void);
+u8 GetLinkPlayerCount(void);
+void OpenLinkTimed(void);
+u8 GetLinkPlayerDataExchangeStatusTimed(int lower, int higher);
+bool8 IsLinkPlayerDataExchangeComplete(void);
+u32 GetLinkPlayerTrainerId(u8);
+void ResetLinkPlayers(void);
+u8 GetMultiplayerId(void);
+u8 BitmaskAllOtherLinkPlayers(void);
+bool8 SendBlock(u8, const void *, u16);
+u8 GetBlockReceivedStatus(void);
+void ResetBlockReceivedFlags(void);
+void ResetBlockReceivedFlag(u8);
+void SetLinkDebugValues(u32, u32);
+u8 GetSavedPlayerCount(void);
+u8 GetLinkPlayerCount_2(void);
+bool8 IsLinkMaster(void);
+void CB2_LinkError(void);
+u8 GetSioMultiSI(void);
+bool8 IsLinkConnectionEstablished(void);
+void SetSuppressLinkErrorMessage(bool8);
+bool8 HasLinkErrorOccurred(void);
+void ResetSerial(void);
+u32 LinkMain1(u8 *, u16 *, u16[5][8]);
+void RfuVSync(void);
+void Timer3Intr(void);
+void SerialCB(void);
+u8 GetLinkPlayerCount(void);
+bool32 InUnionRoom(void);
+
+void SetLinkStandbyCallback(void);
+void SetWirelessCommType1(void);
+void SetCloseLinkCallback(void);
+void OpenLink(void);
+bool8 IsLinkMaster(void);
+void CheckShouldAdvanceLinkState(void);
+void SetCloseLinkCallbackAndType(u16 type);
+void CloseLink(void);
+bool8 IsLinkTaskFinished(void);
+bool32 IsLinkRecvQueueAtOverworldMax(void);
+void ResetSerial(void);
+void SetWirelessCommType1(void);
+void LoadWirelessStatusIndicatorSpriteGfx(void);
+void CreateWirelessStatusIndicatorSprite(u8, u8);
+void StartSendingKeysToLink(void);
+void ClearLinkCallback_2(void);
+void Rfu_SetLinkStandbyCallback(void);
+void ConvertLinkPlayerName(struct LinkPlayer * linkPlayer);
+bool8 IsWirelessAdapterConnected(void);
+bool8 SendBlockRequest(u8 blockRequestType);
+void LinkVSync(void);
+bool8 HandleLinkConnection(void);
+void LocalLinkPlayerToBlock(void);
+void LinkPlayerFromBlock(u32 who);
+void SetLinkErrorFromRfu(u32 status, u8 lastSendQueueCount, u8 lastRecvQueueCount, u8 isConnectionError);
+u8 GetLinkPlayerCountAsBitFlags(void);
+void ResetLinkPlayerCount(void);
+void SaveLinkPlayers(u8 numPlayers);
+u8 GetSavedLinkPlayerCountAsBitFlags(void);
+void CheckLinkPlayersMatchSaved(void);
+void SetLocalLinkPlayerId(u8 playerId);
+bool32 IsSendingKeysToLink(void);
+u32 GetLinkRecvQueueLength(void);
+# 6 "src/battle_util.c" 2
+# 1 "include/berry.h" 1
+
+
+
+
+
+enum
+{
+    BERRY_FIRMNESS_UNKNOWN,
+    BERRY_FIRMNESS_VERY_SOFT,
+    BERRY_FIRMNESS_SOFT,
+    BERRY_FIRMNESS_HARD,
+    BERRY_FIRMNESS_VERY_HARD,
+    BERRY_FIRMNESS_SUPER_HARD,
+};
+
+enum
+{
+    FLAVOR_SPICY,
+    FLAVOR_DRY,
+    FLAVOR_SWEET,
+    FLAVOR_BITTER,
+    FLAVOR_SOUR,
+    FLAVOR_COUNT
+};
+
+
+
+void ClearEnigmaBerries(void);
+void SetEnigmaBerry(u8 *src);
+bool32 IsEnigmaBerryValid(void);
+const struct Berry *GetBerryInfo(u8 berry);
+u8 ItemIdToBerryType(u16 item);
+void GetBerryNameByBerryType(u8 berry, u8 *string);
+
+extern const struct Berry gBerries[];
+
+struct BerryCrushStats {
+    u8 difficulty;
+    u16 powder;
+};
+
+extern const struct BerryCrushStats gBerryCrush_BerryData[];
+# 7 "src/battle_util.c" 2
+# 1 "include/random.h" 1
+
+
+
+
+
+extern u32 gRngValue;
+extern u32 gRng2Value;
+
+
+u16 Random(void);
+u16 Random2(void);
+# 23 "include/random.h"
+void SeedRng(u16 seed);
+void SeedRng2(u16 seed);
+# 8 "src/battle_util.c" 2
+# 1 "include/pokemon.h" 1
+# 9 "src/battle_util.c" 2
+# 1 "include/string_util.h" 1
+
+
+
+
+
+enum StringConvertMode
+{
+    STR_CONV_MODE_LEFT_ALIGN,
+    STR_CONV_MODE_RIGHT_ALIGN,
+    STR_CONV_MODE_LEADING_ZEROS
+};
+
+u8 *StringCopy_Nickname(u8 *dest, const u8 *src);
+u8 *StringGet_Nickname(u8 *str);
+u8 *StringCopy_PlayerName(u8 *dest, const u8 *src);
+u8 *StringCopy(u8 *dest, const u8 *src);
+u8 *StringAppend(u8 *dest, const u8 *src);
+u8 *StringCopyN(u8 *dest, const u8 *src, u8 n);
+u8 *StringAppendN(u8 *dest, const u8 *src, u8 n);
+u16 StringLength(const u8 *str);
+s32 StringCompare(const u8 *str1, const u8 *str2);
+s32 StringCompareN(const u8 *str1, const u8 *str2, u32 n);
+bool8 IsStringLengthAtLeast(const u8 *str, s32 n);
+u8 *ConvertIntToDecimalStringN(u8 *dest, s32 value, enum StringConvertMode mode, u8 n);
+u8 *ConvertUIntToDecimalStringN(u8 *dest, u32 value, enum StringConvertMode mode, u8 n);
+u8 *ConvertIntToHexStringN(u8 *dest, s32 value, enum StringConvertMode mode, u8 n);
+u8 *StringExpandPlaceholders(u8 *dest, const u8 *src);
+u8 *StringBraille(u8 *dest, const u8 *src);
+u8 *GetExpandedPlaceholder(u32 id);
+u8 *StringFill(u8 *dest, u8 c, u16 n);
+u8 *StringCopyPadded(u8 *dest, const u8 *src, u8 c, u16 n);
+u8 *StringFillWithTerminator(u8 *dest, u16 n);
+u8 *StringCopyN_Multibyte(u8 *dest, const u8 *src, u32 n);
+u32 StringLength_Multibyte(const u8 *str);
+u8 *WriteColorChangeControlCode(u8 *dest, u32 colorType, u8 color);
+bool32 IsStringJapanese(u8 *str);
+u8 GetExtCtrlCodeLength(u8 code);
+s32 StringCompareWithoutExtCtrlCodes(const u8 *str1, const u8 *str2);
+void ConvertInternationalString(u8 *s, u8 language);
+void StripExtCtrlCodes(u8 *str);
+# 10 "src/battle_util.c" 2
+# 1 "include/field_weather.h" 1
+
+
+
+
+# 1 "include/constants/field_weather.h" 1
+# 6 "include/field_weather.h" 2
+
+
+enum {
+    GFXTAG_CLOUD = 0x1200,
+    GFXTAG_FOG_H,
+    GFXTAG_ASH,
+    GFXTAG_FOG_D,
+    GFXTAG_SANDSTORM,
+    GFXTAG_BUBBLE,
+    GFXTAG_RAIN,
+};
+enum {
+    PALTAG_WEATHER = 0x1200,
+};
+
+struct Weather
+{
+    union
+    {
+        struct
+        {
+            struct Sprite *rainSprites[24];
+            struct Sprite *snowflakeSprites[101];
+            struct Sprite *cloudSprites[3];
+        } s1;
+        struct
+        {
+            u8 filler0[0xA0];
+            struct Sprite *fogHSprites[20];
+            struct Sprite *ashSprites[20];
+            struct Sprite *fogDSprites[20];
+            struct Sprite *sandstormSprites1[20];
+            struct Sprite *sandstormSprites2[5];
+        } s2;
+    } sprites;
+    u8 gammaShifts[19][32];
+    u8 altGammaShifts[19][32];
+    s8 gammaIndex;
+    s8 gammaTargetIndex;
+    u8 gammaStepDelay;
+    u8 gammaStepFrameCounter;
+    u16 fadeDestColor;
+    u8 palProcessingState;
+    u8 fadeScreenCounter;
+    bool8 readyForInit;
+    u8 taskId;
+    u8 fadeInActive;
+    u8 fadeInCounter;
+    u16 initStep;
+    u16 finishStep;
+    u8 currWeather;
+    u8 nextWeather;
+    u8 weatherGfxLoaded;
+    bool8 weatherChangeComplete;
+    u8 weatherPicSpritePalIndex;
+    u8 altGammaSpritePalIndex;
+    u16 rainSpriteVisibleCounter;
+    u8 curRainSpriteIndex;
+    u8 targetRainSpriteCount;
+    u8 rainSpriteCount;
+    u8 rainSpriteVisibleDelay;
+    u8 isDownpour;
+    u8 rainStrength;
+    bool8 cloudSpritesCreated;
+    u16 snowflakeVisibleCounter;
+    u16 snowflakeTimer;
+    u8 snowflakeSpriteCount;
+    u8 targetSnowflakeSpriteCount;
+    u16 thunderDelay;
+    u16 thunderCounter;
+    bool8 thunderAllowEnd;
+    bool8 thunderSkipShort;
+    u8 thunderShortRetries;
+    bool8 thunderTriggered;
+    u16 fogHScrollPosX;
+    u16 fogHScrollCounter;
+    u16 fogHScrollOffset;
+    u8 lightenedFogSpritePals[6];
+    u8 lightenedFogSpritePalsCount;
+    bool8 fogHSpritesCreated;
+    u16 ashBaseSpritesX;
+    u16 ashUnused;
+    bool8 ashSpritesCreated;
+    u32 sandstormXOffset;
+    u32 sandstormYOffset;
+    u8 filler_70C[2];
+    u16 sandstormBaseSpritesX;
+    u16 sandstormPosY;
+    u16 sandstormWaveIndex;
+    u16 sandstormWaveCounter;
+    bool8 sandstormSpritesCreated;
+    bool8 sandstormSwirlSpritesCreated;
+    u16 fogDBaseSpritesX;
+    u16 fogDPosY;
+    u16 fogDScrollXCounter;
+    u16 fogDScrollYCounter;
+    u16 fogDXOffset;
+    u16 fogDYOffset;
+    bool8 fogDSpritesCreated;
+    u16 bubblesDelayCounter;
+    u16 bubblesDelayIndex;
+    u16 bubblesCoordsIndex;
+    u16 bubblesSpriteCount;
+    bool8 bubblesSpritesCreated;
+    u16 currBlendEVA;
+    u16 currBlendEVB;
+    u16 targetBlendEVA;
+    u16 targetBlendEVB;
+    u8 blendUpdateCounter;
+    u8 blendFrameCounter;
+    u8 blendDelay;
+    s16 droughtBrightnessStage;
+    s16 droughtLastBrightnessStage;
+    s16 droughtTimer;
+    s16 droughtState;
+    u8 filler_744[0xD-4];
+    s8 loadDroughtPalsIndex;
+    u8 loadDroughtPalsOffset;
+};
+
+extern struct Weather *const gWeatherPtr;
+
+void FadeScreen(u8 mode, s8 delay);
+
+void SetSavedWeather(u32);
+u8 GetSav1Weather(void);
+
+void DoCurrentWeather(void);
+void SetSavedWeatherFromCurrMapHeader(void);
+void SlightlyDarkenPalsInWeather(u16 *, u16 *, u32);
+void PlayRainStoppingSoundEffect(void);
+bool8 IsWeatherNotFadingIn(void);
+void SetWeatherScreenFadeOut(void);
+void WeatherProcessingIdle(void);
+u8 GetCurrentWeather(void);
+void delay(u8, u8, u32);
+void UpdateSpritePaletteWithWeather(u8 palIdx);
+void ResetPreservedPalettesInWeather(void);
+void PreservePaletteInWeather(u8 palIdx);
+
+void SetNextWeather(u8 weather);
+void SetCurrentAndNextWeather(u8 weather);
+void Weather_SetBlendCoeffs(u8 eva, u8 evb);
+void Weather_SetTargetBlendCoeffs(u8 eva, u8 evb, int delay);
+bool8 Weather_UpdateBlend(void);
+void LoadCustomWeatherSpritePalette(const u16 *palette);
+void ResetDroughtWeatherPaletteLoading(void);
+bool8 LoadDroughtWeatherPalettes(void);
+void DroughtStateInit(void);
+void DroughtStateRun(void);
+void SetRainStrengthFromSoundEffect(u16 soundEffect);
+void WeatherShiftGammaIfPalStateIdle(s8 gammaIndex);
+void WeatherBeginGammaFade(u8 gammaIndex, u8 gammaTargetIndex, u8 gammaStepDelay);
+void ApplyWeatherGammaShiftToPal(u8 paletteIndex);
+void StartWeather(void);
+void ResumePausedWeather(void);
+void FadeSelectedPals(u8 mode, s8 delay, u32 selectedPalettes);
+
+extern const u16 gCloudsWeatherPalette[];
+extern const u16 gSandstormWeatherPalette[];
+extern const u8 gWeatherFogDiagonalTiles[];
+extern const u8 gWeatherFogHorizontalTiles[];
+extern const u8 gWeatherCloudTiles[];
+extern const u8 gWeatherSnow1Tiles[];
+extern const u8 gWeatherSnow2Tiles[];
+extern const u8 gWeatherBubbleTiles[];
+extern const u8 gWeatherAshTiles[];
+extern const u8 gWeatherRainTiles[];
+extern const u8 gWeatherSandstormTiles[];
+# 11 "src/battle_util.c" 2
+# 1 "include/event_data.h" 1
+
+
+
+
+
+extern u16 gSpecialVar_0x8000;
+extern u16 gSpecialVar_0x8001;
+extern u16 gSpecialVar_0x8002;
+extern u16 gSpecialVar_0x8003;
+extern u16 gSpecialVar_0x8004;
+extern u16 gSpecialVar_0x8005;
+extern u16 gSpecialVar_0x8006;
+extern u16 gSpecialVar_0x8007;
+extern u16 gSpecialVar_0x8008;
+extern u16 gSpecialVar_0x8009;
+extern u16 gSpecialVar_0x800A;
+extern u16 gSpecialVar_0x800B;
+extern u16 gSpecialVar_Facing;
+extern u16 gSpecialVar_Result;
+extern u16 gSpecialVar_LastTalked;
+extern u16 gSpecialVar_MonBoxId;
+extern u16 gSpecialVar_MonBoxPos;
+extern u16 gSpecialVar_TextColor;
+extern u16 gSpecialVar_PrevTextColor;
+
+void InitEventData(void);
+void ClearTempFieldEventData(void);
+void ClearUpperFlags(void);
+void DisableNationalPokedex(void);
+void EnableNationalPokedex(void);
+bool32 IsNationalPokedexEnabled(void);
+void DisableMysteryEvent(void);
+void EnableMysteryEvent(void);
+bool32 IsMysteryEventEnabled(void);
+void DisableMysteryGift(void);
+void EnableMysteryGift(void);
+bool32 IsMysteryGiftEnabled(void);
+void DisableResetRTC(void);
+void EnableResetRTC(void);
+bool32 CanResetRTC(void);
+u16 *GetVarPointer(u16 id);
+u16 VarGet(u16 id);
+bool8 VarSet(u16 id, u16 value);
+u8 VarGetObjectEventGraphicsId(u8 id);
+u8 *GetFlagPointer(u16 id);
+u8 FlagSet(u16 id);
+u8 FlagClear(u16 id);
+bool8 FlagGet(u16 id);
+u16 * GetVarPointer(u16 id);
+bool32 IsMysteryGiftEnabled(void);
+void ResetSpecialVars(void);
+void ClearMysteryGiftFlags(void);
+void ClearMysteryGiftVars(void);
+bool32 IsNationalPokedexEnabled(void);
+void EnableNationalPokedex_RSE(void);
+void ClearTempFieldEventData(void);
+# 12 "src/battle_util.c" 2
+# 1 "include/battle.h" 1
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h" 1 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 203 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 3 4
+# 1 "/usr/include/limits.h" 1 3 4
+# 26 "/usr/include/limits.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/limits.h" 2 3 4
+# 195 "/usr/include/limits.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 2 3 4
+# 161 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 3 4
+# 1 "/usr/include/linux/limits.h" 1 3 4
+# 39 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 2 3 4
+# 81 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 1 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 2 3 4
+# 82 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 2 3 4
+# 162 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 2 3 4
+# 196 "/usr/include/limits.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix2_lim.h" 1 3 4
+# 200 "/usr/include/limits.h" 2 3 4
+# 204 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 2 3 4
+# 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h" 2 3 4
+# 35 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 2 3 4
+# 5 "include/battle.h" 2
+
+# 1 "include/constants/battle.h" 1
+# 7 "include/battle.h" 2
+# 1 "include/constants/battle_script_commands.h" 1
+# 8 "include/battle.h" 2
+# 1 "include/battle_util.h" 1
+# 61 "include/battle_util.h"
+u8 GetBattlerForBattleScript(u8 caseId);
+void PressurePPLose(u8 target, u8 attacker, u16 move);
+void PressurePPLoseOnUsingImprison(u8 attacker);
+void PressurePPLoseOnUsingPerishSong(u8 attacker);
+void MarkBattlerForControllerExec(u8 battlerId);
+void MarkBattlerReceivedLinkData(u8 battlerId);
+void CancelMultiTurnMoves(u8 battler);
+bool8 WasUnableToUseMove(u8 battler);
+void PrepareStringBattle(u16 stringId, u8 battler);
+void ResetSentPokesToOpponentValue(void);
+void OpponentSwitchInResetSentPokesToOpponentValue(u8 battler);
+void UpdateSentPokesToOpponentValue(u8 battler);
+void BattleScriptPush(const u8 *bsPtr);
+void BattleScriptPushCursor(void);
+void BattleScriptPop(void);
+u8 TrySetCantSelectMoveBattleScript(void);
+u8 CheckMoveLimitations(u8 battlerId, u8 unusableMoves, u8 check);
+bool8 AreAllMovesUnusable(void);
+u8 GetImprisonedMovesCount(u8 battlerId, u16 move);
+u8 DoFieldEndTurnEffects(void);
+u8 DoBattlerEndTurnEffects(void);
+bool8 HandleWishPerishSongOnTurnEnd(void);
+bool8 HandleFaintedMonActions(void);
+void TryClearRageStatuses(void);
+u8 AtkCanceller_UnableToUseMove(void);
+bool8 HasNoMonsToSwitch(u8 battler, u8 partyIdBattlerOn1, u8 partyIdBattlerOn2);
+u8 CastformDataTypeChange(u8 battler);
+u8 AbilityBattleEffects(u8 caseID, u8 battler, u8 ability, u8 special, u16 moveArg);
+void BattleScriptExecute(const u8 *BS_ptr);
+void BattleScriptPushCursorAndCallback(const u8 *BS_ptr);
+u8 ItemBattleEffects(u8 caseID, u8 battlerId, bool8 moveTurn);
+void ClearFuryCutterDestinyBondGrudge(u8 battlerId);
+void HandleAction_RunBattleScript(void);
+u8 GetMoveTarget(u16 move, u8 setTarget);
+u8 IsMonDisobedient(void);
+# 9 "include/battle.h" 2
+# 1 "include/battle_script_commands.h" 1
+# 10 "include/battle_script_commands.h"
+void AI_CalcDmg(u8 attacker, u8 defender);
+u8 TypeCalc(u16 move, u8 attacker, u8 defender);
+u8 AI_TypeCalc(u16 move, u16 targetSpecies, u8 targetAbility);
+u8 GetBattlerTurnOrderNum(u8 battlerId);
+void SetMoveEffect(bool8 primary, u8 certain);
+bool32 IsMonGettingExpSentOut(void);
+void BattleDestroyYesNoCursorAt(void);
+void BattleCreateYesNoCursorAt(void);
+void BufferMoveToLearnIntoBattleTextBuff2(void);
+void HandleBattleWindow(u8 xStart, u8 yStart, u8 xEnd, u8 yEnd, u8 flags);
+bool8 UproarWakeUpCheck(u8 battlerId);
+
+extern void (* const gBattleScriptingCommandsTable[])(void);
+# 10 "include/battle.h" 2
+# 1 "include/battle_main.h" 1
+
+
+
+# 1 "include/constants/abilities.h" 1
+# 5 "include/battle_main.h" 2
+
+struct TrainerMoney
+{
+    u8 classId;
+    u8 value;
+};
+
+struct MultiBattlePokemonTx
+{
+             u16 species;
+             u16 heldItem;
+             u8 nickname[10 + 1];
+             u8 level;
+             u16 hp;
+             u16 maxhp;
+             u32 status;
+             u32 personality;
+             u8 gender;
+             u8 language;
+};
+# 48 "include/battle_main.h"
+extern const struct SpriteTemplate gUnknownDebugSprite;
+extern const struct OamData gOamData_BattlerOpponent;
+extern const struct OamData gOamData_BattlerPlayer;
+extern const u8 gTypeNames[][6 + 1];
+extern const u8 gStatusConditionString_PoisonJpn[8];
+extern const u8 gStatusConditionString_SleepJpn[8];
+extern const u8 gStatusConditionString_ParalysisJpn[8];
+extern const u8 gStatusConditionString_BurnJpn[8];
+extern const u8 gStatusConditionString_IceJpn[8];
+extern const u8 gStatusConditionString_ConfusionJpn[8];
+extern const u8 gStatusConditionString_LoveJpn[8];
+extern const u8 *const gStatusConditionStringsTable[7][2];
+extern const u8 gTypeEffectiveness[336];
+extern const struct TrainerMoney gTrainerMoneyTable[];
+extern const u8 *const gAbilityDescriptionPointers[78];
+extern const u8 gAbilityNames[78][12 + 1];
+
+void CB2_InitBattle(void);
+void BattleMainCB2(void);
+void FreeRestoreBattleData(void);
+void VBlankCB_Battle(void);
+void SpriteCB_VsLetterDummy(struct Sprite *sprite);
+void SpriteCB_VsLetterInit(struct Sprite *sprite);
+void CB2_InitEndLinkBattle(void);
+u32 GetBattleBgTemplateData(u8 arrayId, u8 caseId);
+void SpriteCB_EnemyMon(struct Sprite *sprite);
+void SpriteCallbackDummy_2(struct Sprite *sprite);
+void SpriteCB_FaintOpponentMon(struct Sprite *sprite);
+void SpriteCB_ShowAsMoveTarget(struct Sprite *sprite);
+void SpriteCB_HideAsMoveTarget(struct Sprite *sprite);
+void SpriteCB_AllyMon(struct Sprite *sprite);
+void SetIdleSpriteCallback(struct Sprite *sprite);
+void SpriteCB_FaintSlideAnim(struct Sprite *sprite);
+void DoBounceEffect(u8 battler, u8 which, s8 delta, s8 amplitude);
+void EndBounceEffect(u8 battler, u8 which);
+void SpriteCB_PlayerThrowInit(struct Sprite *sprite);
+void UpdatePlayerPosInThrowAnim(struct Sprite *sprite);
+void BeginBattleIntroDummy(void);
+void BeginBattleIntro(void);
+void SwitchInClearSetData(void);
+void FaintClearSetData(void);
+void BattleTurnPassed(void);
+u8 IsRunningFromBattleImpossible(void);
+void UpdatePartyOwnerOnSwitch_NonMulti(u8 battler);
+void SwapTurnOrder(u8 id1, u8 id2);
+u8 GetWhoStrikesFirst(u8 battler1, u8 battler2, bool8 ignoreChosenMoves);
+void RunBattleScriptCommands_PopCallbacksStack(void);
+void RunBattleScriptCommands(void);
+bool8 TryRunFromBattle(u8 battler);
+# 11 "include/battle.h" 2
+# 1 "include/battle_ai_switch_items.h" 1
+
+
+
+
+
+enum {
+    AI_ITEM_FULL_RESTORE = 1,
+    AI_ITEM_HEAL_HP,
+    AI_ITEM_CURE_CONDITION,
+    AI_ITEM_X_STAT,
+    AI_ITEM_GUARD_SPECS,
+    AI_ITEM_NOT_RECOGNIZABLE
+};
+
+enum {
+    AI_HEAL_CONFUSION,
+    AI_HEAL_PARALYSIS,
+    AI_HEAL_FREEZE,
+    AI_HEAL_BURN,
+    AI_HEAL_POISON,
+    AI_HEAL_SLEEP,
+};
+
+void AI_TrySwitchOrUseItem(void);
+u8 GetMostSuitableMonToSwitchInto(void);
+# 12 "include/battle.h" 2
+# 1 "include/battle_gfx_sfx_util.h" 1
+
+
+
+void AllocateBattleSpritesData(void);
+void FreeBattleSpritesData(void);
+void SpriteCB_WaitForBattlerBallReleaseAnim(struct Sprite *sprite);
+void SpriteCB_TrainerSlideIn(struct Sprite *sprite);
+void InitAndLaunchChosenStatusAnimation(bool8 isStatus2, u32 status);
+bool8 TryHandleLaunchBattleTableAnimation(u8 activeBattler, u8 atkBattler, u8 defBattler, u8 tableId, u16 argument);
+void InitAndLaunchSpecialAnimation(u8 activeBattler, u8 atkBattler, u8 defBattler, u8 tableId);
+bool8 IsMoveWithoutAnimation(u16 moveId, u8 animationTurn);
+bool8 IsBattleSEPlaying(u8 battlerId);
+void BattleLoadOpponentMonSpriteGfx(struct Pokemon *mon, u8 battlerId);
+void BattleLoadPlayerMonSpriteGfx(struct Pokemon *mon, u8 battlerId);
+void DecompressGhostFrontPic(struct Pokemon *unused, u8 battlerId);
+void DecompressTrainerFrontPic(u16 frontPicId, u8 battlerId);
+void DecompressTrainerBackPalette(u16 a1, u8 a2);
+void BattleGfxSfxDummy3(u8 gender);
+void FreeTrainerFrontPicPaletteAndTile(u16 frontPicId);
+bool8 BattleLoadAllHealthBoxesGfx(u8 state);
+void LoadBattleBarGfx(u8 arg0);
+bool8 BattleInitAllSprites(u8 *state, u8 *battlerId);
+void ClearSpritesHealthboxAnimData(void);
+void CopyAllBattleSpritesInvisibilities(void);
+void CopyBattleSpriteInvisibility(u8 battlerId);
+void HandleSpeciesGfxDataChange(u8 battlerAtk, u8 battlerDef, u8 transformType);
+void BattleLoadSubstituteOrMonSpriteGfx(u8 battlerId, bool8 loadMonSprite);
+void LoadBattleMonGfxAndAnimate(u8 battlerId, bool8 loadMonSprite, u8 spriteId);
+void TrySetBehindSubstituteSpriteBit(u8 battlerId, u16 move);
+void ClearBehindSubstituteBit(u8 battlerId);
+void HandleLowHpMusicChange(struct Pokemon *mon, u8 battlerId);
+void BattleStopLowHpSound(void);
+void HandleBattleLowHpMusicChange(void);
+void SetBattlerSpriteAffineMode(u8 affineMode);
+void LoadAndCreateEnemyShadowSprites(void);
+void SpriteCB_SetInvisible(struct Sprite *sprite);
+void SetBattlerShadowSpriteCallback(u8 battlerId, u16 species);
+void HideBattlerShadowSprite(u8 battlerId);
+void BattleInterfaceSetWindowPals(void);
+void ClearTemporarySpeciesSpriteData(u8 battlerId, bool8 dontClearSubstitute);
+void AllocateMonSpritesGfx(void);
+void FreeMonSpritesGfx(void);
+bool32 ShouldPlayNormalMonCry(struct Pokemon *mon);
+# 13 "include/battle.h" 2
+# 1 "include/battle_util2.h" 1
+
+
+
+
+
+void AllocateBattleResources(void);
+void FreeBattleResources(void);
+void AdjustFriendshipOnBattleFaint(u8 bank);
+# 14 "include/battle.h" 2
+# 1 "include/battle_bg.h" 1
+
+
+
+# 1 "include/bg.h" 1
+
+
+
+
+
+struct BGCntrlBitfield
+{
+    volatile u16 priority:2;
+    volatile u16 charBaseBlock:2;
+    volatile u16 field_0_2:4;
+    volatile u16 field_1_0:5;
+    volatile u16 areaOverflowMode:1;
+    volatile u16 screenSize:2;
+};
+
+enum
+{
+    BG_CTRL_ATTR_VISIBLE = 1,
+    BG_CTRL_ATTR_CHARBASEINDEX = 2,
+    BG_CTRL_ATTR_MAPBASEINDEX = 3,
+    BG_CTRL_ATTR_SCREENSIZE = 4,
+    BG_CTRL_ATTR_PALETTEMODE = 5,
+    BG_CTRL_ATTR_PRIORITY = 6,
+    BG_CTRL_ATTR_MOSAIC = 7,
+    BG_CTRL_ATTR_WRAPAROUND = 8,
+};
+
+enum
+{
+    BG_ATTR_CHARBASEINDEX = 1,
+    BG_ATTR_MAPBASEINDEX = 2,
+    BG_ATTR_SCREENSIZE = 3,
+    BG_ATTR_PALETTEMODE = 4,
+    BG_ATTR_MOSAIC = 5,
+    BG_ATTR_WRAPAROUND = 6,
+    BG_ATTR_PRIORITY = 7,
+    BG_ATTR_MAPSIZE = 8,
+    BG_ATTR_BGTYPE = 9,
+    BG_ATTR_BASETILE = 10
+};
+
+
+enum {
+    BG_COORD_SET,
+    BG_COORD_ADD,
+    BG_COORD_SUB,
+};
+
+enum AdjustBgMosaicMode
+{
+    BG_MOSAIC_SET,
+    BG_MOSAIC_SET_H,
+    BG_MOSAIC_INC_H,
+    BG_MOSAIC_DEC_H,
+    BG_MOSAIC_SET_V,
+    BG_MOSAIC_INC_V,
+    BG_MOSAIC_DEC_V,
+};
+
+enum BgTileAllocMode
+{
+    BG_TILE_FIND_FREE_SPACE,
+    BG_TILE_ALLOC,
+    BG_TILE_FREE,
+};
+
+struct BgTemplate
+{
+    u16 bg:2;
+    u16 charBaseIndex:2;
+    u16 mapBaseIndex:5;
+    u16 screenSize:2;
+    u16 paletteMode:1;
+    u16 priority:2;
+    u16 baseTile:10;
+};
+
+void ResetBgs(void);
+u8 GetBgMode(void);
+void ResetBgControlStructs(void);
+void Unused_ResetBgControlStruct(u8 bg);
+void SetBgControlAttributes(u8 bg, u8 charBaseIndex, u8 mapBaseIndex, u8 screenSize, u8 paletteMode, u8 priority, u8 mosaic, u8 wraparound);
+u16 GetBgControlAttribute(u8 bg, u8 attributeId);
+u8 LoadBgVram(u8 bg, const void *src, u16 size, u16 destOffset, u8 mode);
+void SetTextModeAndHideBgs(void);
+bool8 IsInvalidBg(u8 bg);
+int BgTileAllocOp(int bg, int offset, int count, int mode);
+void ResetBgsAndClearDma3BusyFlags(bool32 enableWindowTileAutoAlloc);
+void InitBgsFromTemplates(u8 bgMode, const struct BgTemplate *templates, u8 numTemplates);
+void InitBgFromTemplate(const struct BgTemplate *template);
+void SetBgMode(u8 bgMode);
+u16 LoadBgTiles(u8 bg, const void *src, u16 size, u16 destOffset);
+u16 LoadBgTilemap(u8 bg, const void *src, u16 size, u16 destOffset);
+u16 Unused_LoadBgPalette(u8 bg, const void *src, u16 size, u16 destOffset);
+bool8 IsDma3ManagerBusyWithBgCopy(void);
+void ShowBg(u8 bg);
+void HideBg(u8 bg);
+void SetBgAttribute(u8 bg, u8 attributeId, u8 value);
+u16 GetBgAttribute(u8 bg, u8 attributeId);
+u32 ChangeBgX(u8 bg, u32 value, u8 op);
+u32 GetBgX(u8 bg);
+u32 ChangeBgY(u8 bg, u32 value, u8 op);
+u32 ChangeBgY_ScreenOff(u8 bg, u32 value, u8 op);
+u32 GetBgY(u8 bg);
+void SetBgAffine(u8 bg, u32 srcCenterX, u32 srcCenterY, s16 dispCenterX, s16 dispCenterY, s16 scaleX, s16 scaleY, u16 rotationAngle);
+u8 AdjustBgMosaic(u8 value, u8 mode);
+void SetBgTilemapBuffer(u8 bg, void *tilemap);
+void UnsetBgTilemapBuffer(u8 bg);
+void *GetBgTilemapBuffer(u8 bg);
+void CopyToBgTilemapBuffer(u8 bg, const void *src, u16 mode, u16 destOffset);
+void CopyBgTilemapBufferToVram(u8 bg);
+void CopyToBgTilemapBufferRect(u8 bg, const void *src, u8 destX, u8 destY, u8 width, u8 height);
+void CopyToBgTilemapBufferRect_ChangePalette(u8 bg, const void *src, u8 destX, u8 destY, u8 rectWidth, u8 rectHeight, u8 palette);
+void CopyRectToBgTilemapBufferRect(u8 bg, const void *src, u8 srcX, u8 srcY, u8 srcWidth, u8 srcHeight, u8 destX, u8 destY, u8 rectWidth, u8 rectHeight, u8 palette1, s16 tileOffset, s16 palette2);
+void FillBgTilemapBufferRect_Palette0(u8 bg, u16 tileNum, u8 x, u8 y, u8 width, u8 height);
+void FillBgTilemapBufferRect(u8 bg, u16 tileNum, u8 x, u8 y, u8 width, u8 height, u8 palette);
+void WriteSequenceToBgTilemapBuffer(u8 bg, u16 firstTileNum, u8 x, u8 y, u8 width, u8 height, u8 paletteSlot, s16 tileNumDelta);
+u16 GetBgMetricTextMode(u8 bg, u8 whichMetric);
+u32 GetBgMetricAffineMode(u8 bg, u8 whichMetric);
+u32 GetTileMapIndexFromCoords(s32 x, s32 y, s32 screenSize, u32 screenWidth, u32 screenHeight);
+void CopyTileMapEntry(const u16 *src, u16 *dest, s32 palette1, s32 tileOffset, s32 palette2);
+u32 GetBgType(u8 bg);
+bool32 IsInvalidBg32(u8 bg);
+bool32 IsTileMapOutsideWram(u8 bg);
+
+extern bool32 gWindowTileAutoAllocEnabled;
+# 5 "include/battle_bg.h" 2
+
+extern const struct BgTemplate gBattleBgTemplates[];
+
+void InitBattleBgsVideo(void);
+void DrawBattleEntryBackground(void);
+void InitLinkBattleVsScreen(u8 taskId);
+void LoadBattleMenuWindowGfx(void);
+void LoadBattleTextboxAndBackground(void);
+void BattleInitBgsAndWindows(void);
+void DrawMainBattleBackground(void);
+# 15 "include/battle.h" 2
+# 53 "include/battle.h"
+enum {
+    BATTLER_AFFINE_NORMAL,
+    BATTLER_AFFINE_EMERGE,
+    BATTLER_AFFINE_RETURN,
+};
+# 71 "include/battle.h"
+struct TrainerMonNoItemDefaultMoves
+{
+    u16 iv;
+    u8 lvl;
+    u16 species;
+};
+
+struct TrainerMonItemDefaultMoves
+{
+    u16 iv;
+    u8 lvl;
+    u16 species;
+    u16 heldItem;
+};
+
+struct TrainerMonNoItemCustomMoves
+{
+    u16 iv;
+    u8 lvl;
+    u16 species;
+    u16 moves[4];
+};
+
+struct TrainerMonItemCustomMoves
+{
+    u16 iv;
+    u8 lvl;
+    u16 species;
+    u16 heldItem;
+    u16 moves[4];
+};
+
+
+
+
+
+
+union TrainerMonPtr
+{
+    const struct TrainerMonNoItemDefaultMoves *NoItemDefaultMoves;
+    const struct TrainerMonNoItemCustomMoves *NoItemCustomMoves;
+    const struct TrainerMonItemDefaultMoves *ItemDefaultMoves;
+    const struct TrainerMonItemCustomMoves *ItemCustomMoves;
+};
+
+struct Trainer
+{
+             u8 partyFlags;
+             u8 trainerClass;
+             u8 encounterMusic_gender;
+             u8 trainerPic;
+             u8 trainerName[12];
+             u16 items[4];
+             bool8 doubleBattle;
+             u32 aiFlags;
+             u8 partySize;
+             const union TrainerMonPtr party;
+};
+
+extern const struct Trainer gTrainers[];
+
+struct ResourceFlags
+{
+    u32 flags[4];
+};
+
+
+
+struct DisableStruct
+{
+             u32 transformedMonPersonality;
+             u16 disabledMove;
+             u16 encoredMove;
+             u8 protectUses;
+             u8 stockpileCounter;
+             u8 substituteHP;
+             u8 disableTimer : 4;
+             u8 disableTimerStartValue : 4;
+             u8 encoredMovePos;
+             u8 unkD;
+             u8 encoreTimer : 4;
+             u8 encoreTimerStartValue : 4;
+             u8 perishSongTimer : 4;
+             u8 perishSongTimerStartValue : 4;
+             u8 furyCutterCounter;
+             u8 rolloutTimer : 4;
+             u8 rolloutTimerStartValue : 4;
+             u8 chargeTimer : 4;
+             u8 chargeTimerStartValue : 4;
+             u8 tauntTimer:4;
+             u8 tauntTimer2:4;
+             u8 battlerPreventingEscape;
+             u8 battlerWithSureHit;
+             u8 isFirstTurn;
+             u8 unk17;
+             u8 truantCounter : 1;
+             u8 truantSwitchInHack : 1;
+             u8 unk18_a_2 : 2;
+             u8 mimickedMoves : 4;
+             u8 rechargeTimer;
+             u8 unk1A[2];
+};
+
+extern struct DisableStruct gDisableStructs[4];
+
+struct ProtectStruct
+{
+
+    u32 protected:1;
+    u32 endured:1;
+    u32 noValidMoves:1;
+    u32 helpingHand:1;
+    u32 bounceMove:1;
+    u32 stealMove:1;
+    u32 flag0Unknown:1;
+    u32 prlzImmobility:1;
+
+    u32 confusionSelfDmg:1;
+    u32 targetNotAffected:1;
+    u32 chargingTurn:1;
+    u32 fleeType:2;
+    u32 usedImprisonedMove:1;
+    u32 loveImmobility:1;
+    u32 usedDisabledMove:1;
+
+    u32 usedTauntedMove:1;
+    u32 flag2Unknown:1;
+    u32 flinchImmobility:1;
+    u32 notFirstStrike:1;
+    u32 flag_x10 : 1;
+    u32 flag_x20 : 1;
+    u32 flag_x40 : 1;
+    u32 flag_x80 : 1;
+    u32 field3 : 8;
+
+    u32 physicalDmg;
+    u32 specialDmg;
+    u8 physicalBattlerId;
+    u8 specialBattlerId;
+    u16 fieldE;
+};
+
+extern struct ProtectStruct gProtectStructs[4];
+
+struct SpecialStatus
+{
+    u8 statLowered:1;
+    u8 lightningRodRedirected:1;
+    u8 restoredBattlerSprite:1;
+    u8 intimidatedMon:1;
+    u8 traced:1;
+    u8 ppNotAffectedByPressure:1;
+    u8 faintedHasReplacement:1;
+    u8 focusBanded:1;
+    u8 field1[3];
+    s32 dmg;
+    s32 physicalDmg;
+    s32 specialDmg;
+    u8 physicalBattlerId;
+    u8 specialBattlerId;
+    u8 field12;
+    u8 field13;
+};
+
+extern struct SpecialStatus gSpecialStatuses[4];
+
+struct SideTimer
+{
+             u8 reflectTimer;
+             u8 reflectBattlerId;
+             u8 lightscreenTimer;
+             u8 lightscreenBattlerId;
+             u8 mistTimer;
+             u8 mistBattlerId;
+             u8 safeguardTimer;
+             u8 safeguardBattlerId;
+             u8 followmeTimer;
+             u8 followmeTarget;
+             u8 spikesAmount;
+             u8 fieldB;
+};
+
+extern struct SideTimer gSideTimers[];
+
+struct WishFutureKnock
+{
+    u8 futureSightCounter[4];
+    u8 futureSightAttacker[4];
+    s32 futureSightDmg[4];
+    u16 futureSightMove[4];
+    u8 wishCounter[4];
+    u8 wishMonId[4];
+    u8 weatherDuration;
+    u8 knockedOffMons[2];
+};
+
+extern struct WishFutureKnock gWishFutureKnock;
+
+struct AI_ThinkingStruct
+{
+    u8 aiState;
+    u8 movesetIndex;
+    u16 moveConsidered;
+    s8 score[4];
+    u32 funcResult;
+    u32 aiFlags;
+    u8 aiAction;
+    u8 aiLogicId;
+    u8 filler12[6];
+    u8 simulatedRNG[4];
+};
+
+extern u8 gActiveBattler;
+extern u8 gBattlerTarget;
+extern u8 gAbsentBattlerFlags;
+
+extern struct BattlePokemon gBattleMons[4];
+
+struct UsedMoves
+{
+    u16 moves[4];
+    u16 unknown[4];
+};
+
+struct BattleHistory
+{
+             u16 usedMoves[2][8];
+             u8 abilities[4 / 2];
+             u8 itemEffects[4 / 2];
+             u16 trainerItems[4];
+             u8 itemsNo;
+};
+
+struct BattleScriptsStack
+{
+    const u8 *ptr[8];
+    u8 size;
+};
+
+struct BattleCallbacksStack
+{
+    void (*function[8])(void);
+    u8 size;
+};
+
+struct StatsArray
+{
+    u16 stats[6];
+};
+
+struct BattleResources
+{
+    struct SecretBaseRecord *secretBase;
+    struct ResourceFlags *flags;
+    struct BattleScriptsStack *battleScriptsStack;
+    struct BattleCallbacksStack *battleCallbackStack;
+    struct StatsArray *beforeLvlUp;
+    struct AI_ThinkingStruct *ai;
+    struct BattleHistory *battleHistory;
+    struct BattleScriptsStack *AI_ScriptsStack;
+};
+
+extern struct BattleResources *gBattleResources;
+
+struct BattleResults
+{
+    u8 playerFaintCounter;
+    u8 opponentFaintCounter;
+    u8 playerSwitchesCounter;
+    u8 numHealingItemsUsed;
+    u8 numRevivesUsed;
+    u8 playerMonWasDamaged:1;
+    u8 usedMasterBall:1;
+    u8 caughtMonBall:4;
+    u8 shinyWildMon:1;
+    u8 unk5_7:1;
+    u16 playerMon1Species;
+    u8 playerMon1Name[11];
+    u8 battleTurnCounter;
+    u8 playerMon2Name[11];
+    u8 pokeblockThrows;
+    u16 lastOpponentSpecies;
+    u16 lastUsedMovePlayer;
+    u16 lastUsedMoveOpponent;
+    u16 playerMon2Species;
+    u16 caughtMonSpecies;
+    u8 caughtMonNick[10];
+    u8 filler34[2];
+    u8 catchAttempts[11];
+};
+
+extern struct BattleResults gBattleResults;
+
+struct LinkBattlerHeader
+{
+    u8 versionSignatureLo;
+    u8 versionSignatureHi;
+    u8 vsScreenHealthFlagsLo;
+    u8 vsScreenHealthFlagsHi;
+    struct BattleEnigmaBerry battleEnigmaBerry;
+};
+
+struct BattleStruct
+{
+    u8 turnEffectsTracker;
+    u8 turnEffectsBattlerId;
+    u8 filler2;
+    u8 turnCountersTracker;
+    u8 wrappedMove[4 * 2];
+    u8 moveTarget[4];
+    u8 expGetterMonId;
+    u8 field_11;
+    u8 wildVictorySong;
+    u8 dynamicMoveType;
+    u8 wrappedBy[4];
+    u16 assistPossibleMoves[6 * 4];
+    u8 focusPunchBattlerId;
+    u8 battlerPreventingSwitchout;
+    u8 moneyMultiplier;
+    u8 savedTurnActionNumber;
+    u8 switchInAbilitiesCounter;
+    u8 faintedActionsState;
+    u8 faintedActionsBattlerId;
+
+    u16 expValue;
+    u8 scriptPartyIdx;
+    u8 sentInPokes;
+    bool8 selectionScriptFinished[4];
+    u8 battlerPartyIndexes[4];
+    u8 monToSwitchIntoId[4];
+    u8 battlerPartyOrders[4][3];
+    u8 runTries;
+    u8 caughtMonNick[10 + 1];
+    u8 field_78;
+    u8 safariRockThrowCounter;
+    u8 safariBaitThrowCounter;
+    u8 safariEscapeFactor;
+    u8 safariCatchFactor;
+    u8 linkBattleVsSpriteId_V;
+    u8 linkBattleVsSpriteId_S;
+    u8 formToChangeInto;
+    u8 chosenMovePositions[4];
+    u8 stateIdAfterSelScript[4];
+    u8 field_88;
+    u8 field_89;
+    u8 field_8A;
+    u8 playerPartyIdx;
+    u8 field_8C;
+    u8 field_8D;
+    u8 stringMoveType;
+    u8 expGetterBattlerId;
+    u8 field_90;
+    u8 absentBattlerFlags;
+    u8 AI_monToSwitchIntoId[2];
+    u8 simulatedInputState[4];
+    u8 lastTakenMove[4 * 2 * 2];
+    u16 hpOnSwitchout[2];
+    u8 abilityPreventingSwitchout;
+    u8 hpScale;
+    u16 savedBattleTypeFlags;
+    void (*savedCallback)(void);
+    u8 synchronizeMoveEffect;
+    u8 multiplayerId;
+    u8 overworldWeatherDone;
+    u8 atkCancellerTracker;
+    u16 usedHeldItems[4];
+    u8 chosenItem[4];
+    u8 AI_itemType[2];
+    u8 AI_itemFlags[2];
+    u16 choicedMove[4];
+    u16 changedItems[4];
+    u8 intimidateBattler;
+    u8 switchInItemsCounter;
+    u8 field_DA;
+    u8 turnSideTracker;
+    u8 fillerDC[0xDF-0xDC];
+    u8 givenExpMons;
+    u8 lastTakenMoveFrom[4 * 4 * 2];
+    u16 castformPalette[4][16];
+    u8 wishPerishSongState;
+    u8 wishPerishSongBattlerId;
+    u8 field_182;
+
+    union {
+        struct LinkBattlerHeader linkBattlerHeader;
+        struct MultiBattlePokemonTx multiBattleMons[3];
+    } multiBuffer;
+    u8 padding_1E4[0x1C];
+};
+
+extern struct BattleStruct *gBattleStruct;
+# 496 "include/battle.h"
+struct BattleScripting
+{
+    s32 painSplitHp;
+    s32 bideDmg;
+    u8 multihitString[6];
+    u8 dmgMultiplier;
+    u8 twoTurnsMoveStringId;
+    u8 animArg1;
+    u8 animArg2;
+    u16 tripleKickPower;
+    u8 moveendState;
+    u8 battlerWithAbility;
+    u8 multihitMoveEffect;
+    u8 battler;
+    u8 animTurn;
+    u8 animTargetsHit;
+    u8 statChanger;
+    bool8 statAnimPlayed;
+    u8 getexpState;
+    u8 battleStyle;
+    u8 drawlvlupboxState;
+    u8 learnMoveState;
+    u8 pursuitDoublesAttacker;
+    u8 reshowMainState;
+    u8 reshowHelperState;
+    u8 levelUpHP;
+};
+
+struct BattleSpriteInfo
+{
+            u16 invisible : 1;
+            u16 lowHpSong : 1;
+            u16 behindSubstitute : 1;
+            u16 flag_x8 : 1;
+            u16 hpNumbersNoBars : 1;
+            u16 transformSpecies;
+};
+
+struct BattleAnimationInfo
+{
+    u16 animArg;
+    u8 field_2;
+    u8 field_3;
+    u8 field_4;
+    u8 field_5;
+    u8 field_6;
+    u8 field_7;
+    u8 ballThrowCaseId;
+    u8 introAnimActive:1;
+    u8 wildMonInvisible:1;
+    u8 field_9_x1C:3;
+    u8 field_9_x20:1;
+    u8 field_9_x40:1;
+    u8 field_9_x80:1;
+    u8 numBallParticles;
+    u8 field_B;
+    s16 ballSubpx;
+    u8 field_E;
+    u8 field_F;
+};
+
+struct BattleHealthboxInfo
+{
+    u8 partyStatusSummaryShown : 1;
+    u8 healthboxIsBouncing : 1;
+    u8 battlerIsBouncing : 1;
+    u8 ballAnimActive : 1;
+    u8 statusAnimActive : 1;
+    u8 animFromTableActive : 1;
+    u8 specialAnimActive : 1;
+    u8 triedShinyMonAnim : 1;
+    u8 finishedShinyMonAnim : 1;
+    u8 opponentDrawPartyStatusSummaryDelay : 5;
+    u8 healthboxBounceSpriteId;
+    u8 battlerBounceSpriteId;
+    u8 animationState;
+    u8 partyStatusDelayTimer;
+    u8 matrixNum;
+    u8 shadowSpriteId;
+    u8 soundTimer;
+    u8 introEndDelay;
+};
+
+struct BattleBarInfo
+{
+    u8 healthboxSpriteId;
+    s32 maxValue;
+    s32 oldValue;
+    s32 receivedValue;
+    s32 currValue;
+};
+
+struct BattleSpriteData
+{
+    struct BattleSpriteInfo *battlerData;
+    struct BattleHealthboxInfo *healthBoxesData;
+    struct BattleAnimationInfo *animationData;
+    struct BattleBarInfo *battleBars;
+};
+
+extern struct BattleSpriteData *gBattleSpritesDataPtr;
+
+
+
+extern u8 *gLinkBattleSendBuffer;
+extern u8 *gLinkBattleRecvBuffer;
+
+
+
+
+
+struct MonSpritesGfx
+{
+    void *firstDecompressed;
+    void *sprites[4];
+    struct SpriteTemplate templates[4];
+    struct SpriteFrameImage images[4][4];
+    u8 field_F4[0x80];
+    u8 *barFontGfx;
+    void *field_178;
+    u16 *multiUseBuffer;
+};
+
+struct PokedudeBattlerState
+{
+    u8 action_idx;
+    u8 move_idx;
+    u8 timer;
+    u8 msg_idx;
+    u8 saved_bg0y;
+};
+
+extern u16 gBattle_BG0_X;
+extern u16 gBattle_BG0_Y;
+extern u16 gBattle_BG1_X;
+extern u16 gBattle_BG1_Y;
+extern u16 gBattle_BG2_X;
+extern u16 gBattle_BG2_Y;
+extern u16 gBattle_BG3_X;
+extern u16 gBattle_BG3_Y;
+extern u16 gBattle_WIN0H;
+extern u16 gBattle_WIN0V;
+extern u16 gBattle_WIN1H;
+extern u16 gBattle_WIN1V;
+extern struct BattleSpritesGfx *gMonSpritesGfx;
+extern u8 gBattleOutcome;
+extern u16 gLastUsedItem;
+extern u32 gBattleTypeFlags;
+extern struct MonSpritesGfx *gMonSpritesGfxPtr;
+extern u16 gTrainerBattleOpponent_A;
+extern u16 gMoveToLearn;
+extern u16 gBattleMovePower;
+extern struct BattleEnigmaBerry gEnigmaBerries[4];
+extern u16 gCurrentMove;
+extern u16 gChosenMove;
+extern u16 gCalledMove;
+extern u8 gCritMultiplier;
+extern u16 gBattleWeather;
+extern u8 gLastUsedAbility;
+extern u8 gBattlerInMenuId;
+extern u8 gPotentialItemEffectBattler;
+extern u8 gBattlersCount;
+extern u16 gBattlerPartyIndexes[4];
+extern s32 gBattleMoveDamage;
+extern u16 gIntroSlideFlags;
+extern u32 gTransformedPersonalities[4];
+extern u8 gBattlerPositions[4];
+extern u8 gHealthboxSpriteIds[4];
+extern u8 gBattleOutcome;
+extern u8 gBattleMonForms[4];
+extern void (*gBattlerControllerFuncs[4])(void);
+extern u32 gBattleControllerExecFlags;
+extern u8 gBattleBufferA[4][0x200];
+extern u8 gBattleBufferB[4][0x200];
+extern u8 gActionSelectionCursor[4];
+extern void (*gPreBattleCallback1)(void);
+extern bool8 gDoingBattleAnim;
+extern struct PokedudeBattlerState *gPokedudeBattlerStates[4];
+extern u8 *gBattleAnimBgTileBuffer;
+extern u8 *gBattleAnimBgTilemapBuffer;
+extern void (*gBattleMainFunc)(void);
+extern u8 gMoveSelectionCursor[4];
+extern u32 gUnusedFirstBattleVar1;
+extern u8 gUnusedFirstBattleVar2;
+extern u8 gBattlerAttacker;
+extern u8 gEffectBattler;
+extern u8 gMultiHitCounter;
+extern struct BattleScripting gBattleScripting;
+extern u8 gBattlerFainted;
+extern u32 gStatuses3[4];
+extern u8 gSentPokesToOpponent[2];
+extern const u8 *gBattlescriptCurrInstr;
+extern const u8 *gSelectionBattleScripts[4];
+extern u16 gLastMoves[4];
+extern u8 gBattlerByTurnOrder[4];
+extern u8 gBattleCommunication[8];
+extern u16 gSideStatuses[2];
+extern u32 gHitMarker;
+extern u16 gChosenMoveByBattler[4];
+extern u8 gMoveResultFlags;
+extern s32 gTakenDmg[4];
+extern u8 gTakenDmgByBattler[4];
+extern u8 gCurrentActionFuncId;
+extern u8 gCurrMovePos;
+extern u8 gChosenMovePos;
+extern u8 gBattleControllerData[4];
+extern u8 gBattlerStatusSummaryTaskId[4];
+extern u16 gDynamicBasePower;
+extern u16 gLastLandedMoves[4];
+extern u8 gLastHitBy[4];
+extern u8 gMultiUsePlayerCursor;
+extern u8 gNumberOfMovesToChoose;
+extern u16 gLastHitByType[4];
+extern s32 gHpDealt;
+extern u16 gPauseCounterBattle;
+extern u16 gPaydayMoney;
+extern u16 gLockedMoves[4];
+extern u8 gCurrentTurnActionNumber;
+extern u16 gExpShareExp;
+extern u8 gLeveledUpInBattle;
+extern u16 gLastResultingMoves[4];
+extern u16 gLastPrintedMoves[4];
+extern u8 gActionsByTurnOrder[4];
+extern u8 gChosenActionByBattler[4];
+extern u8 gBattleTerrain;
+extern struct MultiBattlePokemonTx gMultiPartnerParty[3];
+extern u16 gRandomTurnNumber;
+# 13 "src/battle_util.c" 2
+# 1 "include/battle_anim.h" 1
+
+
+
+# 1 "include/battle.h" 1
+# 5 "include/battle_anim.h" 2
+# 1 "include/data.h" 1
+# 9 "include/data.h"
+struct MonCoords
+{
+
+
+    u8 size;
+    u8 y_offset;
+};
+
+
+
+
+
+extern const u8 gSpeciesNames[][10 + 1];
+extern const u8 gMoveNames[][12 + 1];
+
+extern const u8 gTrainerClassNames[][13];
+
+extern const struct MonCoords gMonFrontPicCoords[];
+extern const struct CompressedSpriteSheet gMonFrontPicTable[];
+extern const struct MonCoords gMonBackPicCoords[];
+extern const struct CompressedSpriteSheet gMonBackPicTable[];
+extern const struct CompressedSpritePalette gMonPaletteTable[];
+extern const struct CompressedSpritePalette gMonShinyPaletteTable[];
+extern const union AnimCmd *const *const gTrainerFrontAnimsPtrTable[];
+extern const struct MonCoords gTrainerFrontPicCoords[];
+extern const struct CompressedSpriteSheet gTrainerFrontPicTable[];
+extern const struct CompressedSpriteSheet gTrainerBackPicTable[];
+extern const struct CompressedSpritePalette gTrainerFrontPicPaletteTable[];
+extern const union AnimCmd *const *const gTrainerBackAnimsPtrTable[];
+extern const struct MonCoords gTrainerBackPicCoords[];
+extern const struct CompressedSpritePalette gTrainerBackPicPaletteTable[];
+
+extern const struct CompressedSpriteSheet gSpriteSheet_EnemyShadow;
+extern const struct SpriteTemplate gSpriteTemplate_EnemyShadow;
+
+extern const u8 gEnemyMonElevation[412];
+
+extern const u8 *const gBattleAnims_General[];
+extern const u8 *const gBattleAnims_Special[];
+
+extern const union AnimCmd *const gAnims_MonPic[];
+extern const union AffineAnimCmd *const gAffineAnims_BattleSpritePlayerSide[];
+extern const union AffineAnimCmd *const gAffineAnims_BattleSpriteOpponentSide[];
+extern const struct SpriteFrameImage gBattlerPicTable_PlayerLeft[];
+extern const struct SpriteFrameImage gBattlerPicTable_OpponentLeft[];
+extern const struct SpriteFrameImage gBattlerPicTable_PlayerRight[];
+extern const struct SpriteFrameImage gBattlerPicTable_OpponentRight[];
+extern const struct SpriteFrameImage gTrainerBackPicTable_Red[];
+extern const struct SpriteFrameImage gTrainerBackPicTable_Leaf[];
+extern const struct SpriteFrameImage gTrainerBackPicTable_Pokedude[];
+extern const struct SpriteFrameImage gTrainerBackPicTable_OldMan[];
+extern const struct SpriteFrameImage gTrainerBackPicTable_RSBrendan[];
+extern const struct SpriteFrameImage gTrainerBackPicTable_RSMay[];
+# 6 "include/battle_anim.h" 2
+# 1 "include/task.h" 1
+# 13 "include/task.h"
+typedef void (*TaskFunc)(u8 taskId);
+
+struct Task
+{
+    TaskFunc func;
+    bool8 isActive;
+    u8 prev;
+    u8 next;
+    u8 priority;
+    s16 data[16];
+};
+
+extern struct Task gTasks[];
+
+void ResetTasks(void);
+u8 CreateTask(TaskFunc func, u8 priority);
+void DestroyTask(u8 taskId);
+void RunTasks(void);
+void TaskDummy(u8 taskId);
+void SetTaskFuncWithFollowupFunc(u8 taskId, TaskFunc func, TaskFunc followupFunc);
+void SwitchTaskToFollowupFunc(u8 taskId);
+bool8 FuncIsActiveTask(TaskFunc func);
+u8 FindTaskIdByFunc(TaskFunc func);
+u8 GetTaskCount(void);
+void SetWordTaskArg(u8 taskId, u8 dataElem, unsigned long value);
+u32 GetWordTaskArg(u8 taskId, u8 dataElem);
+# 7 "include/battle_anim.h" 2
+# 1 "include/constants/battle_anim.h" 1
+# 8 "include/battle_anim.h" 2
+
+enum
+{
+    BG_ANIM_SCREEN_SIZE,
+    BG_ANIM_AREA_OVERFLOW_MODE,
+    BG_ANIM_MOSAIC,
+    BG_ANIM_CHAR_BASE_BLOCK,
+    BG_ANIM_PRIORITY,
+    BG_ANIM_PALETTES_MODE,
+    BG_ANIM_SCREEN_BASE_BLOCK
+};
+
+enum
+{
+    BATTLER_COORD_X,
+    BATTLER_COORD_Y,
+    BATTLER_COORD_X_2,
+    BATTLER_COORD_Y_PIC_OFFSET,
+    BATTLER_COORD_Y_PIC_OFFSET_DEFAULT,
+};
+
+enum
+{
+    BATTLER_COORD_ATTR_HEIGHT,
+    BATTLER_COORD_ATTR_WIDTH,
+    BATTLER_COORD_ATTR_TOP,
+    BATTLER_COORD_ATTR_BOTTOM,
+    BATTLER_COORD_ATTR_LEFT,
+    BATTLER_COORD_ATTR_RIGHT,
+    BATTLER_COORD_ATTR_RAW_BOTTOM,
+};
+# 50 "include/battle_anim.h"
+struct BattleAnimBgData
+{
+    u8 *bgTiles;
+    u16 *bgTilemap;
+    u8 paletteId;
+    u8 bgId;
+    u16 tilesOffset;
+    u16 unused;
+};
+
+struct BattleAnimBackground
+{
+    const u32 *image;
+    const u32 *palette;
+    const u32 *tilemap;
+};
+# 78 "include/battle_anim.h"
+extern void (*gAnimScriptCallback)(void);
+extern bool8 gAnimScriptActive;
+extern u8 gAnimVisualTaskCount;
+extern u8 gAnimSoundTaskCount;
+extern struct DisableStruct *gAnimDisableStructPtr;
+extern u16 gAnimMovePower;
+extern u8 gAnimFriendship;
+extern u16 gWeatherMoveAnim;
+extern s16 gBattleAnimArgs[8];
+extern u8 gAnimMoveTurn;
+extern u8 gBattleAnimAttacker;
+extern u8 gBattleAnimTarget;
+extern u8 gBattlerSpriteIds[4];
+extern s32 gAnimMoveDmg;
+extern u16 gAnimBattlerSpecies[4];
+extern u8 gAnimCustomPanning;
+
+extern const struct OamData gOamData_AffineOff_ObjNormal_8x8;
+extern const struct OamData gOamData_AffineOff_ObjNormal_16x16;
+extern const struct OamData gOamData_AffineOff_ObjNormal_32x32;
+extern const struct OamData gOamData_AffineOff_ObjNormal_64x64;
+extern const struct OamData gOamData_AffineOff_ObjNormal_16x8;
+extern const struct OamData gOamData_AffineOff_ObjNormal_32x8;
+extern const struct OamData gOamData_AffineOff_ObjNormal_32x16;
+extern const struct OamData gOamData_AffineOff_ObjNormal_64x32;
+extern const struct OamData gOamData_AffineOff_ObjNormal_8x16;
+extern const struct OamData gOamData_AffineOff_ObjNormal_8x32;
+extern const struct OamData gOamData_AffineOff_ObjNormal_16x32;
+extern const struct OamData gOamData_AffineOff_ObjNormal_32x64;
+extern const struct OamData gOamData_AffineNormal_ObjNormal_8x8;
+extern const struct OamData gOamData_AffineNormal_ObjNormal_16x16;
+extern const struct OamData gOamData_AffineNormal_ObjNormal_32x32;
+extern const struct OamData gOamData_AffineNormal_ObjNormal_64x64;
+extern const struct OamData gOamData_AffineNormal_ObjNormal_16x8;
+extern const struct OamData gOamData_AffineNormal_ObjNormal_32x8;
+extern const struct OamData gOamData_AffineNormal_ObjNormal_32x16;
+extern const struct OamData gOamData_AffineNormal_ObjNormal_64x32;
+extern const struct OamData gOamData_AffineNormal_ObjNormal_8x16;
+extern const struct OamData gOamData_AffineNormal_ObjNormal_8x32;
+extern const struct OamData gOamData_AffineNormal_ObjNormal_16x32;
+extern const struct OamData gOamData_AffineNormal_ObjNormal_32x64;
+extern const struct OamData gOamData_AffineDouble_ObjNormal_8x8;
+extern const struct OamData gOamData_AffineDouble_ObjNormal_16x16;
+extern const struct OamData gOamData_AffineDouble_ObjNormal_32x32;
+extern const struct OamData gOamData_AffineDouble_ObjNormal_64x64;
+extern const struct OamData gOamData_AffineDouble_ObjNormal_16x8;
+extern const struct OamData gOamData_AffineDouble_ObjNormal_32x8;
+extern const struct OamData gOamData_AffineDouble_ObjNormal_32x16;
+extern const struct OamData gOamData_AffineDouble_ObjNormal_64x32;
+extern const struct OamData gOamData_AffineDouble_ObjNormal_8x16;
+extern const struct OamData gOamData_AffineDouble_ObjNormal_8x32;
+extern const struct OamData gOamData_AffineDouble_ObjNormal_16x32;
+extern const struct OamData gOamData_AffineDouble_ObjNormal_32x64;
+extern const struct OamData gOamData_AffineOff_ObjBlend_8x8;
+extern const struct OamData gOamData_AffineOff_ObjBlend_16x16;
+extern const struct OamData gOamData_AffineOff_ObjBlend_32x32;
+extern const struct OamData gOamData_AffineOff_ObjBlend_64x64;
+extern const struct OamData gOamData_AffineOff_ObjBlend_16x8;
+extern const struct OamData gOamData_AffineOff_ObjBlend_32x8;
+extern const struct OamData gOamData_AffineOff_ObjBlend_32x16;
+extern const struct OamData gOamData_AffineOff_ObjBlend_64x32;
+extern const struct OamData gOamData_AffineOff_ObjBlend_8x16;
+extern const struct OamData gOamData_AffineOff_ObjBlend_8x32;
+extern const struct OamData gOamData_AffineOff_ObjBlend_16x32;
+extern const struct OamData gOamData_AffineOff_ObjBlend_32x64;
+extern const struct OamData gOamData_AffineNormal_ObjBlend_8x8;
+extern const struct OamData gOamData_AffineNormal_ObjBlend_16x16;
+extern const struct OamData gOamData_AffineNormal_ObjBlend_32x32;
+extern const struct OamData gOamData_AffineNormal_ObjBlend_64x64;
+extern const struct OamData gOamData_AffineNormal_ObjBlend_16x8;
+extern const struct OamData gOamData_AffineNormal_ObjBlend_32x8;
+extern const struct OamData gOamData_AffineNormal_ObjBlend_32x16;
+extern const struct OamData gOamData_AffineNormal_ObjBlend_64x32;
+extern const struct OamData gOamData_AffineNormal_ObjBlend_8x16;
+extern const struct OamData gOamData_AffineNormal_ObjBlend_8x32;
+extern const struct OamData gOamData_AffineNormal_ObjBlend_16x32;
+extern const struct OamData gOamData_AffineNormal_ObjBlend_32x64;
+extern const struct OamData gOamData_AffineDouble_ObjBlend_8x8;
+extern const struct OamData gOamData_AffineDouble_ObjBlend_16x16;
+extern const struct OamData gOamData_AffineDouble_ObjBlend_32x32;
+extern const struct OamData gOamData_AffineDouble_ObjBlend_64x64;
+extern const struct OamData gOamData_AffineDouble_ObjBlend_16x8;
+extern const struct OamData gOamData_AffineDouble_ObjBlend_32x8;
+extern const struct OamData gOamData_AffineDouble_ObjBlend_32x16;
+extern const struct OamData gOamData_AffineDouble_ObjBlend_64x32;
+extern const struct OamData gOamData_AffineDouble_ObjBlend_8x16;
+extern const struct OamData gOamData_AffineDouble_ObjBlend_8x32;
+extern const struct OamData gOamData_AffineDouble_ObjBlend_16x32;
+extern const struct OamData gOamData_AffineDouble_ObjBlend_32x64;
+extern const struct MonCoords gCastformFrontSpriteCoords[];
+extern const struct CompressedSpriteSheet gBattleAnimPicTable[];
+extern const struct CompressedSpritePalette gBattleAnimPaletteTable[];
+extern const struct SpriteTemplate gFlashingHitSplatSpriteTemplate;
+extern const struct SpriteTemplate gBasicHitSplatSpriteTemplate;
+extern const struct SpriteTemplate gWaterHitSplatSpriteTemplate;
+extern const struct SpriteTemplate gWishStarSpriteTemplate;
+extern const struct SpriteTemplate gMiniTwinklingStarSpriteTemplate;
+extern const struct SpriteTemplate gThoughtBubbleSpriteTemplate;
+extern const union AffineAnimCmd *const gAffineAnims_Bite[];
+extern const union AffineAnimCmd *const gAffineAnims_Droplet[];
+extern const union AffineAnimCmd *const gGrowingRingAffineAnimTable[];
+extern const union AnimCmd *const gAnims_SmallBubblePair[];
+extern const union AnimCmd *const gAnims_BasicFire[];
+extern const union AnimCmd *const gAnims_WaterMudOrb[];
+extern const union AnimCmd *const gAnims_WaterBubble[];
+extern const union AnimCmd *const gMusicNotesAnimTable[];
+extern const u8 *const gBattleAnims_StatusConditions[];
+extern const u8 *const gBattleAnims_Moves[];
+extern const u16 gMovesWithQuietBGM[];
+
+void MoveBattlerSpriteToBG(u8 battlerId, u8);
+void ResetBattleAnimBg(u8);
+void ClearBattleAnimationVars(void);
+void DoMoveAnim(u16 move);
+void LaunchBattleAnimation(const u8 *const animsTable[], u16 tableId, bool8 isMoveAnim);
+void DestroyAnimSprite(struct Sprite *sprite);
+void DestroyAnimVisualTask(u8 taskId);
+void DestroyAnimSoundTask(u8 taskId);
+bool8 IsContest(void);
+s8 BattleAnimAdjustPanning(s8 pan);
+s8 BattleAnimAdjustPanning2(s8 pan);
+s16 CalculatePanIncrement(s16 sourcePan, s16 targetPan, s16 incrementPan);
+bool8 IsBattlerSpriteVisible(u8 battlerId);
+s16 KeepPanInRange(s16 a, s32 oldPan);
+void RelocateBattleBgPal(u16 paletteNum, u16 *dest, s32 offset, u8 largeScreen);
+void SetAnimBgAttribute(u8 bgId, u8 attributeId, u8 value);
+s32 GetAnimBgAttribute(u8 bgId, u8 attributeId);
+void HandleIntroSlide(u8 terrain);
+void BattleIntroSlideEnd(u8 taskId);
+void CopyBattlerSpriteToBg(s32 bgId, u8 x, u8 y, u8 battlerPosition, u8 palno, u8 *tilesDest, u16 *tilemapDest, u16 tilesOffset);
+void SetSpriteNextToMonHead(u8 battler, struct Sprite* sprite);
+void TryShinyAnimation(u8 battler, struct Pokemon *mon);
+u8 ItemIdToBallId(u16 itemId);
+u8 AnimateBallOpenParticles(u8 x, u8 y, u8 priority, u8 subpriority, u8 ballId);
+u8 LaunchBallFadeMonTask(bool8 unFadeLater, u8 battlerId, u32 arg2, u8 ballId);
+void DoLoadHealthboxPalsForLevelUp(u8 *, u8 *, u8 battlerId);
+void DoFreeHealthboxPalsForLevelUp(u8 batterId);
+void LaunchStatusAnimation(u8 battlerId, u8 statusAnimId);
+u8 GetBattlerSpriteCoord(u8 battlerId, u8 coordType);
+u8 GetBattlerSpriteCoord2(u8 battlerId, u8 coordType);
+u8 GetBattlerSpriteDefault_Y(u8 battlerId);
+u8 GetSubstituteSpriteDefault_Y(u8 battlerId);
+u8 GetGhostSpriteDefault_Y(u8 battlerId);
+u8 GetBattlerYCoordWithElevation(u8 battlerId);
+u8 GetAnimBattlerSpriteId(u8 animBattler);
+void StoreSpriteCallbackInData6(struct Sprite *sprite, SpriteCallback callback);
+void TranslateSpriteInCircle(struct Sprite *sprite);
+void TranslateSpriteInGrowingCircle(struct Sprite *sprite);
+void TranslateSpriteInEllipse(struct Sprite *sprite);
+void WaitAnimForDuration(struct Sprite *sprite);
+void ConvertPosDataToTranslateLinearData(struct Sprite *sprite);
+void TranslateSpriteLinear(struct Sprite *sprite);
+void TranslateSpriteLinearFixedPoint(struct Sprite *sprite);
+void TranslateSpriteLinearById(struct Sprite *sprite);
+void TranslateSpriteLinearByIdFixedPoint(struct Sprite *sprite);
+void TranslateSpriteLinearAndFlicker(struct Sprite *sprite);
+void DestroySpriteAndMatrix(struct Sprite *sprite);
+void RunStoredCallbackWhenAffineAnimEnds(struct Sprite *sprite);
+void RunStoredCallbackWhenAnimEnds(struct Sprite *sprite);
+void DestroyAnimSpriteAndDisableBlend(struct Sprite *sprite);
+void DestroyAnimVisualTaskAndDisableBlend(u8 taskId);
+void SetSpriteCoordsToAnimAttackerCoords(struct Sprite *sprite);
+void SetAnimSpriteInitialXOffset(struct Sprite *sprite, s16 xOffset);
+void InitAnimArcTranslation(struct Sprite *sprite);
+bool8 TranslateAnimHorizontalArc(struct Sprite *sprite);
+bool8 TranslateAnimVerticalArc(struct Sprite *sprite);
+void SetSpritePrimaryCoordsFromSecondaryCoords(struct Sprite *sprite);
+void InitSpritePosToAnimTarget(struct Sprite *sprite, bool8 respectMonPicOffsets);
+void InitSpritePosToAnimAttacker(struct Sprite *sprite, bool8 respectMonPicOffsets);
+u8 GetBattlerSide(u8 battlerId);
+u8 GetBattlerPosition(u8 battlerId);
+u8 GetBattlerAtPosition(u8 position);
+bool8 IsBattlerSpritePresent(u8 battlerId);
+bool8 IsDoubleBattle(void);
+void GetBattleAnimBg1Data(struct BattleAnimBgData *animBgData);
+void GetBattleAnimBgData(struct BattleAnimBgData *animBgData, u32 bgId);
+void GetBattleAnimBgDataByPriorityRank(struct BattleAnimBgData *animBgData, u8 unused);
+void InitBattleAnimBg(u32 bgId);
+void AnimLoadCompressedBgGfx(u32 bgId, const u32 *src, u32 tilesOffset);
+void InitAnimBgTilemapBuffer(u32 bgId, const void *src);
+void AnimLoadCompressedBgTilemap(u32 bgId, const u32 *src);
+u8 GetBattleBgPaletteNum(void);
+void ToggleBg3Mode(bool8 arg0);
+void Trade_MoveSelectedMonToTarget(struct Sprite *sprite);
+void InitSpriteDataForLinearTranslation(struct Sprite *sprite);
+void InitAnimLinearTranslation(struct Sprite *sprite);
+void StartAnimLinearTranslation(struct Sprite *sprite);
+void PlayerThrowBall_StartAnimLinearTranslation(struct Sprite *sprite);
+bool8 AnimTranslateLinear(struct Sprite *sprite);
+void AnimTranslateLinear_WithFollowup(struct Sprite *sprite);
+void InitAnimLinearTranslationWithSpeed(struct Sprite *sprite);
+void InitAnimLinearTranslationWithSpeedAndPos(struct Sprite *sprite);
+void InitAndRunAnimFastLinearTranslation(struct Sprite *sprite);
+bool8 AnimFastTranslateLinear(struct Sprite *sprite);
+void InitAnimFastLinearTranslationWithSpeed(struct Sprite *sprite);
+void InitAnimFastLinearTranslationWithSpeedAndPos(struct Sprite *sprite);
+void SetSpriteRotScale(u8 spriteId, s16 xScale, s16 yScale, u16 rotation);
+void PrepareBattlerSpriteForRotScale(u8 spriteId, u8 objMode);
+void ResetSpriteRotScale(u8 spriteId);
+void SetBattlerSpriteYOffsetFromRotation(u8 spriteId);
+void TrySetSpriteRotScale(struct Sprite *sprite, bool8 recalcCenterVector, s16 xScale, s16 yScale, u16 rotation);
+void TryResetSpriteAffineState(struct Sprite *sprite);
+u16 ArcTan2Neg(s16 a, s16 b);
+void SetGreyscaleOrOriginalPalette(u16 paletteNum, bool8 restoreOriginalColor);
+u32 GetBattlePalettesMask(bool8 battleBackground, bool8 attacker, bool8 target, bool8 attackerPartner, bool8 targetPartner, bool8 a6, bool8 a7);
+u32 GetBattleMonSpritePalettesMask(bool8 playerLeft, bool8 playerRight, bool8 foeLeft, bool8 foeRight);
+u8 GetSpritePalIdxByBattler(u8 a1);
+void AnimSpriteOnMonPos(struct Sprite *sprite);
+void TranslateAnimSpriteToTargetMonLocation(struct Sprite *sprite);
+void AnimThrowProjectile(struct Sprite *sprite);
+void AnimTravelDiagonally(struct Sprite *sprite);
+s16 CloneBattlerSpriteWithBlend(u8 animBattler);
+void DestroySpriteWithActiveSheet(struct Sprite *sprite);
+void PrepareAffineAnimInTaskData(struct Task *task, u8 spriteId, const union AffineAnimCmd *affineAnimCmds);
+bool8 RunAffineAnimFromTaskData(struct Task *task);
+void SetBattlerSpriteYOffsetFromYScale(u8 spriteId);
+void SetBattlerSpriteYOffsetFromOtherYScale(u8 spriteId, u8 otherSpriteId);
+void StorePointerInVars(s16 *lo, s16 *hi, const void *ptr);
+void *LoadPointerFromVars(s16 lo, s16 hi);
+void BattleAnimHelper_SetSpriteSquashParams(struct Task *task, u8 spriteId, s16 xScale0, s16 yScale0, s16 xScale1, s16 yScale1, u16 duration);
+u8 BattleAnimHelper_RunSpriteSquash(struct Task *task);
+void InitPrioritiesForVisibleBattlers(void);
+u8 GetBattlerSpriteSubpriority(u8 battlerId);
+u8 GetBattlerSpriteBGPriority(u8 battlerId);
+u8 GetBattlerSpriteBGPriorityRank(u8 battlerId);
+u8 CreateAdditionalMonSpriteForMoveAnim(u16 species, bool8 isBackpic, u8 templateId, s16 x, s16 y, u8 subpriority, u32 personality, u32 trainerId, u32 battlerId, u32 ignoreDeoxys);
+void DestroySpriteAndFreeResources_(struct Sprite *sprite);
+s16 GetBattlerSpriteCoordAttr(u8 battlerId, u8 attr);
+void SetAverageBattlerPositions(u8 battlerId, bool8 respectMonPicOffsets, s16 *x, s16 *y);
+u8 CreateInvisibleSpriteCopy(s32 battlerId, u8 spriteId, s32 species);
+void AnimTranslateLinearAndFlicker_Flipped(struct Sprite *sprite);
+void AnimTranslateLinearAndFlicker(struct Sprite *sprite);
+void AnimSpinningSparkle(struct Sprite *sprite);
+void AnimWeatherBallUp(struct Sprite *sprite);
+void AnimWeatherBallDown(struct Sprite *sprite);
+void AnimParticleBurst(struct Sprite *);
+void AnimMoveTwisterParticle(struct Sprite *);
+u32 UnpackSelectedBattlePalettes(s16 selector);
+void AnimTask_HorizontalShake(u8 taskId);
+void DestroyAnimSpriteAfterTimer(struct Sprite *sprite);
+void AnimWaterPulseRing(struct Sprite *sprite);
+u8 SmokescreenImpact(s16 x, s16 y, u8 a3);
+void InitStatsChangeAnimation(u8 taskId);
+void StartMonScrollingBgMask(u8 taskId, s32 unused, u16 arg2, u8 battler1, u8 arg4, u8 arg5, u8 arg6, u8 arg7, const u32 *gfx, const u32 *tilemap, const u32 *palette);
+# 14 "src/battle_util.c" 2
+# 1 "include/battle_scripts.h" 1
+
+
+
+
+
+extern const u8 BattleScript_HitFromCritCalc[];
+extern const u8 BattleScript_MoveEnd[];
+extern const u8 BattleScript_MakeMoveMissed[];
+extern const u8 BattleScript_PrintMoveMissed[];
+extern const u8 BattleScript_MoveMissedPause[];
+extern const u8 BattleScript_MoveMissed[];
+extern const u8 BattleScript_ButItFailed[];
+extern const u8 BattleScript_StatUp[];
+extern const u8 BattleScript_StatDown[];
+extern const u8 BattleScript_AlreadyAtFullHp[];
+extern const u8 BattleScript_PresentHealTarget[];
+extern const u8 BattleScript_MoveUsedMustRecharge[];
+extern const u8 BattleScript_FaintAttacker[];
+extern const u8 BattleScript_FaintTarget[];
+extern const u8 BattleScript_GiveExp[];
+extern const u8 BattleScript_HandleFaintedMon[];
+extern const u8 BattleScript_LocalTrainerBattleWon[];
+extern const u8 BattleScript_LocalTwoTrainersDefeated[];
+extern const u8 BattleScript_LocalBattleWonLoseTexts[];
+extern const u8 BattleScript_LocalBattleWonReward[];
+extern const u8 BattleScript_PayDayMoneyAndPickUpItems[];
+extern const u8 BattleScript_LocalBattleLost[];
+extern const u8 BattleScript_LocalBattleLostPrintWhiteOut[];
+extern const u8 BattleScript_LocalBattleLostEnd[];
+extern const u8 BattleScript_CheckDomeDrew[];
+extern const u8 BattleScript_LinkBattleWonOrLost[];
+extern const u8 BattleScript_BattleTowerTrainerBattleWon[];
+extern const u8 BattleScript_SmokeBallEscape[];
+extern const u8 BattleScript_RanAwayUsingMonAbility[];
+extern const u8 BattleScript_GotAwaySafely[];
+extern const u8 BattleScript_WildMonFled[];
+extern const u8 BattleScript_PrintCantRunFromTrainer[];
+extern const u8 BattleScript_PrintFailedToRunString[];
+extern const u8 BattleScript_PrintCantEscapeFromBattle[];
+extern const u8 BattleScript_PrintFullBox[];
+extern const u8 BattleScript_ActionSwitch[];
+extern const u8 BattleScript_Pausex20[];
+extern const u8 BattleScript_LevelUp[];
+extern const u8 BattleScript_RainContinuesOrEnds[];
+extern const u8 BattleScript_DamagingWeatherContinues[];
+extern const u8 BattleScript_SandStormHailEnds[];
+extern const u8 BattleScript_SunlightContinues[];
+extern const u8 BattleScript_SunlightFaded[];
+extern const u8 BattleScript_OverworldWeatherStarts[];
+extern const u8 BattleScript_SideStatusWoreOff[];
+extern const u8 BattleScript_SafeguardProtected[];
+extern const u8 BattleScript_SafeguardEnds[];
+extern const u8 BattleScript_LeechSeedTurnDrain[];
+extern const u8 BattleScript_BideStoringEnergy[];
+extern const u8 BattleScript_BideAttack[];
+extern const u8 BattleScript_BideNoEnergyToAttack[];
+extern const u8 BattleScript_SuccessForceOut[];
+extern const u8 BattleScript_MistProtected[];
+extern const u8 BattleScript_RageIsBuilding[];
+extern const u8 BattleScript_MoveUsedIsDisabled[];
+extern const u8 BattleScript_SelectingDisabledMove[];
+extern const u8 BattleScript_DisabledNoMore[];
+extern const u8 BattleScript_SelectingDisabledMoveInPalace[];
+extern const u8 BattleScript_SelectingUnusableMoveInPalace[];
+extern const u8 BattleScript_EncoredNoMore[];
+extern const u8 BattleScript_DestinyBondTakesLife[];
+extern const u8 BattleScript_SpikesOnAttacker[];
+extern const u8 BattleScript_SpikesOnTarget[];
+extern const u8 BattleScript_SpikesOngBank1[];
+extern const u8 BattleScript_PerishSongTakesLife[];
+extern const u8 BattleScript_PerishSongCountGoesDown[];
+extern const u8 BattleScript_AllStatsUp[];
+extern const u8 BattleScript_RapidSpinAway[];
+extern const u8 BattleScript_WrapFree[];
+extern const u8 BattleScript_LeechSeedFree[];
+extern const u8 BattleScript_SpikesFree[];
+extern const u8 BattleScript_MonTookFutureAttack[];
+extern const u8 BattleScript_NoMovesLeft[];
+extern const u8 BattleScript_SelectingMoveWithNoPP[];
+extern const u8 BattleScript_NoPPForMove[];
+extern const u8 BattleScript_SelectingTormentedMove[];
+extern const u8 BattleScript_MoveUsedIsTormented[];
+extern const u8 BattleScript_SelectingTormentedMoveInPalace[];
+extern const u8 BattleScript_SelectingNotAllowedMoveTaunt[];
+extern const u8 BattleScript_MoveUsedIsTaunted[];
+extern const u8 BattleScript_SelectingNotAllowedMoveTauntInPalace[];
+extern const u8 BattleScript_WishComesTrue[];
+extern const u8 BattleScript_IngrainTurnHeal[];
+extern const u8 BattleScript_AtkDefDown[];
+extern const u8 BattleScript_KnockedOff[];
+extern const u8 BattleScript_MoveUsedIsImprisoned[];
+extern const u8 BattleScript_SelectingImprisonedMove[];
+extern const u8 BattleScript_SelectingImprisonedMoveInPalace[];
+extern const u8 BattleScript_GrudgeTakesPp[];
+extern const u8 BattleScript_MagicCoatBounce[];
+extern const u8 BattleScript_SnatchedMove[];
+extern const u8 BattleScript_EnduredMsg[];
+extern const u8 BattleScript_OneHitKOMsg[];
+extern const u8 BattleScript_SAtkDown2[];
+extern const u8 BattleScript_FocusPunchSetUp[];
+extern const u8 BattleScript_MoveUsedIsAsleep[];
+extern const u8 BattleScript_MoveUsedWokeUp[];
+extern const u8 BattleScript_MonWokeUpInUproar[];
+extern const u8 BattleScript_PoisonTurnDmg[];
+extern const u8 BattleScript_BurnTurnDmg[];
+extern const u8 BattleScript_MoveUsedIsFrozen[];
+extern const u8 BattleScript_MoveUsedUnfroze[];
+extern const u8 BattleScript_DefrostedViaFireMove[];
+extern const u8 BattleScript_MoveUsedIsParalyzed[];
+extern const u8 BattleScript_MoveUsedFlinched[];
+extern const u8 BattleScript_PrintUproarOverTurns[];
+extern const u8 BattleScript_ThrashConfuses[];
+extern const u8 BattleScript_MoveUsedIsConfused[];
+extern const u8 BattleScript_MoveUsedIsConfusedNoMore[];
+extern const u8 BattleScript_PrintPayDayMoneyString[];
+extern const u8 BattleScript_WrapTurnDmg[];
+extern const u8 BattleScript_WrapEnds[];
+extern const u8 BattleScript_MoveUsedIsInLove[];
+extern const u8 BattleScript_MoveUsedIsInLoveCantAttack[];
+extern const u8 BattleScript_MoveUsedIsParalyzedCantAttack[];
+extern const u8 BattleScript_NightmareTurnDmg[];
+extern const u8 BattleScript_CurseTurnDmg[];
+extern const u8 BattleScript_TargetPRLZHeal[];
+extern const u8 BattleScript_MoveEffectSleep[];
+extern const u8 BattleScript_YawnMakesAsleep[];
+extern const u8 BattleScript_MoveEffectPoison[];
+extern const u8 BattleScript_MoveEffectBurn[];
+extern const u8 BattleScript_MoveEffectFreeze[];
+extern const u8 BattleScript_MoveEffectParalysis[];
+extern const u8 BattleScript_MoveEffectUproar[];
+extern const u8 BattleScript_MoveEffectToxic[];
+extern const u8 BattleScript_MoveEffectPayDay[];
+extern const u8 BattleScript_MoveEffectWrap[];
+extern const u8 BattleScript_MoveEffectConfusion[];
+extern const u8 BattleScript_MoveEffectRecoil33[];
+extern const u8 BattleScript_DoRecoil33[];
+extern const u8 BattleScript_Recoil33End[];
+extern const u8 BattleScript_ItemSteal[];
+extern const u8 BattleScript_DrizzleActivates[];
+extern const u8 BattleScript_SpeedBoostActivates[];
+extern const u8 BattleScript_TraceActivates[];
+extern const u8 BattleScript_RainDishActivates[];
+extern const u8 BattleScript_SandstreamActivates[];
+extern const u8 BattleScript_ShedSkinActivates[];
+extern const u8 BattleScript_WeatherFormChanges[];
+extern const u8 BattleScript_WeatherFormChangesLoop[];
+extern const u8 BattleScript_CastformChange[];
+extern const u8 BattleScript_DroughtActivates[];
+extern const u8 BattleScript_TookAttack[];
+extern const u8 BattleScript_SturdyPreventsOHKO[];
+extern const u8 BattleScript_DampStopsExplosion[];
+extern const u8 BattleScript_MoveHPDrain_PPLoss[];
+extern const u8 BattleScript_MoveHPDrain[];
+extern const u8 BattleScript_MonMadeMoveUseless_PPLoss[];
+extern const u8 BattleScript_MonMadeMoveUseless[];
+extern const u8 BattleScript_FlashFireBoost_PPLoss[];
+extern const u8 BattleScript_FlashFireBoost[];
+extern const u8 BattleScript_AbilityNoStatLoss[];
+extern const u8 BattleScript_BRNPrevention[];
+extern const u8 BattleScript_PRLZPrevention[];
+extern const u8 BattleScript_PSNPrevention[];
+extern const u8 BattleScript_ObliviousPreventsAttraction[];
+extern const u8 BattleScript_FlinchPrevention[];
+extern const u8 BattleScript_OwnTempoPrevents[];
+extern const u8 BattleScript_SoundproofProtected[];
+extern const u8 BattleScript_AbilityNoSpecificStatLoss[];
+extern const u8 BattleScript_StickyHoldActivates[];
+extern const u8 BattleScript_ColorChangeActivates[];
+extern const u8 BattleScript_RoughSkinActivates[];
+extern const u8 BattleScript_CuteCharmActivates[];
+extern const u8 BattleScript_ApplySecondaryEffect[];
+extern const u8 BattleScript_SynchronizeActivates[];
+extern const u8 BattleScript_NoItemSteal[];
+extern const u8 BattleScript_AbilityCuredStatus[];
+extern const u8 BattleScript_IgnoresAndUsesRandomMove[];
+extern const u8 BattleScript_MoveUsedLoafingAround[];
+extern const u8 BattleScript_IgnoresAndFallsAsleep[];
+extern const u8 BattleScript_SubstituteFade[];
+extern const u8 BattleScript_BerryCurePrlzEnd2[];
+extern const u8 BattleScript_BerryCureParRet[];
+extern const u8 BattleScript_BerryCurePsnEnd2[];
+extern const u8 BattleScript_BerryCurePsnRet[];
+extern const u8 BattleScript_BerryCureBrnEnd2[];
+extern const u8 BattleScript_BerryCureBrnRet[];
+extern const u8 BattleScript_BerryCureFrzEnd2[];
+extern const u8 BattleScript_BerryCureFrzRet[];
+extern const u8 BattleScript_BerryCureSlpEnd2[];
+extern const u8 BattleScript_BerryCureSlpRet[];
+extern const u8 BattleScript_BerryCureConfusionEnd2[];
+extern const u8 BattleScript_BerryCureConfusionRet[];
+extern const u8 BattleScript_BerryCureChosenStatusEnd2[];
+extern const u8 BattleScript_BerryCureChosenStatusRet[];
+extern const u8 BattleScript_WhiteHerbEnd2[];
+extern const u8 BattleScript_WhiteHerbRet[];
+extern const u8 BattleScript_ItemHealHP_RemoveItem[];
+extern const u8 BattleScript_BerryPPHealEnd2[];
+extern const u8 BattleScript_ItemHealHP_End2[];
+extern const u8 BattleScript_ItemHealHP_Ret[];
+extern const u8 BattleScript_SelectingNotAllowedMoveChoiceItem[];
+extern const u8 BattleScript_FocusBandActivates[];
+extern const u8 BattleScript_BerryConfuseHealEnd2[];
+extern const u8 BattleScript_BerryStatRaiseEnd2[];
+extern const u8 BattleScript_BerryFocusEnergyEnd2[];
+extern const u8 BattleScript_ActionSelectionItemsCantBeUsed[];
+extern const u8 BattleScript_AskIfWantsToForfeitMatch[];
+extern const u8 BattleScript_PrintPlayerForfeited[];
+extern const u8 BattleScript_PrintPlayerForfeitedLinkBattle[];
+extern const u8 BattleScript_BallThrow[];
+extern const u8 BattleScript_BallThrowByWally[];
+extern const u8 BattleScript_SafariBallThrow[];
+extern const u8 BattleScript_SuccessBallThrow[];
+extern const u8 BattleScript_WallyBallThrow[];
+extern const u8 BattleScript_ShakeBallThrow[];
+extern const u8 BattleScript_TrainerBallBlock[];
+extern const u8 BattleScript_RunByUsingItem[];
+extern const u8 BattleScript_ActionWatchesCarefully[];
+extern const u8 BattleScript_ActionGetNear[];
+extern const u8 BattleScript_ActionThrowPokeblock[];
+extern const u8 BattleScript_GhostGetOutGetOut[];
+extern const u8 BattleScript_TooScaredToMove[];
+extern const u8 BattleScript_IntimidateActivates[];
+extern const u8 BattleScript_IntimidateActivatesEnd3[];
+extern const u8 BattleScript_IgnoresWhileAsleep[];
+extern const u8 BattleScript_IgnoresAndHitsItself[];
+extern const u8 BattleScript_MoveEffectRecoil[];
+extern const u8 BattleScript_FlushMessageBox[];
+extern const u8 BattleScript_SpikesOnFaintedBattler[];
+extern const u8 BattleScript_GhostBallDodge[];
+extern const u8 BattleScript_OldMan_Pokedude_CaughtMessage[];
+extern const u8 BattleScript_SilphScopeUnveiled[];
+extern const u8 BattleScript_BattleTowerTrainerBattleWon[];
+
+extern const u8 *const gBattleScriptsForMoveEffects[];
+extern const u8 *const gBattlescriptsForBallThrow[];
+extern const u8 *const gBattlescriptsForRunningByItem[];
+extern const u8 *const gBattlescriptsForUsingItem[];
+extern const u8 *const gBattlescriptsForSafariActions[];
+# 15 "src/battle_util.c" 2
+# 1 "include/battle_message.h" 1
+
+
+
+
+# 1 "include/constants/battle_string_ids.h" 1
+# 6 "include/battle_message.h" 2
+# 196 "include/battle_message.h"
+struct BattleMsgData
+{
+    u16 currentMove;
+    u16 originallyUsedMove;
+    u16 lastItem;
+    u8 lastAbility;
+    u8 scrActive;
+    u8 bakScriptPartyIdx;
+    u8 hpScale;
+    u8 itemEffectBattler;
+    u8 moveType;
+    u8 abilities[4];
+    u8 textBuffs[3][0x10];
+};
+
+void BufferStringBattle(u16 stringID);
+u32 BattleStringExpandPlaceholdersToDisplayedString(const u8 *src);
+u32 BattleStringExpandPlaceholders(const u8 *src, u8 *dst);
+void BattleHandleAddTextPrinter(const u8 *text, u8 arg1);
+void SetPpNumbersPaletteInMoveSelection(void);
+u8 GetCurrentPpToMaxPpState(u8 currentPp, u8 maxPp);
+void BattlePutTextOnWindow(const u8 *text, u8 windowId_flags);
+bool8 BattleStringShouldBeColored(u16);
+
+extern struct BattleMsgData *gBattleMsgDataPtr;
+
+
+
+extern u8 gDisplayedStringBattle[300];
+extern u8 gBattleTextBuff1[16];
+extern u8 gBattleTextBuff2[16];
+extern u8 gBattleTextBuff3[16];
+
+extern const u8 *const gBattleStringsTable[];
+extern const u8 *const gStatNamesTable[];
+extern const u8 *const gPokeblockWasTooXStringTable[];
+extern const u8 *const gRefereeStringsTable[];
+extern const u8 *const gStatNamesTable2[];
+
+extern const u16 gMissStringIds[];
+extern const u16 gTrappingMoves[];
+
+extern const u8 gText_Sleep[];
+extern const u8 gText_Poison[];
+extern const u8 gText_Burn[];
+extern const u8 gText_Paralysis[];
+extern const u8 gText_Ice[];
+extern const u8 gText_Confusion[];
+extern const u8 gText_Love[];
+
+extern const u8 gText_BattleTowerBan_Space[];
+extern const u8 gText_BattleTowerBan_Newline1[];
+extern const u8 gText_BattleTowerBan_Newline2[];
+extern const u8 gText_BattleTowerBan_Is1[];
+extern const u8 gText_BattleTowerBan_Is2[];
+
+extern const u8 gText_SafariBalls[];
+extern const u8 gText_HighlightRed_Left[];
+
+extern const u8 gText_Win[];
+extern const u8 gText_Loss[];
+extern const u8 gText_Draw[];
+# 16 "src/battle_util.c" 2
+# 1 "include/constants/battle_anim.h" 1
+# 17 "src/battle_util.c" 2
+# 1 "include/battle_controllers.h" 1
+
+
+
+
+
+
+enum
+{
+    REQUEST_ALL_BATTLE,
+    REQUEST_SPECIES_BATTLE,
+    REQUEST_HELDITEM_BATTLE,
+    REQUEST_MOVES_PP_BATTLE,
+    REQUEST_MOVE1_BATTLE,
+    REQUEST_MOVE2_BATTLE,
+    REQUEST_MOVE3_BATTLE,
+    REQUEST_MOVE4_BATTLE,
+    REQUEST_PP_DATA_BATTLE,
+    REQUEST_PPMOVE1_BATTLE,
+    REQUEST_PPMOVE2_BATTLE,
+    REQUEST_PPMOVE3_BATTLE,
+    REQUEST_PPMOVE4_BATTLE,
+    REQUEST_UNUSED_13_BATTLE,
+    REQUEST_UNUSED_14_BATTLE,
+    REQUEST_UNUSED_15_BATTLE,
+    REQUEST_UNUSED_16_BATTLE,
+    REQUEST_OTID_BATTLE,
+    REQUEST_EXP_BATTLE,
+    REQUEST_HP_EV_BATTLE,
+    REQUEST_ATK_EV_BATTLE,
+    REQUEST_DEF_EV_BATTLE,
+    REQUEST_SPEED_EV_BATTLE,
+    REQUEST_SPATK_EV_BATTLE,
+    REQUEST_SPDEF_EV_BATTLE,
+    REQUEST_FRIENDSHIP_BATTLE,
+    REQUEST_POKERUS_BATTLE,
+    REQUEST_MET_LOCATION_BATTLE,
+    REQUEST_MET_LEVEL_BATTLE,
+    REQUEST_MET_GAME_BATTLE,
+    REQUEST_POKEBALL_BATTLE,
+    REQUEST_ALL_IVS_BATTLE,
+    REQUEST_HP_IV_BATTLE,
+    REQUEST_ATK_IV_BATTLE,
+    REQUEST_DEF_IV_BATTLE,
+    REQUEST_SPEED_IV_BATTLE,
+    REQUEST_SPATK_IV_BATTLE,
+    REQUEST_SPDEF_IV_BATTLE,
+    REQUEST_PERSONALITY_BATTLE,
+    REQUEST_CHECKSUM_BATTLE,
+    REQUEST_STATUS_BATTLE,
+    REQUEST_LEVEL_BATTLE,
+    REQUEST_HP_BATTLE,
+    REQUEST_MAX_HP_BATTLE,
+    REQUEST_ATK_BATTLE,
+    REQUEST_DEF_BATTLE,
+    REQUEST_SPEED_BATTLE,
+    REQUEST_SPATK_BATTLE,
+    REQUEST_SPDEF_BATTLE,
+    REQUEST_COOL_BATTLE,
+    REQUEST_BEAUTY_BATTLE,
+    REQUEST_CUTE_BATTLE,
+    REQUEST_SMART_BATTLE,
+    REQUEST_TOUGH_BATTLE,
+    REQUEST_SHEEN_BATTLE,
+    REQUEST_COOL_RIBBON_BATTLE,
+    REQUEST_BEAUTY_RIBBON_BATTLE,
+    REQUEST_CUTE_RIBBON_BATTLE,
+    REQUEST_SMART_RIBBON_BATTLE,
+    REQUEST_TOUGH_RIBBON_BATTLE,
+};
+
+
+
+enum {
+    BUFFER_A,
+    BUFFER_B
+};
+
+enum {
+    RESET_ACTION_MOVE_SELECTION,
+    RESET_ACTION_SELECTION,
+    RESET_MOVE_SELECTION,
+};
+
+enum {
+    BALL_NO_SHAKES,
+    BALL_1_SHAKE,
+    BALL_2_SHAKES,
+    BALL_3_SHAKES_FAIL,
+    BALL_3_SHAKES_SUCCESS,
+    BALL_TRAINER_BLOCK,
+    BALL_GHOST_DODGE,
+};
+
+enum {
+    LINK_STANDBY_MSG_STOP_BOUNCE,
+    LINK_STANDBY_STOP_BOUNCE_ONLY,
+    LINK_STANDBY_MSG_ONLY,
+};
+# 109 "include/battle_controllers.h"
+struct UnusedControllerStruct
+{
+    u8 unk:7;
+    u8 flag:1;
+};
+
+struct HpAndStatus
+{
+    u16 hp;
+    u32 status;
+};
+
+struct MovePpInfo
+{
+    u16 moves[4];
+    u8 pp[4];
+    u8 ppBonuses;
+};
+
+struct ChooseMoveStruct
+{
+    u16 moves[4];
+    u8 currentPp[4];
+    u8 maxPp[4];
+    u16 species;
+    u8 monType1;
+    u8 monType2;
+};
+
+enum
+{
+    CONTROLLER_GETMONDATA,
+    CONTROLLER_GETRAWMONDATA,
+    CONTROLLER_SETMONDATA,
+    CONTROLLER_SETRAWMONDATA,
+    CONTROLLER_LOADMONSPRITE,
+    CONTROLLER_SWITCHINANIM,
+    CONTROLLER_RETURNMONTOBALL,
+    CONTROLLER_DRAWTRAINERPIC,
+    CONTROLLER_TRAINERSLIDE,
+    CONTROLLER_TRAINERSLIDEBACK,
+    CONTROLLER_FAINTANIMATION,
+    CONTROLLER_PALETTEFADE,
+    CONTROLLER_SUCCESSBALLTHROWANIM,
+    CONTROLLER_BALLTHROWANIM,
+    CONTROLLER_PAUSE,
+    CONTROLLER_MOVEANIMATION,
+    CONTROLLER_PRINTSTRING,
+    CONTROLLER_PRINTSTRINGPLAYERONLY,
+    CONTROLLER_CHOOSEACTION,
+    CONTROLLER_UNKNOWNYESNOBOX,
+    CONTROLLER_CHOOSEMOVE,
+    CONTROLLER_OPENBAG,
+    CONTROLLER_CHOOSEPOKEMON,
+    CONTROLLER_23,
+    CONTROLLER_HEALTHBARUPDATE,
+    CONTROLLER_EXPUPDATE,
+    CONTROLLER_STATUSICONUPDATE,
+    CONTROLLER_STATUSANIMATION,
+    CONTROLLER_STATUSXOR,
+    CONTROLLER_DATATRANSFER,
+    CONTROLLER_DMA3TRANSFER,
+    CONTROLLER_PLAYBGM,
+    CONTROLLER_32,
+    CONTROLLER_TWORETURNVALUES,
+    CONTROLLER_CHOSENMONRETURNVALUE,
+    CONTROLLER_ONERETURNVALUE,
+    CONTROLLER_ONERETURNVALUE_DUPLICATE,
+    CONTROLLER_CLEARUNKVAR,
+    CONTROLLER_SETUNKVAR,
+    CONTROLLER_CLEARUNKFLAG,
+    CONTROLLER_TOGGLEUNKFLAG,
+    CONTROLLER_HITANIMATION,
+    CONTROLLER_CANTSWITCH,
+    CONTROLLER_PLAYSE,
+    CONTROLLER_PLAYFANFARE,
+    CONTROLLER_FAINTINGCRY,
+    CONTROLLER_INTROSLIDE,
+    CONTROLLER_INTROTRAINERBALLTHROW,
+    CONTROLLER_DRAWPARTYSTATUSSUMMARY,
+    CONTROLLER_HIDEPARTYSTATUSSUMMARY,
+    CONTROLLER_ENDBOUNCE,
+    CONTROLLER_SPRITEINVISIBILITY,
+    CONTROLLER_BATTLEANIMATION,
+    CONTROLLER_LINKSTANDBYMSG,
+    CONTROLLER_RESETACTIONMOVESELECTION,
+    CONTROLLER_ENDLINKBATTLE,
+
+    CONTROLLER_TERMINATOR_NOP,
+    CONTROLLER_CMDS_COUNT
+};
+
+extern struct UnusedControllerStruct gUnusedControllerStruct;
+
+
+void HandleLinkBattleSetup(void);
+void SetUpBattleVars(void);
+void InitBattleControllers(void);
+void TryReceiveLinkBattleData(void);
+void PrepareBufferDataTransferLink(u8 bufferId, u16 size, u8 *data);
+
+
+void BtlController_EmitGetMonData(u8 bufferId, u8 requestId, u8 monToCheck);
+void BtlController_EmitSetMonData(u8 bufferId, u8 requestId, u8 monToCheck, u8 bytes, void *data);
+void BtlController_EmitLoadMonSprite(u8 bufferId);
+void BtlController_EmitSwitchInAnim(u8 bufferId, u8 partyId, bool8 dontClearSubstituteBit);
+void BtlController_EmitReturnMonToBall(u8 bufferId, bool8 skipAnim);
+void BtlController_EmitDrawTrainerPic(u8 bufferId);
+void BtlController_EmitTrainerSlide(u8 bufferId);
+void BtlController_EmitTrainerSlideBack(u8 bufferId);
+void BtlController_EmitFaintAnimation(u8 bufferId);
+void BtlController_EmitBallThrowAnim(u8 bufferId, u8 caseId);
+void BtlController_EmitMoveAnimation(u8 bufferId, u16 move, u8 turnOfMove, u16 movePower, s32 dmg, u8 friendship, struct DisableStruct *disableStructPtr);
+void BtlController_EmitPrintString(u8 bufferId, u16 stringId);
+void BtlController_EmitPrintSelectionString(u8 bufferId, u16 stringId);
+void BtlController_EmitChooseAction(u8 bufferId, u8 action, u16 itemId);
+void BtlController_EmitChooseMove(u8 bufferId, bool8 isDoubleBattle, bool8 NoPpNumber, struct ChooseMoveStruct *movePpData);
+void BtlController_EmitChooseItem(u8 bufferId, u8 *arg1);
+void BtlController_EmitChoosePokemon(u8 bufferId, u8 caseId, u8 arg2, u8 abilityId, u8 *arg4);
+void BtlController_EmitHealthBarUpdate(u8 bufferId, u16 hpValue);
+void BtlController_EmitExpUpdate(u8 bufferId, u8 partyId, u16 expPoints);
+void BtlController_EmitStatusIconUpdate(u8 bufferId, u32 status1, u32 status2);
+void BtlController_EmitStatusAnimation(u8 bufferId, bool8 status2, u32 status);
+void BtlController_EmitDataTransfer(u8 bufferId, u16 size, void *data);
+void BtlController_EmitTwoReturnValues(u8 bufferId, u8 arg1, u16 arg2);
+void BtlController_EmitChosenMonReturnValue(u8 bufferId, u8 b, u8 *c);
+void BtlController_EmitOneReturnValue(u8 bufferId, u16 arg1);
+void BtlController_EmitOneReturnValue_Duplicate(u8 bufferId, u16 b);
+void BtlController_EmitHitAnimation(u8 bufferId);
+void BtlController_EmitCantSwitch(u8 bufferId);
+void BtlController_EmitPlaySE(u8 bufferId, u16 songId);
+void BtlController_EmitPlayFanfare(u8 bufferId, u16 songId);
+void BtlController_EmitFaintingCry(u8 bufferId);
+void BtlController_EmitIntroSlide(u8 bufferId, u8 terrainId);
+void BtlController_EmitIntroTrainerBallThrow(u8 bufferId);
+void BtlController_EmitDrawPartyStatusSummary(u8 bufferId, struct HpAndStatus *hpAndStatus, u8 param);
+void BtlController_EmitHidePartyStatusSummary(u8 bufferId);
+void BtlController_EmitEndBounceEffect(u8 bufferId);
+void BtlController_EmitSpriteInvisibility(u8 bufferId, bool8 isInvisible);
+void BtlController_EmitBattleAnimation(u8 bufferId, u8 animationId, u16 argument);
+void BtlController_EmitLinkStandbyMsg(u8 bufferId, u8 mode);
+void BtlController_EmitResetActionMoveSelection(u8 bufferId, u8 caseId);
+void BtlController_EmitEndLinkBattle(u8 bufferId, u8 battleOutcome);
+
+
+void BattleControllerDummy(void);
+void SetControllerToPlayer(void);
+void PlayerHandleGetRawMonData(void);
+void SpriteCB_FreePlayerSpriteLoadMonSprite(struct Sprite *sprite);
+void SetCB2ToReshowScreenAfterMenu(void);
+void SetCB2ToReshowScreenAfterMenu2(void);
+void Task_PlayerController_RestoreBgmAfterCry(u8 taskId);
+void ActionSelectionCreateCursorAt(u8 cursorPos, u8 unused);
+void ActionSelectionDestroyCursorAt(u8 cursorPos);
+void InitMoveSelectionsVarsAndStrings(void);
+void SetBattleEndCallbacks(void);
+void MoveSelectionCreateCursorAt(u8 cursorPos, u8 arg1);
+void MoveSelectionDestroyCursorAt(u8 cursorPos);
+void HandleInputChooseMove(void);
+
+
+void SetControllerToOpponent(void);
+void OpponentBufferExecCompleted(void);
+
+
+void SetControllerToSafari(void);
+
+
+void SetControllerToPokedude(void);
+void InitPokedudePartyAndOpponent(void);
+
+
+void SetControllerToOakOrOldMan(void);
+# 295 "include/battle_controllers.h"
+bool8 BtlCtrl_OakOldMan_TestState2Flag(u8 mask);
+void BtlCtrl_OakOldMan_SetState2Flag(u8 mask);
+void PrintOakText_InflictingDamageIsKey(void);
+void PrintOakText_HowDisappointing(void);
+void PrintOakText_OakNoRunningFromATrainer(void);
+void OakOldManHandleInputChooseMove(void);
+void BtlCtrl_DrawVoiceoverMessageFrame(void);
+void BtlCtrl_RemoveVoiceoverMessageFrame(void);
+
+
+void SetControllerToLinkOpponent(void);
+
+
+void SetControllerToLinkPartner(void);
+# 18 "src/battle_util.c" 2
+# 1 "include/battle_ai_script_commands.h" 1
+# 11 "include/battle_ai_script_commands.h"
+void BattleAI_HandleItemUseBeforeAISetup(void);
+void BattleAI_SetupAIData(void);
+u8 BattleAI_ChooseMoveOrAction(void);
+void ClearBankMoveHistory(u8 bank);
+void RecordAbilityBattle(u8 bank, u8 abilityId);
+void ClearBankAbilityHistory(u8 bank);
+void RecordItemEffectBattle(u8 bank, u8 itemEffect);
+void ClearBankItemEffectHistory(u8 bank);
+u8 BattleAI_ChooseMoveOrAction(void);
+# 19 "src/battle_util.c" 2
+# 1 "include/constants/battle.h" 1
+# 20 "src/battle_util.c" 2
+# 1 "include/constants/moves.h" 1
+# 21 "src/battle_util.c" 2
+# 1 "include/constants/items.h" 1
+# 22 "src/battle_util.c" 2
+# 1 "include/constants/weather.h" 1
+# 23 "src/battle_util.c" 2
+# 1 "include/constants/abilities.h" 1
+# 24 "src/battle_util.c" 2
+# 1 "include/constants/pokemon.h" 1
+# 25 "src/battle_util.c" 2
+# 1 "include/constants/hold_effects.h" 1
+# 26 "src/battle_util.c" 2
+# 1 "include/constants/battle_move_effects.h" 1
+# 27 "src/battle_util.c" 2
+# 1 "include/constants/battle_script_commands.h" 1
+# 28 "src/battle_util.c" 2
+
+
+
+static const u16 sSoundMovesTable[] =
+{
+    45, 46, 47, 48, 103, 173,
+    253, 319, 320, 304, 0xFFFF
+};
+
+u8 GetBattlerForBattleScript(u8 caseId)
+{
+    u8 ret = 0;
+    switch (caseId)
+    {
+    case 0:
+        ret = gBattlerTarget;
+        break;
+    case 1:
+        ret = gBattlerAttacker;
+        break;
+    case 2:
+        ret = gEffectBattler;
+        break;
+    case 7:
+        ret = 0;
+        break;
+    case 10:
+        ret = gBattleScripting.battler;
+        break;
+    case 3:
+        ret = gBattlerFainted;
+        break;
+    case 5:
+        ret = gBattlerFainted;
+        break;
+    case 11:
+        ret = GetBattlerAtPosition(0);
+        break;
+    case 12:
+        ret = GetBattlerAtPosition(1);
+        break;
+    case 4:
+    case 6:
+    case 8:
+    case 9:
+        break;
+    }
+    return ret;
+}
+
+void PressurePPLose(u8 target, u8 attacker, u16 move)
+{
+    int moveIndex;
+
+    if (gBattleMons[target].ability != 46)
+        return;
+
+    for (moveIndex = 0; moveIndex < 4; moveIndex++)
+    {
+        if (gBattleMons[attacker].moves[moveIndex] == move)
+            break;
+    }
+
+    if (moveIndex == 4)
+        return;
+
+    if (gBattleMons[attacker].pp[moveIndex] != 0)
+        gBattleMons[attacker].pp[moveIndex]--;
+
+    if ((!(gBattleMons[attacker].status2 & (1 << 21)) && !(gDisableStructs[attacker].mimickedMoves & gBitTable[moveIndex])))
+    {
+        gActiveBattler = attacker;
+        BtlController_EmitSetMonData(BUFFER_A, REQUEST_PPMOVE1_BATTLE + moveIndex, 0, 1, &gBattleMons[gActiveBattler].pp[moveIndex]);
+        MarkBattlerForControllerExec(gActiveBattler);
+    }
+}
+
+void PressurePPLoseOnUsingImprison(u8 attacker)
+{
+    int i, j;
+    int imprisonPos = 4;
+    u8 atkSide = GetBattlerSide(attacker);
+
+    for (i = 0; i < gBattlersCount; i++)
+    {
+        if (atkSide != GetBattlerSide(i) && gBattleMons[i].ability == 46)
+        {
+            for (j = 0; j < 4; j++)
+            {
+                if (gBattleMons[attacker].moves[j] == 286)
+                    break;
+            }
+            if (j != 4)
+            {
+                imprisonPos = j;
+                if (gBattleMons[attacker].pp[j] != 0)
+                    gBattleMons[attacker].pp[j]--;
+            }
+        }
+    }
+
+    if (imprisonPos != 4 && (!(gBattleMons[attacker].status2 & (1 << 21)) && !(gDisableStructs[attacker].mimickedMoves & gBitTable[imprisonPos])))
+    {
+        gActiveBattler = attacker;
+        BtlController_EmitSetMonData(BUFFER_A, REQUEST_PPMOVE1_BATTLE + imprisonPos, 0, 1, &gBattleMons[gActiveBattler].pp[imprisonPos]);
+        MarkBattlerForControllerExec(gActiveBattler);
+    }
+}
+
+void PressurePPLoseOnUsingPerishSong(u8 attacker)
+{
+    int i, j;
+    int perishSongPos = 4;
+
+    for (i = 0; i < gBattlersCount; i++)
+    {
+        if (gBattleMons[i].ability == 46 && i != attacker)
+        {
+            for (j = 0; j < 4; j++)
+            {
+                if (gBattleMons[attacker].moves[j] == 195)
+                    break;
+            }
+            if (j != 4)
+            {
+                perishSongPos = j;
+                if (gBattleMons[attacker].pp[j] != 0)
+                    gBattleMons[attacker].pp[j]--;
+            }
+        }
+    }
+
+    if (perishSongPos != 4 && (!(gBattleMons[attacker].status2 & (1 << 21)) && !(gDisableStructs[attacker].mimickedMoves & gBitTable[perishSongPos])))
+    {
+        gActiveBattler = attacker;
+        BtlController_EmitSetMonData(BUFFER_A, REQUEST_PPMOVE1_BATTLE + perishSongPos, 0, 1, &gBattleMons[gActiveBattler].pp[perishSongPos]);
+        MarkBattlerForControllerExec(gActiveBattler);
+    }
+}
+
+
+static void MarkAllBattlersForControllerExec(void)
+{
+    int i;
+
+    if (gBattleTypeFlags & (1 << 1))
+    {
+        for (i = 0; i < gBattlersCount; i++)
+            gBattleControllerExecFlags |= gBitTable[i] << (32 - 4);
+    }
+    else
+    {
+        for (i = 0; i < gBattlersCount; i++)
+            gBattleControllerExecFlags |= gBitTable[i];
+    }
+}
+
+void MarkBattlerForControllerExec(u8 battlerId)
+{
+    if (gBattleTypeFlags & (1 << 1))
+        gBattleControllerExecFlags |= gBitTable[battlerId] << (32 - 4);
+    else
+        gBattleControllerExecFlags |= gBitTable[battlerId];
+}
+
+void MarkBattlerReceivedLinkData(u8 battlerId)
+{
+    s32 i;
+
+    for (i = 0; i < GetLinkPlayerCount(); i++)
+        gBattleControllerExecFlags |= gBitTable[battlerId] << (i << 2);
+
+    gBattleControllerExecFlags &= ~((1 << 28) << battlerId);
+}
+
+void CancelMultiTurnMoves(u8 battler)
+{
+    gBattleMons[battler].status2 &= ~(1 << 12);
+    gBattleMons[battler].status2 &= ~(1 << 10 | 1 << 11);
+    gBattleMons[battler].status2 &= ~(1 << 4 | 1 << 5 | 1 << 6);
+    gBattleMons[battler].status2 &= ~(1 << 8 | 1 << 9);
+
+    gStatuses3[battler] &= ~((1 << 7) | (1 << 6) | (1 << 18));
+
+    gDisableStructs[battler].rolloutTimer = 0;
+    gDisableStructs[battler].furyCutterCounter = 0;
+}
+
+bool8 WasUnableToUseMove(u8 battler)
+{
+    if (gProtectStructs[battler].prlzImmobility
+        || gProtectStructs[battler].targetNotAffected
+        || gProtectStructs[battler].usedImprisonedMove
+        || gProtectStructs[battler].loveImmobility
+        || gProtectStructs[battler].usedDisabledMove
+        || gProtectStructs[battler].usedTauntedMove
+        || gProtectStructs[battler].flag2Unknown
+        || gProtectStructs[battler].flinchImmobility
+        || gProtectStructs[battler].confusionSelfDmg)
+        return 1;
+    else
+        return 0;
+}
+
+void PrepareStringBattle(u16 stringId, u8 battler)
+{
+    gActiveBattler = battler;
+    BtlController_EmitPrintString(BUFFER_A, stringId);
+    MarkBattlerForControllerExec(gActiveBattler);
+}
+
+void ResetSentPokesToOpponentValue(void)
+{
+    s32 i;
+    u32 bits = 0;
+
+    gSentPokesToOpponent[0] = 0;
+    gSentPokesToOpponent[1] = 0;
+
+    for (i = 0; i < gBattlersCount; i += 2)
+        bits |= gBitTable[gBattlerPartyIndexes[i]];
+
+    for (i = 1; i < gBattlersCount; i += 2)
+        gSentPokesToOpponent[(i & 2) >> 1] = bits;
+}
+
+void OpponentSwitchInResetSentPokesToOpponentValue(u8 battler)
+{
+    s32 i = 0;
+    u32 bits = 0;
+
+    if (GetBattlerSide(battler) == 1)
+    {
+        u8 flank = ((battler & 2) >> 1);
+        gSentPokesToOpponent[flank] = 0;
+
+        for (i = 0; i < gBattlersCount; i += 2)
+        {
+            if (!(gAbsentBattlerFlags & gBitTable[i]))
+                bits |= gBitTable[gBattlerPartyIndexes[i]];
+        }
+        gSentPokesToOpponent[flank] = bits;
+    }
+}
+
+void UpdateSentPokesToOpponentValue(u8 battler)
+{
+    if (GetBattlerSide(battler) == 1)
+    {
+        OpponentSwitchInResetSentPokesToOpponentValue(battler);
+    }
+    else
+    {
+        s32 i;
+        for (i = 1; i < gBattlersCount; i++)
+            gSentPokesToOpponent[(i & 2) >> 1] |= gBitTable[gBattlerPartyIndexes[battler]];
+    }
+}
+
+void BattleScriptPush(const u8 *bsPtr)
+{
+    gBattleResources->battleScriptsStack->ptr[gBattleResources->battleScriptsStack->size++] = bsPtr;
+}
+
+void BattleScriptPushCursor(void)
+{
+    gBattleResources->battleScriptsStack->ptr[gBattleResources->battleScriptsStack->size++] = gBattlescriptCurrInstr;
+}
+
+void BattleScriptPop(void)
+{
+    gBattlescriptCurrInstr = gBattleResources->battleScriptsStack->ptr[--gBattleResources->battleScriptsStack->size];
+}
+
+u8 TrySetCantSelectMoveBattleScript(void)
+{
+    u8 holdEffect;
+    u8 limitations = 0;
+    u16 move = gBattleMons[gActiveBattler].moves[gBattleBufferB[gActiveBattler][2]];
+    u16 *choicedMove = &gBattleStruct->choicedMove[gActiveBattler];
+
+    if (gDisableStructs[gActiveBattler].disabledMove == move && move != 0)
+    {
+        gBattleScripting.battler = gActiveBattler;
+        gCurrentMove = move;
+        gSelectionBattleScripts[gActiveBattler] = BattleScript_SelectingDisabledMove;
+        limitations = 1;
+    }
+
+    if (move == gLastMoves[gActiveBattler] && move != 165 && (gBattleMons[gActiveBattler].status2 & (1 << 31)))
+    {
+        CancelMultiTurnMoves(gActiveBattler);
+        gSelectionBattleScripts[gActiveBattler] = BattleScript_SelectingTormentedMove;
+        limitations++;
+    }
+
+    if (gDisableStructs[gActiveBattler].tauntTimer != 0 && gBattleMoves[move].power == 0)
+    {
+        gCurrentMove = move;
+        gSelectionBattleScripts[gActiveBattler] = BattleScript_SelectingNotAllowedMoveTaunt;
+        limitations++;
+    }
+
+    if (GetImprisonedMovesCount(gActiveBattler, move))
+    {
+        gCurrentMove = move;
+        gSelectionBattleScripts[gActiveBattler] = BattleScript_SelectingImprisonedMove;
+        limitations++;
+    }
+
+    if (gBattleMons[gActiveBattler].item == 175)
+        holdEffect = gEnigmaBerries[gActiveBattler].holdEffect;
+    else
+        holdEffect = ItemId_GetHoldEffect(gBattleMons[gActiveBattler].item);
+
+    gPotentialItemEffectBattler = gActiveBattler;
+
+    if (holdEffect == 29 && *choicedMove != 0 && *choicedMove != 0xFFFF && *choicedMove != move)
+    {
+        gCurrentMove = *choicedMove;
+        gLastUsedItem = gBattleMons[gActiveBattler].item;
+        gSelectionBattleScripts[gActiveBattler] = BattleScript_SelectingNotAllowedMoveChoiceItem;
+        limitations++;
+    }
+
+    if (gBattleMons[gActiveBattler].pp[gBattleBufferB[gActiveBattler][2]] == 0)
+    {
+        gSelectionBattleScripts[gActiveBattler] = BattleScript_SelectingMoveWithNoPP;
+        limitations++;
+    }
+    return limitations;
+}
+
+u8 CheckMoveLimitations(u8 battlerId, u8 unusableMoves, u8 check)
+{
+    u8 holdEffect;
+    u16 *choicedMove = &gBattleStruct->choicedMove[battlerId];
+    s32 i;
+
+    if (gBattleMons[battlerId].item == 175)
+        holdEffect = gEnigmaBerries[battlerId].holdEffect;
+    else
+        holdEffect = ItemId_GetHoldEffect(gBattleMons[battlerId].item);
+
+    gPotentialItemEffectBattler = battlerId;
+
+    for (i = 0; i < 4; i++)
+    {
+
+        if (gBattleMons[battlerId].moves[i] == 0 && check & (1 << 0))
+            unusableMoves |= gBitTable[i];
+
+        if (gBattleMons[battlerId].pp[i] == 0 && check & (1 << 1))
+            unusableMoves |= gBitTable[i];
+
+        if (gBattleMons[battlerId].moves[i] == gDisableStructs[battlerId].disabledMove && check & (1 << 2))
+            unusableMoves |= gBitTable[i];
+
+        if (gBattleMons[battlerId].moves[i] == gLastMoves[battlerId] && check & (1 << 3) && gBattleMons[battlerId].status2 & (1 << 31))
+            unusableMoves |= gBitTable[i];
+
+        if (gDisableStructs[battlerId].tauntTimer && check & (1 << 4) && gBattleMoves[gBattleMons[battlerId].moves[i]].power == 0)
+            unusableMoves |= gBitTable[i];
+
+        if (GetImprisonedMovesCount(battlerId, gBattleMons[battlerId].moves[i]) && check & (1 << 5))
+            unusableMoves |= gBitTable[i];
+
+        if (gDisableStructs[battlerId].encoreTimer && gDisableStructs[battlerId].encoredMove != gBattleMons[battlerId].moves[i])
+            unusableMoves |= gBitTable[i];
+
+        if (holdEffect == 29 && *choicedMove != 0 && *choicedMove != 0xFFFF && *choicedMove != gBattleMons[battlerId].moves[i])
+            unusableMoves |= gBitTable[i];
+    }
+    return unusableMoves;
+}
+
+
+bool8 AreAllMovesUnusable(void)
+{
+    u8 unusable = CheckMoveLimitations(gActiveBattler, 0, 0xFF);
+
+    if (unusable == ((1 << 4) - 1))
+    {
+        gProtectStructs[gActiveBattler].noValidMoves = 1;
+        gSelectionBattleScripts[gActiveBattler] = BattleScript_NoMovesLeft;
+        if (gBattleTypeFlags & (1 << 0))
+            gBattleBufferB[gActiveBattler][3] = GetBattlerAtPosition((((GetBattlerPosition(gActiveBattler)) ^ 1)) | (Random() & 2));
+        else
+            gBattleBufferB[gActiveBattler][3] = GetBattlerAtPosition(((GetBattlerPosition(gActiveBattler)) ^ 1));
+    }
+    else
+    {
+        gProtectStructs[gActiveBattler].noValidMoves = 0;
+    }
+
+    return (unusable == ((1 << 4) - 1));
+}
+
+
+u8 GetImprisonedMovesCount(u8 battlerId, u16 move)
+{
+    s32 i;
+    u8 imprisonedMoves = 0;
+    u8 battlerSide = GetBattlerSide(battlerId);
+
+    for (i = 0; i < gBattlersCount; i++)
+    {
+        if (battlerSide != GetBattlerSide(i) && gStatuses3[i] & (1 << 13))
+        {
+            s32 j;
+            for (j = 0; j < 4; j++)
+            {
+                if (move == gBattleMons[i].moves[j])
+                    break;
+            }
+            if (j < 4)
+                imprisonedMoves++;
+        }
+    }
+
+    return imprisonedMoves;
+}
+
+enum
+{
+    ENDTURN_ORDER,
+    ENDTURN_REFLECT,
+    ENDTURN_LIGHT_SCREEN,
+    ENDTURN_MIST,
+    ENDTURN_SAFEGUARD,
+    ENDTURN_WISH,
+    ENDTURN_RAIN,
+    ENDTURN_SANDSTORM,
+    ENDTURN_SUN,
+    ENDTURN_HAIL,
+    ENDTURN_FIELD_COUNT,
+};
+
+u8 DoFieldEndTurnEffects(void)
+{
+    u8 effect = 0;
+    s32 i;
+
+    for (gBattlerAttacker = 0; gBattlerAttacker < gBattlersCount && gAbsentBattlerFlags & gBitTable[gBattlerAttacker]; gBattlerAttacker++)
+    {
+    }
+    for (gBattlerTarget = 0; gBattlerTarget < gBattlersCount && gAbsentBattlerFlags & gBitTable[gBattlerTarget]; gBattlerTarget++)
+    {
+    }
+
+    do
+    {
+        u8 side;
+
+        switch (gBattleStruct->turnCountersTracker)
+        {
+        case ENDTURN_ORDER:
+            for (i = 0; i < gBattlersCount; i++)
+            {
+                gBattlerByTurnOrder[i] = i;
+            }
+            for (i = 0; i < gBattlersCount - 1; i++)
+            {
+                s32 j;
+                for (j = i + 1; j < gBattlersCount; j++)
+                {
+                    if (GetWhoStrikesFirst(gBattlerByTurnOrder[i], gBattlerByTurnOrder[j], 0))
+                        SwapTurnOrder(i, j);
+                }
+            }
+            {
+                u8 *var = &gBattleStruct->turnCountersTracker;
+
+                ++*var;
+                gBattleStruct->turnSideTracker = 0;
+            }
+
+        case ENDTURN_REFLECT:
+            while (gBattleStruct->turnSideTracker < 2)
+            {
+                side = gBattleStruct->turnSideTracker;
+                gActiveBattler = gBattlerAttacker = gSideTimers[side].reflectBattlerId;
+                if (gSideStatuses[side] & (1 << 0))
+                {
+                    if (--gSideTimers[side].reflectTimer == 0)
+                    {
+                        gSideStatuses[side] &= ~(1 << 0);
+                        BattleScriptExecute(BattleScript_SideStatusWoreOff);
+                        { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 2; gBattleTextBuff1[2] = 115; gBattleTextBuff1[3] = (115 & 0xFF00) >> 8; gBattleTextBuff1[4] = 0xFF; };
+                        effect++;
+                    }
+                }
+                gBattleStruct->turnSideTracker++;
+                if (effect != 0)
+                    break;
+            }
+            if (effect == 0)
+            {
+                gBattleStruct->turnCountersTracker++;
+                gBattleStruct->turnSideTracker = 0;
+            }
+            break;
+        case ENDTURN_LIGHT_SCREEN:
+            while (gBattleStruct->turnSideTracker < 2)
+            {
+                side = gBattleStruct->turnSideTracker;
+                gActiveBattler = gBattlerAttacker = gSideTimers[side].lightscreenBattlerId;
+                if (gSideStatuses[side] & (1 << 1))
+                {
+                    if (--gSideTimers[side].lightscreenTimer == 0)
+                    {
+                        gSideStatuses[side] &= ~(1 << 1);
+                        BattleScriptExecute(BattleScript_SideStatusWoreOff);
+                        gBattleCommunication[5] = side;
+                        { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 2; gBattleTextBuff1[2] = 113; gBattleTextBuff1[3] = (113 & 0xFF00) >> 8; gBattleTextBuff1[4] = 0xFF; };
+                        effect++;
+                    }
+                }
+                gBattleStruct->turnSideTracker++;
+                if (effect != 0)
+                    break;
+            }
+            if (effect == 0)
+            {
+                gBattleStruct->turnCountersTracker++;
+                gBattleStruct->turnSideTracker = 0;
+            }
+            break;
+        case ENDTURN_MIST:
+            while (gBattleStruct->turnSideTracker < 2)
+            {
+                side = gBattleStruct->turnSideTracker;
+                gActiveBattler = gBattlerAttacker = gSideTimers[side].mistBattlerId;
+                if (gSideTimers[side].mistTimer != 0 && --gSideTimers[side].mistTimer == 0)
+                {
+                    gSideStatuses[side] &= ~(1 << 8);
+                    BattleScriptExecute(BattleScript_SideStatusWoreOff);
+                    gBattleCommunication[5] = side;
+                    { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 2; gBattleTextBuff1[2] = 54; gBattleTextBuff1[3] = (54 & 0xFF00) >> 8; gBattleTextBuff1[4] = 0xFF; };
+                    effect++;
+                }
+                gBattleStruct->turnSideTracker++;
+                if (effect != 0)
+                    break;
+            }
+            if (effect == 0)
+            {
+                gBattleStruct->turnCountersTracker++;
+                gBattleStruct->turnSideTracker = 0;
+            }
+            break;
+        case ENDTURN_SAFEGUARD:
+            while (gBattleStruct->turnSideTracker < 2)
+            {
+                side = gBattleStruct->turnSideTracker;
+                gActiveBattler = gBattlerAttacker = gSideTimers[side].safeguardBattlerId;
+                if (gSideStatuses[side] & (1 << 5))
+                {
+                    if (--gSideTimers[side].safeguardTimer == 0)
+                    {
+                        gSideStatuses[side] &= ~(1 << 5);
+                        BattleScriptExecute(BattleScript_SafeguardEnds);
+                        effect++;
+                    }
+                }
+                gBattleStruct->turnSideTracker++;
+                if (effect != 0)
+                    break;
+            }
+            if (effect == 0)
+            {
+                gBattleStruct->turnCountersTracker++;
+                gBattleStruct->turnSideTracker = 0;
+            }
+            break;
+        case ENDTURN_WISH:
+            while (gBattleStruct->turnSideTracker < gBattlersCount)
+            {
+                gActiveBattler = gBattlerByTurnOrder[gBattleStruct->turnSideTracker];
+                if (gWishFutureKnock.wishCounter[gActiveBattler] != 0
+                 && --gWishFutureKnock.wishCounter[gActiveBattler] == 0
+                 && gBattleMons[gActiveBattler].hp != 0)
+                {
+                    gBattlerTarget = gActiveBattler;
+                    BattleScriptExecute(BattleScript_WishComesTrue);
+                    effect++;
+                }
+                gBattleStruct->turnSideTracker++;
+                if (effect != 0)
+                    break;
+            }
+            if (effect == 0)
+            {
+                gBattleStruct->turnCountersTracker++;
+            }
+            break;
+        case ENDTURN_RAIN:
+            if (gBattleWeather & ((1 << 0) | (1 << 1) | (1 << 2)))
+            {
+                if (!(gBattleWeather & (1 << 2)))
+                {
+                    if (--gWishFutureKnock.weatherDuration == 0)
+                    {
+                        gBattleWeather &= ~(1 << 0);
+                        gBattleWeather &= ~(1 << 1);
+                        gBattleCommunication[5] = 2;
+                    }
+                    else if (gBattleWeather & (1 << 1))
+                        gBattleCommunication[5] = 1;
+                    else
+                        gBattleCommunication[5] = 0;
+                }
+                else if (gBattleWeather & (1 << 1))
+                {
+                    gBattleCommunication[5] = 1;
+                }
+                else
+                {
+                    gBattleCommunication[5] = 0;
+                }
+
+                BattleScriptExecute(BattleScript_RainContinuesOrEnds);
+                effect++;
+            }
+            gBattleStruct->turnCountersTracker++;
+            break;
+        case ENDTURN_SANDSTORM:
+            if (gBattleWeather & ((1 << 3) | (1 << 4)))
+            {
+                if (!(gBattleWeather & (1 << 4)) && --gWishFutureKnock.weatherDuration == 0)
+                {
+                    gBattleWeather &= ~(1 << 3);
+                    gBattlescriptCurrInstr = BattleScript_SandStormHailEnds;
+                }
+                else
+                {
+                    gBattlescriptCurrInstr = BattleScript_DamagingWeatherContinues;
+                }
+
+                gBattleScripting.animArg1 = 12;
+                gBattleCommunication[5] = 0;
+                BattleScriptExecute(gBattlescriptCurrInstr);
+                effect++;
+            }
+            gBattleStruct->turnCountersTracker++;
+            break;
+        case ENDTURN_SUN:
+            if (gBattleWeather & ((1 << 5) | (1 << 6)))
+            {
+                if (!(gBattleWeather & (1 << 6)) && --gWishFutureKnock.weatherDuration == 0)
+                {
+                    gBattleWeather &= ~(1 << 5);
+                    gBattlescriptCurrInstr = BattleScript_SunlightFaded;
+                }
+                else
+                {
+                    gBattlescriptCurrInstr = BattleScript_SunlightContinues;
+                }
+
+                BattleScriptExecute(gBattlescriptCurrInstr);
+                effect++;
+            }
+            gBattleStruct->turnCountersTracker++;
+            break;
+        case ENDTURN_HAIL:
+            if (gBattleWeather & ((1 << 7)))
+            {
+                if (--gWishFutureKnock.weatherDuration == 0)
+                {
+                    gBattleWeather &= ~(1 << 7);
+                    gBattlescriptCurrInstr = BattleScript_SandStormHailEnds;
+                }
+                else
+                {
+                    gBattlescriptCurrInstr = BattleScript_DamagingWeatherContinues;
+                }
+
+                gBattleScripting.animArg1 = 13;
+                gBattleCommunication[5] = 1;
+                BattleScriptExecute(gBattlescriptCurrInstr);
+                effect++;
+            }
+            gBattleStruct->turnCountersTracker++;
+            break;
+        case ENDTURN_FIELD_COUNT:
+            effect++;
+            break;
+        }
+    } while (effect == 0);
+    return (gBattleMainFunc != BattleTurnPassed);
+}
+
+enum
+{
+    ENDTURN_INGRAIN,
+    ENDTURN_ABILITIES,
+    ENDTURN_ITEMS1,
+    ENDTURN_LEECH_SEED,
+    ENDTURN_POISON,
+    ENDTURN_BAD_POISON,
+    ENDTURN_BURN,
+    ENDTURN_NIGHTMARES,
+    ENDTURN_CURSE,
+    ENDTURN_WRAP,
+    ENDTURN_UPROAR,
+    ENDTURN_THRASH,
+    ENDTURN_DISABLE,
+    ENDTURN_ENCORE,
+    ENDTURN_LOCK_ON,
+    ENDTURN_CHARGE,
+    ENDTURN_TAUNT,
+    ENDTURN_YAWN,
+    ENDTURN_ITEMS2,
+    ENDTURN_BATTLER_COUNT
+};
+
+u8 DoBattlerEndTurnEffects(void)
+{
+    u8 effect = 0;
+
+    gHitMarker |= ((1 << 24) | (1 << 5));
+    while (gBattleStruct->turnEffectsBattlerId < gBattlersCount && gBattleStruct->turnEffectsTracker <= ENDTURN_BATTLER_COUNT)
+    {
+        gActiveBattler = gBattlerAttacker = gBattlerByTurnOrder[gBattleStruct->turnEffectsBattlerId];
+        if (gAbsentBattlerFlags & gBitTable[gActiveBattler])
+        {
+            gBattleStruct->turnEffectsBattlerId++;
+        }
+        else
+        {
+            switch (gBattleStruct->turnEffectsTracker)
+            {
+            case ENDTURN_INGRAIN:
+                if ((gStatuses3[gActiveBattler] & (1 << 10))
+                 && gBattleMons[gActiveBattler].hp != gBattleMons[gActiveBattler].maxHP
+                 && gBattleMons[gActiveBattler].hp != 0)
+                {
+                    gBattleMoveDamage = gBattleMons[gActiveBattler].maxHP / 16;
+                    if (gBattleMoveDamage == 0)
+                        gBattleMoveDamage = 1;
+                    gBattleMoveDamage *= -1;
+                    BattleScriptExecute(BattleScript_IngrainTurnHeal);
+                    effect++;
+                }
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_ABILITIES:
+                if (AbilityBattleEffects(1, gActiveBattler, 0, 0, 0))
+                    effect++;
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_ITEMS1:
+                if (ItemBattleEffects(1, gActiveBattler, 0))
+                    effect++;
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_ITEMS2:
+                if (ItemBattleEffects(1, gActiveBattler, 1))
+                    effect++;
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_LEECH_SEED:
+                if ((gStatuses3[gActiveBattler] & (1 << 2))
+                 && gBattleMons[gStatuses3[gActiveBattler] & (1 << 0 | 1 << 1)].hp != 0
+                 && gBattleMons[gActiveBattler].hp != 0)
+                {
+                    gBattlerTarget = gStatuses3[gActiveBattler] & (1 << 0 | 1 << 1);
+                    gBattleMoveDamage = gBattleMons[gActiveBattler].maxHP / 8;
+                    if (gBattleMoveDamage == 0)
+                        gBattleMoveDamage = 1;
+                    gBattleScripting.animArg1 = gBattlerTarget;
+                    gBattleScripting.animArg2 = gBattlerAttacker;
+                    BattleScriptExecute(BattleScript_LeechSeedTurnDrain);
+                    effect++;
+                }
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_POISON:
+                if ((gBattleMons[gActiveBattler].status1 & (1 << 3)) && gBattleMons[gActiveBattler].hp != 0)
+                {
+                    gBattleMoveDamage = gBattleMons[gActiveBattler].maxHP / 8;
+                    if (gBattleMoveDamage == 0)
+                        gBattleMoveDamage = 1;
+                    BattleScriptExecute(BattleScript_PoisonTurnDmg);
+                    effect++;
+                }
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_BAD_POISON:
+                if ((gBattleMons[gActiveBattler].status1 & (1 << 7)) && gBattleMons[gActiveBattler].hp != 0)
+                {
+                    gBattleMoveDamage = gBattleMons[gActiveBattler].maxHP / 16;
+                    if (gBattleMoveDamage == 0)
+                        gBattleMoveDamage = 1;
+                    if ((gBattleMons[gActiveBattler].status1 & (1 << 8 | 1 << 9 | 1 << 10 | 1 << 11)) != ((15) << 8))
+                        gBattleMons[gActiveBattler].status1 += ((1) << 8);
+                    gBattleMoveDamage *= (gBattleMons[gActiveBattler].status1 & (1 << 8 | 1 << 9 | 1 << 10 | 1 << 11)) >> 8;
+                    BattleScriptExecute(BattleScript_PoisonTurnDmg);
+                    effect++;
+                }
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_BURN:
+                if ((gBattleMons[gActiveBattler].status1 & (1 << 4)) && gBattleMons[gActiveBattler].hp != 0)
+                {
+                    gBattleMoveDamage = gBattleMons[gActiveBattler].maxHP / 8;
+                    if (gBattleMoveDamage == 0)
+                        gBattleMoveDamage = 1;
+                    BattleScriptExecute(BattleScript_BurnTurnDmg);
+                    effect++;
+                }
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_NIGHTMARES:
+                if ((gBattleMons[gActiveBattler].status2 & (1 << 27)) && gBattleMons[gActiveBattler].hp != 0)
+                {
+
+
+                    if (gBattleMons[gActiveBattler].status1 & (1 << 0 | 1 << 1 | 1 << 2))
+                    {
+                        gBattleMoveDamage = gBattleMons[gActiveBattler].maxHP / 4;
+                        if (gBattleMoveDamage == 0)
+                            gBattleMoveDamage = 1;
+                        BattleScriptExecute(BattleScript_NightmareTurnDmg);
+                        effect++;
+                    }
+                    else
+                    {
+                        gBattleMons[gActiveBattler].status2 &= ~(1 << 27);
+                    }
+                }
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_CURSE:
+                if ((gBattleMons[gActiveBattler].status2 & (1 << 28)) && gBattleMons[gActiveBattler].hp != 0)
+                {
+                    gBattleMoveDamage = gBattleMons[gActiveBattler].maxHP / 4;
+                    if (gBattleMoveDamage == 0)
+                        gBattleMoveDamage = 1;
+                    BattleScriptExecute(BattleScript_CurseTurnDmg);
+                    effect++;
+                }
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_WRAP:
+                if ((gBattleMons[gActiveBattler].status2 & (1 << 13 | 1 << 14 | 1 << 15)) && gBattleMons[gActiveBattler].hp != 0)
+                {
+                    gBattleMons[gActiveBattler].status2 -= ((1) << 13);
+                    if (gBattleMons[gActiveBattler].status2 & (1 << 13 | 1 << 14 | 1 << 15))
+                    {
+                        gBattleScripting.animArg1 = *(gBattleStruct->wrappedMove + gActiveBattler * 2 + 0);
+                        gBattleScripting.animArg2 = *(gBattleStruct->wrappedMove + gActiveBattler * 2 + 1);
+                        gBattleTextBuff1[0] = 0xFD;
+                        gBattleTextBuff1[1] = 2;
+                        gBattleTextBuff1[2] = *(gBattleStruct->wrappedMove + gActiveBattler * 2 + 0);
+                        gBattleTextBuff1[3] = *(gBattleStruct->wrappedMove + gActiveBattler * 2 + 1);
+                        gBattleTextBuff1[4] = 0xFF;
+                        gBattlescriptCurrInstr = BattleScript_WrapTurnDmg;
+                        gBattleMoveDamage = gBattleMons[gActiveBattler].maxHP / 16;
+                        if (gBattleMoveDamage == 0)
+                            gBattleMoveDamage = 1;
+                    }
+                    else
+                    {
+                        gBattleTextBuff1[0] = 0xFD;
+                        gBattleTextBuff1[1] = 2;
+                        gBattleTextBuff1[2] = *(gBattleStruct->wrappedMove + gActiveBattler * 2 + 0);
+                        gBattleTextBuff1[3] = *(gBattleStruct->wrappedMove + gActiveBattler * 2 + 1);
+                        gBattleTextBuff1[4] = 0xFF;
+                        gBattlescriptCurrInstr = BattleScript_WrapEnds;
+                    }
+                    BattleScriptExecute(gBattlescriptCurrInstr);
+                    effect++;
+                }
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_UPROAR:
+                if (gBattleMons[gActiveBattler].status2 & (1 << 4 | 1 << 5 | 1 << 6))
+                {
+                    for (gBattlerAttacker = 0; gBattlerAttacker < gBattlersCount; gBattlerAttacker++)
+                    {
+                        if ((gBattleMons[gBattlerAttacker].status1 & (1 << 0 | 1 << 1 | 1 << 2))
+                         && gBattleMons[gBattlerAttacker].ability != 43)
+                        {
+                            gBattleMons[gBattlerAttacker].status1 &= ~(1 << 0 | 1 << 1 | 1 << 2);
+                            gBattleMons[gBattlerAttacker].status2 &= ~(1 << 27);
+                            gBattleCommunication[5] = 1;
+                            BattleScriptExecute(BattleScript_MonWokeUpInUproar);
+                            gActiveBattler = gBattlerAttacker;
+                            BtlController_EmitSetMonData(BUFFER_A, REQUEST_STATUS_BATTLE, 0, 4, &gBattleMons[gActiveBattler].status1);
+                            MarkBattlerForControllerExec(gActiveBattler);
+                            break;
+                        }
+                    }
+                    if (gBattlerAttacker != gBattlersCount)
+                    {
+                        effect = 2;
+                        break;
+                    }
+                    else
+                    {
+                        gBattlerAttacker = gActiveBattler;
+                        gBattleMons[gActiveBattler].status2 -= ((1) << 4);
+                        if (WasUnableToUseMove(gActiveBattler))
+                        {
+                            CancelMultiTurnMoves(gActiveBattler);
+                            gBattleCommunication[5] = 1;
+                        }
+                        else if (gBattleMons[gActiveBattler].status2 & (1 << 4 | 1 << 5 | 1 << 6))
+                        {
+                            gBattleCommunication[5] = 0;
+                            gBattleMons[gActiveBattler].status2 |= (1 << 12);
+                        }
+                        else
+                        {
+                            gBattleCommunication[5] = 1;
+                            CancelMultiTurnMoves(gActiveBattler);
+                        }
+                        BattleScriptExecute(BattleScript_PrintUproarOverTurns);
+                        effect = 1;
+                    }
+                }
+                if (effect != 2)
+                    gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_THRASH:
+                if (gBattleMons[gActiveBattler].status2 & (1 << 10 | 1 << 11))
+                {
+                    gBattleMons[gActiveBattler].status2 -= ((1) << 10);
+                    if (WasUnableToUseMove(gActiveBattler))
+                        CancelMultiTurnMoves(gActiveBattler);
+                    else if (!(gBattleMons[gActiveBattler].status2 & (1 << 10 | 1 << 11))
+                     && (gBattleMons[gActiveBattler].status2 & (1 << 12)))
+                    {
+                        gBattleMons[gActiveBattler].status2 &= ~(1 << 12);
+                        if (!(gBattleMons[gActiveBattler].status2 & (1 << 0 | 1 << 1 | 1 << 2)))
+                        {
+                            gBattleCommunication[3] = 7 | (1 << 6);
+                            SetMoveEffect(1, 0);
+                            if (gBattleMons[gActiveBattler].status2 & (1 << 0 | 1 << 1 | 1 << 2))
+                                BattleScriptExecute(BattleScript_ThrashConfuses);
+                            effect++;
+                        }
+                    }
+                }
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_DISABLE:
+                if (gDisableStructs[gActiveBattler].disableTimer != 0)
+                {
+                    s32 i;
+                    for (i = 0; i < 4; i++)
+                    {
+                        if (gDisableStructs[gActiveBattler].disabledMove == gBattleMons[gActiveBattler].moves[i])
+                            break;
+                    }
+                    if (i == 4)
+                    {
+                        gDisableStructs[gActiveBattler].disabledMove = 0;
+                        gDisableStructs[gActiveBattler].disableTimer = 0;
+                    }
+                    else if (--gDisableStructs[gActiveBattler].disableTimer == 0)
+                    {
+                        gDisableStructs[gActiveBattler].disabledMove = 0;
+                        BattleScriptExecute(BattleScript_DisabledNoMore);
+                        effect++;
+                    }
+                }
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_ENCORE:
+                if (gDisableStructs[gActiveBattler].encoreTimer != 0)
+                {
+                    if (gBattleMons[gActiveBattler].moves[gDisableStructs[gActiveBattler].encoredMovePos] != gDisableStructs[gActiveBattler].encoredMove)
+                    {
+                        gDisableStructs[gActiveBattler].encoredMove = 0;
+                        gDisableStructs[gActiveBattler].encoreTimer = 0;
+                    }
+                    else if (--gDisableStructs[gActiveBattler].encoreTimer == 0
+                     || gBattleMons[gActiveBattler].pp[gDisableStructs[gActiveBattler].encoredMovePos] == 0)
+                    {
+                        gDisableStructs[gActiveBattler].encoredMove = 0;
+                        gDisableStructs[gActiveBattler].encoreTimer = 0;
+                        BattleScriptExecute(BattleScript_EncoredNoMore);
+                        effect++;
+                    }
+                }
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_LOCK_ON:
+                if (gStatuses3[gActiveBattler] & (1 << 3 | 1 << 4))
+                    gStatuses3[gActiveBattler] -= (((1) << 3) & (1 << 3 | 1 << 4));
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_CHARGE:
+                if (gDisableStructs[gActiveBattler].chargeTimer && --gDisableStructs[gActiveBattler].chargeTimer == 0)
+                    gStatuses3[gActiveBattler] &= ~(1 << 9);
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_TAUNT:
+                if (gDisableStructs[gActiveBattler].tauntTimer)
+                    gDisableStructs[gActiveBattler].tauntTimer--;
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_YAWN:
+                if (gStatuses3[gActiveBattler] & (1 << 11 | 1 << 12))
+                {
+                    gStatuses3[gActiveBattler] -= (((1) << 11) & (1 << 11 | 1 << 12));
+                    if (!(gStatuses3[gActiveBattler] & (1 << 11 | 1 << 12)) && !(gBattleMons[gActiveBattler].status1 & ((1 << 0 | 1 << 1 | 1 << 2) | (1 << 3) | (1 << 4) | (1 << 5) | (1 << 6) | (1 << 7)))
+                     && gBattleMons[gActiveBattler].ability != 72
+                     && gBattleMons[gActiveBattler].ability != 15 && !UproarWakeUpCheck(gActiveBattler))
+                    {
+                        CancelMultiTurnMoves(gActiveBattler);
+                        gBattleMons[gActiveBattler].status1 |= (((Random() & 3) + 2) << 0);
+                        BtlController_EmitSetMonData(BUFFER_A, REQUEST_STATUS_BATTLE, 0, 4, &gBattleMons[gActiveBattler].status1);
+                        MarkBattlerForControllerExec(gActiveBattler);
+                        gEffectBattler = gActiveBattler;
+                        BattleScriptExecute(BattleScript_YawnMakesAsleep);
+                        effect++;
+                    }
+                }
+                gBattleStruct->turnEffectsTracker++;
+                break;
+            case ENDTURN_BATTLER_COUNT:
+                gBattleStruct->turnEffectsTracker = 0;
+                gBattleStruct->turnEffectsBattlerId++;
+                break;
+            }
+            if (effect != 0)
+                return effect;
+        }
+    }
+    gHitMarker &= ~((1 << 24) | (1 << 5));
+    return 0;
+}
+
+bool8 HandleWishPerishSongOnTurnEnd(void)
+{
+    gHitMarker |= ((1 << 24) | (1 << 5));
+
+    switch (gBattleStruct->wishPerishSongState)
+    {
+    case 0:
+        while (gBattleStruct->wishPerishSongBattlerId < gBattlersCount)
+        {
+            gActiveBattler = gBattleStruct->wishPerishSongBattlerId;
+            if (gAbsentBattlerFlags & gBitTable[gActiveBattler])
+            {
+                gBattleStruct->wishPerishSongBattlerId++;
+                continue;
+            }
+
+            gBattleStruct->wishPerishSongBattlerId++;
+            if (gWishFutureKnock.futureSightCounter[gActiveBattler] != 0
+             && --gWishFutureKnock.futureSightCounter[gActiveBattler] == 0
+             && gBattleMons[gActiveBattler].hp != 0)
+            {
+                if (gWishFutureKnock.futureSightMove[gActiveBattler] == 248)
+                    gBattleCommunication[5] = 0;
+                else
+                    gBattleCommunication[5] = 1;
+
+                { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 2; gBattleTextBuff1[2] = gWishFutureKnock.futureSightMove[gActiveBattler]; gBattleTextBuff1[3] = (gWishFutureKnock.futureSightMove[gActiveBattler] & 0xFF00) >> 8; gBattleTextBuff1[4] = 0xFF; };
+
+                gBattlerTarget = gActiveBattler;
+                gBattlerAttacker = gWishFutureKnock.futureSightAttacker[gActiveBattler];
+                gBattleMoveDamage = gWishFutureKnock.futureSightDmg[gActiveBattler];
+                gSpecialStatuses[gBattlerTarget].dmg = 0xFFFF;
+                BattleScriptExecute(BattleScript_MonTookFutureAttack);
+                return 1;
+            }
+        }
+        {
+            u8 *state = &gBattleStruct->wishPerishSongState;
+            *state = 1;
+            gBattleStruct->wishPerishSongBattlerId = 0;
+        }
+
+    case 1:
+        while (gBattleStruct->wishPerishSongBattlerId < gBattlersCount)
+        {
+            gActiveBattler = gBattlerAttacker = gBattlerByTurnOrder[gBattleStruct->wishPerishSongBattlerId];
+            if (gAbsentBattlerFlags & gBitTable[gActiveBattler])
+            {
+                gBattleStruct->wishPerishSongBattlerId++;
+                continue;
+            }
+            gBattleStruct->wishPerishSongBattlerId++;
+            if (gStatuses3[gActiveBattler] & (1 << 5))
+            {
+                { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 1; gBattleTextBuff1[2] = 1; gBattleTextBuff1[3] = 1; gBattleTextBuff1[4] = (gDisableStructs[gActiveBattler].perishSongTimer); gBattleTextBuff1[5] = 0xFF; };
+                if (gDisableStructs[gActiveBattler].perishSongTimer == 0)
+                {
+                    gStatuses3[gActiveBattler] &= ~(1 << 5);
+                    gBattleMoveDamage = gBattleMons[gActiveBattler].hp;
+                    gBattlescriptCurrInstr = BattleScript_PerishSongTakesLife;
+                }
+                else
+                {
+                    gDisableStructs[gActiveBattler].perishSongTimer--;
+                    gBattlescriptCurrInstr = BattleScript_PerishSongCountGoesDown;
+                }
+                BattleScriptExecute(gBattlescriptCurrInstr);
+                return 1;
+            }
+        }
+        break;
+    }
+
+    gHitMarker &= ~((1 << 24) | (1 << 5));
+
+    return 0;
+}
+
+
+
+bool8 HandleFaintedMonActions(void)
+{
+    if (gBattleTypeFlags & (1 << 7))
+        return 0;
+    do
+    {
+        s32 i;
+        switch (gBattleStruct->faintedActionsState)
+        {
+        case 0:
+            gBattleStruct->faintedActionsBattlerId = 0;
+            gBattleStruct->faintedActionsState++;
+            for (i = 0; i < gBattlersCount; i++)
+            {
+                if (gAbsentBattlerFlags & gBitTable[i] && !HasNoMonsToSwitch(i, 6, 6))
+                    gAbsentBattlerFlags &= ~(gBitTable[i]);
+            }
+
+        case 1:
+            do
+            {
+                gBattlerFainted = gBattlerTarget = gBattleStruct->faintedActionsBattlerId;
+                if (gBattleMons[gBattleStruct->faintedActionsBattlerId].hp == 0
+                 && !(gBattleStruct->givenExpMons & gBitTable[gBattlerPartyIndexes[gBattleStruct->faintedActionsBattlerId]])
+                 && !(gAbsentBattlerFlags & gBitTable[gBattleStruct->faintedActionsBattlerId]))
+                {
+                    BattleScriptExecute(BattleScript_GiveExp);
+                    gBattleStruct->faintedActionsState = 2;
+                    return 1;
+                }
+            } while (++gBattleStruct->faintedActionsBattlerId != gBattlersCount);
+            gBattleStruct->faintedActionsState = 3;
+            break;
+        case 2:
+            OpponentSwitchInResetSentPokesToOpponentValue(gBattlerFainted);
+            if (++gBattleStruct->faintedActionsBattlerId == gBattlersCount)
+                gBattleStruct->faintedActionsState = 3;
+            else
+                gBattleStruct->faintedActionsState = 1;
+            break;
+        case 3:
+            gBattleStruct->faintedActionsBattlerId = 0;
+            gBattleStruct->faintedActionsState++;
+
+        case 4:
+            do
+            {
+                gBattlerFainted = gBattlerTarget = gBattleStruct->faintedActionsBattlerId;
+                if (gBattleMons[gBattleStruct->faintedActionsBattlerId].hp == 0
+                 && !(gAbsentBattlerFlags & gBitTable[gBattleStruct->faintedActionsBattlerId]))
+                {
+                    BattleScriptExecute(BattleScript_HandleFaintedMon);
+                    gBattleStruct->faintedActionsState = 5;
+                    return 1;
+                }
+            } while (++gBattleStruct->faintedActionsBattlerId != gBattlersCount);
+            gBattleStruct->faintedActionsState = 6;
+            break;
+        case 5:
+            if (++gBattleStruct->faintedActionsBattlerId == gBattlersCount)
+                gBattleStruct->faintedActionsState = 6;
+            else
+                gBattleStruct->faintedActionsState = 4;
+            break;
+        case 6:
+            if (AbilityBattleEffects(9, 0, 0, 0, 0)
+             || AbilityBattleEffects(11, 0, 0, 0, 0)
+             || ItemBattleEffects(1, 0, 1)
+             || AbilityBattleEffects(6, 0, 0, 0, 0))
+                return 1;
+            gBattleStruct->faintedActionsState++;
+            break;
+        case 7:
+            break;
+        }
+    } while (gBattleStruct->faintedActionsState != 7);
+    return 0;
+}
+
+void TryClearRageStatuses(void)
+{
+    s32 i;
+    for (i = 0; i < gBattlersCount; i++)
+    {
+        if ((gBattleMons[i].status2 & (1 << 23)) && gChosenMoveByBattler[i] != 99)
+            gBattleMons[i].status2 &= ~(1 << 23);
+    }
+}
+
+enum
+{
+    CANCELLER_FLAGS,
+    CANCELLER_ASLEEP,
+    CANCELLER_FROZEN,
+    CANCELLER_TRUANT,
+    CANCELLER_RECHARGE,
+    CANCELLER_FLINCH,
+    CANCELLER_DISABLED,
+    CANCELLER_TAUNTED,
+    CANCELLER_IMPRISONED,
+    CANCELLER_CONFUSED,
+    CANCELLER_PARALYSED,
+    CANCELLER_GHOST,
+    CANCELLER_IN_LOVE,
+    CANCELLER_BIDE,
+    CANCELLER_THAW,
+    CANCELLER_END,
+};
+
+u8 AtkCanceller_UnableToUseMove(void)
+{
+    u8 effect = 0;
+    s32 *bideDmg = &gBattleScripting.bideDmg;
+    do
+    {
+        switch (gBattleStruct->atkCancellerTracker)
+        {
+        case CANCELLER_FLAGS:
+            gBattleMons[gBattlerAttacker].status2 &= ~(1 << 25);
+            gStatuses3[gBattlerAttacker] &= ~(1 << 14);
+            gBattleStruct->atkCancellerTracker++;
+            break;
+        case CANCELLER_ASLEEP:
+            if (gBattleMons[gBattlerAttacker].status1 & (1 << 0 | 1 << 1 | 1 << 2))
+            {
+                if (UproarWakeUpCheck(gBattlerAttacker))
+                {
+                    gBattleMons[gBattlerAttacker].status1 &= ~(1 << 0 | 1 << 1 | 1 << 2);
+                    gBattleMons[gBattlerAttacker].status2 &= ~(1 << 27);
+                    BattleScriptPushCursor();
+                    gBattleCommunication[5] = 1;
+                    gBattlescriptCurrInstr = BattleScript_MoveUsedWokeUp;
+                    effect = 2;
+                }
+                else
+                {
+                    u8 toSub;
+                    if (gBattleMons[gBattlerAttacker].ability == 48)
+                        toSub = 2;
+                    else
+                        toSub = 1;
+                    if ((gBattleMons[gBattlerAttacker].status1 & (1 << 0 | 1 << 1 | 1 << 2)) < toSub)
+                        gBattleMons[gBattlerAttacker].status1 &= ~(1 << 0 | 1 << 1 | 1 << 2);
+                    else
+                        gBattleMons[gBattlerAttacker].status1 -= toSub;
+                    if (gBattleMons[gBattlerAttacker].status1 & (1 << 0 | 1 << 1 | 1 << 2))
+                    {
+                        if (gCurrentMove != 173 && gCurrentMove != 214)
+                        {
+                            gBattlescriptCurrInstr = BattleScript_MoveUsedIsAsleep;
+                            gHitMarker |= (1 << 19);
+                            effect = 2;
+                        }
+                    }
+                    else
+                    {
+                        gBattleMons[gBattlerAttacker].status2 &= ~(1 << 27);
+                        BattleScriptPushCursor();
+                        gBattleCommunication[5] = 0;
+                        gBattlescriptCurrInstr = BattleScript_MoveUsedWokeUp;
+                        effect = 2;
+                    }
+                }
+            }
+            gBattleStruct->atkCancellerTracker++;
+            break;
+        case CANCELLER_FROZEN:
+            if (gBattleMons[gBattlerAttacker].status1 & (1 << 5))
+            {
+                if (Random() % 5)
+                {
+                    if (gBattleMoves[gCurrentMove].effect != 125)
+                    {
+                        gBattlescriptCurrInstr = BattleScript_MoveUsedIsFrozen;
+                        gHitMarker |= (1 << 9);
+                    }
+                    else
+                    {
+                        gBattleStruct->atkCancellerTracker++;
+                        break;
+                    }
+                }
+                else
+                {
+                    gBattleMons[gBattlerAttacker].status1 &= ~(1 << 5);
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_MoveUsedUnfroze;
+                    gBattleCommunication[5] = 0;
+                }
+                effect = 2;
+            }
+            gBattleStruct->atkCancellerTracker++;
+            break;
+        case CANCELLER_TRUANT:
+            if (gBattleMons[gBattlerAttacker].ability == 54 && gDisableStructs[gBattlerAttacker].truantCounter)
+            {
+                CancelMultiTurnMoves(gBattlerAttacker);
+                gHitMarker |= (1 << 19);
+                gBattleCommunication[5] = 0;
+                gBattlescriptCurrInstr = BattleScript_MoveUsedLoafingAround;
+                gMoveResultFlags |= (1 << 0);
+                effect = 1;
+            }
+            gBattleStruct->atkCancellerTracker++;
+            break;
+        case CANCELLER_RECHARGE:
+            if (gBattleMons[gBattlerAttacker].status2 & (1 << 22))
+            {
+                gBattleMons[gBattlerAttacker].status2 &= ~(1 << 22);
+                gDisableStructs[gBattlerAttacker].rechargeTimer = 0;
+                CancelMultiTurnMoves(gBattlerAttacker);
+                gBattlescriptCurrInstr = BattleScript_MoveUsedMustRecharge;
+                gHitMarker |= (1 << 19);
+                effect = 1;
+            }
+            gBattleStruct->atkCancellerTracker++;
+            break;
+        case CANCELLER_FLINCH:
+            if (gBattleMons[gBattlerAttacker].status2 & (1 << 3))
+            {
+                gBattleMons[gBattlerAttacker].status2 &= ~(1 << 3);
+                gProtectStructs[gBattlerAttacker].flinchImmobility = 1;
+                CancelMultiTurnMoves(gBattlerAttacker);
+                gBattlescriptCurrInstr = BattleScript_MoveUsedFlinched;
+                gHitMarker |= (1 << 19);
+                effect = 1;
+            }
+            gBattleStruct->atkCancellerTracker++;
+            break;
+        case CANCELLER_DISABLED:
+            if (gDisableStructs[gBattlerAttacker].disabledMove == gCurrentMove && gDisableStructs[gBattlerAttacker].disabledMove != 0)
+            {
+                gProtectStructs[gBattlerAttacker].usedDisabledMove = 1;
+                gBattleScripting.battler = gBattlerAttacker;
+                CancelMultiTurnMoves(gBattlerAttacker);
+                gBattlescriptCurrInstr = BattleScript_MoveUsedIsDisabled;
+                gHitMarker |= (1 << 19);
+                effect = 1;
+            }
+            gBattleStruct->atkCancellerTracker++;
+            break;
+        case CANCELLER_TAUNTED:
+            if (gDisableStructs[gBattlerAttacker].tauntTimer && gBattleMoves[gCurrentMove].power == 0)
+            {
+                gProtectStructs[gBattlerAttacker].usedTauntedMove = 1;
+                CancelMultiTurnMoves(gBattlerAttacker);
+                gBattlescriptCurrInstr = BattleScript_MoveUsedIsTaunted;
+                gHitMarker |= (1 << 19);
+                effect = 1;
+            }
+            gBattleStruct->atkCancellerTracker++;
+            break;
+        case CANCELLER_IMPRISONED:
+            if (GetImprisonedMovesCount(gBattlerAttacker, gCurrentMove))
+            {
+                gProtectStructs[gBattlerAttacker].usedImprisonedMove = 1;
+                CancelMultiTurnMoves(gBattlerAttacker);
+                gBattlescriptCurrInstr = BattleScript_MoveUsedIsImprisoned;
+                gHitMarker |= (1 << 19);
+                effect = 1;
+            }
+            gBattleStruct->atkCancellerTracker++;
+            break;
+        case CANCELLER_CONFUSED:
+            if (gBattleMons[gBattlerAttacker].status2 & (1 << 0 | 1 << 1 | 1 << 2))
+            {
+                gBattleMons[gBattlerAttacker].status2 -= ((1) << 0);
+                if (gBattleMons[gBattlerAttacker].status2 & (1 << 0 | 1 << 1 | 1 << 2))
+                {
+                    if (Random() & 1)
+                    {
+
+
+                        gBattleCommunication[5] = 0;
+                        BattleScriptPushCursor();
+                    }
+                    else
+                    {
+                        gBattleCommunication[5] = 1;
+                        gBattlerTarget = gBattlerAttacker;
+                        gBattleMoveDamage = CalculateBaseDamage(&gBattleMons[gBattlerAttacker], &gBattleMons[gBattlerAttacker], 1, 0, 40, 0, gBattlerAttacker, gBattlerAttacker);
+                        gProtectStructs[gBattlerAttacker].confusionSelfDmg = 1;
+                        gHitMarker |= (1 << 19);
+                    }
+                    gBattlescriptCurrInstr = BattleScript_MoveUsedIsConfused;
+                }
+                else
+                {
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_MoveUsedIsConfusedNoMore;
+                }
+                effect = 1;
+            }
+            gBattleStruct->atkCancellerTracker++;
+            break;
+        case CANCELLER_PARALYSED:
+            if ((gBattleMons[gBattlerAttacker].status1 & (1 << 6)) && (Random() % 4) == 0)
+            {
+                gProtectStructs[gBattlerAttacker].prlzImmobility = 1;
+
+
+                gBattlescriptCurrInstr = BattleScript_MoveUsedIsParalyzed;
+                gHitMarker |= (1 << 19);
+                effect = 1;
+            }
+            gBattleStruct->atkCancellerTracker++;
+            break;
+        case CANCELLER_GHOST:
+            if (((gBattleTypeFlags) & (1 << 15) && !((gBattleTypeFlags) & (1 << 13))))
+            {
+                if (GetBattlerSide(gBattlerAttacker) == 0)
+                    gBattlescriptCurrInstr = BattleScript_TooScaredToMove;
+                else
+                    gBattlescriptCurrInstr = BattleScript_GhostGetOutGetOut;
+                gBattleCommunication[5] = 0;
+                effect = 1;
+            }
+            gBattleStruct->atkCancellerTracker++;
+            break;
+        case CANCELLER_IN_LOVE:
+            if (gBattleMons[gBattlerAttacker].status2 & (1 << 16 | 1 << 17 | 1 << 18 | 1 << 19))
+            {
+                gBattleScripting.battler = CountTrailingZeroBits((gBattleMons[gBattlerAttacker].status2 & (1 << 16 | 1 << 17 | 1 << 18 | 1 << 19)) >> 0x10);
+                if (Random() & 1)
+                {
+                    BattleScriptPushCursor();
+                }
+                else
+                {
+                    BattleScriptPush(BattleScript_MoveUsedIsInLoveCantAttack);
+                    gHitMarker |= (1 << 19);
+                    gProtectStructs[gBattlerAttacker].loveImmobility = 1;
+                    CancelMultiTurnMoves(gBattlerAttacker);
+                }
+                gBattlescriptCurrInstr = BattleScript_MoveUsedIsInLove;
+                effect = 1;
+            }
+            gBattleStruct->atkCancellerTracker++;
+            break;
+        case CANCELLER_BIDE:
+            if (gBattleMons[gBattlerAttacker].status2 & (1 << 8 | 1 << 9))
+            {
+                gBattleMons[gBattlerAttacker].status2 -= (((1) << 8) & (1 << 8 | 1 << 9));
+                if (gBattleMons[gBattlerAttacker].status2 & (1 << 8 | 1 << 9))
+                {
+                    gBattlescriptCurrInstr = BattleScript_BideStoringEnergy;
+                }
+                else
+                {
+
+
+                    if (gTakenDmg[gBattlerAttacker])
+                    {
+                        gCurrentMove = 117;
+                        *bideDmg = gTakenDmg[gBattlerAttacker] * 2;
+                        gBattlerTarget = gTakenDmgByBattler[gBattlerAttacker];
+                        if (gAbsentBattlerFlags & gBitTable[gBattlerTarget])
+                            gBattlerTarget = GetMoveTarget(117, 0 + 1);
+                        gBattlescriptCurrInstr = BattleScript_BideAttack;
+                    }
+                    else
+                    {
+                        gBattlescriptCurrInstr = BattleScript_BideNoEnergyToAttack;
+                    }
+                }
+                effect = 1;
+            }
+            gBattleStruct->atkCancellerTracker++;
+            break;
+        case CANCELLER_THAW:
+            if (gBattleMons[gBattlerAttacker].status1 & (1 << 5))
+            {
+                if (gBattleMoves[gCurrentMove].effect == 125)
+                {
+                    gBattleMons[gBattlerAttacker].status1 &= ~(1 << 5);
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_MoveUsedUnfroze;
+                    gBattleCommunication[5] = 1;
+                }
+                effect = 2;
+            }
+            gBattleStruct->atkCancellerTracker++;
+            break;
+        case CANCELLER_END:
+            break;
+        }
+
+    } while (gBattleStruct->atkCancellerTracker != CANCELLER_END && effect == 0);
+
+    if (effect == 2)
+    {
+        gActiveBattler = gBattlerAttacker;
+        BtlController_EmitSetMonData(BUFFER_A, REQUEST_STATUS_BATTLE, 0, 4, &gBattleMons[gActiveBattler].status1);
+        MarkBattlerForControllerExec(gActiveBattler);
+    }
+    return effect;
+}
+
+bool8 HasNoMonsToSwitch(u8 battler, u8 partyIdBattlerOn1, u8 partyIdBattlerOn2)
+{
+    u8 playerId, flankId;
+    struct Pokemon *party;
+    s32 i;
+
+    if (!(gBattleTypeFlags & (1 << 0)))
+        return 0;
+
+    if (gBattleTypeFlags & (1 << 6))
+    {
+        flankId = GetBattlerMultiplayerId(battler);
+        if (GetBattlerSide(battler) == 0)
+            party = gPlayerParty;
+        else
+            party = gEnemyParty;
+
+        playerId = GetLinkTrainerFlankId(flankId);
+        for (i = playerId * (6 / 2); i < playerId * (6 / 2) + (6 / 2); i++)
+        {
+            if (GetMonData(&party[i], 57) != 0
+             && GetMonData(&party[i], 65) != 0
+             && GetMonData(&party[i], 65) != 412)
+                break;
+        }
+        return (i == playerId * (6 / 2) + (6 / 2));
+    }
+    else
+    {
+        if (GetBattlerSide(battler) == 1)
+        {
+            flankId = GetBattlerAtPosition(1);
+            playerId = GetBattlerAtPosition(3);
+            party = gEnemyParty;
+        }
+        else
+        {
+            flankId = GetBattlerAtPosition(0);
+            playerId = GetBattlerAtPosition(2);
+            party = gPlayerParty;
+        }
+
+        if (partyIdBattlerOn1 == 6)
+            partyIdBattlerOn1 = gBattlerPartyIndexes[flankId];
+        if (partyIdBattlerOn2 == 6)
+            partyIdBattlerOn2 = gBattlerPartyIndexes[playerId];
+
+        for (i = 0; i < 6; i++)
+        {
+            if (GetMonData(&party[i], 57) != 0
+             && GetMonData(&party[i], 65) != 0
+             && GetMonData(&party[i], 65) != 412
+             && i != partyIdBattlerOn1 && i != partyIdBattlerOn2
+             && i != *(gBattleStruct->monToSwitchIntoId + flankId) && i != playerId[gBattleStruct->monToSwitchIntoId])
+                break;
+        }
+        return (i == 6);
+    }
+}
+
+enum
+{
+    CASTFORM_NO_CHANGE,
+    CASTFORM_TO_NORMAL,
+    CASTFORM_TO_FIRE,
+    CASTFORM_TO_WATER,
+    CASTFORM_TO_ICE,
+};
+
+u8 CastformDataTypeChange(u8 battler)
+{
+    u8 formChange = 0;
+    if (gBattleMons[battler].species != 385 || gBattleMons[battler].ability != 59 || gBattleMons[battler].hp == 0)
+        return CASTFORM_NO_CHANGE;
+    if (!((!AbilityBattleEffects(19, 0, 13, 0, 0) && !AbilityBattleEffects(19, 0, 77, 0, 0))) && !((gBattleMons[battler].type1 == 0 || gBattleMons[battler].type2 == 0)))
+    {
+        { gBattleMons[battler].type1 = 0; gBattleMons[battler].type2 = 0; };
+        return CASTFORM_TO_NORMAL;
+    }
+    if (!((!AbilityBattleEffects(19, 0, 13, 0, 0) && !AbilityBattleEffects(19, 0, 77, 0, 0))))
+        return CASTFORM_NO_CHANGE;
+    if (!(gBattleWeather & (((1 << 0) | (1 << 1) | (1 << 2)) | ((1 << 5) | (1 << 6)) | ((1 << 7)))) && !((gBattleMons[battler].type1 == 0 || gBattleMons[battler].type2 == 0)))
+    {
+        { gBattleMons[battler].type1 = 0; gBattleMons[battler].type2 = 0; };
+        formChange = CASTFORM_TO_NORMAL;
+    }
+    if (gBattleWeather & ((1 << 5) | (1 << 6)) && !((gBattleMons[battler].type1 == 10 || gBattleMons[battler].type2 == 10)))
+    {
+        { gBattleMons[battler].type1 = 10; gBattleMons[battler].type2 = 10; };
+        formChange = CASTFORM_TO_FIRE;
+    }
+    if (gBattleWeather & ((1 << 0) | (1 << 1) | (1 << 2)) && !((gBattleMons[battler].type1 == 11 || gBattleMons[battler].type2 == 11)))
+    {
+        { gBattleMons[battler].type1 = 11; gBattleMons[battler].type2 = 11; };
+        formChange = CASTFORM_TO_WATER;
+    }
+    if (gBattleWeather & ((1 << 7)) && !((gBattleMons[battler].type1 == 15 || gBattleMons[battler].type2 == 15)))
+    {
+        { gBattleMons[battler].type1 = 15; gBattleMons[battler].type2 = 15; };
+        formChange = CASTFORM_TO_ICE;
+    }
+    return formChange;
+}
+
+u8 AbilityBattleEffects(u8 caseID, u8 battler, u8 ability, u8 special, u16 moveArg)
+{
+    u8 effect = 0;
+    struct Pokemon *pokeAtk;
+    struct Pokemon *pokeDef;
+    u16 speciesAtk;
+    u16 speciesDef;
+    u32 pidAtk;
+    u32 pidDef;
+
+    if (gBattlerAttacker >= gBattlersCount)
+        gBattlerAttacker = battler;
+
+    if (GetBattlerSide(gBattlerAttacker) == 0)
+        pokeAtk = &gPlayerParty[gBattlerPartyIndexes[gBattlerAttacker]];
+    else
+        pokeAtk = &gEnemyParty[gBattlerPartyIndexes[gBattlerAttacker]];
+
+    if (gBattlerTarget >= gBattlersCount)
+        gBattlerTarget = battler;
+
+    if (GetBattlerSide(gBattlerTarget) == 0)
+        pokeDef = &gPlayerParty[gBattlerPartyIndexes[gBattlerTarget]];
+    else
+        pokeDef = &gEnemyParty[gBattlerPartyIndexes[gBattlerTarget]];
+
+    speciesAtk = GetMonData(pokeAtk, 11);
+    pidAtk = GetMonData(pokeAtk, 0);
+
+    speciesDef = GetMonData(pokeDef, 11);
+    pidDef = GetMonData(pokeDef, 0);
+
+    if (!(gBattleTypeFlags & (1 << 7)))
+    {
+        u8 moveType;
+        s32 i;
+        u16 move;
+        u8 side;
+        u8 target1;
+
+        if (special)
+            gLastUsedAbility = special;
+        else
+            gLastUsedAbility = gBattleMons[battler].ability;
+
+        if (moveArg)
+            move = moveArg;
+        else
+            move = gCurrentMove;
+
+        { if (gBattleStruct->dynamicMoveType) moveType = gBattleStruct->dynamicMoveType & ((1 << 6) - 1); else moveType = gBattleMoves[move].type; };
+
+        if (((gBattleTypeFlags) & (1 << 15) && !((gBattleTypeFlags) & (1 << 13)))
+         && (gLastUsedAbility == 22 || gLastUsedAbility == 36))
+            return effect;
+
+        switch (caseID)
+        {
+        case 0:
+            if (gBattlerAttacker >= gBattlersCount)
+                gBattlerAttacker = battler;
+            switch (gLastUsedAbility)
+            {
+            case 255:
+                switch (GetCurrentWeather())
+                {
+                case 3:
+                case 5:
+                case 13:
+                    if (!(gBattleWeather & ((1 << 0) | (1 << 1) | (1 << 2))))
+                    {
+                        gBattleWeather = ((1 << 0) | (1 << 2));
+                        gBattleScripting.animArg1 = 10;
+                        gBattleScripting.battler = battler;
+                        effect++;
+                    }
+                    break;
+                case 8:
+                    if (!(gBattleWeather & ((1 << 3) | (1 << 4))))
+                    {
+                        gBattleWeather = ((1 << 3) | (1 << 4));
+                        gBattleScripting.animArg1 = 12;
+                        gBattleScripting.battler = battler;
+                        effect++;
+                    }
+                    break;
+                case 12:
+                    if (!(gBattleWeather & ((1 << 5) | (1 << 6))))
+                    {
+                        gBattleWeather = ((1 << 5) | (1 << 6));
+                        gBattleScripting.animArg1 = 11;
+                        gBattleScripting.battler = battler;
+                        effect++;
+                    }
+                    break;
+                }
+                if (effect != 0)
+                {
+                    gBattleCommunication[5] = GetCurrentWeather();
+                    BattleScriptPushCursorAndCallback(BattleScript_OverworldWeatherStarts);
+                }
+                break;
+            case 2:
+                if (!(gBattleWeather & (1 << 2)))
+                {
+                    gBattleWeather = ((1 << 2) | (1 << 0));
+                    BattleScriptPushCursorAndCallback(BattleScript_DrizzleActivates);
+                    gBattleScripting.battler = battler;
+                    effect++;
+                }
+                break;
+            case 45:
+                if (!(gBattleWeather & (1 << 4)))
+                {
+                    gBattleWeather = ((1 << 3) | (1 << 4));
+                    BattleScriptPushCursorAndCallback(BattleScript_SandstreamActivates);
+                    gBattleScripting.battler = battler;
+                    effect++;
+                }
+                break;
+            case 70:
+                if (!(gBattleWeather & (1 << 6)))
+                {
+                    gBattleWeather = ((1 << 5) | (1 << 6));
+                    BattleScriptPushCursorAndCallback(BattleScript_DroughtActivates);
+                    gBattleScripting.battler = battler;
+                    effect++;
+                }
+                break;
+            case 22:
+                if (!(gSpecialStatuses[battler].intimidatedMon))
+                {
+                    gStatuses3[battler] |= (1 << 19);
+                    gSpecialStatuses[battler].intimidatedMon = 1;
+                }
+                break;
+            case 59:
+                effect = CastformDataTypeChange(battler);
+                if (effect != 0)
+                {
+                    BattleScriptPushCursorAndCallback(BattleScript_CastformChange);
+                    gBattleScripting.battler = battler;
+                    *(&gBattleStruct->formToChangeInto) = effect - 1;
+                }
+                break;
+            case 36:
+                if (!(gSpecialStatuses[battler].traced))
+                {
+                    gStatuses3[battler] |= (1 << 20);
+                    gSpecialStatuses[battler].traced = 1;
+                }
+                break;
+            case 13:
+            case 77:
+                {
+                    for (target1 = 0; target1 < gBattlersCount; target1++)
+                    {
+                        effect = CastformDataTypeChange(target1);
+                        if (effect != 0)
+                        {
+                            BattleScriptPushCursorAndCallback(BattleScript_CastformChange);
+                            gBattleScripting.battler = target1;
+                            *(&gBattleStruct->formToChangeInto) = effect - 1;
+                            break;
+                        }
+                    }
+                }
+                break;
+            }
+            break;
+        case 1:
+            if (gBattleMons[battler].hp != 0)
+            {
+                gBattlerAttacker = battler;
+                switch (gLastUsedAbility)
+                {
+                case 44:
+                    if (((!AbilityBattleEffects(19, 0, 13, 0, 0) && !AbilityBattleEffects(19, 0, 77, 0, 0))) && (gBattleWeather & ((1 << 0) | (1 << 1) | (1 << 2)))
+                     && gBattleMons[battler].maxHP > gBattleMons[battler].hp)
+                    {
+                        gLastUsedAbility = 44;
+                        BattleScriptPushCursorAndCallback(BattleScript_RainDishActivates);
+                        gBattleMoveDamage = gBattleMons[battler].maxHP / 16;
+                        if (gBattleMoveDamage == 0)
+                            gBattleMoveDamage = 1;
+                        gBattleMoveDamage *= -1;
+                        effect++;
+                    }
+                    break;
+                case 61:
+                    if ((gBattleMons[battler].status1 & ((1 << 0 | 1 << 1 | 1 << 2) | (1 << 3) | (1 << 4) | (1 << 5) | (1 << 6) | (1 << 7))) && (Random() % 3) == 0)
+                    {
+                        if (gBattleMons[battler].status1 & ((1 << 3) | (1 << 7)))
+                            StringCopy(gBattleTextBuff1, gStatusConditionString_PoisonJpn);
+                        if (gBattleMons[battler].status1 & (1 << 0 | 1 << 1 | 1 << 2))
+                            StringCopy(gBattleTextBuff1, gStatusConditionString_SleepJpn);
+                        if (gBattleMons[battler].status1 & (1 << 6))
+                            StringCopy(gBattleTextBuff1, gStatusConditionString_ParalysisJpn);
+                        if (gBattleMons[battler].status1 & (1 << 4))
+                            StringCopy(gBattleTextBuff1, gStatusConditionString_BurnJpn);
+                        if (gBattleMons[battler].status1 & (1 << 5))
+                            StringCopy(gBattleTextBuff1, gStatusConditionString_IceJpn);
+                        gBattleMons[battler].status1 = 0;
+                        gBattleMons[battler].status2 &= ~(1 << 27);
+                        gBattleScripting.battler = gActiveBattler = battler;
+                        BattleScriptPushCursorAndCallback(BattleScript_ShedSkinActivates);
+                        BtlController_EmitSetMonData(BUFFER_A, REQUEST_STATUS_BATTLE, 0, 4, &gBattleMons[battler].status1);
+                        MarkBattlerForControllerExec(gActiveBattler);
+                        effect++;
+                    }
+                    break;
+                case 3:
+                    if (gBattleMons[battler].statStages[3] < 12 && gDisableStructs[battler].isFirstTurn != 2)
+                    {
+                        gBattleMons[battler].statStages[3]++;
+                        gBattleScripting.animArg1 = 14 + 3;
+                        gBattleScripting.animArg2 = 0;
+                        BattleScriptPushCursorAndCallback(BattleScript_SpeedBoostActivates);
+                        gBattleScripting.battler = battler;
+                        effect++;
+                    }
+                    break;
+                case 54:
+                    gDisableStructs[gBattlerAttacker].truantCounter ^= 1;
+                    break;
+                }
+            }
+            break;
+        case 2:
+            if (gLastUsedAbility == 43)
+            {
+                for (i = 0; sSoundMovesTable[i] != 0xFFFF; i++)
+                {
+                    if (sSoundMovesTable[i] == move)
+                        break;
+                }
+                if (sSoundMovesTable[i] != 0xFFFF)
+                {
+                    if (gBattleMons[gBattlerAttacker].status2 & (1 << 12))
+                        gHitMarker |= (1 << 11);
+                    gBattlescriptCurrInstr = BattleScript_SoundproofProtected;
+                    effect = 1;
+                }
+            }
+            break;
+        case 3:
+            if (move)
+            {
+                switch (gLastUsedAbility)
+                {
+                case 10:
+                    if (moveType == 13 && gBattleMoves[move].power != 0)
+                    {
+                        if (gProtectStructs[gBattlerAttacker].notFirstStrike)
+                            gBattlescriptCurrInstr = BattleScript_MoveHPDrain;
+                        else
+                            gBattlescriptCurrInstr = BattleScript_MoveHPDrain_PPLoss;
+
+                        effect = 1;
+                    }
+                    break;
+                case 11:
+                    if (moveType == 11 && gBattleMoves[move].power != 0)
+                    {
+                        if (gProtectStructs[gBattlerAttacker].notFirstStrike)
+                            gBattlescriptCurrInstr = BattleScript_MoveHPDrain;
+                        else
+                            gBattlescriptCurrInstr = BattleScript_MoveHPDrain_PPLoss;
+
+                        effect = 1;
+                    }
+                    break;
+                case 18:
+                    if (moveType == 10 && !(gBattleMons[battler].status1 & (1 << 5)))
+                    {
+                        if (!(gBattleResources->flags->flags[battler] & 1))
+                        {
+                            gBattleCommunication[5] = 0;
+                            if (gProtectStructs[gBattlerAttacker].notFirstStrike)
+                                gBattlescriptCurrInstr = BattleScript_FlashFireBoost;
+                            else
+                                gBattlescriptCurrInstr = BattleScript_FlashFireBoost_PPLoss;
+
+                            gBattleResources->flags->flags[battler] |= 1;
+                            effect = 2;
+                        }
+                        else
+                        {
+                            gBattleCommunication[5] = 1;
+                            if (gProtectStructs[gBattlerAttacker].notFirstStrike)
+                                gBattlescriptCurrInstr = BattleScript_FlashFireBoost;
+                            else
+                                gBattlescriptCurrInstr = BattleScript_FlashFireBoost_PPLoss;
+
+                            effect = 2;
+                        }
+                    }
+                    break;
+                }
+                if (effect == 1)
+                {
+                    if (gBattleMons[battler].maxHP == gBattleMons[battler].hp)
+                    {
+                        if ((gProtectStructs[gBattlerAttacker].notFirstStrike))
+                            gBattlescriptCurrInstr = BattleScript_MonMadeMoveUseless;
+                        else
+                            gBattlescriptCurrInstr = BattleScript_MonMadeMoveUseless_PPLoss;
+                    }
+                    else
+                    {
+                        gBattleMoveDamage = gBattleMons[battler].maxHP / 4;
+                        if (gBattleMoveDamage == 0)
+                            gBattleMoveDamage = 1;
+                        gBattleMoveDamage *= -1;
+                    }
+                }
+            }
+            break;
+        case 4:
+            switch (gLastUsedAbility)
+            {
+            case 16:
+                if (!(gMoveResultFlags & ((1 << 0) | (1 << 3) | (1 << 5)))
+                 && move != 165
+                 && gBattleMoves[move].power != 0
+                 && ((gSpecialStatuses[gBattlerTarget].physicalDmg != 0 || gSpecialStatuses[gBattlerTarget].specialDmg != 0))
+                 && !((gBattleMons[battler].type1 == moveType || gBattleMons[battler].type2 == moveType))
+                 && gBattleMons[battler].hp != 0)
+                {
+                    { gBattleMons[battler].type1 = moveType; gBattleMons[battler].type2 = moveType; };
+                    { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 3; gBattleTextBuff1[2] = moveType; gBattleTextBuff1[3] = 0xFF; };
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_ColorChangeActivates;
+                    effect++;
+                }
+                break;
+            case 24:
+                if (!(gMoveResultFlags & ((1 << 0) | (1 << 3) | (1 << 5)))
+                 && gBattleMons[gBattlerAttacker].hp != 0
+                 && !gProtectStructs[gBattlerAttacker].confusionSelfDmg
+                 && ((gSpecialStatuses[gBattlerTarget].physicalDmg != 0 || gSpecialStatuses[gBattlerTarget].specialDmg != 0))
+                 && (gBattleMoves[move].flags & (1 << 0)))
+                {
+                    gBattleMoveDamage = gBattleMons[gBattlerAttacker].maxHP / 16;
+                    if (gBattleMoveDamage == 0)
+                        gBattleMoveDamage = 1;
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_RoughSkinActivates;
+                    effect++;
+                }
+                break;
+            case 27:
+                if (!(gMoveResultFlags & ((1 << 0) | (1 << 3) | (1 << 5)))
+                 && gBattleMons[gBattlerAttacker].hp != 0
+                 && !gProtectStructs[gBattlerAttacker].confusionSelfDmg
+                 && ((gSpecialStatuses[gBattlerTarget].physicalDmg != 0 || gSpecialStatuses[gBattlerTarget].specialDmg != 0))
+                 && (gBattleMoves[move].flags & (1 << 0))
+                 && (Random() % 10) == 0)
+                {
+                    do
+                    {
+                        gBattleCommunication[3] = Random() & 3;
+                    } while (gBattleCommunication[3] == 0);
+
+                    if (gBattleCommunication[3] == 3)
+                        gBattleCommunication[3] += 2;
+
+                    gBattleCommunication[3] += (1 << 6);
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_ApplySecondaryEffect;
+                    gHitMarker |= (1 << 13);
+                    effect++;
+                }
+                break;
+            case 38:
+                if (!(gMoveResultFlags & ((1 << 0) | (1 << 3) | (1 << 5)))
+                 && gBattleMons[gBattlerAttacker].hp != 0
+                 && !gProtectStructs[gBattlerAttacker].confusionSelfDmg
+                 && ((gSpecialStatuses[gBattlerTarget].physicalDmg != 0 || gSpecialStatuses[gBattlerTarget].specialDmg != 0))
+                 && (gBattleMoves[move].flags & (1 << 0))
+                 && (Random() % 3) == 0)
+                {
+                    gBattleCommunication[3] = (1 << 6) | 2;
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_ApplySecondaryEffect;
+                    gHitMarker |= (1 << 13);
+                    effect++;
+                }
+                break;
+            case 9:
+                if (!(gMoveResultFlags & ((1 << 0) | (1 << 3) | (1 << 5)))
+                 && gBattleMons[gBattlerAttacker].hp != 0
+                 && !gProtectStructs[gBattlerAttacker].confusionSelfDmg
+                 && ((gSpecialStatuses[gBattlerTarget].physicalDmg != 0 || gSpecialStatuses[gBattlerTarget].specialDmg != 0))
+                 && (gBattleMoves[move].flags & (1 << 0))
+                 && (Random() % 3) == 0)
+                {
+                    gBattleCommunication[3] = (1 << 6) | 5;
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_ApplySecondaryEffect;
+                    gHitMarker |= (1 << 13);
+                    effect++;
+                }
+                break;
+            case 49:
+                if (!(gMoveResultFlags & ((1 << 0) | (1 << 3) | (1 << 5)))
+                 && gBattleMons[gBattlerAttacker].hp != 0
+                 && !gProtectStructs[gBattlerAttacker].confusionSelfDmg
+                 && (gBattleMoves[move].flags & (1 << 0))
+                 && ((gSpecialStatuses[gBattlerTarget].physicalDmg != 0 || gSpecialStatuses[gBattlerTarget].specialDmg != 0))
+                 && (Random() % 3) == 0)
+                {
+                    gBattleCommunication[3] = (1 << 6) | 3;
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_ApplySecondaryEffect;
+                    gHitMarker |= (1 << 13);
+                    effect++;
+                }
+                break;
+            case 56:
+                if (!(gMoveResultFlags & ((1 << 0) | (1 << 3) | (1 << 5)))
+                 && gBattleMons[gBattlerAttacker].hp != 0
+                 && !gProtectStructs[gBattlerAttacker].confusionSelfDmg
+                 && (gBattleMoves[move].flags & (1 << 0))
+                 && ((gSpecialStatuses[gBattlerTarget].physicalDmg != 0 || gSpecialStatuses[gBattlerTarget].specialDmg != 0))
+                 && gBattleMons[gBattlerTarget].hp != 0
+                 && (Random() % 3) == 0
+                 && gBattleMons[gBattlerAttacker].ability != 12
+                 && GetGenderFromSpeciesAndPersonality(speciesAtk, pidAtk) != GetGenderFromSpeciesAndPersonality(speciesDef, pidDef)
+                 && !(gBattleMons[gBattlerAttacker].status2 & (1 << 16 | 1 << 17 | 1 << 18 | 1 << 19))
+                 && GetGenderFromSpeciesAndPersonality(speciesAtk, pidAtk) != 0xFF
+                 && GetGenderFromSpeciesAndPersonality(speciesDef, pidDef) != 0xFF)
+                {
+                    gBattleMons[gBattlerAttacker].status2 |= (gBitTable[gBattlerTarget] << 16);
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_CuteCharmActivates;
+                    effect++;
+                }
+                break;
+            }
+            break;
+        case 5:
+            for (battler = 0; battler < gBattlersCount; battler++)
+            {
+                switch (gBattleMons[battler].ability)
+                {
+                case 17:
+                    if (gBattleMons[battler].status1 & ((1 << 3) | (1 << 7) | (1 << 8 | 1 << 9 | 1 << 10 | 1 << 11)))
+                    {
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_PoisonJpn);
+                        effect = 1;
+                    }
+                    break;
+                case 20:
+                    if (gBattleMons[battler].status2 & (1 << 0 | 1 << 1 | 1 << 2))
+                    {
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_ConfusionJpn);
+                        effect = 2;
+                    }
+                    break;
+                case 7:
+                    if (gBattleMons[battler].status1 & (1 << 6))
+                    {
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_ParalysisJpn);
+                        effect = 1;
+                    }
+                    break;
+                case 15:
+                case 72:
+                    if (gBattleMons[battler].status1 & (1 << 0 | 1 << 1 | 1 << 2))
+                    {
+                        gBattleMons[battler].status2 &= ~(1 << 27);
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_SleepJpn);
+                        effect = 1;
+                    }
+                    break;
+                case 41:
+                    if (gBattleMons[battler].status1 & (1 << 4))
+                    {
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_BurnJpn);
+                        effect = 1;
+                    }
+                    break;
+                case 40:
+                    if (gBattleMons[battler].status1 & (1 << 5))
+                    {
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_IceJpn);
+                        effect = 1;
+                    }
+                    break;
+                case 12:
+                    if (gBattleMons[battler].status2 & (1 << 16 | 1 << 17 | 1 << 18 | 1 << 19))
+                    {
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_LoveJpn);
+                        effect = 3;
+                    }
+                    break;
+                }
+                if (effect != 0)
+                {
+                    switch (effect)
+                    {
+                    case 1:
+                        gBattleMons[battler].status1 = 0;
+                        break;
+                    case 2:
+                        gBattleMons[battler].status2 &= ~(1 << 0 | 1 << 1 | 1 << 2);
+                        break;
+                    case 3:
+                        gBattleMons[battler].status2 &= ~(1 << 16 | 1 << 17 | 1 << 18 | 1 << 19);
+                        break;
+                    }
+
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_AbilityCuredStatus;
+                    gBattleScripting.battler = battler;
+                    gActiveBattler = battler;
+                    BtlController_EmitSetMonData(BUFFER_A, REQUEST_STATUS_BATTLE, 0, 4, &gBattleMons[gActiveBattler].status1);
+                    MarkBattlerForControllerExec(gActiveBattler);
+                    return effect;
+                }
+            }
+            break;
+        case 6:
+            for (battler = 0; battler < gBattlersCount; battler++)
+            {
+                if (gBattleMons[battler].ability == 59)
+                {
+                    effect = CastformDataTypeChange(battler);
+                    if (effect != 0)
+                    {
+                        BattleScriptPushCursorAndCallback(BattleScript_CastformChange);
+                        gBattleScripting.battler = battler;
+                        *(&gBattleStruct->formToChangeInto) = effect - 1;
+                        return effect;
+                    }
+                }
+            }
+            break;
+        case 7:
+            if (gLastUsedAbility == 28 && (gHitMarker & (1 << 14)))
+            {
+                gHitMarker &= ~(1 << 14);
+                gBattleStruct->synchronizeMoveEffect &= ~((1 << 6) | (1 << 7));
+                if (gBattleStruct->synchronizeMoveEffect == 6)
+                    gBattleStruct->synchronizeMoveEffect = 2;
+
+                gBattleCommunication[3] = gBattleStruct->synchronizeMoveEffect + (1 << 6);
+                gBattleScripting.battler = gBattlerTarget;
+                BattleScriptPushCursor();
+                gBattlescriptCurrInstr = BattleScript_SynchronizeActivates;
+                gHitMarker |= (1 << 13);
+                effect++;
+            }
+            break;
+        case 8:
+            if (gLastUsedAbility == 28 && (gHitMarker & (1 << 14)))
+            {
+                gHitMarker &= ~(1 << 14);
+                gBattleStruct->synchronizeMoveEffect &= ~((1 << 6) | (1 << 7));
+                if (gBattleStruct->synchronizeMoveEffect == 6)
+                    gBattleStruct->synchronizeMoveEffect = 2;
+
+                gBattleCommunication[3] = gBattleStruct->synchronizeMoveEffect;
+                gBattleScripting.battler = gBattlerAttacker;
+                BattleScriptPushCursor();
+                gBattlescriptCurrInstr = BattleScript_SynchronizeActivates;
+                gHitMarker |= (1 << 13);
+                effect++;
+            }
+            break;
+        case 9:
+            for (i = 0; i < gBattlersCount; i++)
+            {
+                if (gBattleMons[i].ability == 22 && gStatuses3[i] & (1 << 19))
+                {
+                    gLastUsedAbility = 22;
+                    gStatuses3[i] &= ~(1 << 19);
+                    BattleScriptPushCursorAndCallback(BattleScript_IntimidateActivatesEnd3);
+                    gBattleStruct->intimidateBattler = i;
+                    effect++;
+                    break;
+                }
+            }
+            break;
+        case 11:
+            for (i = 0; i < gBattlersCount; i++)
+            {
+                if (gBattleMons[i].ability == 36 && (gStatuses3[i] & (1 << 20)))
+                {
+                    u8 target2;
+                    side = (GetBattlerPosition(i) ^ 1) & 1;
+                    target1 = GetBattlerAtPosition(side);
+                    target2 = GetBattlerAtPosition(side + 2);
+                    if (gBattleTypeFlags & (1 << 0))
+                    {
+                        if (gBattleMons[target1].ability != 0 && gBattleMons[target1].hp != 0
+                         && gBattleMons[target2].ability != 0 && gBattleMons[target2].hp != 0)
+                        {
+                            gActiveBattler = GetBattlerAtPosition(((Random() & 1) * 2) | side);
+                            gBattleMons[i].ability = gBattleMons[gActiveBattler].ability;
+                            gLastUsedAbility = gBattleMons[gActiveBattler].ability;
+                            effect++;
+                        }
+                        else if (gBattleMons[target1].ability != 0 && gBattleMons[target1].hp != 0)
+                        {
+                            gActiveBattler = target1;
+                            gBattleMons[i].ability = gBattleMons[gActiveBattler].ability;
+                            gLastUsedAbility = gBattleMons[gActiveBattler].ability;
+                            effect++;
+                        }
+                        else if (gBattleMons[target2].ability != 0 && gBattleMons[target2].hp != 0)
+                        {
+                            gActiveBattler = target2;
+                            gBattleMons[i].ability = gBattleMons[gActiveBattler].ability;
+                            gLastUsedAbility = gBattleMons[gActiveBattler].ability;
+                            effect++;
+                        }
+                    }
+                    else
+                    {
+                        gActiveBattler = target1;
+                        if (gBattleMons[target1].ability && gBattleMons[target1].hp)
+                        {
+                            gBattleMons[i].ability = gBattleMons[target1].ability;
+                            gLastUsedAbility = gBattleMons[target1].ability;
+                            effect++;
+                        }
+                    }
+                    if (effect != 0)
+                    {
+                        BattleScriptPushCursorAndCallback(BattleScript_TraceActivates);
+                        gStatuses3[i] &= ~(1 << 20);
+                        gBattleScripting.battler = i;
+
+                        { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 4; gBattleTextBuff1[2] = gActiveBattler; gBattleTextBuff1[3] = gBattlerPartyIndexes[gActiveBattler]; gBattleTextBuff1[4] = 0xFF; }
+                        { gBattleTextBuff2[0] = 0xFD; gBattleTextBuff2[1] = 9; gBattleTextBuff2[2] = gLastUsedAbility; gBattleTextBuff2[3] = 0xFF; }
+                        break;
+                    }
+                }
+            }
+            break;
+        case 10:
+            for (i = 0; i < gBattlersCount; i++)
+            {
+                if (gBattleMons[i].ability == 22 && (gStatuses3[i] & (1 << 19)))
+                {
+                    gLastUsedAbility = 22;
+                    gStatuses3[i] &= ~(1 << 19);
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_IntimidateActivates;
+                    gBattleStruct->intimidateBattler = i;
+                    effect++;
+                    break;
+                }
+            }
+            break;
+        case 12:
+            side = GetBattlerSide(battler);
+            for (i = 0; i < gBattlersCount; i++)
+            {
+                if (GetBattlerSide(i) != side && gBattleMons[i].ability == ability)
+                {
+                    gLastUsedAbility = ability;
+                    effect = i + 1;
+                }
+            }
+            break;
+        case 13:
+            side = GetBattlerSide(battler);
+            for (i = 0; i < gBattlersCount; i++)
+            {
+                if (GetBattlerSide(i) == side && gBattleMons[i].ability == ability)
+                {
+                    gLastUsedAbility = ability;
+                    effect = i + 1;
+                }
+            }
+            break;
+        case 14:
+            switch (gLastUsedAbility)
+            {
+            case 253:
+                for (i = 0; i < gBattlersCount; i++)
+                {
+                    if (gStatuses3[i] & (1 << 16))
+                        effect = i + 1;
+                }
+                break;
+            case 254:
+                for (i = 0; i < gBattlersCount; i++)
+                {
+                    if (gStatuses3[i] & (1 << 17))
+                        effect = i + 1;
+                }
+                break;
+            default:
+                for (i = 0; i < gBattlersCount; i++)
+                {
+                    if (gBattleMons[i].ability == ability)
+                    {
+                        gLastUsedAbility = ability;
+                        effect = i + 1;
+                    }
+                }
+                break;
+            }
+            break;
+        case 19:
+            for (i = 0; i < gBattlersCount; i++)
+            {
+                if (gBattleMons[i].ability == ability && gBattleMons[i].hp != 0)
+                {
+                    gLastUsedAbility = ability;
+                    effect = i + 1;
+                }
+            }
+            break;
+        case 15:
+            side = GetBattlerSide(battler);
+            for (i = 0; i < gBattlersCount; i++)
+            {
+                if (GetBattlerSide(i) != side && gBattleMons[i].ability == ability)
+                {
+                    gLastUsedAbility = ability;
+                    effect = i + 1;
+                    break;
+                }
+            }
+            if (effect == 0)
+            {
+                for (i = 0; i < gBattlersCount; i++)
+                {
+                    if (gBattleMons[i].ability == ability && GetBattlerSide(i) == side && i != battler)
+                    {
+                        gLastUsedAbility = ability;
+                        effect = i + 1;
+                    }
+                }
+            }
+            break;
+        case 16:
+            side = GetBattlerSide(battler);
+            for (i = 0; i < gBattlersCount; i++)
+            {
+                if (GetBattlerSide(i) != side && gBattleMons[i].ability == ability)
+                {
+                    gLastUsedAbility = ability;
+                    effect++;
+                }
+            }
+            break;
+        case 17:
+            side = GetBattlerSide(battler);
+            for (i = 0; i < gBattlersCount; i++)
+            {
+                if (GetBattlerSide(i) == side && gBattleMons[i].ability == ability)
+                {
+                    gLastUsedAbility = ability;
+                    effect++;
+                }
+            }
+            break;
+        case 18:
+            for (i = 0; i < gBattlersCount; i++)
+            {
+                if (gBattleMons[i].ability == ability && i != battler)
+                {
+                    gLastUsedAbility = ability;
+                    effect++;
+                }
+            }
+            break;
+        }
+
+        if (effect && caseID < 12 && gLastUsedAbility != 0xFF)
+            RecordAbilityBattle(battler, gLastUsedAbility);
+    }
+
+    return effect;
+}
+
+void BattleScriptExecute(const u8 *BS_ptr)
+{
+    gBattlescriptCurrInstr = BS_ptr;
+    gBattleResources->battleCallbackStack->function[gBattleResources->battleCallbackStack->size++] = gBattleMainFunc;
+    gBattleMainFunc = RunBattleScriptCommands_PopCallbacksStack;
+    gCurrentActionFuncId = 0;
+}
+
+void BattleScriptPushCursorAndCallback(const u8 *BS_ptr)
+{
+    BattleScriptPushCursor();
+    gBattlescriptCurrInstr = BS_ptr;
+    gBattleResources->battleCallbackStack->function[gBattleResources->battleCallbackStack->size++] = gBattleMainFunc;
+    gBattleMainFunc = RunBattleScriptCommands;
+}
+
+enum
+{
+    ITEM_NO_EFFECT,
+    ITEM_STATUS_CHANGE,
+    ITEM_EFFECT_OTHER,
+    ITEM_PP_CHANGE,
+    ITEM_HP_CHANGE,
+    ITEM_STATS_CHANGE,
+};
+# 2484 "src/battle_util.c"
+u8 ItemBattleEffects(u8 caseID, u8 battlerId, bool8 moveTurn)
+{
+    int i = 0;
+    u8 effect = ITEM_NO_EFFECT;
+    u8 changedPP = 0;
+    u8 battlerHoldEffect, atkHoldEffect, defHoldEffect;
+    u8 battlerHoldEffectParam, atkHoldEffectParam, defHoldEffectParam;
+    u16 atkItem, defItem;
+
+    gLastUsedItem = gBattleMons[battlerId].item;
+    if (gLastUsedItem == 175)
+    {
+        battlerHoldEffect = gEnigmaBerries[battlerId].holdEffect;
+        battlerHoldEffectParam = gEnigmaBerries[battlerId].holdEffectParam;
+    }
+    else
+    {
+        battlerHoldEffect = ItemId_GetHoldEffect(gLastUsedItem);
+        battlerHoldEffectParam = ItemId_GetHoldEffectParam(gLastUsedItem);
+    }
+
+    atkItem = gBattleMons[gBattlerAttacker].item;
+    if (atkItem == 175)
+    {
+        atkHoldEffect = gEnigmaBerries[gBattlerAttacker].holdEffect;
+        atkHoldEffectParam = gEnigmaBerries[gBattlerAttacker].holdEffectParam;
+    }
+    else
+    {
+        atkHoldEffect = ItemId_GetHoldEffect(atkItem);
+        atkHoldEffectParam = ItemId_GetHoldEffectParam(atkItem);
+    }
+
+
+    defItem = gBattleMons[gBattlerTarget].item;
+    if (defItem == 175)
+    {
+        defHoldEffect = gEnigmaBerries[gBattlerTarget].holdEffect;
+        defHoldEffectParam = gEnigmaBerries[gBattlerTarget].holdEffectParam;
+    }
+    else
+    {
+        defHoldEffect = ItemId_GetHoldEffect(defItem);
+        defHoldEffectParam = ItemId_GetHoldEffectParam(defItem);
+    }
+
+    switch (caseID)
+    {
+    case 0:
+        switch (battlerHoldEffect)
+        {
+        case 32:
+            gBattleStruct->moneyMultiplier = 2;
+            break;
+        case 23:
+            for (i = 0; i < (6 + 2); i++)
+            {
+                if (gBattleMons[battlerId].statStages[i] < 6)
+                {
+                    gBattleMons[battlerId].statStages[i] = 6;
+                    effect = ITEM_STATS_CHANGE;
+                }
+            }
+            if (effect != 0)
+            {
+                gBattleScripting.battler = battlerId;
+                gPotentialItemEffectBattler = battlerId;
+                gActiveBattler = gBattlerAttacker = battlerId;
+                BattleScriptExecute(BattleScript_WhiteHerbEnd2);
+            }
+            break;
+        }
+        break;
+    case 1:
+        if (gBattleMons[battlerId].hp)
+        {
+            switch (battlerHoldEffect)
+            {
+            case 1:
+                if (gBattleMons[battlerId].hp <= gBattleMons[battlerId].maxHP / 2 && !moveTurn)
+                {
+                    gBattleMoveDamage = battlerHoldEffectParam;
+                    if (gBattleMons[battlerId].hp + battlerHoldEffectParam > gBattleMons[battlerId].maxHP)
+                        gBattleMoveDamage = gBattleMons[battlerId].maxHP - gBattleMons[battlerId].hp;
+                    gBattleMoveDamage *= -1;
+                    BattleScriptExecute(BattleScript_ItemHealHP_RemoveItem);
+                    effect = ITEM_HP_CHANGE;
+                }
+                break;
+            case 7:
+                if (!moveTurn)
+                {
+                    struct Pokemon *mon;
+                    u8 ppBonuses;
+                    u16 move;
+
+                    if (GetBattlerSide(battlerId) == 0)
+                        mon = &gPlayerParty[gBattlerPartyIndexes[battlerId]];
+                    else
+                        mon = &gEnemyParty[gBattlerPartyIndexes[battlerId]];
+                    for (i = 0; i < 4; i++)
+                    {
+                        move = GetMonData(mon, 13 + i);
+                        changedPP = GetMonData(mon, 17 + i);
+                        ppBonuses = GetMonData(mon, 21);
+                        if (move && changedPP == 0)
+                            break;
+                    }
+                    if (i != 4)
+                    {
+                        u8 maxPP = CalculatePPWithBonus(move, ppBonuses, i);
+                        if (changedPP + battlerHoldEffectParam > maxPP)
+                            changedPP = maxPP;
+                        else
+                            changedPP = changedPP + battlerHoldEffectParam;
+
+                        { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 2; gBattleTextBuff1[2] = move; gBattleTextBuff1[3] = (move & 0xFF00) >> 8; gBattleTextBuff1[4] = 0xFF; };
+
+                        BattleScriptExecute(BattleScript_BerryPPHealEnd2);
+                        BtlController_EmitSetMonData(BUFFER_A, i + REQUEST_PPMOVE1_BATTLE, 0, 1, &changedPP);
+                        MarkBattlerForControllerExec(gActiveBattler);
+                        effect = ITEM_PP_CHANGE;
+                    }
+                }
+                break;
+            case 23:
+                for (i = 0; i < (6 + 2); i++)
+                {
+                    if (gBattleMons[battlerId].statStages[i] < 6)
+                    {
+                        gBattleMons[battlerId].statStages[i] = 6;
+                        effect = ITEM_STATS_CHANGE;
+                    }
+                }
+                if (effect != 0)
+                {
+                    gBattleScripting.battler = battlerId;
+                    gPotentialItemEffectBattler = battlerId;
+                    gActiveBattler = gBattlerAttacker = battlerId;
+                    BattleScriptExecute(BattleScript_WhiteHerbEnd2);
+                }
+                break;
+            case 43:
+                if (gBattleMons[battlerId].hp < gBattleMons[battlerId].maxHP && !moveTurn)
+                {
+                    gBattleMoveDamage = gBattleMons[battlerId].maxHP / 16;
+                    if (gBattleMoveDamage == 0)
+                        gBattleMoveDamage = 1;
+                    if (gBattleMons[battlerId].hp + gBattleMoveDamage > gBattleMons[battlerId].maxHP)
+                        gBattleMoveDamage = gBattleMons[battlerId].maxHP - gBattleMons[battlerId].hp;
+                    gBattleMoveDamage *= -1;
+                    BattleScriptExecute(BattleScript_ItemHealHP_End2);
+                    effect = ITEM_HP_CHANGE;
+                    RecordItemEffectBattle(battlerId, battlerHoldEffect);
+                }
+                break;
+            case 10:
+                if (gBattleMons[battlerId].hp <= gBattleMons[battlerId].maxHP / 2 && !moveTurn) { { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 8; gBattleTextBuff1[2] = FLAVOR_SPICY; gBattleTextBuff1[3] = 0xFF; }; gBattleMoveDamage = gBattleMons[battlerId].maxHP / battlerHoldEffectParam; if (gBattleMoveDamage == 0) gBattleMoveDamage = 1; if (gBattleMons[battlerId].hp + gBattleMoveDamage > gBattleMons[battlerId].maxHP) gBattleMoveDamage = gBattleMons[battlerId].maxHP - gBattleMons[battlerId].hp; gBattleMoveDamage *= -1; if (GetFlavorRelationByPersonality(gBattleMons[battlerId].personality, FLAVOR_SPICY) < 0) BattleScriptExecute(BattleScript_BerryConfuseHealEnd2); else BattleScriptExecute(BattleScript_ItemHealHP_RemoveItem); effect = ITEM_HP_CHANGE; };
+                break;
+            case 11:
+                if (gBattleMons[battlerId].hp <= gBattleMons[battlerId].maxHP / 2 && !moveTurn) { { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 8; gBattleTextBuff1[2] = FLAVOR_DRY; gBattleTextBuff1[3] = 0xFF; }; gBattleMoveDamage = gBattleMons[battlerId].maxHP / battlerHoldEffectParam; if (gBattleMoveDamage == 0) gBattleMoveDamage = 1; if (gBattleMons[battlerId].hp + gBattleMoveDamage > gBattleMons[battlerId].maxHP) gBattleMoveDamage = gBattleMons[battlerId].maxHP - gBattleMons[battlerId].hp; gBattleMoveDamage *= -1; if (GetFlavorRelationByPersonality(gBattleMons[battlerId].personality, FLAVOR_DRY) < 0) BattleScriptExecute(BattleScript_BerryConfuseHealEnd2); else BattleScriptExecute(BattleScript_ItemHealHP_RemoveItem); effect = ITEM_HP_CHANGE; };
+                break;
+            case 12:
+                if (gBattleMons[battlerId].hp <= gBattleMons[battlerId].maxHP / 2 && !moveTurn) { { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 8; gBattleTextBuff1[2] = FLAVOR_SWEET; gBattleTextBuff1[3] = 0xFF; }; gBattleMoveDamage = gBattleMons[battlerId].maxHP / battlerHoldEffectParam; if (gBattleMoveDamage == 0) gBattleMoveDamage = 1; if (gBattleMons[battlerId].hp + gBattleMoveDamage > gBattleMons[battlerId].maxHP) gBattleMoveDamage = gBattleMons[battlerId].maxHP - gBattleMons[battlerId].hp; gBattleMoveDamage *= -1; if (GetFlavorRelationByPersonality(gBattleMons[battlerId].personality, FLAVOR_SWEET) < 0) BattleScriptExecute(BattleScript_BerryConfuseHealEnd2); else BattleScriptExecute(BattleScript_ItemHealHP_RemoveItem); effect = ITEM_HP_CHANGE; };
+                break;
+            case 13:
+                if (gBattleMons[battlerId].hp <= gBattleMons[battlerId].maxHP / 2 && !moveTurn) { { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 8; gBattleTextBuff1[2] = FLAVOR_BITTER; gBattleTextBuff1[3] = 0xFF; }; gBattleMoveDamage = gBattleMons[battlerId].maxHP / battlerHoldEffectParam; if (gBattleMoveDamage == 0) gBattleMoveDamage = 1; if (gBattleMons[battlerId].hp + gBattleMoveDamage > gBattleMons[battlerId].maxHP) gBattleMoveDamage = gBattleMons[battlerId].maxHP - gBattleMons[battlerId].hp; gBattleMoveDamage *= -1; if (GetFlavorRelationByPersonality(gBattleMons[battlerId].personality, FLAVOR_BITTER) < 0) BattleScriptExecute(BattleScript_BerryConfuseHealEnd2); else BattleScriptExecute(BattleScript_ItemHealHP_RemoveItem); effect = ITEM_HP_CHANGE; };
+                break;
+            case 14:
+                if (gBattleMons[battlerId].hp <= gBattleMons[battlerId].maxHP / 2 && !moveTurn) { { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 8; gBattleTextBuff1[2] = FLAVOR_SOUR; gBattleTextBuff1[3] = 0xFF; }; gBattleMoveDamage = gBattleMons[battlerId].maxHP / battlerHoldEffectParam; if (gBattleMoveDamage == 0) gBattleMoveDamage = 1; if (gBattleMons[battlerId].hp + gBattleMoveDamage > gBattleMons[battlerId].maxHP) gBattleMoveDamage = gBattleMons[battlerId].maxHP - gBattleMons[battlerId].hp; gBattleMoveDamage *= -1; if (GetFlavorRelationByPersonality(gBattleMons[battlerId].personality, FLAVOR_SOUR) < 0) BattleScriptExecute(BattleScript_BerryConfuseHealEnd2); else BattleScriptExecute(BattleScript_ItemHealHP_RemoveItem); effect = ITEM_HP_CHANGE; };
+                break;
+            case 15:
+                if (gBattleMons[battlerId].hp <= gBattleMons[battlerId].maxHP / battlerHoldEffectParam
+                && !moveTurn && gBattleMons[battlerId].statStages[1] < 12)
+                {
+                    { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 5; gBattleTextBuff1[2] = 1; gBattleTextBuff1[3] = 0xFF; };
+                    { gBattleTextBuff2[0] = 0xFD; gBattleTextBuff2[1] = 0; gBattleTextBuff2[2] = 210; gBattleTextBuff2[3] = (210 & 0xFF00) >> 8; gBattleTextBuff2[4] = 0xFF; };
+                    gEffectBattler = battlerId;
+                    (gBattleScripting.statChanger = (1) + (1 << 4) + (0 << 7));
+                    gBattleScripting.animArg1 = 14 + 1;
+                    gBattleScripting.animArg2 = 0;
+                    BattleScriptExecute(BattleScript_BerryStatRaiseEnd2);
+                    effect = ITEM_STATS_CHANGE;
+                }
+                break;
+            case 16:
+                if (gBattleMons[battlerId].hp <= gBattleMons[battlerId].maxHP / battlerHoldEffectParam && !moveTurn && gBattleMons[battlerId].statStages[2] < 12) { { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 5; gBattleTextBuff1[2] = 2; gBattleTextBuff1[3] = 0xFF; }; gEffectBattler = battlerId; (gBattleScripting.statChanger = (2) + (1 << 4) + (0 << 7)); gBattleScripting.animArg1 = 14 + (2); gBattleScripting.animArg2 = 0; BattleScriptExecute(BattleScript_BerryStatRaiseEnd2); effect = ITEM_STATS_CHANGE; };
+                break;
+            case 17:
+                if (gBattleMons[battlerId].hp <= gBattleMons[battlerId].maxHP / battlerHoldEffectParam && !moveTurn && gBattleMons[battlerId].statStages[3] < 12) { { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 5; gBattleTextBuff1[2] = 3; gBattleTextBuff1[3] = 0xFF; }; gEffectBattler = battlerId; (gBattleScripting.statChanger = (3) + (1 << 4) + (0 << 7)); gBattleScripting.animArg1 = 14 + (3); gBattleScripting.animArg2 = 0; BattleScriptExecute(BattleScript_BerryStatRaiseEnd2); effect = ITEM_STATS_CHANGE; };
+                break;
+            case 18:
+                if (gBattleMons[battlerId].hp <= gBattleMons[battlerId].maxHP / battlerHoldEffectParam && !moveTurn && gBattleMons[battlerId].statStages[4] < 12) { { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 5; gBattleTextBuff1[2] = 4; gBattleTextBuff1[3] = 0xFF; }; gEffectBattler = battlerId; (gBattleScripting.statChanger = (4) + (1 << 4) + (0 << 7)); gBattleScripting.animArg1 = 14 + (4); gBattleScripting.animArg2 = 0; BattleScriptExecute(BattleScript_BerryStatRaiseEnd2); effect = ITEM_STATS_CHANGE; };
+                break;
+            case 19:
+                if (gBattleMons[battlerId].hp <= gBattleMons[battlerId].maxHP / battlerHoldEffectParam && !moveTurn && gBattleMons[battlerId].statStages[5] < 12) { { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 5; gBattleTextBuff1[2] = 5; gBattleTextBuff1[3] = 0xFF; }; gEffectBattler = battlerId; (gBattleScripting.statChanger = (5) + (1 << 4) + (0 << 7)); gBattleScripting.animArg1 = 14 + (5); gBattleScripting.animArg2 = 0; BattleScriptExecute(BattleScript_BerryStatRaiseEnd2); effect = ITEM_STATS_CHANGE; };
+                break;
+            case 20:
+                if (gBattleMons[battlerId].hp <= gBattleMons[battlerId].maxHP / battlerHoldEffectParam && !moveTurn
+                    && !(gBattleMons[battlerId].status2 & (1 << 20)))
+                {
+                    gBattleMons[battlerId].status2 |= (1 << 20);
+                    BattleScriptExecute(BattleScript_BerryFocusEnergyEnd2);
+                    effect = ITEM_EFFECT_OTHER;
+                }
+                break;
+            case 21:
+                if (!moveTurn && gBattleMons[battlerId].hp <= gBattleMons[battlerId].maxHP / battlerHoldEffectParam)
+                {
+                    for (i = 0; i < 6 - 1; i++)
+                    {
+                        if (gBattleMons[battlerId].statStages[1 + i] < 12)
+                            break;
+                    }
+                    if (i != 6 - 1)
+                    {
+                        do
+                        {
+                            i = Random() % (6 - 1);
+                        } while (gBattleMons[battlerId].statStages[1 + i] == 12);
+
+                        { gBattleTextBuff1[0] = 0xFD; gBattleTextBuff1[1] = 5; gBattleTextBuff1[2] = i + 1; gBattleTextBuff1[3] = 0xFF; };
+
+                        gBattleTextBuff2[0] = 0xFD;
+                        gBattleTextBuff2[1] = 0;
+                        gBattleTextBuff2[2] = 209;
+                        gBattleTextBuff2[3] = 209 >> 8;
+                        gBattleTextBuff2[4] = 0;
+                        gBattleTextBuff2[5] = 210;
+                        gBattleTextBuff2[6] = 210 >> 8;
+                        gBattleTextBuff2[7] = 0xFF;
+
+                        gEffectBattler = battlerId;
+                        (gBattleScripting.statChanger = (i + 1) + (2 << 4) + (0 << 7));
+                        gBattleScripting.animArg1 = 0x21 + i + 6;
+                        gBattleScripting.animArg2 = 0;
+                        BattleScriptExecute(BattleScript_BerryStatRaiseEnd2);
+                        effect = ITEM_STATS_CHANGE;
+                    }
+                }
+                break;
+            case 2:
+                if (gBattleMons[battlerId].status1 & (1 << 6))
+                {
+                    gBattleMons[battlerId].status1 &= ~(1 << 6);
+                    BattleScriptExecute(BattleScript_BerryCurePrlzEnd2);
+                    effect = ITEM_STATUS_CHANGE;
+                }
+                break;
+            case 4:
+                if (gBattleMons[battlerId].status1 & ((1 << 3) | (1 << 7)))
+                {
+                    gBattleMons[battlerId].status1 &= ~(((1 << 3) | (1 << 7)) | (1 << 8 | 1 << 9 | 1 << 10 | 1 << 11));
+                    BattleScriptExecute(BattleScript_BerryCurePsnEnd2);
+                    effect = ITEM_STATUS_CHANGE;
+                }
+                break;
+            case 5:
+                if (gBattleMons[battlerId].status1 & (1 << 4))
+                {
+                    gBattleMons[battlerId].status1 &= ~(1 << 4);
+                    BattleScriptExecute(BattleScript_BerryCureBrnEnd2);
+                    effect = ITEM_STATUS_CHANGE;
+                }
+                break;
+            case 6:
+                if (gBattleMons[battlerId].status1 & (1 << 5))
+                {
+                    gBattleMons[battlerId].status1 &= ~(1 << 5);
+                    BattleScriptExecute(BattleScript_BerryCureFrzEnd2);
+                    effect = ITEM_STATUS_CHANGE;
+                }
+                break;
+            case 3:
+                if (gBattleMons[battlerId].status1 & (1 << 0 | 1 << 1 | 1 << 2))
+                {
+                    gBattleMons[battlerId].status1 &= ~(1 << 0 | 1 << 1 | 1 << 2);
+                    gBattleMons[battlerId].status2 &= ~(1 << 27);
+                    BattleScriptExecute(BattleScript_BerryCureSlpEnd2);
+                    effect = ITEM_STATUS_CHANGE;
+                }
+                break;
+            case 8:
+                if (gBattleMons[battlerId].status2 & (1 << 0 | 1 << 1 | 1 << 2))
+                {
+                    gBattleMons[battlerId].status2 &= ~(1 << 0 | 1 << 1 | 1 << 2);
+                    BattleScriptExecute(BattleScript_BerryCureConfusionEnd2);
+                    effect = ITEM_EFFECT_OTHER;
+                }
+                break;
+            case 9:
+                if (gBattleMons[battlerId].status1 & ((1 << 0 | 1 << 1 | 1 << 2) | (1 << 3) | (1 << 4) | (1 << 5) | (1 << 6) | (1 << 7)) || gBattleMons[battlerId].status2 & (1 << 0 | 1 << 1 | 1 << 2))
+                {
+                    i = 0;
+                    if (gBattleMons[battlerId].status1 & ((1 << 3) | (1 << 7)))
+                    {
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_PoisonJpn);
+                        i++;
+                    }
+                    if (gBattleMons[battlerId].status1 & (1 << 0 | 1 << 1 | 1 << 2))
+                    {
+                        gBattleMons[battlerId].status2 &= ~(1 << 27);
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_SleepJpn);
+                        i++;
+                    }
+                    if (gBattleMons[battlerId].status1 & (1 << 6))
+                    {
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_ParalysisJpn);
+                        i++;
+                    }
+                    if (gBattleMons[battlerId].status1 & (1 << 4))
+                    {
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_BurnJpn);
+                        i++;
+                    }
+                    if (gBattleMons[battlerId].status1 & (1 << 5))
+                    {
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_IceJpn);
+                        i++;
+                    }
+                    if (gBattleMons[battlerId].status2 & (1 << 0 | 1 << 1 | 1 << 2))
+                    {
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_ConfusionJpn);
+                        i++;
+                    }
+                    if (i <= 1)
+                        gBattleCommunication[5] = 0;
+                    else
+                        gBattleCommunication[5] = 1;
+                    gBattleMons[battlerId].status1 = 0;
+                    gBattleMons[battlerId].status2 &= ~(1 << 0 | 1 << 1 | 1 << 2);
+                    BattleScriptExecute(BattleScript_BerryCureChosenStatusEnd2);
+                    effect = ITEM_STATUS_CHANGE;
+                }
+                break;
+            case 28:
+                if (gBattleMons[battlerId].status2 & (1 << 16 | 1 << 17 | 1 << 18 | 1 << 19))
+                {
+                    gBattleMons[battlerId].status2 &= ~(1 << 16 | 1 << 17 | 1 << 18 | 1 << 19);
+                    StringCopy(gBattleTextBuff1, gStatusConditionString_LoveJpn);
+                    BattleScriptExecute(BattleScript_BerryCureChosenStatusEnd2);
+                    gBattleCommunication[5] = 0;
+                    effect = ITEM_EFFECT_OTHER;
+                }
+                break;
+            }
+            if (effect != 0)
+            {
+                gBattleScripting.battler = battlerId;
+                gPotentialItemEffectBattler = battlerId;
+                gActiveBattler = gBattlerAttacker = battlerId;
+                switch (effect)
+                {
+                case ITEM_STATUS_CHANGE:
+                    BtlController_EmitSetMonData(BUFFER_A, REQUEST_STATUS_BATTLE, 0, 4, &gBattleMons[battlerId].status1);
+                    MarkBattlerForControllerExec(gActiveBattler);
+                    break;
+                case ITEM_PP_CHANGE:
+                    if ((!(gBattleMons[battlerId].status2 & (1 << 21)) && !(gDisableStructs[battlerId].mimickedMoves & gBitTable[i])))
+                        gBattleMons[battlerId].pp[i] = changedPP;
+                    break;
+                }
+            }
+        }
+        break;
+    case 2:
+        break;
+    case 3:
+        for (battlerId = 0; battlerId < gBattlersCount; battlerId++)
+        {
+            gLastUsedItem = gBattleMons[battlerId].item;
+            if (gBattleMons[battlerId].item == 175)
+            {
+                battlerHoldEffect = gEnigmaBerries[battlerId].holdEffect;
+                battlerHoldEffectParam = gEnigmaBerries[battlerId].holdEffectParam;
+            }
+            else
+            {
+                battlerHoldEffect = ItemId_GetHoldEffect(gLastUsedItem);
+                battlerHoldEffectParam = ItemId_GetHoldEffectParam(gLastUsedItem);
+            }
+            switch (battlerHoldEffect)
+            {
+            case 2:
+                if (gBattleMons[battlerId].status1 & (1 << 6))
+                {
+                    gBattleMons[battlerId].status1 &= ~(1 << 6);
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_BerryCureParRet;
+                    effect = ITEM_STATUS_CHANGE;
+                }
+                break;
+            case 4:
+                if (gBattleMons[battlerId].status1 & ((1 << 3) | (1 << 7)))
+                {
+                    gBattleMons[battlerId].status1 &= ~(((1 << 3) | (1 << 7)) | (1 << 8 | 1 << 9 | 1 << 10 | 1 << 11));
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_BerryCurePsnRet;
+                    effect = ITEM_STATUS_CHANGE;
+                }
+                break;
+            case 5:
+                if (gBattleMons[battlerId].status1 & (1 << 4))
+                {
+                    gBattleMons[battlerId].status1 &= ~(1 << 4);
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_BerryCureBrnRet;
+                    effect = ITEM_STATUS_CHANGE;
+                }
+                break;
+            case 6:
+                if (gBattleMons[battlerId].status1 & (1 << 5))
+                {
+                    gBattleMons[battlerId].status1 &= ~(1 << 5);
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_BerryCureFrzRet;
+                    effect = ITEM_STATUS_CHANGE;
+                }
+                break;
+            case 3:
+                if (gBattleMons[battlerId].status1 & (1 << 0 | 1 << 1 | 1 << 2))
+                {
+                    gBattleMons[battlerId].status1 &= ~(1 << 0 | 1 << 1 | 1 << 2);
+                    gBattleMons[battlerId].status2 &= ~(1 << 27);
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_BerryCureSlpRet;
+                    effect = ITEM_STATUS_CHANGE;
+                }
+                break;
+            case 8:
+                if (gBattleMons[battlerId].status2 & (1 << 0 | 1 << 1 | 1 << 2))
+                {
+                    gBattleMons[battlerId].status2 &= ~(1 << 0 | 1 << 1 | 1 << 2);
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_BerryCureConfusionRet;
+                    effect = ITEM_EFFECT_OTHER;
+                }
+                break;
+            case 28:
+                if (gBattleMons[battlerId].status2 & (1 << 16 | 1 << 17 | 1 << 18 | 1 << 19))
+                {
+                    gBattleMons[battlerId].status2 &= ~(1 << 16 | 1 << 17 | 1 << 18 | 1 << 19);
+                    StringCopy(gBattleTextBuff1, gStatusConditionString_LoveJpn);
+                    BattleScriptPushCursor();
+                    gBattleCommunication[5] = 0;
+                    gBattlescriptCurrInstr = BattleScript_BerryCureChosenStatusRet;
+                    effect = ITEM_EFFECT_OTHER;
+                }
+                break;
+            case 9:
+                if (gBattleMons[battlerId].status1 & ((1 << 0 | 1 << 1 | 1 << 2) | (1 << 3) | (1 << 4) | (1 << 5) | (1 << 6) | (1 << 7)) || gBattleMons[battlerId].status2 & (1 << 0 | 1 << 1 | 1 << 2))
+                {
+                    if (gBattleMons[battlerId].status1 & ((1 << 3) | (1 << 7)))
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_PoisonJpn);
+
+                    if (gBattleMons[battlerId].status1 & (1 << 0 | 1 << 1 | 1 << 2))
+                    {
+                        gBattleMons[battlerId].status2 &= ~(1 << 27);
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_SleepJpn);
+                    }
+
+                    if (gBattleMons[battlerId].status1 & (1 << 6))
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_ParalysisJpn);
+
+                    if (gBattleMons[battlerId].status1 & (1 << 4))
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_BurnJpn);
+
+                    if (gBattleMons[battlerId].status1 & (1 << 5))
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_IceJpn);
+
+                    if (gBattleMons[battlerId].status2 & (1 << 0 | 1 << 1 | 1 << 2))
+                        StringCopy(gBattleTextBuff1, gStatusConditionString_ConfusionJpn);
+
+                    gBattleMons[battlerId].status1 = 0;
+                    gBattleMons[battlerId].status2 &= ~(1 << 0 | 1 << 1 | 1 << 2);
+                    BattleScriptPushCursor();
+                    gBattleCommunication[5] = 0;
+                    gBattlescriptCurrInstr = BattleScript_BerryCureChosenStatusRet;
+                    effect = ITEM_STATUS_CHANGE;
+                }
+                break;
+            case 23:
+                for (i = 0; i < (6 + 2); i++)
+                {
+                    if (gBattleMons[battlerId].statStages[i] < 6)
+                    {
+                        gBattleMons[battlerId].statStages[i] = 6;
+                        effect = ITEM_STATS_CHANGE;
+                    }
+                }
+                if (effect != 0)
+                {
+                    gBattleScripting.battler = battlerId;
+                    gPotentialItemEffectBattler = battlerId;
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_WhiteHerbRet;
+                    return effect;
+                }
+                break;
+            }
+            if (effect != 0)
+            {
+                gBattleScripting.battler = battlerId;
+                gPotentialItemEffectBattler = battlerId;
+                gActiveBattler = battlerId;
+                BtlController_EmitSetMonData(BUFFER_A, REQUEST_STATUS_BATTLE, 0, 4, &gBattleMons[gActiveBattler].status1);
+                MarkBattlerForControllerExec(gActiveBattler);
+                break;
+            }
+        }
+        break;
+    case 4:
+        if (gBattleMoveDamage)
+        {
+            switch (atkHoldEffect)
+            {
+            case 30:
+                if (!(gMoveResultFlags & ((1 << 0) | (1 << 3) | (1 << 5)))
+                    && ((gSpecialStatuses[gBattlerTarget].physicalDmg != 0 || gSpecialStatuses[gBattlerTarget].specialDmg != 0))
+                    && (Random() % 100) < battlerHoldEffectParam
+                    && gBattleMoves[gCurrentMove].flags & (1 << 5)
+                    && gBattleMons[gBattlerTarget].hp)
+                {
+                    gBattleCommunication[3] = 8;
+                    BattleScriptPushCursor();
+                    SetMoveEffect(0, 0);
+                    BattleScriptPop();
+                }
+                break;
+            case 62:
+                if (!(gMoveResultFlags & ((1 << 0) | (1 << 3) | (1 << 5)))
+                    && gSpecialStatuses[gBattlerTarget].dmg != 0
+                    && gSpecialStatuses[gBattlerTarget].dmg != 0xFFFF
+                    && gBattlerAttacker != gBattlerTarget
+                    && gBattleMons[gBattlerAttacker].hp != gBattleMons[gBattlerAttacker].maxHP
+                    && gBattleMons[gBattlerAttacker].hp != 0)
+                {
+                    gLastUsedItem = atkItem;
+                    gPotentialItemEffectBattler = gBattlerAttacker;
+                    gBattleScripting.battler = gBattlerAttacker;
+                    gBattleMoveDamage = (gSpecialStatuses[gBattlerTarget].dmg / atkHoldEffectParam) * -1;
+                    if (gBattleMoveDamage == 0)
+                        gBattleMoveDamage = -1;
+                    gSpecialStatuses[gBattlerTarget].dmg = 0;
+                    BattleScriptPushCursor();
+                    gBattlescriptCurrInstr = BattleScript_ItemHealHP_Ret;
+                    effect++;
+                }
+                break;
+            }
+        }
+        break;
+    }
+
+    return effect;
+}
+
+void ClearFuryCutterDestinyBondGrudge(u8 battlerId)
+{
+    gDisableStructs[battlerId].furyCutterCounter = 0;
+    gBattleMons[battlerId].status2 &= ~(1 << 25);
+    gStatuses3[battlerId] &= ~(1 << 14);
+}
+
+void HandleAction_RunBattleScript(void)
+{
+    if (gBattleControllerExecFlags == 0)
+        gBattleScriptingCommandsTable[*gBattlescriptCurrInstr]();
+}
+
+u8 GetMoveTarget(u16 move, u8 setTarget)
+{
+    u8 targetBattler = 0;
+    u8 moveTarget;
+    u8 side;
+
+    if (setTarget != 0)
+        moveTarget = setTarget - 1;
+    else
+        moveTarget = gBattleMoves[move].target;
+
+    switch (moveTarget)
+    {
+    case 0:
+        side = GetBattlerSide(gBattlerAttacker) ^ 1;
+        if (gSideTimers[side].followmeTimer && gBattleMons[gSideTimers[side].followmeTarget].hp)
+            targetBattler = gSideTimers[side].followmeTarget;
+        else
+        {
+            side = GetBattlerSide(gBattlerAttacker);
+            do
+            {
+                targetBattler = Random() % gBattlersCount;
+            } while (targetBattler == gBattlerAttacker || side == GetBattlerSide(targetBattler) || gAbsentBattlerFlags & gBitTable[targetBattler]);
+            if (gBattleMoves[move].type == 13
+                && AbilityBattleEffects(16, gBattlerAttacker, 31, 0, 0)
+                && gBattleMons[targetBattler].ability != 31)
+            {
+                targetBattler ^= 2;
+                RecordAbilityBattle(targetBattler, gBattleMons[targetBattler].ability);
+                gSpecialStatuses[targetBattler].lightningRodRedirected = 1;
+            }
+        }
+        break;
+    case (1 << 0):
+    case (1 << 3):
+    case (1 << 5):
+    case (1 << 6):
+        targetBattler = GetBattlerAtPosition((GetBattlerPosition(gBattlerAttacker) & 1) ^ 1);
+        if (gAbsentBattlerFlags & gBitTable[targetBattler])
+            targetBattler ^= 2;
+        break;
+    case (1 << 2):
+        side = GetBattlerSide(gBattlerAttacker) ^ 1;
+        if (gSideTimers[side].followmeTimer && gBattleMons[gSideTimers[side].followmeTarget].hp)
+            targetBattler = gSideTimers[side].followmeTarget;
+        else if (gBattleTypeFlags & (1 << 0) && moveTarget & (1 << 2))
+        {
+            if (GetBattlerSide(gBattlerAttacker) == 0)
+            {
+                if (Random() & 1)
+                    targetBattler = GetBattlerAtPosition(1);
+                else
+                    targetBattler = GetBattlerAtPosition(3);
+            }
+            else
+            {
+                if (Random() & 1)
+                    targetBattler = GetBattlerAtPosition(0);
+                else
+                    targetBattler = GetBattlerAtPosition(2);
+            }
+            if (gAbsentBattlerFlags & gBitTable[targetBattler])
+                targetBattler ^= 2;
+        }
+        else
+            targetBattler = GetBattlerAtPosition((GetBattlerPosition(gBattlerAttacker) & 1) ^ 1);
+        break;
+    case (1 << 1):
+    case (1 << 4):
+        targetBattler = gBattlerAttacker;
+        break;
+    }
+
+    *(gBattleStruct->moveTarget + gBattlerAttacker) = targetBattler;
+
+    return targetBattler;
+}
+
+static bool32 IsBattlerModernFatefulEncounter(u8 battlerId)
+{
+    if (GetBattlerSide(battlerId) == 1)
+        return 1;
+    if (GetMonData(&gPlayerParty[gBattlerPartyIndexes[battlerId]], 11, 
+# 3137 "src/battle_util.c" 3 4
+                                                                                    ((void *)0)
+# 3137 "src/battle_util.c"
+                                                                                        ) != 410
+        && GetMonData(&gPlayerParty[gBattlerPartyIndexes[battlerId]], 11, 
+# 3138 "src/battle_util.c" 3 4
+                                                                                       ((void *)0)
+# 3138 "src/battle_util.c"
+                                                                                           ) != 151)
+            return 1;
+    return GetMonData(&gPlayerParty[gBattlerPartyIndexes[battlerId]], 80, 
+# 3140 "src/battle_util.c" 3 4
+                                                                                                        ((void *)0)
+# 3140 "src/battle_util.c"
+                                                                                                            );
+}
+
+u8 IsMonDisobedient(void)
+{
+    s32 rnd;
+    s32 calc;
+    u8 obedienceLevel = 0;
+
+    if ((gBattleTypeFlags & ((1 << 1) | (1 << 16))))
+        return 0;
+    if (GetBattlerSide(gBattlerAttacker) == 1)
+        return 0;
+
+    if (IsBattlerModernFatefulEncounter(gBattlerAttacker))
+    {
+        if (!IsOtherTrainer(gBattleMons[gBattlerAttacker].otId, gBattleMons[gBattlerAttacker].otName))
+            return 0;
+        if (FlagGet(((((0x4FF + 1) + 768 - 1) + 1) + 0x27)))
+            return 0;
+
+        obedienceLevel = 10;
+
+        if (FlagGet(((((0x4FF + 1) + 768 - 1) + 1) + 0x21)))
+            obedienceLevel = 30;
+        if (FlagGet(((((0x4FF + 1) + 768 - 1) + 1) + 0x23)))
+            obedienceLevel = 50;
+        if (FlagGet(((((0x4FF + 1) + 768 - 1) + 1) + 0x25)))
+            obedienceLevel = 70;
+    }
+
+    if (gBattleMons[gBattlerAttacker].level <= obedienceLevel)
+        return 0;
+    rnd = (Random() & 255);
+    calc = (gBattleMons[gBattlerAttacker].level + obedienceLevel) * rnd >> 8;
+    if (calc < obedienceLevel)
+        return 0;
+
+
+    if (gCurrentMove == 99)
+        gBattleMons[gBattlerAttacker].status2 &= ~(1 << 23);
+    if (gBattleMons[gBattlerAttacker].status1 & (1 << 0 | 1 << 1 | 1 << 2) && (gCurrentMove == 173 || gCurrentMove == 214))
+    {
+        gBattlescriptCurrInstr = BattleScript_IgnoresWhileAsleep;
+        return 1;
+    }
+
+    rnd = (Random() & 255);
+    calc = (gBattleMons[gBattlerAttacker].level + obedienceLevel) * rnd >> 8;
+    if (calc < obedienceLevel && gCurrentMove != 264)
+    {
+        calc = CheckMoveLimitations(gBattlerAttacker, gBitTable[gCurrMovePos], 0xFF);
+        if (calc == 0xF)
+        {
+
+
+            gBattleCommunication[5] = Random() & (4 - 1);
+            gBattlescriptCurrInstr = BattleScript_MoveUsedLoafingAround;
+            return 1;
+        }
+        else
+        {
+            do
+            {
+                gCurrMovePos = gChosenMovePos = Random() & (4 - 1);
+            } while (gBitTable[gCurrMovePos] & calc);
+
+            gCalledMove = gBattleMons[gBattlerAttacker].moves[gCurrMovePos];
+            gBattlescriptCurrInstr = BattleScript_IgnoresAndUsesRandomMove;
+            gBattlerTarget = GetMoveTarget(gCalledMove, 0);
+            gHitMarker |= (1 << 21);
+            return 2;
+        }
+    }
+    else
+    {
+        obedienceLevel = gBattleMons[gBattlerAttacker].level - obedienceLevel;
+
+        calc = (Random() & 255);
+        if (calc < obedienceLevel && !(gBattleMons[gBattlerAttacker].status1 & ((1 << 0 | 1 << 1 | 1 << 2) | (1 << 3) | (1 << 4) | (1 << 5) | (1 << 6) | (1 << 7))) && gBattleMons[gBattlerAttacker].ability != 72 && gBattleMons[gBattlerAttacker].ability != 15)
+        {
+
+            int i;
+            for (i = 0; i < gBattlersCount; i++)
+            {
+                if (gBattleMons[i].status2 & (1 << 4 | 1 << 5 | 1 << 6))
+                    break;
+            }
+            if (i == gBattlersCount)
+            {
+                gBattlescriptCurrInstr = BattleScript_IgnoresAndFallsAsleep;
+                return 1;
+            }
+        }
+        calc -= obedienceLevel;
+        if (calc < obedienceLevel)
+        {
+            gBattleMoveDamage = CalculateBaseDamage(&gBattleMons[gBattlerAttacker], &gBattleMons[gBattlerAttacker], 1, 0, 40, 0, gBattlerAttacker, gBattlerAttacker);
+            gBattlerTarget = gBattlerAttacker;
+            gBattlescriptCurrInstr = BattleScript_IgnoresAndHitsItself;
+            gHitMarker |= (1 << 19);
+            return 2;
+        }
+        else
+        {
+
+
+            gBattleCommunication[5] = Random() & (4 - 1);
+            gBattlescriptCurrInstr = BattleScript_MoveUsedLoafingAround;
+            return 1;
+        }
+    }
+}
@@ -6,6 +6,12 @@ make -C tools/gbagfx CXX=${1:-g++}
 make -C tools/preproc CXX=${1:-g++}
 make -C tools/ramscrgen CXX=${1:-g++}
 make -C tools/rsfont CXX=${1:-g++}
+make -C tools/symgen CXX=${1:-g++}
 make -C tools/scaninc CXX=${1:-g++}
 make -C tools/mapjson CXX=${1:-g++}
 make -C tools/jsonproc CXX=${1:-g++}
+make -C tools/objcache CXX=${1:-g++}
+make -C tools/asmsplit CXX=${1:-g++}
+make -C tools/scriptasm CXX=${1:-g++}
+make -C tools/romlink CXX=${1:-g++}
+make -C tools/iwramgen CXX=${1:-g++}
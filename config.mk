@@ -5,6 +5,19 @@ GAME_REVISION ?= 0
 GAME_LANGUAGE ?= ENGLISH
 MODERN        ?= 0
 COMPARE       ?= 0
+MIDI_OBJ      ?= 0
+USE_ASSETD    ?= 0
+ASSETD_SOCKET ?= build/assetd.sock
+USE_OBJCACHE  ?= 0
+OBJCACHE_DIR  ?= .objcache
+USE_SCRIPTASM ?= 0
+INCREMENTAL_LINK ?= 0
+IWRAM_FUNCTIONS ?=
+IWRAM_CODE_BUDGET ?= 0x2000
+IWRAM_STACK_RESERVE ?= 0x1000
+HOST_CC       ?= cc
+HOST_AR       ?= ar
+HOST_CFLAGS   ?= -O2 -g
 
 # For gbafix
 MAKER_CODE  := 01
@@ -0,0 +1,553 @@
+// Micro-benchmarks for the engine core, built by "make host".
+//
+//   bench [-n ITERATIONS] [NAME...]
+//
+// runs each benchmark (or only the ones named) and prints how long an
+// iteration took, with a checksum of the state it left behind. The work is
+// the same on every run, so a change that should only make the code faster
+// must leave the checksums alone.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "global.h"
+#include "dma3.h"
+#include "main.h"
+#include "malloc.h"
+#include "palette.h"
+#include "random.h"
+#include "sprite.h"
+#include "task.h"
+
+struct Benchmark
+{
+    const char *name;
+    void (*setup)(void);
+    void (*run)(void);
+    u32 (*checksum)(void);
+};
+
+static u32 sBenchRng;
+
+// The benchmarks' own numbers come from here, so that the random benchmark
+// doesn't change them.
+static u16 BenchRandom(void)
+{
+    sBenchRng = ISO_RANDOMIZE1(sBenchRng);
+    return sBenchRng >> 16;
+}
+
+static u32 Checksum(const void *data, size_t size)
+{
+    const u8 *bytes = data;
+    u32 hash = 2166136261u;
+    size_t i;
+
+    for (i = 0; i < size; i++)
+        hash = (hash ^ bytes[i]) * 16777619u;
+
+    return hash;
+}
+
+extern u8 gSpriteOrder[];
+
+#define NUM_HEAP_BLOCKS 48
+#define NUM_STRESS_BLOCKS 256
+
+static void *sHeapBlocks[NUM_STRESS_BLOCKS];
+static u16 sHeapBlockSizes[NUM_STRESS_BLOCKS];
+
+static void SetupMalloc(void)
+{
+    InitHeap(gHeap, HEAP_SIZE);
+    memset(sHeapBlocks, 0, sizeof(sHeapBlocks));
+}
+
+// Frees the block in the given slot if there is one, or allocates one of the
+// given size there and fills it with the slot number.
+static void ToggleHeapBlock(int slot, u16 size)
+{
+    if (sHeapBlocks[slot] != NULL)
+    {
+        Free(sHeapBlocks[slot]);
+        sHeapBlocks[slot] = NULL;
+    }
+    else
+    {
+        sHeapBlocks[slot] = Alloc(size);
+        sHeapBlockSizes[slot] = size;
+        if (sHeapBlocks[slot] != NULL)
+            memset(sHeapBlocks[slot], slot, size);
+    }
+}
+
+// Frees and allocates blocks of mixed sizes the way a scene change does.
+static void RunMalloc(void)
+{
+    int i;
+
+    for (i = 0; i < NUM_HEAP_BLOCKS; i++)
+    {
+        int slot = BenchRandom() % NUM_HEAP_BLOCKS;
+
+        ToggleHeapBlock(slot, 16 + (BenchRandom() & 0x3FF));
+    }
+}
+
+// Many small blocks and a few large ones, as a menu full of windows and
+// sprites has.
+static void RunMallocStress(void)
+{
+    int i;
+
+    for (i = 0; i < 32; i++)
+    {
+        int slot = BenchRandom() % NUM_STRESS_BLOCKS;
+
+        if (BenchRandom() % 8 == 0)
+            ToggleHeapBlock(slot, 64 + (BenchRandom() & 0x7FF));
+        else
+            ToggleHeapBlock(slot, 1 + (BenchRandom() & 0x3F));
+    }
+}
+
+// The blocks' contents rather than their addresses, which depend on how the
+// allocator lays out the heap.
+static u32 ChecksumMalloc(void)
+{
+    u32 hash = CheckHeap();
+    int i;
+
+    for (i = 0; i < NUM_STRESS_BLOCKS; i++)
+    {
+        hash = hash * 31 + (sHeapBlocks[i] != NULL);
+        if (sHeapBlocks[i] != NULL)
+            hash = hash * 31 + Checksum(sHeapBlocks[i], sHeapBlockSizes[i]);
+    }
+
+    return hash;
+}
+
+static void Task_Count(u8 taskId)
+{
+    gTasks[taskId].data[0]++;
+}
+
+static void SetupTasks(void)
+{
+    int i;
+
+    ResetTasks();
+    for (i = 0; i < 12; i++)
+        CreateTask(Task_Count, BenchRandom() & 0xFF);
+}
+
+// A frame in which one task ends and another starts.
+static void RunTaskFrame(void)
+{
+    u8 taskId = BenchRandom() % NUM_TASKS;
+
+    if (gTasks[taskId].isActive)
+    {
+        DestroyTask(taskId);
+        CreateTask(Task_Count, BenchRandom() & 0xFF);
+    }
+
+    RunTasks();
+}
+
+// Only the tasks' data, since the functions' addresses change with the code.
+static u32 ChecksumTasks(void)
+{
+    u32 hash = 0;
+    int i;
+
+    for (i = 0; i < NUM_TASKS; i++)
+    {
+        u8 links[4] = {gTasks[i].isActive, gTasks[i].prev, gTasks[i].next, gTasks[i].priority};
+
+        hash = hash * 31 + Checksum(links, sizeof(links));
+        hash = hash * 31 + Checksum(gTasks[i].data, sizeof(gTasks[i].data));
+    }
+
+    return hash;
+}
+
+#define NUM_BENCH_SPRITES 64
+
+static void SetupSprites(void)
+{
+    int i;
+
+    ResetSpriteData();
+    for (i = 0; i < NUM_BENCH_SPRITES; i++)
+        CreateSprite(&gDummySpriteTemplate, BenchRandom() % DISPLAY_WIDTH, BenchRandom() % DISPLAY_HEIGHT, BenchRandom() & 0xFF);
+}
+
+// A frame of sprites moving up and down past each other.
+static void RunSprites(void)
+{
+    int i;
+
+    for (i = 0; i < NUM_BENCH_SPRITES; i += 4)
+        gSprites[i].y = BenchRandom() % DISPLAY_HEIGHT;
+
+    AnimateSprites();
+    BuildOamBuffer();
+}
+
+static u32 ChecksumSprites(void)
+{
+    return Checksum(gMain.oamBuffer, sizeof(gMain.oamBuffer)) ^ Checksum(gSpriteOrder, MAX_SPRITES);
+}
+
+#define NUM_OVERWORLD_SPRITES 6
+
+static u8 sOverworldSpriteIds[NUM_OVERWORLD_SPRITES];
+
+static void SetupOverworldSprites(void)
+{
+    int i;
+
+    ResetSpriteData();
+    for (i = 0; i < NUM_OVERWORLD_SPRITES; i++)
+        sOverworldSpriteIds[i] = CreateSprite(&gDummySpriteTemplate, BenchRandom() % DISPLAY_WIDTH, BenchRandom() % DISPLAY_HEIGHT, 0);
+}
+
+// A frame of the few sprites on an overworld map walking around, with one of
+// them going off screen and another coming on now and then.
+static void RunOverworldSprites(void)
+{
+    int i = BenchRandom() % NUM_OVERWORLD_SPRITES;
+
+    gSprites[sOverworldSpriteIds[i]].x += 1;
+    gSprites[sOverworldSpriteIds[i]].y += 1;
+    if (BenchRandom() % 16 == 0)
+    {
+        DestroySprite(&gSprites[sOverworldSpriteIds[i]]);
+        sOverworldSpriteIds[i] = CreateSprite(&gDummySpriteTemplate, BenchRandom() % DISPLAY_WIDTH, BenchRandom() % DISPLAY_HEIGHT, 0);
+    }
+
+    AnimateSprites();
+    BuildOamBuffer();
+}
+
+static bool8 sSpritesReversed;
+
+// A battle scene's worth of sprites, some of them large affine ones, with
+// the same priority so that their order only depends on their Y positions.
+static void SetupSpriteSortWorstCase(void)
+{
+    int i;
+
+    ResetSpriteData();
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        u8 spriteId = CreateSprite(&gDummySpriteTemplate, BenchRandom() % DISPLAY_WIDTH, 0, 0);
+
+        if (i % 8 == 0)
+        {
+            gSprites[spriteId].oam.affineMode = ST_OAM_AFFINE_DOUBLE;
+            gSprites[spriteId].oam.size = 3;
+        }
+    }
+
+    sSpritesReversed = FALSE;
+}
+
+// Reverses the sprites' order on screen every frame, the most work for a sort
+// that starts from the previous frame's order.
+static void RunSpriteSortWorstCase(void)
+{
+    int i;
+
+    sSpritesReversed ^= TRUE;
+    for (i = 0; i < MAX_SPRITES; i++)
+        gSprites[i].y = sSpritesReversed ? 2 * i : 190 - 2 * i;
+
+    BuildOamBuffer();
+}
+
+#define NUM_TILE_RANGES 24
+
+static struct SpriteFrameImage sTileRangeImages[NUM_TILE_RANGES];
+static s16 sTileRangeStarts[NUM_TILE_RANGES];
+
+static void SetupSpriteTiles(void)
+{
+    int i;
+
+    ResetSpriteData();
+    for (i = 0; i < NUM_TILE_RANGES; i++)
+        sTileRangeStarts[i] = -1;
+}
+
+// A battle animation's worth of sprites that have their own tiles being
+// created and destroyed.
+static void RunSpriteTiles(void)
+{
+    int i;
+
+    for (i = 0; i < 8; i++)
+    {
+        int slot = BenchRandom() % NUM_TILE_RANGES;
+
+        if (sTileRangeStarts[slot] >= 0)
+        {
+            struct Sprite sprite = {0};
+
+            sprite.images = &sTileRangeImages[slot];
+            sprite.oam.tileNum = sTileRangeStarts[slot];
+            FreeSpriteTilesIfNotUsingSheet(&sprite);
+            sTileRangeStarts[slot] = -1;
+        }
+        else
+        {
+            u16 tileCount = 1 + BenchRandom() % 64;
+
+            sTileRangeImages[slot].size = tileCount * TILE_SIZE_4BPP;
+            sTileRangeStarts[slot] = AllocSpriteTiles(tileCount);
+        }
+    }
+}
+
+static u32 ChecksumSpriteTiles(void)
+{
+    return Checksum(sTileRangeStarts, sizeof(sTileRangeStarts));
+}
+
+static void SetupPaletteFade(void)
+{
+    int i;
+
+    ResetTasks();
+    ResetPaletteFade();
+    for (i = 0; i < PLTT_SIZE / 2; i++)
+        gPlttBufferUnfaded[i] = gPlttBufferFaded[i] = BenchRandom() & 0x7FFF;
+}
+
+// A frame of fading all the palettes out and back in.
+static void RunPaletteFade(void)
+{
+    if (!gPaletteFade.active)
+    {
+        if (gPaletteFade.y == 0)
+            BeginNormalPaletteFade(PALETTES_ALL, 0, 0, 16, RGB_BLACK);
+        else
+            BeginNormalPaletteFade(PALETTES_ALL, 0, 16, 0, RGB_BLACK);
+    }
+
+    UpdatePaletteFade();
+    TransferPlttBuffer();
+}
+
+static u32 ChecksumPaletteFade(void)
+{
+    return Checksum(gHostPltt, sizeof(gHostPltt));
+}
+
+static u8 sPaletteCycleCoeff;
+
+static void SetupPaletteCycle(void)
+{
+    SetupPaletteFade();
+    TransferPlttBuffer();
+    sPaletteCycleCoeff = 0;
+}
+
+// A frame of pulsing two palettes, as battle animations and field effects do,
+// while the others stay as they are.
+static void RunPaletteCycle(void)
+{
+    BlendPalettes((1 << 2) | (1 << 18), sPaletteCycleCoeff, RGB_WHITE);
+    sPaletteCycleCoeff = (sPaletteCycleCoeff + 1) % 17;
+    TransferPlttBuffer();
+}
+
+static u8 sDma3Source[0x10000] ALIGNED(4);
+
+static void SetupDma3(void)
+{
+    int i;
+
+    HostSetDmaTiming(FALSE);
+    ClearDma3Requests();
+    REG_VCOUNT = DISPLAY_HEIGHT;
+    memset(gHostVram, 0, sizeof(gHostVram));
+    for (i = 0; i < (int)sizeof(sDma3Source); i++)
+        sDma3Source[i] = BenchRandom();
+}
+
+// A frame of a map scene: some tiles streamed in blocks, as decompressed
+// graphics are, a tilemap and a cleared window, queued and then done at
+// VBlank. Some frames have more than fits in one VBlank.
+static void RunDma3(void)
+{
+    int i;
+    int numBlocks = BenchRandom() % 48;
+    u32 src = (BenchRandom() % 16) * 0x400;
+    u32 dest = (BenchRandom() % 16) * 0x400;
+
+    for (i = 0; i < numBlocks; i++)
+        RequestDma3Copy(sDma3Source + src + i * 0x200, gHostVram + dest + i * 0x200, 0x200, DMA3_16BIT);
+
+    RequestDma3Copy(sDma3Source + (BenchRandom() % 8) * 0x800, gHostVram + 0x10000, 0x800, DMA3_16BIT | DMA3_HIGH_PRIORITY);
+    RequestDma3Fill(BenchRandom(), gHostVram + 0x10800, 0x800, DMA3_32BIT);
+    ProcessDma3Requests();
+}
+
+static u32 ChecksumDma3(void)
+{
+    // Finish what's still waiting, so the result doesn't depend on the order.
+    while (WaitDma3Request(-1) != 0)
+        ProcessDma3Requests();
+    return Checksum(gHostVram, sizeof(gHostVram));
+}
+
+static u8 sDma3WorstOverrun;
+
+static void SetupDma3Late(void)
+{
+    SetupDma3();
+    HostSetDmaTiming(TRUE);
+    sDma3WorstOverrun = 0;
+}
+
+// A frame whose uploads start 4 lines before the end of VBlank: a block of
+// streamed tiles, which is merged into few requests, and then the tilemap
+// that goes with it. The DMAs move VCOUNT on as they would on hardware, and
+// the checksum includes how far into the next frame they went at worst.
+static void RunDma3Late(void)
+{
+    int i;
+    u32 src = (BenchRandom() % 32) * 0x400;
+    u32 dest = (BenchRandom() % 32) * 0x400;
+    u32 endLine;
+
+    for (i = 0; i < 32; i++)
+        RequestDma3Copy(sDma3Source + src + i * 0x200, gHostVram + dest + i * 0x200, 0x200, DMA3_16BIT);
+
+    RequestDma3Copy(sDma3Source + (BenchRandom() % 8) * 0x800, gHostVram + 0x10000, 0x800, DMA3_16BIT);
+    REG_VCOUNT = 220;
+    ProcessDma3Requests();
+
+    endLine = REG_VCOUNT < 220 ? REG_VCOUNT + 228 : REG_VCOUNT;
+    if (endLine > 227 && sDma3WorstOverrun < endLine - 227)
+        sDma3WorstOverrun = endLine - 227;
+}
+
+static u32 ChecksumDma3Late(void)
+{
+    u32 checksum;
+
+    while (WaitDma3Request(-1) != 0)
+    {
+        REG_VCOUNT = 160;
+        ProcessDma3Requests();
+    }
+
+    checksum = Checksum(gHostVram, sizeof(gHostVram)) ^ sDma3WorstOverrun;
+    HostSetDmaTiming(FALSE);
+    return checksum;
+}
+
+static u32 sRandomSum;
+
+static void SetupRandom(void)
+{
+    SeedRng(0);
+    sRandomSum = 0;
+}
+
+static void RunRandom(void)
+{
+    int i;
+
+    for (i = 0; i < 256; i++)
+        sRandomSum += Random();
+}
+
+static u32 ChecksumRandom(void)
+{
+    return sRandomSum;
+}
+
+static const struct Benchmark sBenchmarks[] =
+{
+    {"malloc",        SetupMalloc,              RunMalloc,              ChecksumMalloc},
+    {"malloc_stress", SetupMalloc,              RunMallocStress,        ChecksumMalloc},
+    {"tasks",         SetupTasks,               RunTaskFrame,           ChecksumTasks},
+    {"sprites",       SetupSprites,             RunSprites,             ChecksumSprites},
+    {"sprite_sort",   SetupSpriteSortWorstCase, RunSpriteSortWorstCase, ChecksumSprites},
+    {"overworld",     SetupOverworldSprites,    RunOverworldSprites,    ChecksumSprites},
+    {"sprite_tiles",  SetupSpriteTiles,         RunSpriteTiles,         ChecksumSpriteTiles},
+    {"palette_fade",  SetupPaletteFade,         RunPaletteFade,         ChecksumPaletteFade},
+    {"palette_cycle", SetupPaletteCycle,        RunPaletteCycle,        ChecksumPaletteFade},
+    {"dma3",          SetupDma3,                RunDma3,                ChecksumDma3},
+    {"dma3_late",     SetupDma3Late,            RunDma3Late,            ChecksumDma3Late},
+    {"random",        SetupRandom,              RunRandom,              ChecksumRandom},
+};
+
+static double Seconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static bool32 IsSelected(const char *name, int argc, char **argv)
+{
+    int i;
+
+    if (argc == 0)
+        return TRUE;
+
+    for (i = 0; i < argc; i++)
+        if (strcmp(argv[i], name) == 0)
+            return TRUE;
+
+    return FALSE;
+}
+
+int main(int argc, char **argv)
+{
+    long iterations = 100000;
+    size_t i;
+
+    argc--;
+    argv++;
+    if (argc >= 2 && strcmp(argv[0], "-n") == 0)
+    {
+        iterations = strtol(argv[1], NULL, 0);
+        argc -= 2;
+        argv += 2;
+    }
+
+    if (iterations <= 0)
+    {
+        fprintf(stderr, "Usage: bench [-n ITERATIONS] [NAME...]\n");
+        return 1;
+    }
+
+    for (i = 0; i < ARRAY_COUNT(sBenchmarks); i++)
+    {
+        const struct Benchmark *benchmark = &sBenchmarks[i];
+        double start;
+        long j;
+
+        if (!IsSelected(benchmark->name, argc, argv))
+            continue;
+
+        sBenchRng = 0;
+        benchmark->setup();
+        start = Seconds();
+        for (j = 0; j < iterations; j++)
+            benchmark->run();
+
+        printf("%-15s %10.1f ns  checksum %08X\n", benchmark->name,
+            (Seconds() - start) * 1e9 / iterations, benchmark->checksum());
+    }
+
+    return 0;
+}
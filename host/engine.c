@@ -0,0 +1,14 @@
+// Definitions the host build's core files need from parts of the engine it
+// doesn't build. They're weak, so a program that builds those parts too gets
+// the real ones.
+
+#include "global.h"
+#include "decompress.h"
+#include "main.h"
+
+__attribute__((weak)) struct Main gMain;
+
+__attribute__((weak)) void LZDecompressWram(const void *src, void *dest)
+{
+    LZ77UnCompWram(src, dest);
+}
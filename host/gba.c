@@ -0,0 +1,382 @@
+// The hardware under the host build: memory regions and I/O registers as
+// plain arrays, DMA done with memcpy-like loops, and C versions of the BIOS
+// calls in libagbsyscall.
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "global.h"
+
+unsigned char gHostEwram[0x40000] ALIGNED(4);
+// The heap is at the start of EWRAM, as in the linker script.
+extern u8 gHeap[0x40000] __attribute__((alias("gHostEwram")));
+unsigned char gHostIwram[0x8000] ALIGNED(4);
+unsigned char gHostIoRegs[0x400] ALIGNED(4);
+unsigned char gHostPltt[0x400] ALIGNED(4);
+unsigned char gHostVram[0x18000] ALIGNED(4);
+unsigned char gHostOam[0x400] ALIGNED(4);
+
+// The DMA address registers only hold 32 bits, so the full host addresses of
+// the channels waiting for HostDmaTrigger are kept here.
+static struct
+{
+    uintptr_t src;
+    uintptr_t dest;
+} sDmaChannels[4];
+
+#define CYCLES_PER_SCANLINE 1232
+#define NUM_SCANLINES 228
+
+static int sDmaTiming;
+static u32 sDmaCycles;
+
+void HostSetDmaTiming(int enable)
+{
+    sDmaTiming = enable;
+    sDmaCycles = 0;
+}
+
+static void AdvanceVCount(u32 bytes)
+{
+    sDmaCycles += bytes * 2;
+    REG_VCOUNT = (REG_VCOUNT + sDmaCycles / CYCLES_PER_SCANLINE) % NUM_SCANLINES;
+    sDmaCycles %= CYCLES_PER_SCANLINE;
+}
+
+static void DoDmaTransfer(int dmaNum, u32 control)
+{
+    u16 flags = control >> 16;
+    u32 count = control & 0xFFFF;
+    u32 unit = (flags & DMA_32BIT) ? 4 : 2;
+    intptr_t srcStep = unit;
+    intptr_t destStep = unit;
+    uintptr_t src = sDmaChannels[dmaNum].src & ~(uintptr_t)(unit - 1);
+    uintptr_t dest = sDmaChannels[dmaNum].dest & ~(uintptr_t)(unit - 1);
+    u32 i;
+
+    if (count == 0)
+        count = (dmaNum == 3) ? 0x10000 : 0x4000;
+
+    if ((flags & DMA_SRC_FIXED) == DMA_SRC_FIXED)
+        srcStep = 0;
+    else if (flags & DMA_SRC_DEC)
+        srcStep = -srcStep;
+
+    if ((flags & DMA_DEST_RELOAD) == DMA_DEST_FIXED)
+        destStep = 0;
+    else if ((flags & DMA_DEST_RELOAD) == DMA_DEST_DEC)
+        destStep = -destStep;
+
+    for (i = 0; i < count; i++)
+    {
+        if (unit == 4)
+            *(u32 *)dest = *(const u32 *)src;
+        else
+            *(u16 *)dest = *(const u16 *)src;
+        src += srcStep;
+        dest += destStep;
+    }
+
+    if (sDmaTiming)
+        AdvanceVCount(count * unit);
+
+    // A repeating transfer continues from where it stopped, except for a
+    // destination that's reloaded each time.
+    sDmaChannels[dmaNum].src = src;
+    if ((flags & DMA_DEST_RELOAD) != DMA_DEST_RELOAD)
+        sDmaChannels[dmaNum].dest = dest;
+}
+
+void HostDmaSet(int dmaNum, uintptr_t src, uintptr_t dest, u32 control)
+{
+    vu32 *dmaRegs = (vu32 *)(REG_ADDR_DMA0 + 12 * dmaNum);
+    u16 flags = control >> 16;
+
+    dmaRegs[0] = src;
+    dmaRegs[1] = dest;
+    dmaRegs[2] = control;
+    sDmaChannels[dmaNum].src = src;
+    sDmaChannels[dmaNum].dest = dest;
+
+    if ((flags & DMA_ENABLE) && (flags & DMA_START_MASK) == DMA_START_NOW)
+    {
+        DoDmaTransfer(dmaNum, control);
+        dmaRegs[2] = control & ~(DMA_ENABLE << 16);
+    }
+}
+
+void HostDmaTrigger(u16 timing)
+{
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        vu32 *dmaRegs = (vu32 *)(REG_ADDR_DMA0 + 12 * i);
+        u32 control = dmaRegs[2];
+        u16 flags = control >> 16;
+
+        if (!(flags & DMA_ENABLE) || (flags & DMA_START_MASK) != timing)
+            continue;
+
+        DoDmaTransfer(i, control);
+        if (!(flags & DMA_REPEAT))
+            dmaRegs[2] = control & ~(DMA_ENABLE << 16);
+    }
+}
+
+uint32_t HostCycleCount(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(uint64_t)((now.tv_sec * 1e9 + now.tv_nsec) * 0.016777216);
+}
+
+void SoftReset(u32 resetFlags)
+{
+    fprintf(stderr, "SoftReset(0x%X)\n", resetFlags);
+    exit(0);
+}
+
+void RegisterRamReset(u32 resetFlags)
+{
+    if (resetFlags & RESET_EWRAM)
+        memset(gHostEwram, 0, sizeof(gHostEwram));
+    if (resetFlags & RESET_IWRAM)
+        memset(gHostIwram, 0, sizeof(gHostIwram) - 0x200);
+    if (resetFlags & RESET_PALETTE)
+        memset(gHostPltt, 0, sizeof(gHostPltt));
+    if (resetFlags & RESET_VRAM)
+        memset(gHostVram, 0, sizeof(gHostVram));
+    if (resetFlags & RESET_OAM)
+        memset(gHostOam, 0, sizeof(gHostOam));
+    if (resetFlags & RESET_REGS)
+        memset(gHostIoRegs, 0, sizeof(gHostIoRegs));
+}
+
+// There are no interrupts on the host, so a frame ends as soon as it's waited
+// for.
+void VBlankIntrWait(void)
+{
+    HostDmaTrigger(DMA_START_VBLANK);
+}
+
+u16 Sqrt(u32 num)
+{
+    u32 root = 0;
+    u32 bit = 1u << 30;
+
+    while (bit > num)
+        bit >>= 2;
+
+    while (bit != 0)
+    {
+        if (num >= root + bit)
+        {
+            num -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return root;
+}
+
+// Close to the BIOS's result, which comes from a polynomial approximation,
+// but not always the same in the lowest bits.
+u16 ArcTan2(s16 x, s16 y)
+{
+    double angle = atan2(y, x);
+
+    if (angle < 0)
+        angle += 2 * M_PI;
+
+    return (u16)(s32)(angle * 0x8000 / M_PI);
+}
+
+void CpuSet(const void *src, void *dest, u32 control)
+{
+    u32 count = control & 0x1FFFFF;
+    bool32 fixed = (control & CPU_SET_SRC_FIXED) != 0;
+    u32 i;
+
+    if (control & CPU_SET_32BIT)
+    {
+        const u32 *src32 = (const u32 *)((uintptr_t)src & ~(uintptr_t)3);
+        u32 *dest32 = (u32 *)((uintptr_t)dest & ~(uintptr_t)3);
+
+        for (i = 0; i < count; i++)
+            dest32[i] = fixed ? *src32 : src32[i];
+    }
+    else
+    {
+        const u16 *src16 = (const u16 *)((uintptr_t)src & ~(uintptr_t)1);
+        u16 *dest16 = (u16 *)((uintptr_t)dest & ~(uintptr_t)1);
+
+        for (i = 0; i < count; i++)
+            dest16[i] = fixed ? *src16 : src16[i];
+    }
+}
+
+void CpuFastSet(const void *src, void *dest, u32 control)
+{
+    // The BIOS copies whole blocks of 8 words.
+    CpuSet(src, dest, CPU_SET_32BIT | (control & CPU_FAST_SET_SRC_FIXED) | (((control & 0x1FFFFF) + 7) & ~7));
+}
+
+static s32 Sin14(u8 angle)
+{
+    return (s32)lround(sin(angle * M_PI / 128) * 0x4000);
+}
+
+void BgAffineSet(struct BgAffineSrcData *src, struct BgAffineDstData *dest, s32 count)
+{
+    for (; count > 0; count--, src++, dest++)
+    {
+        s32 sinValue = Sin14(src->alpha >> 8);
+        s32 cosValue = Sin14((src->alpha >> 8) + 64);
+
+        dest->pa = (src->sx * cosValue) >> 14;
+        dest->pb = -(src->sx * sinValue) >> 14;
+        dest->pc = (src->sy * sinValue) >> 14;
+        dest->pd = (src->sy * cosValue) >> 14;
+        dest->dx = src->texX - (dest->pa * src->scrX + dest->pb * src->scrY);
+        dest->dy = src->texY - (dest->pc * src->scrX + dest->pd * src->scrY);
+    }
+}
+
+void ObjAffineSet(struct ObjAffineSrcData *src, void *dest, s32 count, s32 offset)
+{
+    u8 *out = dest;
+
+    for (; count > 0; count--, src++, out += 4 * offset)
+    {
+        s32 sinValue = Sin14(src->rotation >> 8);
+        s32 cosValue = Sin14((src->rotation >> 8) + 64);
+
+        *(s16 *)(out) = (src->xScale * cosValue) >> 14;
+        *(s16 *)(out + offset) = -(src->xScale * sinValue) >> 14;
+        *(s16 *)(out + 2 * offset) = (src->yScale * sinValue) >> 14;
+        *(s16 *)(out + 3 * offset) = (src->yScale * cosValue) >> 14;
+    }
+}
+
+// The VRAM versions write 16 bits at a time, which gives the same result in
+// host memory.
+void LZ77UnCompWram(const void *src, void *dest)
+{
+    const u8 *in = src;
+    u8 *out = dest;
+    u32 size = in[1] | (in[2] << 8) | (in[3] << 16);
+    u8 *end = out + size;
+
+    in += 4;
+    while (out < end)
+    {
+        u8 flags = *in++;
+        int i;
+
+        for (i = 0; i < 8 && out < end; i++, flags <<= 1)
+        {
+            if (flags & 0x80)
+            {
+                u32 length = (in[0] >> 4) + 3;
+                u32 distance = (((in[0] & 0xF) << 8) | in[1]) + 1;
+
+                in += 2;
+                while (length-- != 0 && out < end)
+                {
+                    *out = *(out - distance);
+                    out++;
+                }
+            }
+            else
+            {
+                *out++ = *in++;
+            }
+        }
+    }
+}
+
+void LZ77UnCompVram(const void *src, void *dest)
+{
+    LZ77UnCompWram(src, dest);
+}
+
+void RLUnCompWram(const void *src, void *dest)
+{
+    const u8 *in = src;
+    u8 *out = dest;
+    u32 size = in[1] | (in[2] << 8) | (in[3] << 16);
+    u8 *end = out + size;
+
+    in += 4;
+    while (out < end)
+    {
+        u8 flag = *in++;
+
+        if (flag & 0x80)
+        {
+            u32 length = (flag & 0x7F) + 3;
+
+            for (; length != 0 && out < end; length--)
+                *out++ = *in;
+            in++;
+        }
+        else
+        {
+            u32 length = (flag & 0x7F) + 1;
+
+            for (; length != 0 && out < end; length--)
+                *out++ = *in++;
+        }
+    }
+}
+
+void RLUnCompVram(const void *src, void *dest)
+{
+    RLUnCompWram(src, dest);
+}
+
+int MultiBoot(struct MultiBootParam *mp)
+{
+    return 1;
+}
+
+// The BIOS doesn't fault on a zero divisor, so neither does this.
+s32 Div(s32 num, s32 denom)
+{
+    if (denom == 0)
+        return 0;
+    return num / denom;
+}
+
+void AGBPrintInit(void)
+{
+}
+
+void AGBPrintf(const char *pBuf, ...)
+{
+    va_list args;
+
+    va_start(args, pBuf);
+    vfprintf(stderr, pBuf, args);
+    va_end(args);
+}
+
+void AGBAssert(const char *pFile, int nLine, const char *pExpression, int nStopProgram)
+{
+    if (nStopProgram)
+    {
+        fprintf(stderr, "ASSERTION FAILED  FILE=[%s] LINE=[%d]  EXP=[%s]\n", pFile, nLine, pExpression);
+        abort();
+    }
+
+    fprintf(stderr, "WARNING FILE=[%s] LINE=[%d]  EXP=[%s]\n", pFile, nLine, pExpression);
+}
@@ -13,6 +13,24 @@
 
 #define DMA3_16BIT 0
 #define DMA3_32BIT 1
+#if MODERN
+// Added to the mode of a request that should go ahead of the others when they
+// don't all fit in one VBlank, e.g. a tilemap. It still waits for any earlier
+// request that writes to or reads from the same memory.
+#define DMA3_HIGH_PRIORITY 2
+
+// What the last call to ProcessDma3Requests did, for finding frames where
+// uploads spill past VBlank. merged and framesDeferred count up from
+// ClearDma3Requests.
+struct Dma3Stats
+{
+    u32 bytes;
+    u16 requests;
+    u16 deferred; // requests left for a later frame
+    u16 merged; // requests that continued the one before and were merged into it
+    u32 framesDeferred;
+};
+#endif // MODERN
 
 #define Dma3CopyLarge_(src, dest, size, bit)               \
 {                                                          \
@@ -78,4 +96,8 @@ s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode);
 // Returns -1 if pending, 0 otherwise
 s16 WaitDma3Request(s16 index);
 
+#if MODERN
+void GetDma3Stats(struct Dma3Stats *stats);
+#endif // MODERN
+
 #endif // GUARD_DMA3_H
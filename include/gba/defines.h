@@ -20,8 +20,35 @@
 #define NOINLINE
 #endif
 
+// MODERN builds run functions marked IWRAM_CODE from IWRAM as ARM code, like
+// the ones chosen by tools/iwramgen. Calls from the ROM have to see the
+// attribute, so it goes on the function's declaration as well.
+#if MODERN && !defined(HOST_BUILD)
+#define IWRAM_CODE __attribute__((section(".iwram_code"), target("arm"), long_call, noinline))
+#else
+#define IWRAM_CODE
+#endif
+
 #define ALIGNED(n) __attribute__((aligned(n)))
 
+#ifdef HOST_BUILD
+#include "gba/host.h"
+
+#define SOUND_INFO_PTR (*(struct SoundInfo **)(IWRAM_START + 0x7FF0))
+#define INTR_CHECK     (*(u16 *)(IWRAM_START + 0x7FF8))
+#define INTR_VECTOR    (*(void **)(IWRAM_START + 0x7FFC))
+
+#define EWRAM_START ((uintptr_t)gHostEwram)
+#define EWRAM_END   (EWRAM_START + 0x40000)
+#define IWRAM_START ((uintptr_t)gHostIwram)
+// Buffers are compared against this to tell them from VRAM and ROM. On the
+// host they're all ordinary memory.
+#define IWRAM_END   UINTPTR_MAX
+
+#define PLTT ((uintptr_t)gHostPltt)
+#define VRAM ((uintptr_t)gHostVram)
+#define OAM  ((uintptr_t)gHostOam)
+#else
 #define SOUND_INFO_PTR (*(struct SoundInfo **)0x3007FF0)
 #define INTR_CHECK     (*(u16 *)0x3007FF8)
 #define INTR_VECTOR    (*(void **)0x3007FFC)
@@ -31,7 +58,11 @@
 #define IWRAM_START 0x03000000
 #define IWRAM_END   (IWRAM_START + 0x8000)
 
-#define PLTT      0x5000000
+#define PLTT 0x5000000
+#define VRAM 0x6000000
+#define OAM  0x7000000
+#endif // HOST_BUILD
+
 #define PLTT_SIZE 0x400
 
 #define BG_PLTT      PLTT
@@ -40,7 +71,6 @@
 #define OBJ_PLTT      (PLTT + 0x200)
 #define OBJ_PLTT_SIZE 0x200
 
-#define VRAM      0x6000000
 #define VRAM_SIZE 0x18000
 
 #define BG_VRAM           VRAM
@@ -63,7 +93,6 @@
 #define OBJ_VRAM1      (void *)(VRAM + 0x14000)
 #define OBJ_VRAM1_SIZE 0x4000
 
-#define OAM      0x7000000
 #define OAM_SIZE 0x400
 
 #define ROM_HEADER_SIZE   0xC0
@@ -0,0 +1,36 @@
+#ifndef GUARD_GBA_HOST_H
+#define GUARD_GBA_HOST_H
+
+// The host build (make host) runs the engine core natively. The GBA's memory
+// regions and I/O registers are ordinary arrays, defined in host/gba.c, and
+// the fixed addresses in defines.h and io_reg.h point into them.
+
+#include <stdint.h>
+
+extern unsigned char gHostEwram[0x40000];
+extern unsigned char gHostIwram[0x8000];
+extern unsigned char gHostIoRegs[0x400];
+extern unsigned char gHostPltt[0x400];
+extern unsigned char gHostVram[0x18000];
+extern unsigned char gHostOam[0x400];
+
+// Sets up a DMA channel as DmaSet does on hardware. Transfers that start
+// immediately are done before it returns; the others wait for
+// HostDmaTrigger.
+void HostDmaSet(int dmaNum, uintptr_t src, uintptr_t dest, uint32_t control);
+
+// Runs the enabled DMA channels that start at the given timing, e.g.
+// DMA_START_VBLANK, the way the hardware does at the start of that period.
+void HostDmaTrigger(uint16_t timing);
+
+// Makes DMA transfers move REG_VCOUNT on by the scanlines they would take on
+// hardware, at about 2 cycles a byte as a copy from EWRAM to VRAM takes, for
+// testing code that checks how much of VBlank is left. It's off by default,
+// which leaves VCOUNT to the program.
+void HostSetDmaTiming(int enable);
+
+// The time from the host's clock, counted in GBA CPU cycles. It wraps around
+// every few minutes, so only differences between readings are meaningful.
+uint32_t HostCycleCount(void);
+
+#endif // GUARD_GBA_HOST_H
@@ -31,6 +31,10 @@
 
 #define CpuFastCopy(src, dest, size) CpuFastSet(src, dest, ((size)/(32/8) & 0x1FFFFF))
 
+#ifdef HOST_BUILD
+#define DmaSet(dmaNum, src, dest, control) \
+    HostDmaSet(dmaNum, (uintptr_t)(src), (uintptr_t)(dest), (u32)(control))
+#else
 #define DmaSet(dmaNum, src, dest, control)        \
 {                                                 \
     vu32 *dmaRegs = (vu32 *)REG_ADDR_DMA##dmaNum; \
@@ -39,6 +43,7 @@
     dmaRegs[2] = (vu32)(control);                 \
     dmaRegs[2];                                   \
 }
+#endif // HOST_BUILD
 
 #define DMA_FILL(dmaNum, value, dest, size, bit)                                              \
 {                                                                                             \
@@ -21,5 +21,26 @@ void *Alloc(u32 size);
 void *AllocZeroed(u32 size);
 void Free(void *pointer);
 void InitHeap(void *pointer, u32 size);
+bool32 CheckMemBlock(void *pointer);
+bool32 CheckHeap(void);
+
+#if MODERN
+// An arena hands out pieces of one heap block in order, for allocations that
+// all last until the same point, such as a screen's buffers until it closes.
+// EndHeapArena frees everything allocated from it at once. Allocations that
+// don't fit in the block come from the heap and are freed along with it.
+struct HeapArena
+{
+    u8 *start;
+    u8 *pos;
+    u8 *end;
+    void *overflow;
+};
+
+void BeginHeapArena(struct HeapArena *arena, u32 size);
+void *ArenaAlloc(struct HeapArena *arena, u32 size);
+void *ArenaAllocZeroed(struct HeapArena *arena, u32 size);
+void EndHeapArena(struct HeapArena *arena);
+#endif // MODERN
 
 #endif // GUARD_MALLOC_H
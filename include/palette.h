@@ -53,6 +53,17 @@ extern struct PaletteFadeControl gPaletteFade;
 extern u32 gPlttBufferTransferPending;
 extern u16 gPlttBufferUnfaded[PLTT_BUFFER_SIZE];
 extern u16 gPlttBufferFaded[PLTT_BUFFER_SIZE];
+#if MODERN
+// One bit per 16-color palette in gPlttBufferFaded that has changed since
+// TransferPlttBuffer last copied it to palette RAM. Code that writes to
+// gPlttBufferFaded itself, or to palette RAM directly, marks what it wrote.
+extern u32 gPlttBufferDirty;
+void MarkPlttBufferDirty(u16 offset, u16 count);
+#define MarkPalettesDirty(selectedPalettes) (gPlttBufferDirty |= (selectedPalettes))
+#else
+#define MarkPlttBufferDirty(offset, count)
+#define MarkPalettesDirty(selectedPalettes)
+#endif // MODERN
 
 void LoadCompressedPalette(const u32 *src, u16 offset, u16 size);
 void LoadPalette(const void *src, u16 offset, u16 size);
@@ -249,6 +249,18 @@ struct OamMatrix
     s16 d;
 };
 
+#if MODERN
+// How the unreserved sprite tiles are split up, for debugging. fragmentation
+// is the percentage of free tiles outside the largest free run.
+struct SpriteTileAllocStats
+{
+    u16 freeTiles;
+    u16 freeRuns;
+    u16 largestFreeRun;
+    u8 fragmentation;
+};
+#endif // MODERN
+
 extern const struct OamData gDummyOamData;
 extern const union AnimCmd *const gDummySpriteAnimTable[];
 extern const union AffineAnimCmd *const gDummySpriteAffineAnimTable[];
@@ -313,12 +325,21 @@ void SetSubspriteTables(struct Sprite *sprite, const struct SubspriteTable *subs
 bool8 AddSpriteToOamBuffer(struct Sprite *object, u8 *oamIndex);
 bool8 AddSubspritesToOamBuffer(struct Sprite *sprite, struct OamData *destOam, u8 *oamIndex);
 void CopyToSprites(u8 *src);
+#if MODERN
+// Must follow copying a sprite in use into a free slot without CreateSprite.
+void RegisterCopiedSprite(u8 spriteId);
+#else
+#define RegisterCopiedSprite(spriteId)
+#endif // MODERN
 void CopyFromSprites(u8 *dest);
 u8 SpriteTileAllocBitmapOp(u16 bit, u8 op);
 void ClearSpriteCopyRequests(void);
 void ResetAffineAnimData(void);
 void FreeSpriteTilesIfNotUsingSheet(struct Sprite *sprite);
 s16 AllocSpriteTiles(u16 tileCount);
+#if MODERN
+void GetSpriteTileAllocStats(struct SpriteTileAllocStats *stats);
+#endif // MODERN
 void SetSpriteMatrixAnchor(struct Sprite* sprite, s16 xmod, s16 ymod);
 
 #endif //GUARD_SPRITE_H
@@ -1,829 +1,289 @@
 STD_REVERB = 50
 
+# Per-song mid2agb options, looked up by the song's file name.
+MID_FLAGS_mus_rocket_hideout := -E -R$(STD_REVERB) -G133 -V090
+MID_FLAGS_mus_follow_me := -E -R$(STD_REVERB) -G131 -V068
+MID_FLAGS_mus_rs_vs_trainer := -E -R$(STD_REVERB) -G011 -V080 -P1
+MID_FLAGS_mus_rs_vs_gym_leader := -E -R$(STD_REVERB) -G010 -V080
+MID_FLAGS_mus_victory_road := -E -R$(STD_REVERB) -G154 -V090
+MID_FLAGS_mus_cycling := -E -R$(STD_REVERB) -G141 -V090
+MID_FLAGS_mus_intro_fight := -E -R$(STD_REVERB) -G136 -V090
+MID_FLAGS_mus_hall_of_fame := -E -R$(STD_REVERB) -G145 -V079
+MID_FLAGS_mus_encounter_deoxys := -E -R$(STD_REVERB) -G184 -V079
+MID_FLAGS_mus_dummy := -E -R40
+MID_FLAGS_mus_credits := -E -R$(STD_REVERB) -G149 -V090
+MID_FLAGS_mus_encounter_gym_leader := -E -R$(STD_REVERB) -G144 -V090
+MID_FLAGS_mus_dex_rating := -E -R$(STD_REVERB) -G175 -V070 -P5
+MID_FLAGS_mus_obtain_key_item := -E -R$(STD_REVERB) -G178 -V077 -P5
+MID_FLAGS_mus_caught_intro := -E -R$(STD_REVERB) -G179 -V094 -P5
+MID_FLAGS_mus_level_up := -E -R$(STD_REVERB) -G008 -V090 -P5
+MID_FLAGS_mus_obtain_item := -E -R$(STD_REVERB) -G008 -V090 -P5
+MID_FLAGS_mus_evolved := -E -R$(STD_REVERB) -G008 -V090 -P5
+MID_FLAGS_mus_caught := -E -R$(STD_REVERB) -G170 -V100
+MID_FLAGS_mus_cinnabar := -E -R$(STD_REVERB) -G138 -V090
+MID_FLAGS_mus_gym := -E -R$(STD_REVERB) -G134 -V090
+MID_FLAGS_mus_fuchsia := -E -R$(STD_REVERB) -G167 -V090
+MID_FLAGS_mus_poke_jump := -E -R$(STD_REVERB) -G132 -V090
+MID_FLAGS_mus_heal_unused := -E -R$(STD_REVERB) -G140 -V090
+MID_FLAGS_mus_oak_lab := -E -R$(STD_REVERB) -G160 -V075
+MID_FLAGS_mus_berry_pick := -E -R$(STD_REVERB) -G132 -V090
+MID_FLAGS_mus_vermillion := -E -R$(STD_REVERB) -G172 -V090
+MID_FLAGS_mus_route1 := -E -R$(STD_REVERB) -G150 -V079
+MID_FLAGS_mus_route3 := -E -R$(STD_REVERB) -G152 -V083
+MID_FLAGS_mus_route11 := -E -R$(STD_REVERB) -G153 -V090
+MID_FLAGS_mus_pallet := -E -R$(STD_REVERB) -G159 -V100
+MID_FLAGS_mus_heal := -E -R$(STD_REVERB) -G008 -V090 -P5
+MID_FLAGS_mus_slots_jackpot := -E -R$(STD_REVERB) -G008 -V100 -P5
+MID_FLAGS_mus_slots_win := -E -R$(STD_REVERB) -G008 -V100 -P5
+MID_FLAGS_mus_obtain_badge := -E -R$(STD_REVERB) -G008 -V090 -P5
+MID_FLAGS_mus_obtain_berry := -E -R$(STD_REVERB) -G008 -V090 -P5
+MID_FLAGS_mus_photo := -E -R$(STD_REVERB) -G180 -V100 -P5
+MID_FLAGS_mus_evolution_intro := -E -R$(STD_REVERB) -G009 -V080 -P1
+MID_FLAGS_mus_move_deleted := -E -R$(STD_REVERB) -G008 -V090 -P5
+MID_FLAGS_mus_obtain_tmhm := -E -R$(STD_REVERB) -G008 -V090 -P5
+MID_FLAGS_mus_too_bad := -E -R$(STD_REVERB) -G008 -V090 -P5
+MID_FLAGS_mus_surf := -E -R$(STD_REVERB) -G164 -V071
+MID_FLAGS_mus_sevii_123 := -E -R$(STD_REVERB) -G173 -V084
+MID_FLAGS_mus_sevii_45 := -E -R$(STD_REVERB) -G188 -V084
+MID_FLAGS_mus_sevii_67 := -E -R$(STD_REVERB) -G189 -V084
+MID_FLAGS_mus_sevii_cave := -E -R$(STD_REVERB) -G147 -V090
+MID_FLAGS_mus_sevii_dungeon := -E -R$(STD_REVERB) -G146 -V090
+MID_FLAGS_mus_sevii_route := -E -R$(STD_REVERB) -G187 -V080
+MID_FLAGS_mus_net_center := -E -R$(STD_REVERB) -G162 -V096
+MID_FLAGS_mus_pewter := -E -R$(STD_REVERB) -G173 -V084
+MID_FLAGS_mus_oak := -E -R$(STD_REVERB) -G161 -V086
+MID_FLAGS_mus_mystery_gift := -E -R$(STD_REVERB) -G183 -V100
+MID_FLAGS_mus_route24 := -E -R$(STD_REVERB) -G151 -V086
+MID_FLAGS_mus_teachy_tv_show := -E -R$(STD_REVERB) -G131 -V068
+MID_FLAGS_mus_mt_moon := -E -R$(STD_REVERB) -G147 -V090
+MID_FLAGS_mus_school := -E -R$(STD_REVERB) -G012 -V100 -P1
+MID_FLAGS_mus_poke_tower := -E -R$(STD_REVERB) -G165 -V090
+MID_FLAGS_mus_poke_center := -E -R$(STD_REVERB) -G162 -V096
+MID_FLAGS_mus_poke_flute := -E -R$(STD_REVERB) -G165 -V048 -P5
+MID_FLAGS_mus_poke_mansion := -E -R$(STD_REVERB) -G148 -V090
+MID_FLAGS_mus_jigglypuff := -E -R$(STD_REVERB) -G135 -V068 -P5
+MID_FLAGS_mus_encounter_rival := -E -R$(STD_REVERB) -G174 -V079
+MID_FLAGS_mus_rival_exit := -E -R$(STD_REVERB) -G174 -V079
+MID_FLAGS_mus_encounter_rocket := -E -R$(STD_REVERB) -G142 -V096
+MID_FLAGS_mus_ss_anne := -E -R$(STD_REVERB) -G163 -V090
+MID_FLAGS_mus_new_game_exit := -E -R$(STD_REVERB) -G182 -V088
+MID_FLAGS_mus_new_game_intro := -E -R$(STD_REVERB) -G182 -V088
+MID_FLAGS_mus_evolution := -E -R$(STD_REVERB) -G009 -V080 -P1
+MID_FLAGS_mus_lavender := -E -R$(STD_REVERB) -G139 -V090
+MID_FLAGS_mus_silph := -E -R$(STD_REVERB) -G166 -V076
+MID_FLAGS_mus_encounter_girl := -E -R$(STD_REVERB) -G143 -V051
+MID_FLAGS_mus_encounter_boy := -E -R$(STD_REVERB) -G144 -V090
+MID_FLAGS_mus_game_corner := -E -R$(STD_REVERB) -G132 -V090
+MID_FLAGS_mus_slow_pallet := -E -R$(STD_REVERB) -G159 -V092
+MID_FLAGS_mus_new_game_instruct := -E -R$(STD_REVERB) -G182 -V085
+MID_FLAGS_mus_viridian_forest := -E -R$(STD_REVERB) -G146 -V090
+MID_FLAGS_mus_trainer_tower := -E -R$(STD_REVERB) -G134 -V090
+MID_FLAGS_mus_celadon := -E -R$(STD_REVERB) -G168 -V070
+MID_FLAGS_mus_title := -E -R$(STD_REVERB) -G137 -V090
+MID_FLAGS_mus_game_freak := -E -R$(STD_REVERB) -G181 -V075
+MID_FLAGS_mus_teachy_tv_menu := -E -R$(STD_REVERB) -G186 -V059
+MID_FLAGS_mus_union_room := -E -R$(STD_REVERB) -G132 -V090
+MID_FLAGS_mus_vs_legend := -E -R$(STD_REVERB) -G157 -V090
+MID_FLAGS_mus_vs_deoxys := -E -R$(STD_REVERB) -G185 -V080
+MID_FLAGS_mus_vs_gym_leader := -E -R$(STD_REVERB) -G155 -V090
+MID_FLAGS_mus_vs_champion := -E -R$(STD_REVERB) -G158 -V090
+MID_FLAGS_mus_vs_mewtwo := -E -R$(STD_REVERB) -G157 -V090
+MID_FLAGS_mus_vs_trainer := -E -R$(STD_REVERB) -G156 -V090
+MID_FLAGS_mus_vs_wild := -E -R$(STD_REVERB) -G157 -V090
+MID_FLAGS_se_door := -E -R$(STD_REVERB) -G129 -V100 -P5
+MID_FLAGS_mus_victory_gym_leader := -E -R$(STD_REVERB) -G171 -V090
+MID_FLAGS_mus_victory_trainer := -E -R$(STD_REVERB) -G169 -V089
+MID_FLAGS_mus_victory_wild := -E -R$(STD_REVERB) -G170 -V090
+MID_FLAGS_ph_choice_blend := -E -G130 -P4
+MID_FLAGS_ph_choice_held := -E -G130 -P4
+MID_FLAGS_ph_choice_solo := -E -G130 -P4
+MID_FLAGS_ph_cloth_blend := -E -G130 -P4
+MID_FLAGS_ph_cloth_held := -E -G130 -P4
+MID_FLAGS_ph_cloth_solo := -E -G130 -P4
+MID_FLAGS_ph_cure_blend := -E -G130 -P4
+MID_FLAGS_ph_cure_held := -E -G130 -P4
+MID_FLAGS_ph_cure_solo := -E -G130 -P4
+MID_FLAGS_ph_dress_blend := -E -G130 -P4
+MID_FLAGS_ph_dress_held := -E -G130 -P4
+MID_FLAGS_ph_dress_solo := -E -G130 -P4
+MID_FLAGS_ph_face_blend := -E -G130 -P4
+MID_FLAGS_ph_face_held := -E -G130 -P4
+MID_FLAGS_ph_face_solo := -E -G130 -P4
+MID_FLAGS_ph_fleece_blend := -E -G130 -P4
+MID_FLAGS_ph_fleece_held := -E -G130 -P4
+MID_FLAGS_ph_fleece_solo := -E -G130 -P4
+MID_FLAGS_ph_foot_blend := -E -G130 -P4
+MID_FLAGS_ph_foot_held := -E -G130 -P4
+MID_FLAGS_ph_foot_solo := -E -G130 -P4
+MID_FLAGS_ph_goat_blend := -E -G130 -P4
+MID_FLAGS_ph_goat_held := -E -G130 -P4
+MID_FLAGS_ph_goat_solo := -E -G130 -P4
+MID_FLAGS_ph_goose_blend := -E -G130 -P4
+MID_FLAGS_ph_goose_held := -E -G130 -P4
+MID_FLAGS_ph_goose_solo := -E -G130 -P4
+MID_FLAGS_ph_kit_blend := -E -G130 -P4
+MID_FLAGS_ph_kit_held := -E -G130 -P4
+MID_FLAGS_ph_kit_solo := -E -G130 -P4
+MID_FLAGS_ph_lot_blend := -E -G130 -P4
+MID_FLAGS_ph_lot_held := -E -G130 -P4
+MID_FLAGS_ph_lot_solo := -E -G130 -P4
+MID_FLAGS_ph_mouth_blend := -E -G130 -P4
+MID_FLAGS_ph_mouth_held := -E -G130 -P4
+MID_FLAGS_ph_mouth_solo := -E -G130 -P4
+MID_FLAGS_ph_nurse_blend := -E -G130 -P4
+MID_FLAGS_ph_nurse_held := -E -G130 -P4
+MID_FLAGS_ph_nurse_solo := -E -G130 -P4
+MID_FLAGS_ph_price_blend := -E -G130 -P4
+MID_FLAGS_ph_price_held := -E -G130 -P4
+MID_FLAGS_ph_price_solo := -E -G130 -P4
+MID_FLAGS_ph_strut_blend := -E -G130 -P4
+MID_FLAGS_ph_strut_held := -E -G130 -P4
+MID_FLAGS_ph_strut_solo := -E -G130 -P4
+MID_FLAGS_ph_thought_blend := -E -G130 -P4
+MID_FLAGS_ph_thought_held := -E -G130 -P4
+MID_FLAGS_ph_thought_solo := -E -G130 -P4
+MID_FLAGS_ph_trap_blend := -E -G130 -P4
+MID_FLAGS_ph_trap_held := -E -G130 -P4
+MID_FLAGS_ph_trap_solo := -E -G130 -P4
+MID_FLAGS_se_bang := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_taillow_wing_flap := -E -R$(STD_REVERB) -G128 -V105 -P5
+MID_FLAGS_se_glass_flute := -E -R$(STD_REVERB) -G128 -V105 -P5
+MID_FLAGS_se_boo := -E -R$(STD_REVERB) -G127 -V110 -P4
+MID_FLAGS_se_ball := -E -R$(STD_REVERB) -G127 -V070 -P4
+MID_FLAGS_se_ball_open := -E -R$(STD_REVERB) -G127 -V100 -P5
+MID_FLAGS_se_mugshot := -E -R$(STD_REVERB) -G128 -V090 -P5
+MID_FLAGS_se_contest_heart := -E -R$(STD_REVERB) -G128 -V090 -P5
+MID_FLAGS_se_contest_curtain_fall := -E -R$(STD_REVERB) -G128 -V070 -P5
+MID_FLAGS_se_contest_curtain_rise := -E -R$(STD_REVERB) -G128 -V070 -P5
+MID_FLAGS_se_contest_icon_change := -E -R$(STD_REVERB) -G128 -V110 -P5
+MID_FLAGS_se_contest_mons_turn := -E -R$(STD_REVERB) -G128 -V090 -P5
+MID_FLAGS_se_contest_icon_clear := -E -R$(STD_REVERB) -G128 -V090 -P5
+MID_FLAGS_se_card := -E -R$(STD_REVERB) -G127 -V100 -P4
+MID_FLAGS_se_ledge := -E -R$(STD_REVERB) -G127 -V100 -P4
+MID_FLAGS_se_itemfinder := -E -R$(STD_REVERB) -G127 -V090 -P5
+MID_FLAGS_se_applause := -E -R$(STD_REVERB) -G128 -V100 -P5
+MID_FLAGS_se_field_poison := -E -R$(STD_REVERB) -G127 -V110 -P5
+MID_FLAGS_se_rs_door := -E -R$(STD_REVERB) -G127 -V080 -P5
+MID_FLAGS_se_elevator := -E -R$(STD_REVERB) -G128 -V100 -P4
+MID_FLAGS_se_escalator := -E -R$(STD_REVERB) -G128 -V100 -P4
+MID_FLAGS_se_exp := -E -R$(STD_REVERB) -G128 -V080 -P5
+MID_FLAGS_se_exp_max := -E -R$(STD_REVERB) -G128 -V094 -P5
+MID_FLAGS_se_fu_zaku := -E -R$(STD_REVERB) -G127 -V120 -P4
+MID_FLAGS_se_contest_condition_lose := -E -R$(STD_REVERB) -G127 -V110 -P4
+MID_FLAGS_se_lavaridge_fall_warp := -E -R$(STD_REVERB) -G127 -P4
+MID_FLAGS_se_balloon_red := -E -R$(STD_REVERB) -G128 -V105 -P4
+MID_FLAGS_se_balloon_blue := -E -R$(STD_REVERB) -G128 -V105 -P4
+MID_FLAGS_se_balloon_yellow := -E -R$(STD_REVERB) -G128 -V105 -P4
+MID_FLAGS_se_bridge_walk := -E -R$(STD_REVERB) -G128 -V095 -P4
+MID_FLAGS_se_failure := -E -R$(STD_REVERB) -G127 -V120 -P4
+MID_FLAGS_se_rotating_gate := -E -R$(STD_REVERB) -G128 -V090 -P4
+MID_FLAGS_se_low_health := -E -R$(STD_REVERB) -G127 -V100 -P3
+MID_FLAGS_se_sliding_door := -E -R$(STD_REVERB) -G128 -V095 -P4
+MID_FLAGS_se_vend := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_bike_hop := -E -R$(STD_REVERB) -G127 -V090 -P4
+MID_FLAGS_se_bike_bell := -E -R$(STD_REVERB) -G128 -V090 -P4
+MID_FLAGS_se_contest_place := -E -R$(STD_REVERB) -G127 -V110 -P4
+MID_FLAGS_se_exit := -E -R$(STD_REVERB) -G127 -V120 -P5
+MID_FLAGS_se_use_item := -E -R$(STD_REVERB) -G127 -V100 -P5
+MID_FLAGS_se_unlock := -E -R$(STD_REVERB) -G128 -V100 -P4
+MID_FLAGS_se_ball_bounce_1 := -E -R$(STD_REVERB) -G128 -V100 -P4
+MID_FLAGS_se_ball_bounce_2 := -E -R$(STD_REVERB) -G128 -V100 -P4
+MID_FLAGS_se_ball_bounce_3 := -E -R$(STD_REVERB) -G128 -V100 -P4
+MID_FLAGS_se_ball_bounce_4 := -E -R$(STD_REVERB) -G128 -V100 -P4
+MID_FLAGS_se_super_effective := -E -R$(STD_REVERB) -G127 -V110 -P5
+MID_FLAGS_se_not_effective := -E -R$(STD_REVERB) -G127 -V110 -P5
+MID_FLAGS_se_effective := -E -R$(STD_REVERB) -G127 -V110 -P5
+MID_FLAGS_se_puddle := -E -R$(STD_REVERB) -G128 -V020 -P4
+MID_FLAGS_se_berry_blender := -E -R$(STD_REVERB) -G128 -V090 -P4
+MID_FLAGS_se_switch := -E -R$(STD_REVERB) -G127 -V100 -P4
+MID_FLAGS_se_ball_throw := -E -R$(STD_REVERB) -G128 -V120 -P5
+MID_FLAGS_se_ship := -E -R$(STD_REVERB) -G127 -V075 -P4
+MID_FLAGS_se_flee := -E -R$(STD_REVERB) -G127 -V090 -P5
+MID_FLAGS_se_intro_blast := -E -R$(STD_REVERB) -G127 -V100 -P5
+MID_FLAGS_se_pc_login := -E -R$(STD_REVERB) -G127 -V100 -P5
+MID_FLAGS_se_pc_off := -E -R$(STD_REVERB) -G127 -V100 -P5
+MID_FLAGS_se_pc_on := -E -R$(STD_REVERB) -G127 -V100 -P5
+MID_FLAGS_se_pin := -E -R$(STD_REVERB) -G127 -V060 -P4
+MID_FLAGS_se_ding_dong := -E -R$(STD_REVERB) -G127 -V090 -P5
+MID_FLAGS_se_pokenav_off := -E -R$(STD_REVERB) -G127 -V100 -P5
+MID_FLAGS_se_pokenav_on := -E -R$(STD_REVERB) -G127 -V100 -P5
+MID_FLAGS_se_faint := -E -R$(STD_REVERB) -G127 -V110 -P5
+MID_FLAGS_se_shiny := -E -R$(STD_REVERB) -G128 -V095 -P5
+MID_FLAGS_se_rs_shop := -E -R$(STD_REVERB) -G127 -V090 -P5
+MID_FLAGS_se_ice_crack := -E -R$(STD_REVERB) -G127 -V100 -P4
+MID_FLAGS_se_ice_stairs := -E -R$(STD_REVERB) -G128 -V090 -P4
+MID_FLAGS_se_ice_break := -E -R$(STD_REVERB) -G128 -V100 -P4
+MID_FLAGS_se_fall := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_save := -E -R$(STD_REVERB) -G128 -V080 -P5
+MID_FLAGS_se_success := -E -R$(STD_REVERB) -G127 -V080 -P4
+MID_FLAGS_se_select := -E -R$(STD_REVERB) -G127 -V080 -P5
+MID_FLAGS_se_ball_trade := -E -R$(STD_REVERB) -G127 -V100 -P5
+MID_FLAGS_se_thunderstorm := -E -R$(STD_REVERB) -G128 -V080 -P2
+MID_FLAGS_se_thunderstorm_stop := -E -R$(STD_REVERB) -G128 -V080 -P2
+MID_FLAGS_se_thunder := -E -R$(STD_REVERB) -G128 -V110 -P3
+MID_FLAGS_se_thunder2 := -E -R$(STD_REVERB) -G128 -V110 -P3
+MID_FLAGS_se_rain := -E -R$(STD_REVERB) -G128 -V080 -P2
+MID_FLAGS_se_rain_stop := -E -R$(STD_REVERB) -G128 -V080 -P2
+MID_FLAGS_se_downpour := -E -R$(STD_REVERB) -G128 -V100 -P2
+MID_FLAGS_se_downpour_stop := -E -R$(STD_REVERB) -G128 -V100 -P2
+MID_FLAGS_se_orb := -E -R$(STD_REVERB) -G128 -V100 -P5
+MID_FLAGS_se_egg_hatch := -E -R$(STD_REVERB) -G128 -V120 -P5
+MID_FLAGS_se_roulette_ball := -E -R$(STD_REVERB) -G128 -V110 -P2
+MID_FLAGS_se_roulette_ball2 := -E -R$(STD_REVERB) -G128 -V110 -P2
+MID_FLAGS_se_ball_tray_exit := -E -R$(STD_REVERB) -G127 -V100 -P5
+MID_FLAGS_se_ball_tray_ball := -E -R$(STD_REVERB) -G128 -V110 -P5
+MID_FLAGS_se_ball_tray_enter := -E -R$(STD_REVERB) -G128 -V110 -P5
+MID_FLAGS_se_click := -E -R$(STD_REVERB) -G127 -V110 -P4
+MID_FLAGS_se_warp_in := -E -R$(STD_REVERB) -G127 -V090 -P4
+MID_FLAGS_se_warp_out := -E -R$(STD_REVERB) -G127 -V090 -P4
+MID_FLAGS_se_note_a := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_note_b := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_note_c := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_note_c_high := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_note_d := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_mud_ball := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_note_e := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_note_f := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_note_g := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_breakable_door := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_truck_door := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_truck_unload := -E -R$(STD_REVERB) -G127 -P4
+MID_FLAGS_se_truck_move := -E -R$(STD_REVERB) -G128 -P4
+MID_FLAGS_se_truck_stop := -E -R$(STD_REVERB) -G128 -P4
+MID_FLAGS_se_repel := -E -R$(STD_REVERB) -G127 -V090 -P4
+MID_FLAGS_se_m_double_slap := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_m_comet_punch := -E -R$(STD_REVERB) -G128 -V120 -P4
+MID_FLAGS_se_m_pay_day := -E -R$(STD_REVERB) -G128 -V095 -P4
+MID_FLAGS_se_m_fire_punch := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_m_scratch := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_m_vicegrip := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_m_razor_wind := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_m_razor_wind2 := -E -R$(STD_REVERB) -G128 -V090 -P4
+MID_FLAGS_se_m_swords_dance := -E -R$(STD_REVERB) -G128 -V100 -P4
+MID_FLAGS_se_m_cut := -E -R$(STD_REVERB) -G128 -V120 -P4
+MID_FLAGS_se_m_gust := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_m_gust2 := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_m_wing_attack := -E -R$(STD_REVERB) -G128 -V105 -P4
+MID_FLAGS_se_m_fly := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_m_bind := -E -R$(STD_REVERB) -G128 -V100 -P4
+MID_FLAGS_se_m_mega_kick := -E -R$(STD_REVERB) -G128 -V090 -P4
+MID_FLAGS_se_m_mega_kick2 := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_m_jump_kick := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_m_sand_attack := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_m_headbutt := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_m_horn_attack := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_m_take_down := -E -R$(STD_REVERB) -G128 -V105 -P4
+MID_FLAGS_se_m_tail_whip := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_m_leer := -E -R$(STD_REVERB) -G128 -V110 -P4
+MID_FLAGS_se_dex_search := -E -R$(STD_REVERB) -G127 -v100 -P5
+
+ifeq ($(MIDI_OBJ),1)
+$(MID_BUILDDIR)/%.o: $(MID_SUBDIR)/%.mid
+	$(MID) $< $@ $(MID_FLAGS_$*)
+else
 $(MID_BUILDDIR)/%.o: $(MID_SUBDIR)/%.s
 	$(AS) $(ASFLAGS) -I sound -o $@ $<
 
-$(MID_SUBDIR)/mus_rocket_hideout.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G133 -V090
-
-$(MID_SUBDIR)/mus_follow_me.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G131 -V068
-
-$(MID_SUBDIR)/mus_rs_vs_trainer.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G011 -V080 -P1
-
-$(MID_SUBDIR)/mus_rs_vs_gym_leader.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G010 -V080
-
-$(MID_SUBDIR)/mus_victory_road.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G154 -V090
-
-$(MID_SUBDIR)/mus_cycling.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G141 -V090
-
-$(MID_SUBDIR)/mus_intro_fight.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G136 -V090
-
-$(MID_SUBDIR)/mus_hall_of_fame.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G145 -V079
-
-$(MID_SUBDIR)/mus_encounter_deoxys.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G184 -V079
-
-$(MID_SUBDIR)/mus_dummy.s: %.s: %.mid
-	$(MID) $< $@ -E -R40
-
-$(MID_SUBDIR)/mus_credits.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G149 -V090
-
-$(MID_SUBDIR)/mus_encounter_gym_leader.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G144 -V090
-
-$(MID_SUBDIR)/mus_dex_rating.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G175 -V070 -P5
-
-$(MID_SUBDIR)/mus_obtain_key_item.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G178 -V077 -P5
-
-$(MID_SUBDIR)/mus_caught_intro.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G179 -V094 -P5
-
-$(MID_SUBDIR)/mus_level_up.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G008 -V090 -P5
-
-$(MID_SUBDIR)/mus_obtain_item.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G008 -V090 -P5
-
-$(MID_SUBDIR)/mus_evolved.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G008 -V090 -P5
-
-$(MID_SUBDIR)/mus_caught.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G170 -V100
-
-$(MID_SUBDIR)/mus_cinnabar.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G138 -V090
-
-$(MID_SUBDIR)/mus_gym.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G134 -V090
-
-$(MID_SUBDIR)/mus_fuchsia.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G167 -V090
-
-$(MID_SUBDIR)/mus_poke_jump.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G132 -V090
-
-$(MID_SUBDIR)/mus_heal_unused.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G140 -V090
-
-$(MID_SUBDIR)/mus_oak_lab.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G160 -V075
-
-$(MID_SUBDIR)/mus_berry_pick.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G132 -V090
-
-$(MID_SUBDIR)/mus_vermillion.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G172 -V090
-
-$(MID_SUBDIR)/mus_route1.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G150 -V079
-
-$(MID_SUBDIR)/mus_route3.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G152 -V083
-
-$(MID_SUBDIR)/mus_route11.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G153 -V090
-
-$(MID_SUBDIR)/mus_pallet.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G159 -V100
-
-$(MID_SUBDIR)/mus_heal.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G008 -V090 -P5
-
-$(MID_SUBDIR)/mus_slots_jackpot.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G008 -V100 -P5
-
-$(MID_SUBDIR)/mus_slots_win.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G008 -V100 -P5
-
-$(MID_SUBDIR)/mus_obtain_badge.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G008 -V090 -P5
-
-$(MID_SUBDIR)/mus_obtain_berry.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G008 -V090 -P5
-
-$(MID_SUBDIR)/mus_photo.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G180 -V100 -P5
-
-$(MID_SUBDIR)/mus_evolution_intro.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G009 -V080 -P1
-
-$(MID_SUBDIR)/mus_move_deleted.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G008 -V090 -P5
-
-$(MID_SUBDIR)/mus_obtain_tmhm.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G008 -V090 -P5
-
-$(MID_SUBDIR)/mus_too_bad.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G008 -V090 -P5
-
-$(MID_SUBDIR)/mus_surf.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G164 -V071
-
-$(MID_SUBDIR)/mus_sevii_123.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G173 -V084
-
-$(MID_SUBDIR)/mus_sevii_45.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G188 -V084
-
-$(MID_SUBDIR)/mus_sevii_67.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G189 -V084
-
-$(MID_SUBDIR)/mus_sevii_cave.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G147 -V090
-
-$(MID_SUBDIR)/mus_sevii_dungeon.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G146 -V090
-
-$(MID_SUBDIR)/mus_sevii_route.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G187 -V080
-
-$(MID_SUBDIR)/mus_net_center.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G162 -V096
-
-$(MID_SUBDIR)/mus_pewter.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G173 -V084
-
-$(MID_SUBDIR)/mus_oak.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G161 -V086
-
-$(MID_SUBDIR)/mus_mystery_gift.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G183 -V100
-
-$(MID_SUBDIR)/mus_route24.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G151 -V086
-
-$(MID_SUBDIR)/mus_teachy_tv_show.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G131 -V068
-
-$(MID_SUBDIR)/mus_mt_moon.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G147 -V090
-
-$(MID_SUBDIR)/mus_school.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G012 -V100 -P1
-
-$(MID_SUBDIR)/mus_poke_tower.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G165 -V090
-
-$(MID_SUBDIR)/mus_poke_center.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G162 -V096
-
-$(MID_SUBDIR)/mus_poke_flute.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G165 -V048 -P5
-
-$(MID_SUBDIR)/mus_poke_mansion.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G148 -V090
-
-$(MID_SUBDIR)/mus_jigglypuff.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G135 -V068 -P5
-
-$(MID_SUBDIR)/mus_encounter_rival.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G174 -V079
-
-$(MID_SUBDIR)/mus_rival_exit.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G174 -V079
-
-$(MID_SUBDIR)/mus_encounter_rocket.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G142 -V096
-
-$(MID_SUBDIR)/mus_ss_anne.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G163 -V090
-
-$(MID_SUBDIR)/mus_new_game_exit.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G182 -V088
-
-$(MID_SUBDIR)/mus_new_game_intro.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G182 -V088
-
-$(MID_SUBDIR)/mus_evolution.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G009 -V080 -P1
-
-$(MID_SUBDIR)/mus_lavender.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G139 -V090
-
-$(MID_SUBDIR)/mus_silph.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G166 -V076
-
-$(MID_SUBDIR)/mus_encounter_girl.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G143 -V051
-
-$(MID_SUBDIR)/mus_encounter_boy.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G144 -V090
-
-$(MID_SUBDIR)/mus_game_corner.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G132 -V090
-
-$(MID_SUBDIR)/mus_slow_pallet.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G159 -V092
-
-$(MID_SUBDIR)/mus_new_game_instruct.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G182 -V085
-
-$(MID_SUBDIR)/mus_viridian_forest.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G146 -V090
-
-$(MID_SUBDIR)/mus_trainer_tower.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G134 -V090
-
-$(MID_SUBDIR)/mus_celadon.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G168 -V070
-
-$(MID_SUBDIR)/mus_title.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G137 -V090
-
-$(MID_SUBDIR)/mus_game_freak.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G181 -V075
-
-$(MID_SUBDIR)/mus_teachy_tv_menu.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G186 -V059
-
-$(MID_SUBDIR)/mus_union_room.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G132 -V090
-
-$(MID_SUBDIR)/mus_vs_legend.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G157 -V090
-
-$(MID_SUBDIR)/mus_vs_deoxys.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G185 -V080
-
-$(MID_SUBDIR)/mus_vs_gym_leader.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G155 -V090
-
-$(MID_SUBDIR)/mus_vs_champion.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G158 -V090
-
-$(MID_SUBDIR)/mus_vs_mewtwo.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G157 -V090
-
-$(MID_SUBDIR)/mus_vs_trainer.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G156 -V090
-
-$(MID_SUBDIR)/mus_vs_wild.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G157 -V090
-
-$(MID_SUBDIR)/se_door.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G129 -V100 -P5
-
-$(MID_SUBDIR)/mus_victory_gym_leader.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G171 -V090
-
-$(MID_SUBDIR)/mus_victory_trainer.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G169 -V089
-
-$(MID_SUBDIR)/mus_victory_wild.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G170 -V090
-
-$(MID_SUBDIR)/ph_choice_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_choice_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_choice_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_cloth_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_cloth_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_cloth_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_cure_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_cure_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_cure_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_dress_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_dress_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_dress_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_face_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_face_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_face_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_fleece_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_fleece_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_fleece_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_foot_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_foot_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_foot_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_goat_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_goat_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_goat_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_goose_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_goose_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_goose_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_kit_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_kit_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_kit_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_lot_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_lot_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_lot_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_mouth_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_mouth_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_mouth_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_nurse_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_nurse_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_nurse_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_price_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_price_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_price_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_strut_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_strut_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_strut_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_thought_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_thought_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_thought_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_trap_blend.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_trap_held.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/ph_trap_solo.s: %.s: %.mid
-	$(MID) $< $@ -E -G130 -P4
-
-$(MID_SUBDIR)/se_bang.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_taillow_wing_flap.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V105 -P5
-
-$(MID_SUBDIR)/se_glass_flute.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V105 -P5
-
-$(MID_SUBDIR)/se_boo.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V110 -P4
-
-$(MID_SUBDIR)/se_ball.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V070 -P4
-
-$(MID_SUBDIR)/se_ball_open.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V100 -P5
-
-$(MID_SUBDIR)/se_mugshot.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V090 -P5
-
-$(MID_SUBDIR)/se_contest_heart.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V090 -P5
-
-$(MID_SUBDIR)/se_contest_curtain_fall.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V070 -P5
-
-$(MID_SUBDIR)/se_contest_curtain_rise.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V070 -P5
-
-$(MID_SUBDIR)/se_contest_icon_change.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P5
-
-$(MID_SUBDIR)/se_contest_mons_turn.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V090 -P5
-
-$(MID_SUBDIR)/se_contest_icon_clear.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V090 -P5
-
-$(MID_SUBDIR)/se_card.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V100 -P4
-
-$(MID_SUBDIR)/se_ledge.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V100 -P4
-
-$(MID_SUBDIR)/se_itemfinder.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V090 -P5
-
-$(MID_SUBDIR)/se_applause.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V100 -P5
-
-$(MID_SUBDIR)/se_field_poison.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V110 -P5
-
-$(MID_SUBDIR)/se_rs_door.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V080 -P5
-
-$(MID_SUBDIR)/se_elevator.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V100 -P4
-
-$(MID_SUBDIR)/se_escalator.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V100 -P4
-
-$(MID_SUBDIR)/se_exp.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V080 -P5
-
-$(MID_SUBDIR)/se_exp_max.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V094 -P5
-
-$(MID_SUBDIR)/se_fu_zaku.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V120 -P4
-
-$(MID_SUBDIR)/se_contest_condition_lose.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V110 -P4
-
-$(MID_SUBDIR)/se_lavaridge_fall_warp.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -P4
-
-$(MID_SUBDIR)/se_balloon_red.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V105 -P4
-
-$(MID_SUBDIR)/se_balloon_blue.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V105 -P4
-
-$(MID_SUBDIR)/se_balloon_yellow.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V105 -P4
-
-$(MID_SUBDIR)/se_bridge_walk.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V095 -P4
-
-$(MID_SUBDIR)/se_failure.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V120 -P4
-
-$(MID_SUBDIR)/se_rotating_gate.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V090 -P4
-
-$(MID_SUBDIR)/se_low_health.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V100 -P3
-
-$(MID_SUBDIR)/se_sliding_door.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V095 -P4
-
-$(MID_SUBDIR)/se_vend.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_bike_hop.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V090 -P4
-
-$(MID_SUBDIR)/se_bike_bell.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V090 -P4
-
-$(MID_SUBDIR)/se_contest_place.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V110 -P4
-
-$(MID_SUBDIR)/se_exit.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V120 -P5
-
-$(MID_SUBDIR)/se_use_item.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V100 -P5
-
-$(MID_SUBDIR)/se_unlock.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V100 -P4
-
-$(MID_SUBDIR)/se_ball_bounce_1.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V100 -P4
-
-$(MID_SUBDIR)/se_ball_bounce_2.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V100 -P4
-
-$(MID_SUBDIR)/se_ball_bounce_3.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V100 -P4
-
-$(MID_SUBDIR)/se_ball_bounce_4.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V100 -P4
-
-$(MID_SUBDIR)/se_super_effective.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V110 -P5
-
-$(MID_SUBDIR)/se_not_effective.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V110 -P5
-
-$(MID_SUBDIR)/se_effective.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V110 -P5
-
-$(MID_SUBDIR)/se_puddle.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V020 -P4
-
-$(MID_SUBDIR)/se_berry_blender.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V090 -P4
-
-$(MID_SUBDIR)/se_switch.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V100 -P4
-
-$(MID_SUBDIR)/se_ball_throw.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V120 -P5
-
-$(MID_SUBDIR)/se_ship.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V075 -P4
-
-$(MID_SUBDIR)/se_flee.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V090 -P5
-
-$(MID_SUBDIR)/se_intro_blast.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V100 -P5
-
-$(MID_SUBDIR)/se_pc_login.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V100 -P5
-
-$(MID_SUBDIR)/se_pc_off.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V100 -P5
-
-$(MID_SUBDIR)/se_pc_on.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V100 -P5
-
-$(MID_SUBDIR)/se_pin.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V060 -P4
-
-$(MID_SUBDIR)/se_ding_dong.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V090 -P5
-
-$(MID_SUBDIR)/se_pokenav_off.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V100 -P5
-
-$(MID_SUBDIR)/se_pokenav_on.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V100 -P5
-
-$(MID_SUBDIR)/se_faint.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V110 -P5
-
-$(MID_SUBDIR)/se_shiny.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V095 -P5
-
-$(MID_SUBDIR)/se_rs_shop.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V090 -P5
-
-$(MID_SUBDIR)/se_ice_crack.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V100 -P4
-
-$(MID_SUBDIR)/se_ice_stairs.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V090 -P4
-
-$(MID_SUBDIR)/se_ice_break.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V100 -P4
-
-$(MID_SUBDIR)/se_fall.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_save.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V080 -P5
-
-$(MID_SUBDIR)/se_success.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V080 -P4
-
-$(MID_SUBDIR)/se_select.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V080 -P5
-
-$(MID_SUBDIR)/se_ball_trade.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V100 -P5
-
-$(MID_SUBDIR)/se_thunderstorm.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V080 -P2
-
-$(MID_SUBDIR)/se_thunderstorm_stop.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V080 -P2
-
-$(MID_SUBDIR)/se_thunder.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P3
-
-$(MID_SUBDIR)/se_thunder2.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P3
-
-$(MID_SUBDIR)/se_rain.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V080 -P2
-
-$(MID_SUBDIR)/se_rain_stop.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V080 -P2
-
-$(MID_SUBDIR)/se_downpour.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V100 -P2
-
-$(MID_SUBDIR)/se_downpour_stop.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V100 -P2
-
-$(MID_SUBDIR)/se_orb.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V100 -P5
-
-$(MID_SUBDIR)/se_egg_hatch.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V120 -P5
-
-$(MID_SUBDIR)/se_roulette_ball.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P2
-
-$(MID_SUBDIR)/se_roulette_ball2.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P2
-
-$(MID_SUBDIR)/se_ball_tray_exit.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V100 -P5
-
-$(MID_SUBDIR)/se_ball_tray_ball.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P5
-
-$(MID_SUBDIR)/se_ball_tray_enter.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P5
-
-$(MID_SUBDIR)/se_click.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V110 -P4
-
-$(MID_SUBDIR)/se_warp_in.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V090 -P4
-
-$(MID_SUBDIR)/se_warp_out.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V090 -P4
-
-$(MID_SUBDIR)/se_note_a.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_note_b.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_note_c.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_note_c_high.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_note_d.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_mud_ball.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_note_e.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_note_f.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_note_g.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_breakable_door.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_truck_door.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_truck_unload.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -P4
-
-$(MID_SUBDIR)/se_truck_move.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -P4
-
-$(MID_SUBDIR)/se_truck_stop.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -P4
-
-$(MID_SUBDIR)/se_repel.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -V090 -P4
-
-$(MID_SUBDIR)/se_m_double_slap.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_m_comet_punch.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V120 -P4
-
-$(MID_SUBDIR)/se_m_pay_day.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V095 -P4
-
-$(MID_SUBDIR)/se_m_fire_punch.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_m_scratch.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_m_vicegrip.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_m_razor_wind.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_m_razor_wind2.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V090 -P4
-
-$(MID_SUBDIR)/se_m_swords_dance.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V100 -P4
-
-$(MID_SUBDIR)/se_m_cut.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V120 -P4
-
-$(MID_SUBDIR)/se_m_gust.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_m_gust2.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_m_wing_attack.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V105 -P4
-
-$(MID_SUBDIR)/se_m_fly.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_m_bind.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V100 -P4
-
-$(MID_SUBDIR)/se_m_mega_kick.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V090 -P4
-
-$(MID_SUBDIR)/se_m_mega_kick2.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_m_jump_kick.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_m_sand_attack.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_m_headbutt.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_m_horn_attack.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_m_take_down.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V105 -P4
-
-$(MID_SUBDIR)/se_m_tail_whip.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_m_leer.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G128 -V110 -P4
-
-$(MID_SUBDIR)/se_dex_search.s: %.s: %.mid
-	$(MID) $< $@ -E -R$(STD_REVERB) -G127 -v100 -P5
+$(MID_SUBDIR)/%.s: $(MID_SUBDIR)/%.mid
+	$(MID) $< $@ $(MID_FLAGS_$*)
+endif
@@ -747,6 +747,7 @@ static void Task_InitUpdateMonBg(u8 taskId)
         src = gPlttBufferFaded + 0x100 + palIndex * 16;
         dst = gPlttBufferFaded + 0x100 + animBg.paletteId * 16 - 256;
         CpuCopy32(src, dst, 0x20);
+        MarkPlttBufferDirty(dst - gPlttBufferFaded, 16);
     }
     else
     {
@@ -758,6 +759,7 @@ static void Task_InitUpdateMonBg(u8 taskId)
         src = gPlttBufferFaded + 0x100 + palIndex * 16;
         dst = gPlttBufferFaded + 0x100 - 112;
         CpuCopy32(src, dst, 0x20);
+        MarkPlttBufferDirty(dst - gPlttBufferFaded, 16);
     }
 }
 
@@ -4020,6 +4020,7 @@ static void AnimProtect_Step(struct Sprite *sprite)
         }
 
         gPlttBufferFaded[sprite->data[2] + 7] = savedPal;
+        MarkPlttBufferDirty(sprite->data[2] + 1, 7);
     }
 
     if (sprite->data[7] > 6 && sprite->data[0] >0 && ++sprite->data[6] > 1)
@@ -5113,6 +5114,7 @@ void AnimTask_MoonlightEndFade_Step(u8 taskId)
                 bitmask <<= 1;
                 r3 += 16;
             }
+            MarkPalettesDirty((u16)task->data[3]);
         }
         break;
     case 1:
@@ -5298,6 +5300,7 @@ void AnimTask_MusicNotesRainbowBlend(u8 taskId)
         index = (index << 4) + 0x100;
         for (i = 1; i < NELEMS(sParticlesColorBlendTable[0]); i++)
             gPlttBufferFaded[index + i] = sParticlesColorBlendTable[0][i];
+        MarkPlttBufferDirty(index, 16);
     }
 
     for (j = 1; j < NELEMS(sParticlesColorBlendTable); j++)
@@ -5308,6 +5311,7 @@ void AnimTask_MusicNotesRainbowBlend(u8 taskId)
             index = (index << 4) + 0x100;
             for (i = 1; i < NELEMS(sParticlesColorBlendTable[0]); i++)
                 gPlttBufferFaded[index + i] = sParticlesColorBlendTable[j][i];
+            MarkPlttBufferDirty(index, 16);
         }
     }
     DestroyAnimVisualTask(taskId);
@@ -1372,6 +1372,7 @@ static void SetPsychicBackground_Step(u8 taskId)
             gPlttBufferFaded[paletteIndex * 16 + i + 1] = gPlttBufferFaded[paletteIndex * 16 + i];
 
         gPlttBufferFaded[paletteIndex * 16 + 1] = lastColor;
+        MarkPlttBufferDirty(paletteIndex * 16, 16);
         gTasks[taskId].data[5] = 0;
     }
 
@@ -1397,6 +1398,7 @@ static void FadeScreenToWhite_Step(u8 taskId)
         for (i = 10; i > 0; i--)
             gPlttBufferFaded[paletteIndex * 16 + i + 1] = gPlttBufferFaded[paletteIndex * 16 + i];
         gPlttBufferFaded[paletteIndex * 16 + 1] = lastColor;
+        MarkPlttBufferDirty(paletteIndex * 16, 16);
 
         lastColor = gPlttBufferUnfaded[paletteIndex * 16 + 11];
         for (i = 10; i > 0; i--)
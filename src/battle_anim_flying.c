@@ -404,6 +404,7 @@ static void AnimTask_AnimateGustTornadoPalette_Step(u8 taskId)
         } while (--i > 0);
 
         gPlttBufferFaded[base + 0x101] = temp;
+        MarkPlttBufferDirty(base + 0x100, 16);
     }
     if (--gTasks[taskId].data[0] == 0)
         DestroyAnimVisualTask(taskId);
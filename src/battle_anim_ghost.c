@@ -646,6 +646,7 @@ static void AnimTask_SpiteTargetShadow_Step1(u8 taskId)
     case 1:
         task->data[14] = (task->data[14] + 16) * 16;
         CpuCopy32(&gPlttBufferUnfaded[task->data[4]], &gPlttBufferFaded[task->data[14]], 0x20);
+        MarkPlttBufferDirty(task->data[14], 16);
         BlendPalette(task->data[4], 16, 10, RGB(13, 0, 15));
         ++task->data[15];
         break;
@@ -1310,6 +1310,7 @@ void SetGreyscaleOrOriginalPalette(u16 paletteNum, bool8 restoreOriginalColor)
     {
         CpuCopy32(&gPlttBufferUnfaded[paletteNum], &gPlttBufferFaded[paletteNum], 32);
     }
+    MarkPlttBufferDirty(paletteNum, 16);
 }
 
 u32 GetBattlePalettesMask(bool8 battleBackground, bool8 attacker, bool8 target, bool8 attackerPartner, bool8 targetPartner, bool8 anim1, bool8 anim2)
@@ -1528,6 +1529,7 @@ s16 CloneBattlerSpriteWithBlend(u8 animBattler)
                 gSprites[i] = gSprites[spriteId];
                 gSprites[i].oam.objMode = ST_OAM_OBJ_BLEND;
                 gSprites[i].invisible = FALSE;
+                RegisterCopiedSprite(i);
                 return i;
             }
         }
@@ -489,6 +489,7 @@ static void AnimDefensiveWall_Step3(struct Sprite *sprite)
         for (i = 8; i > 0; --i)
             gPlttBufferFaded[startOffset + i] = gPlttBufferFaded[startOffset + i - 1];
         gPlttBufferFaded[startOffset + 1] = color;
+        MarkPlttBufferDirty(startOffset, 16);
         if (++sprite->data[2] == 16)
             sprite->callback = AnimDefensiveWall_Step4;
     }
@@ -398,6 +398,7 @@ static void AnimTask_FrozenIceCube_Step2(u8 taskId)
             gPlttBufferFaded[0x100 + palIndex * 16 + 13] = gPlttBufferFaded[0x100 + palIndex * 16 + 14];
             gPlttBufferFaded[0x100 + palIndex * 16 + 14] = gPlttBufferFaded[0x100 + palIndex * 16 + 15];
             gPlttBufferFaded[0x100 + palIndex * 16 + 15] = temp;
+            MarkPlttBufferDirty(0x100 + palIndex * 16, 16);
 
             gTasks[taskId].data[2] = 0;
             gTasks[taskId].data[3]++;
@@ -643,6 +643,7 @@ static void SetPalettesToColor(u32 selectedPalettes, u16 color)
 {
     u16 i, curOffset, paletteOffset;
 
+    MarkPalettesDirty(selectedPalettes);
     for (i = 0; i < 32; selectedPalettes >>= 1, ++i)
         if (selectedPalettes & 1)
             for (curOffset = i * 16, paletteOffset = curOffset; curOffset < paletteOffset + 16; ++curOffset)
@@ -637,6 +637,7 @@ static void AnimTask_RotateAuroraRingColors_Step(u8 taskId)
         for (i = 1; i < 8; i++)
             gPlttBufferFaded[palIndex + i - 1] = gPlttBufferFaded[palIndex + i];
         gPlttBufferFaded[palIndex + 7] = tempPlt;
+        MarkPlttBufferDirty(palIndex, 8);
     }
     if (++gTasks[taskId].data[11] == gTasks[taskId].data[0])
         DestroyAnimVisualTask(taskId);
@@ -896,6 +897,7 @@ static void AnimTask_CreateSurfWave_Step1(u8 taskId)
             gPlttBufferFaded[16 * animBg.paletteId + 1 + i] = gPlttBufferFaded[16 * animBg.paletteId + 1 + i - 1]; // 1 + i - 1 is needed to match for some bizarre reason
         }
         gPlttBufferFaded[16 * animBg.paletteId + 1] = rgbBuffer;
+        MarkPlttBufferDirty(16 * animBg.paletteId, 16);
         gTasks[taskId].data[5] = 0;
     }
     if (++gTasks[taskId].data[6] > 1)
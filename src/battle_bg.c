@@ -697,12 +697,14 @@ void LoadBattleMenuWindowGfx(void)
     gPlttBufferUnfaded[0x5E] = RGB(31, 31, 31);
     gPlttBufferUnfaded[0x5F] = RGB( 26,  26,  25);
     CpuCopy16(&gPlttBufferUnfaded[0x5C], &gPlttBufferFaded[0x5C], 8);
+    MarkPlttBufferDirty(0x5C, 4);
     if (gBattleTypeFlags & (BATTLE_TYPE_FIRST_BATTLE | BATTLE_TYPE_POKEDUDE))
     {
         Menu_LoadStdPalAt(0x70);
         LoadMenuMessageWindowGfx(0, 0x030, 0x70);
         gPlttBufferUnfaded[0x76] = RGB( 0,  0,  0);
         CpuCopy16(&gPlttBufferUnfaded[0x76], &gPlttBufferFaded[0x76], 2);
+        MarkPlttBufferDirty(0x76, 1);
     }
 }
 
@@ -928,6 +930,7 @@ void InitLinkBattleVsScreen(u8 taskId)
     case 1:
         palId = AllocSpritePalette(TAG_VS_LETTERS);
         gPlttBufferUnfaded[palId * 16 + 0x10F] = gPlttBufferFaded[palId * 16 + 0x10F] = RGB(31, 31, 31);
+        MarkPlttBufferDirty(palId * 16 + 0x10F, 1);
         gBattleStruct->linkBattleVsSpriteId_V = CreateSprite(&sVsLetter_V_SpriteTemplate, 108, 80, 0);
         gBattleStruct->linkBattleVsSpriteId_S = CreateSprite(&sVsLetter_S_SpriteTemplate, 132, 80, 0);
         gSprites[gBattleStruct->linkBattleVsSpriteId_V].invisible = TRUE;
@@ -2825,6 +2825,7 @@ void SetPpNumbersPaletteInMoveSelection(void)
 
     CpuCopy16(&gPlttBufferUnfaded[92], &gPlttBufferFaded[92], sizeof(u16));
     CpuCopy16(&gPlttBufferUnfaded[91], &gPlttBufferFaded[91], sizeof(u16));
+    MarkPlttBufferDirty(91, 2);
 }
 
 u8 GetCurrentPpToMaxPpState(u8 currentPp, u8 maxPp)
@@ -221,6 +221,7 @@ static void ResetGpu(void)
     u32 size = PLTT_SIZE;
     DmaClear16(3, dest, size);
     }
+    MarkPalettesDirty(PALETTES_ALL);
 
     SetGpuReg(REG_OFFSET_DISPCNT, 0);
     SetGpuReg(REG_OFFSET_BG0CNT, 0);
@@ -9705,6 +9705,7 @@ static void Cmd_displaydexinfo(void)
                                             0,
                                             0xFFFF);
             CpuFill32(0, gPlttBufferFaded, BG_PLTT_SIZE);
+            MarkPalettesDirty(PALETTES_BG);
             BeginNormalPaletteFade(0x1FFFF, 0, 16, 0, RGB_BLACK);
             ShowBg(0);
             ShowBg(3);
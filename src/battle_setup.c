@@ -26,6 +26,7 @@
 #include "battle.h"
 #include "battle_transition.h"
 #include "battle_controllers.h"
+#include "palette.h"
 #include "constants/battle_setup.h"
 #include "constants/items.h"
 #include "constants/maps.h"
@@ -421,6 +422,7 @@ static void StartPokedudeBattle(void)
 static void CB2_EndWildBattle(void)
 {
     CpuFill16(0, (void *)BG_PLTT, BG_PLTT_SIZE);
+    MarkPalettesDirty(PALETTES_BG);
     ResetOamRange(0, 128);
     if (IsPlayerDefeated(gBattleOutcome) == TRUE)
     {
@@ -436,6 +438,7 @@ static void CB2_EndWildBattle(void)
 static void CB2_EndScriptedWildBattle(void)
 {
     CpuFill16(0, (void *)BG_PLTT, BG_PLTT_SIZE);
+    MarkPalettesDirty(PALETTES_BG);
     ResetOamRange(0, 128);
     if (IsPlayerDefeated(gBattleOutcome) == TRUE)
         SetMainCallback2(CB2_WhiteOut);
@@ -446,6 +449,7 @@ static void CB2_EndScriptedWildBattle(void)
 static void CB2_EndMarowakBattle(void)
 {
     CpuFill16(0, (void *)BG_PLTT, BG_PLTT_SIZE);
+    MarkPalettesDirty(PALETTES_BG);
     ResetOamRange(0, 128);
     if (IsPlayerDefeated(gBattleOutcome))
     {
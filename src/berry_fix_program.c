@@ -8,6 +8,7 @@
 #include "scanline_effect.h"
 #include "help_system.h"
 #include "m4a.h"
+#include "palette.h"
 
 enum {
     SCENE_ENSURE_CONNECT,
@@ -85,6 +86,7 @@ static void SetScene(int scene)
     LZ77UnCompVram(sBerryFixGraphics[scene][0], (void *)BG_CHAR_ADDR(0));
     LZ77UnCompVram(sBerryFixGraphics[scene][1], (void *)BG_SCREEN_ADDR(31));
     CpuCopy16(sBerryFixGraphics[scene][2], (void *)BG_PLTT, 0x200);
+    MarkPalettesDirty(PALETTES_BG);
     REG_BG0CNT = BGCNT_PRIORITY(0) | BGCNT_CHARBASE(0) | BGCNT_16COLOR | BGCNT_SCREENBASE(31) | BGCNT_TXT256x256;
     REG_DISPCNT = DISPCNT_BG0_ON;
 }
@@ -101,6 +103,7 @@ void CB2_InitBerryFixProgram(void)
     SetVBlankCallback(NULL);
     DmaFill32(3, 0, (void *)VRAM, VRAM_SIZE);
     DmaFill32(3, 0, (void *)PLTT, PLTT_SIZE);
+    MarkPalettesDirty(PALETTES_ALL);
     ResetSpriteData();
     ResetTasks();
     ScanlineEffect_Stop();
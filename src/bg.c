@@ -181,7 +181,13 @@ u8 LoadBgVram(u8 bg, const void *src, u16 size, u16 destOffset, u8 mode)
 
         offset = destOffset + offset;
 
+#if MODERN
+        // A tilemap that's late shows up wrong, but tiles are usually loaded
+        // ahead of time.
+        cursor = RequestDma3Copy(src, (void *)(offset + BG_VRAM), size, mode == 0x2 ? DMA3_16BIT | DMA3_HIGH_PRIORITY : DMA3_16BIT);
+#else
         cursor = RequestDma3Copy(src, (void *)(offset + BG_VRAM), size, DMA3_16BIT);
+#endif // MODERN
 
         if (cursor == -1)
         {
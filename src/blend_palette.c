@@ -2,9 +2,42 @@
 #include "blend_palette.h"
 #include "palette.h"
 
+#if MODERN
+#define LOW_CHANNELS 0x001F001F
+
+// Blends the colors two at a time, one in each half of a word. Each channel
+// gets a 16-bit lane, which is room for src * (16 - coeff) + target * coeff,
+// so one multiply blends the same channel of both colors. Dividing the sum by
+// 16 gives the same result as the per-color blend below for coeff <= 16.
+static IWRAM_CODE void BlendColorPairs(const u32 *src, u32 *dest, u32 numPairs, u32 coeff, u32 blendColor)
+{
+    u32 srcCoeff = 16 - coeff;
+    u32 r = (blendColor & 0x1F) * 0x10001 * coeff;
+    u32 g = ((blendColor >> 5) & 0x1F) * 0x10001 * coeff;
+    u32 b = ((blendColor >> 10) & 0x1F) * 0x10001 * coeff;
+
+    while (numPairs-- != 0)
+    {
+        u32 colors = *src++;
+
+        *dest++ = ((((colors & LOW_CHANNELS) * srcCoeff + r) >> 4) & LOW_CHANNELS)
+                | (((((colors >> 5) & LOW_CHANNELS) * srcCoeff + g) >> 4) & LOW_CHANNELS) << 5
+                | (((((colors >> 10) & LOW_CHANNELS) * srcCoeff + b) >> 4) & LOW_CHANNELS) << 10;
+    }
+}
+#endif // MODERN
+
 void BlendPalette(u16 palOffset, u16 numEntries, u8 coeff, u16 blendColor)
 {
     u16 i;
+#if MODERN
+    if (coeff <= 16 && !(palOffset & 1) && !(numEntries & 1))
+    {
+        BlendColorPairs((const u32 *)&gPlttBufferUnfaded[palOffset], (u32 *)&gPlttBufferFaded[palOffset], numEntries / 2, coeff, blendColor);
+        MarkPlttBufferDirty(palOffset, numEntries);
+        return;
+    }
+#endif // MODERN
     for (i = 0; i < numEntries; i++)
     {
         u16 index = i + palOffset;
@@ -17,6 +50,7 @@ void BlendPalette(u16 palOffset, u16 numEntries, u8 coeff, u16 blendColor)
                                 | ((g + (((data2->g - g) * coeff) >> 4)) << 5)
                                 | ((b + (((data2->b - b) * coeff) >> 4)) << 10);
     }
+    MarkPlttBufferDirty(palOffset, numEntries);
 }
 
 void BlendPalettesAt(u16 * palbuff, u16 blend_pal, u32 coefficient, s32 size)
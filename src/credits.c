@@ -806,6 +806,7 @@ static bool32 DoOverworldMapScrollScene(u8 whichMon)
         Menu_LoadStdPalAt(0xF0);
         gPlttBufferUnfaded[0xFF] = RGB_BLACK;
         gPlttBufferFaded[0xFF] = RGB_BLACK;
+        MarkPlttBufferDirty(0xFF, 1);
         return TRUE;
     default:
         return FALSE;
@@ -830,6 +831,7 @@ static s32 RollCredits(void)
         Menu_LoadStdPalAt(0xF0);
         gPlttBufferUnfaded[0xFF] = RGB_BLACK;
         gPlttBufferFaded[0xFF] = RGB_BLACK;
+        MarkPlttBufferDirty(0xFF, 1);
         sCreditsMgr->mainseqno = CREDITSSCENE_OPEN_WIN0;
         return 0;
     case CREDITSSCENE_OPEN_WIN0:
@@ -3,6 +3,260 @@
 
 #define MAX_DMA_REQUESTS 128
 
+#if MODERN
+// Requests wait in the order they were made, from gDma3RequestCursor up to
+// sDma3RequestTail. Each frame, the high priority ones go first, as long as
+// they don't touch memory an earlier request uses, and then the rest are done
+// in order until the frame's budget runs out. Requests that go ahead leave a
+// hole that's skipped when the cursor gets to it.
+
+#define DMA3_MAX_BYTES_PER_FRAME (40 * 1024)
+
+// A request that continues the last one is merged into it, up to one DMA
+// block. VCOUNT and the budget are only checked between requests, so a larger
+// one could start at the end of VBlank and run well into the next frame.
+#define DMA3_MAX_MERGED_SIZE MAX_DMA_BLOCK_SIZE
+
+static struct {
+    const u8 *src;
+    u8 *dest;
+    u16 size;
+    u8 mode;
+    u8 priority;
+    u32 value;
+} gDma3Requests[MAX_DMA_REQUESTS];
+
+static volatile bool8 gDma3ManagerLocked;
+static u8 gDma3RequestCursor;
+static u8 sDma3RequestTail;
+static u8 sDma3QueueLength; // Including holes
+static u8 sNumPendingDma3Requests;
+static u8 sNumHighPriorityDma3Requests;
+static struct Dma3Stats sDma3Stats;
+
+#define NEXT_DMA3_REQUEST(i) (((i) + 1) % MAX_DMA_REQUESTS)
+#define IS_DMA3_COPY(mode) ((mode) == DMA_REQUEST_COPY32 || (mode) == DMA_REQUEST_COPY16)
+
+void ClearDma3Requests(void)
+{
+    int i;
+
+    gDma3ManagerLocked = TRUE;
+    gDma3RequestCursor = 0;
+    sDma3RequestTail = 0;
+    sDma3QueueLength = 0;
+    sNumPendingDma3Requests = 0;
+    sNumHighPriorityDma3Requests = 0;
+    memset(&sDma3Stats, 0, sizeof(sDma3Stats));
+
+    for (i = 0; i < MAX_DMA_REQUESTS; i++)
+    {
+        gDma3Requests[i].size = 0;
+        gDma3Requests[i].src = 0;
+        gDma3Requests[i].dest = 0;
+    }
+
+    gDma3ManagerLocked = FALSE;
+}
+
+static bool32 RangesOverlap(const u8 *a, u32 aSize, const u8 *b, u32 bSize)
+{
+    return a < b + bSize && b < a + aSize;
+}
+
+// Whether doing the later request first could change what either one does.
+static bool32 Dma3RequestsConflict(u32 earlier, u32 later)
+{
+    const u8 *dest = gDma3Requests[later].dest;
+    u32 size = gDma3Requests[later].size;
+    const u8 *earlierDest = gDma3Requests[earlier].dest;
+    u32 earlierSize = gDma3Requests[earlier].size;
+
+    if (RangesOverlap(dest, size, earlierDest, earlierSize))
+        return TRUE;
+    if (IS_DMA3_COPY(gDma3Requests[earlier].mode)
+     && RangesOverlap(dest, size, gDma3Requests[earlier].src, earlierSize))
+        return TRUE;
+    if (IS_DMA3_COPY(gDma3Requests[later].mode)
+     && RangesOverlap(gDma3Requests[later].src, size, earlierDest, earlierSize))
+        return TRUE;
+    return FALSE;
+}
+
+// Returns FALSE, leaving the request for a later frame, if there isn't time
+// for it in this one.
+static bool32 TryDoDma3Request(u32 index, u32 *bytesTransferred)
+{
+    u32 vcount;
+
+    *bytesTransferred += gDma3Requests[index].size;
+
+    if (*bytesTransferred > DMA3_MAX_BYTES_PER_FRAME)
+        return FALSE; // don't transfer more than 40 KiB
+    // Stop when we're about to leave VBlank, or have already gone past the
+    // last line into the next frame.
+    vcount = *(u8 *)REG_ADDR_VCOUNT;
+    if (vcount > 224 || vcount < DISPLAY_HEIGHT)
+        return FALSE;
+
+    switch (gDma3Requests[index].mode)
+    {
+    case DMA_REQUEST_COPY32:
+        Dma3CopyLarge32_(gDma3Requests[index].src, gDma3Requests[index].dest, gDma3Requests[index].size);
+        break;
+    case DMA_REQUEST_FILL32:
+        Dma3FillLarge32_(gDma3Requests[index].value, gDma3Requests[index].dest, gDma3Requests[index].size);
+        break;
+    case DMA_REQUEST_COPY16:
+        Dma3CopyLarge16_(gDma3Requests[index].src, gDma3Requests[index].dest, gDma3Requests[index].size);
+        break;
+    case DMA_REQUEST_FILL16:
+        Dma3FillLarge16_(gDma3Requests[index].value, gDma3Requests[index].dest, gDma3Requests[index].size);
+        break;
+    }
+
+    sDma3Stats.bytes += gDma3Requests[index].size;
+    sDma3Stats.requests++;
+    sNumPendingDma3Requests--;
+    if (gDma3Requests[index].priority != 0)
+        sNumHighPriorityDma3Requests--;
+
+    // Free the request
+    gDma3Requests[index].src = NULL;
+    gDma3Requests[index].dest = NULL;
+    gDma3Requests[index].size = 0;
+    gDma3Requests[index].mode = 0;
+    gDma3Requests[index].priority = 0;
+    gDma3Requests[index].value = 0;
+    return TRUE;
+}
+
+// Returns FALSE if the frame's budget ran out.
+static bool32 DoHighPriorityDma3Requests(u32 *bytesTransferred)
+{
+    u32 i, j, n;
+
+    for (i = gDma3RequestCursor, n = 0; n < sDma3QueueLength && sNumHighPriorityDma3Requests != 0; i = NEXT_DMA3_REQUEST(i), n++)
+    {
+        if (gDma3Requests[i].size == 0 || gDma3Requests[i].priority == 0)
+            continue;
+
+        for (j = gDma3RequestCursor; j != i; j = NEXT_DMA3_REQUEST(j))
+        {
+            if (gDma3Requests[j].size != 0 && Dma3RequestsConflict(j, i))
+                break;
+        }
+
+        if (j == i && !TryDoDma3Request(i, bytesTransferred))
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+void ProcessDma3Requests(void)
+{
+    u32 bytesTransferred;
+
+    sDma3Stats.bytes = 0;
+    sDma3Stats.requests = 0;
+
+    if (!gDma3ManagerLocked)
+    {
+        bytesTransferred = 0;
+
+        if (sNumHighPriorityDma3Requests == 0 || DoHighPriorityDma3Requests(&bytesTransferred))
+        {
+            while (sDma3QueueLength != 0)
+            {
+                if (gDma3Requests[gDma3RequestCursor].size != 0
+                 && !TryDoDma3Request(gDma3RequestCursor, &bytesTransferred))
+                    break;
+
+                gDma3RequestCursor = NEXT_DMA3_REQUEST(gDma3RequestCursor);
+                sDma3QueueLength--;
+            }
+        }
+    }
+
+    sDma3Stats.deferred = sNumPendingDma3Requests;
+    if (sNumPendingDma3Requests != 0)
+        sDma3Stats.framesDeferred++;
+}
+
+// Merges the request into the last one queued if it continues it. Returns the
+// index of the merged request, or -1.
+static s16 TryMergeDma3Request(const u8 *src, u8 *dest, u16 size, u8 mode, u32 value, u8 priority)
+{
+    u32 last = (sDma3RequestTail + MAX_DMA_REQUESTS - 1) % MAX_DMA_REQUESTS;
+
+    if (sDma3QueueLength == 0
+     || gDma3Requests[last].size == 0
+     || gDma3Requests[last].mode != mode
+     || gDma3Requests[last].priority != priority
+     || gDma3Requests[last].dest + gDma3Requests[last].size != dest
+     || gDma3Requests[last].size + size > DMA3_MAX_MERGED_SIZE)
+        return -1;
+
+    if (IS_DMA3_COPY(mode) ? gDma3Requests[last].src + gDma3Requests[last].size != src
+                           : gDma3Requests[last].value != value)
+        return -1;
+
+    gDma3Requests[last].size += size;
+    sDma3Stats.merged++;
+    return last;
+}
+
+static s16 QueueDma3Request(const void *src, void *dest, u16 size, u8 mode, u32 value, u8 priority)
+{
+    s16 index;
+
+    gDma3ManagerLocked = TRUE;
+
+    index = TryMergeDma3Request(src, dest, size, mode, value, priority);
+    if (index < 0 && sDma3QueueLength < MAX_DMA_REQUESTS)
+    {
+        index = sDma3RequestTail;
+
+        // An empty request is already done, so it isn't queued.
+        if (size != 0)
+        {
+            gDma3Requests[index].src = src;
+            gDma3Requests[index].dest = dest;
+            gDma3Requests[index].size = size;
+            gDma3Requests[index].mode = mode;
+            gDma3Requests[index].priority = priority;
+            gDma3Requests[index].value = value;
+            sDma3RequestTail = NEXT_DMA3_REQUEST(sDma3RequestTail);
+            sDma3QueueLength++;
+            sNumPendingDma3Requests++;
+            if (priority != 0)
+                sNumHighPriorityDma3Requests++;
+        }
+    }
+
+    gDma3ManagerLocked = FALSE;
+    return index;
+}
+
+s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
+{
+    return QueueDma3Request(src, dest, size, (mode & DMA3_32BIT) ? DMA_REQUEST_COPY32 : DMA_REQUEST_COPY16,
+                            0, (mode & DMA3_HIGH_PRIORITY) != 0);
+}
+
+s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)
+{
+    return QueueDma3Request(NULL, dest, size, (mode & DMA3_32BIT) ? DMA_REQUEST_FILL32 : DMA_REQUEST_FILL16,
+                            value, (mode & DMA3_HIGH_PRIORITY) != 0);
+}
+
+void GetDma3Stats(struct Dma3Stats *stats)
+{
+    *stats = sDma3Stats;
+}
+
+#else
 static struct {
     /* 0x00 */ const u8 *src;
     /* 0x04 */ u8 *dest;
@@ -162,6 +416,8 @@ s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)
     return -1;
 }
 
+#endif // MODERN
+
 s16 WaitDma3Request(s16 index)
 {
     int current = 0;
@@ -1168,6 +1168,7 @@ static void FCSetup_ClearVideoRegisters(void)
     DmaClearLarge16(3, vram, VRAM_SIZE, 0x1000);
     DmaClear32(3, OAM, OAM_SIZE);
     DmaClear16(3, PLTT, PLTT_SIZE);
+    MarkPalettesDirty(PALETTES_ALL);
     SetGpuReg(REG_OFFSET_DISPCNT,  0);
     SetGpuReg(REG_OFFSET_BG0CNT,   0);
     SetGpuReg(REG_OFFSET_BG0HOFS,  0);
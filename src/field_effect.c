@@ -455,6 +455,7 @@ void ApplyGlobalFieldPaletteTint(u8 paletteIdx)
         return;
     }
     CpuFastCopy(&gPlttBufferUnfaded[(paletteIdx + 16) * 16], &gPlttBufferFaded[(paletteIdx + 16) * 16], 0x20);
+    MarkPlttBufferDirty((paletteIdx + 16) * 16, 16);
 }
 
 static void FieldEffectScript_LoadFadedPal(const u8 **script)
@@ -654,6 +655,7 @@ void MultiplyInvertedPaletteRGBComponents(u16 i, u8 r, u8 g, u8 b)
     outPal |= curGreen << 5;
     outPal |= curBlue << 10;
     gPlttBufferFaded[i] = outPal;
+    MarkPlttBufferDirty(i, 1);
 }
 
 // r, g, b are between 0 and 16
@@ -675,6 +677,7 @@ static void MultiplyPaletteRGBComponents(u16 i, u8 r, u8 g, u8 b)
     outPal |= curGreen << 5;
     outPal |= curBlue << 10;
     gPlttBufferFaded[i] = outPal;
+    MarkPlttBufferDirty(i, 1);
 }
 
 static void PokecenterHealEffect_Init(struct Task *task);
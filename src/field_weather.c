@@ -448,6 +448,7 @@ static void ApplyGammaShift(u8 startPalIndex, u8 numPalettes, s8 gammaIndex)
 
     if (gammaIndex > 0)
     {
+        MarkPlttBufferDirty(startPalIndex * 16, numPalettes * 16);
         gammaIndex--;
         palOffset = startPalIndex * 16;
         numPalettes += startPalIndex;
@@ -520,6 +521,7 @@ static void ApplyGammaShift(u8 startPalIndex, u8 numPalettes, s8 gammaIndex)
     {
         // No palette blending.
         CpuFastCopy(gPlttBufferUnfaded + startPalIndex * 16, gPlttBufferFaded + startPalIndex * 16, numPalettes * 16 * sizeof(u16));
+        MarkPlttBufferDirty(startPalIndex * 16, numPalettes * 16);
     }
 }
 
@@ -533,6 +535,7 @@ static void ApplyGammaShiftWithBlend(u8 startPalIndex, u8 numPalettes, s8 gammaI
     u8 gBlend = color.g;
     u8 bBlend = color.b;
 
+    MarkPlttBufferDirty(startPalIndex * 16, numPalettes * 16);
     palOffset = startPalIndex * 16;
     numPalettes += startPalIndex;
     gammaIndex--;
@@ -590,6 +593,7 @@ static void ApplyDroughtGammaShiftWithBlend(s8 gammaIndex, u8 blendCoeff, u16 bl
     gBlend = color.g;
     bBlend = color.b;
     palOffset = 0;
+    MarkPalettesDirty(PALETTES_ALL);
     for (curPalIndex = 0; curPalIndex < 32; curPalIndex++)
     {
         if (sPaletteGammaTypes[curPalIndex] == GAMMA_NONE)
@@ -632,6 +636,7 @@ static void ApplyFogBlend(u8 blendCoeff, u16 blendColor)
     u16 curPalIndex;
 
     BlendPalette(0, 256, blendCoeff, blendColor);
+    MarkPalettesDirty(PALETTES_OBJECTS);
     color = *(struct RGBColor *)&blendColor;
     rBlend = color.r;
     gBlend = color.g;
@@ -871,6 +876,7 @@ void UpdateSpritePaletteWithWeather(u8 spritePaletteIndex)
             paletteIndex *= 16;
             for (i = 0; i < 16; i++)
                 gPlttBufferFaded[paletteIndex + i] = gWeatherPtr->fadeDestColor;
+            MarkPlttBufferDirty(paletteIndex, 16);
         }
         break;
     case WEATHER_PAL_STATE_SCREEN_FADING_OUT:
@@ -858,6 +858,7 @@ static void ApplyGlobalTintToPaletteEntries(u16 offset, u16 size)
         return;
     }
     CpuCopy16(gPlttBufferUnfaded + offset, gPlttBufferFaded + offset, size * sizeof(u16));
+    MarkPlttBufferDirty(offset, size);
 }
 
 void ApplyGlobalTintToPaletteSlot(u8 slot, u8 count)
@@ -880,6 +881,7 @@ void ApplyGlobalTintToPaletteSlot(u8 slot, u8 count)
         return;
     }
     CpuFastCopy(gPlttBufferUnfaded + slot * 16, gPlttBufferFaded + slot * 16, count * 16 * sizeof(u16));
+    MarkPlttBufferDirty(slot * 16, count * 16);
 }
 
 static void LoadTilesetPalette(struct Tileset const *tileset, u16 destOffset, u16 size)
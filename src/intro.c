@@ -1025,6 +1025,7 @@ static void CB2_SetUpIntro(void)
         DmaFill16(3, 0, VRAM, VRAM_SIZE);
         DmaFill32(3, 0, OAM, OAM_SIZE);
         DmaFill16(3, 0, PLTT, PLTT_SIZE);
+        MarkPalettesDirty(PALETTES_ALL);
         FillPalette(RGB_BLACK, 0, 0x400);
         ResetBgsAndClearDma3BusyFlags(FALSE);
         InitBgsFromTemplates(0, sBgTemplates_GameFreakScene, ARRAY_COUNT(sBgTemplates_GameFreakScene));
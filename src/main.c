@@ -18,6 +18,13 @@
 
 extern u32 intr_main[];
 
+#if MODERN
+// Bounds of the functions placed in IWRAM by the linker script.
+extern u32 __iwram_code_start[];
+extern u32 __iwram_code_end[];
+extern const u32 __iwram_code_load[];
+#endif //MODERN
+
 static void VBlankIntr(void);
 static void HBlankIntr(void);
 static void VCountIntr(void);
@@ -119,10 +126,12 @@ void AgbMain()
         :
         : "r0", "r1", "r2", "r3", "r4", "r5", "memory"
     );
+    CpuCopy32(__iwram_code_load, __iwram_code_start, (u32)__iwram_code_end - (u32)__iwram_code_start);
 #else
     RegisterRamReset(RESET_ALL);
 #endif //MODERN
     *(vu16 *)BG_PLTT = RGB_WHITE;
+    MarkPalettesDirty(PALETTES_BG);
     InitGpuRegManager();
     REG_WAITCNT = WAITCNT_PREFETCH_ENABLE | WAITCNT_WS0_S_1 | WAITCNT_WS0_N_3;
     InitKeys();
@@ -476,6 +476,7 @@ static void Task_ExecuteMainMenuSelection(u8 taskId)
         case MAIN_MENU_CONTINUE:
             gPlttBufferUnfaded[0] = RGB_BLACK;
             gPlttBufferFaded[0] = RGB_BLACK;
+            MarkPlttBufferDirty(0, 1);
             gExitStairsMovementDisabled = FALSE;
             FreeAllWindowBuffers();
             TrySetUpQuestLogScenes_ElseContinueFromSave(taskId);
@@ -1,4 +1,5 @@
 #include "global.h"
+#include "malloc.h"
 
 static void *sHeapStart;
 static u32 sHeapSize;
@@ -45,6 +46,185 @@ void PutFirstMemBlockHeader(void *block, u32 size)
     PutMemBlockHeader(block, (struct MemBlock *)block, (struct MemBlock *)block, size - sizeof(struct MemBlock));
 }
 
+#if MODERN
+// MODERN builds also keep the free blocks in lists by size, so that finding
+// one doesn't mean walking past every block in use. A free block's links are
+// in its data.
+struct FreeLinks {
+    struct MemBlock *prev;
+    struct MemBlock *next;
+};
+
+#define FREE_LINKS(block) ((struct FreeLinks *)(block)->data)
+
+// Blocks smaller than 256 bytes are in classes 16 bytes apart, and larger
+// ones in classes a power of 2 apart, with the last class taking the rest.
+#define NUM_SMALL_SIZE_CLASSES 16
+#define SMALL_SIZE_CLASS_SHIFT 4
+#define NUM_SIZE_CLASSES 32
+
+static EWRAM_DATA struct MemBlock *sFreeLists[NUM_SIZE_CLASSES] = {0};
+// A bit for each size class whose list isn't empty.
+static EWRAM_DATA u32 sNonEmptySizeClasses = 0;
+
+static u32 GetSizeClass(u32 size)
+{
+    u32 sizeClass = NUM_SMALL_SIZE_CLASSES;
+
+    if (size < (NUM_SMALL_SIZE_CLASSES << SMALL_SIZE_CLASS_SHIFT))
+        return size >> SMALL_SIZE_CLASS_SHIFT;
+
+    while (size >= (2 * NUM_SMALL_SIZE_CLASSES << SMALL_SIZE_CLASS_SHIFT) && sizeClass < NUM_SIZE_CLASSES - 1)
+    {
+        size >>= 1;
+        sizeClass++;
+    }
+
+    return sizeClass;
+}
+
+static void AddFreeBlock(struct MemBlock *block)
+{
+    u32 sizeClass = GetSizeClass(block->size);
+
+    FREE_LINKS(block)->prev = NULL;
+    FREE_LINKS(block)->next = sFreeLists[sizeClass];
+    if (sFreeLists[sizeClass] != NULL)
+        FREE_LINKS(sFreeLists[sizeClass])->prev = block;
+    sFreeLists[sizeClass] = block;
+    sNonEmptySizeClasses |= 1u << sizeClass;
+}
+
+static void RemoveFreeBlock(struct MemBlock *block)
+{
+    struct FreeLinks *links = FREE_LINKS(block);
+
+    if (links->next != NULL)
+        FREE_LINKS(links->next)->prev = links->prev;
+
+    if (links->prev != NULL)
+    {
+        FREE_LINKS(links->prev)->next = links->next;
+    }
+    else
+    {
+        u32 sizeClass = GetSizeClass(block->size);
+
+        sFreeLists[sizeClass] = links->next;
+        if (links->next == NULL)
+            sNonEmptySizeClasses &= ~(1u << sizeClass);
+    }
+}
+
+static struct MemBlock *FindFreeBlock(u32 size)
+{
+    u32 sizeClass = GetSizeClass(size);
+    u32 largerClasses = sNonEmptySizeClasses & ~((2u << sizeClass) - 1);
+    struct MemBlock *block = sFreeLists[sizeClass];
+
+    // The first block in the request's own class may be big enough.
+    if (block != NULL && block->size >= size)
+        return block;
+
+    // Any block in a larger class is.
+    if (largerClasses != 0)
+    {
+        sizeClass++;
+        while (!((largerClasses >> sizeClass) & 1))
+            sizeClass++;
+        return sFreeLists[sizeClass];
+    }
+
+    // Otherwise look through the rest of the request's class.
+    for (; block != NULL; block = FREE_LINKS(block)->next)
+    {
+        if (block->size >= size)
+            return block;
+    }
+
+    return NULL;
+}
+
+void *AllocInternal(void *heapStart, u32 size)
+{
+    head = (struct MemBlock *)heapStart;
+
+    // Alignment, and room for the links when the block is freed.
+    if (size & 3)
+        size = 4 * ((size / 4) + 1);
+    if (size < sizeof(struct FreeLinks))
+        size = sizeof(struct FreeLinks);
+
+    pos = FindFreeBlock(size);
+    if (pos == NULL)
+    {
+        AGB_ASSERT_EX(0, ABSPATH("gflib/malloc.c"), 174);
+        return NULL;
+    }
+
+    RemoveFreeBlock(pos);
+    pos->flag = TRUE;
+
+    // If the block is significantly bigger than the requested size, split
+    // the rest into a separate block.
+    if (pos->size - size >= 2 * sizeof(struct MemBlock))
+    {
+        splitBlock = (struct MemBlock *)(pos->data + size);
+
+        PutMemBlockHeader(splitBlock, pos, pos->next, pos->size - size - sizeof(struct MemBlock));
+
+        pos->size = size;
+        pos->next = splitBlock;
+
+        if (splitBlock->next != head)
+            splitBlock->next->prev = splitBlock;
+        AddFreeBlock(splitBlock);
+    }
+
+    return pos->data;
+}
+
+void FreeInternal(void *heapStart, void *p)
+{
+    AGB_ASSERT_EX(p != NULL, ABSPATH("gflib/malloc.c"), 195);
+
+    if (p) {
+        struct MemBlock *head = (struct MemBlock *)heapStart;
+        struct MemBlock *pos = (struct MemBlock *)((u8 *)p - sizeof(struct MemBlock));
+        AGB_ASSERT_EX(pos->magic_number == MALLOC_SYSTEM_ID, ABSPATH("gflib/malloc.c"), 204);
+        AGB_ASSERT_EX(pos->flag == TRUE, ABSPATH("gflib/malloc.c"), 205);
+        pos->flag = FALSE;
+
+        // Merge with the next block if it's not in use.
+        if (pos->next != head && !pos->next->flag) {
+            AGB_ASSERT_EX(pos->next->magic_number == MALLOC_SYSTEM_ID, ABSPATH("gflib/malloc.c"), 211);
+            RemoveFreeBlock(pos->next);
+            pos->size += sizeof(struct MemBlock) + pos->next->size;
+            pos->next->magic_number = 0;
+            pos->next = pos->next->next;
+            if (pos->next != head)
+                pos->next->prev = pos;
+        }
+
+        // Merge with the previous block if it's not in use.
+        if (pos != head && !pos->prev->flag) {
+            struct MemBlock *prev = pos->prev;
+            AGB_ASSERT_EX(prev->magic_number == MALLOC_SYSTEM_ID, ABSPATH("gflib/malloc.c"), 228);
+            RemoveFreeBlock(prev);
+            prev->next = pos->next;
+
+            if (pos->next != head)
+                pos->next->prev = prev;
+
+            pos->magic_number = 0;
+            prev->size += sizeof(struct MemBlock) + pos->size;
+            pos = prev;
+        }
+
+        AddFreeBlock(pos);
+    }
+}
+#else
 void *AllocInternal(void *heapStart, u32 size)
 {
     u32 foundBlockSize;
@@ -142,6 +322,7 @@ void FreeInternal(void *heapStart, void *p)
         }
     }
 }
+#endif // MODERN
 
 void *AllocZeroedInternal(void *heapStart, u32 size)
 {
@@ -188,6 +369,11 @@ void InitHeap(void *heapStart, u32 heapSize)
     sHeapStart = heapStart;
     sHeapSize = heapSize;
     PutFirstMemBlockHeader(heapStart, heapSize);
+#if MODERN
+    memset(sFreeLists, 0, sizeof(sFreeLists));
+    sNonEmptySizeClasses = 0;
+    AddFreeBlock(heapStart);
+#endif // MODERN
 }
 
 void *Alloc(u32 size)
@@ -205,6 +391,78 @@ void Free(void *pointer)
     FreeInternal(sHeapStart, pointer);
 }
 
+#if MODERN
+// Each allocation that didn't fit in an arena's block starts with a link to
+// the one before it.
+struct ArenaOverflow {
+    struct ArenaOverflow *prev;
+    u8 data[0];
+};
+
+void BeginHeapArena(struct HeapArena *arena, u32 size)
+{
+    arena->start = Alloc(size);
+    arena->pos = arena->start;
+    arena->end = arena->start != NULL ? arena->start + size : NULL;
+    arena->overflow = NULL;
+}
+
+void *ArenaAlloc(struct HeapArena *arena, u32 size)
+{
+    struct ArenaOverflow *overflow;
+
+    if (size & 3)
+        size = 4 * ((size / 4) + 1);
+
+    if (size <= arena->end - arena->pos) {
+        void *mem = arena->pos;
+        arena->pos += size;
+        return mem;
+    }
+
+    overflow = Alloc(sizeof(struct ArenaOverflow) + size);
+    if (overflow == NULL)
+        return NULL;
+
+    overflow->prev = arena->overflow;
+    arena->overflow = overflow;
+    return overflow->data;
+}
+
+void *ArenaAllocZeroed(struct HeapArena *arena, u32 size)
+{
+    void *mem = ArenaAlloc(arena, size);
+
+    if (mem != NULL) {
+        if (size & 3)
+            size = 4 * ((size / 4) + 1);
+
+        CpuFill32(0, mem, size);
+    }
+
+    return mem;
+}
+
+void EndHeapArena(struct HeapArena *arena)
+{
+    struct ArenaOverflow *overflow = arena->overflow;
+
+    while (overflow != NULL) {
+        struct ArenaOverflow *prev = overflow->prev;
+        Free(overflow);
+        overflow = prev;
+    }
+
+    if (arena->start != NULL)
+        Free(arena->start);
+
+    arena->start = NULL;
+    arena->pos = NULL;
+    arena->end = NULL;
+    arena->overflow = NULL;
+}
+#endif // MODERN
+
 bool32 CheckMemBlock(void *pointer)
 {
     return CheckMemBlockInternal(sHeapStart, pointer);
@@ -213,12 +471,49 @@ bool32 CheckMemBlock(void *pointer)
 bool32 CheckHeap()
 {
     struct MemBlock *pos = (struct MemBlock *)sHeapStart;
+#if MODERN
+    u32 numFreeBlocks = 0;
+    u32 sizeClass;
+#endif // MODERN
 
     do {
         if (!CheckMemBlockInternal(sHeapStart, pos->data))
             return FALSE;
+#if MODERN
+        // Free blocks are always merged with the ones next to them, and the
+        // last block ends at the end of the heap.
+        if (!pos->flag) {
+            if (pos->next != sHeapStart && !pos->next->flag)
+                return FALSE;
+            numFreeBlocks++;
+        }
+        if (pos->next == sHeapStart && pos->data + pos->size != (u8 *)sHeapStart + sHeapSize)
+            return FALSE;
+#endif // MODERN
         pos = pos->next;
     } while (pos != (struct MemBlock *)sHeapStart);
 
+#if MODERN
+    // Each free block is in the list for its size, and nothing else is.
+    for (sizeClass = 0; sizeClass < NUM_SIZE_CLASSES; sizeClass++) {
+        struct MemBlock *prev = NULL;
+
+        if ((sFreeLists[sizeClass] != NULL) != ((sNonEmptySizeClasses >> sizeClass) & 1))
+            return FALSE;
+
+        for (pos = sFreeLists[sizeClass]; pos != NULL; pos = FREE_LINKS(pos)->next) {
+            if (pos->magic_number != MALLOC_SYSTEM_ID || pos->flag || GetSizeClass(pos->size) != sizeClass)
+                return FALSE;
+            if (FREE_LINKS(pos)->prev != prev || numFreeBlocks == 0)
+                return FALSE;
+            numFreeBlocks--;
+            prev = pos;
+        }
+    }
+
+    if (numFreeBlocks != 0)
+        return FALSE;
+#endif // MODERN
+
     return TRUE;
 }
@@ -514,6 +514,7 @@ static void NamingScreen_InitBGs(void)
     DmaClearLarge16(3, (void *)VRAM, VRAM_SIZE, 0x1000);
     DmaClear32(3, (void *)OAM, OAM_SIZE);
     DmaClear16(3, (void *)PLTT, PLTT_SIZE);
+    MarkPalettesDirty(PALETTES_ALL);
 
     SetGpuReg(REG_OFFSET_DISPCNT, DISPCNT_MODE_0);
     ResetBgsAndClearDma3BusyFlags(FALSE);
@@ -991,6 +992,7 @@ static void RestoreButtonColor(u8 button)
 {
     u16 index = GetButtonPalOffset(button);
     gPlttBufferFaded[index] = gPlttBufferUnfaded[index];
+    MarkPlttBufferDirty(index, 1);
 }
 
 static void StartButtonFlash(struct Task *task, u8 button, u8 keepFlashing)
@@ -687,6 +687,7 @@ void StartNewGameScene(void)
 {
     gPlttBufferUnfaded[0] = RGB_BLACK;
     gPlttBufferFaded[0]   = RGB_BLACK;
+    MarkPlttBufferDirty(0, 1);
     CreateTask(Task_NewGameScene, 0);
     SetMainCallback2(CB2_NewGameScene);
 }
@@ -290,6 +290,7 @@ static void InitOptionMenuBg(void)
     DmaClearLarge16(3, dest, VRAM_SIZE, 0x1000);    
     DmaClear32(3, (void *)OAM, OAM_SIZE);
     DmaClear16(3, (void *)PLTT, PLTT_SIZE);    
+    MarkPalettesDirty(PALETTES_ALL);
     SetGpuReg(REG_OFFSET_DISPCNT, DISPCNT_MODE_0);
     ResetBgsAndClearDma3BusyFlags(0);
     InitBgsFromTemplates(0, sOptionMenuBgTemplates, NELEMS(sOptionMenuBgTemplates));
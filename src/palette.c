@@ -53,12 +53,18 @@ static u8 UpdateHardwarePaletteFade(void);
 static void UpdateBlendRegisters(void);
 static bool8 IsSoftwarePaletteFadeFinishing(void);
 static void Task_BlendPalettesGradually(u8 taskId);
+#if MODERN
+static void BlendPaletteRuns(u32 selectedPalettes, u16 paletteOffset, u8 coeff, u16 color);
+#endif // MODERN
 
 ALIGNED(4) EWRAM_DATA u16 gPlttBufferUnfaded[PLTT_BUFFER_SIZE] = {0};
 ALIGNED(4) EWRAM_DATA u16 gPlttBufferFaded[PLTT_BUFFER_SIZE] = {0};
 static EWRAM_DATA struct PaletteStruct sPaletteStructs[NUM_PALETTE_STRUCTS] = {0};
 EWRAM_DATA struct PaletteFadeControl gPaletteFade = {0};
 static EWRAM_DATA u32 sPlttBufferTransferPending = 0;
+#if MODERN
+EWRAM_DATA u32 gPlttBufferDirty = 0;
+#endif // MODERN
 EWRAM_DATA u8 gPaletteDecompressionBuffer[PLTT_DECOMP_BUFFER_SIZE] = {0};
 
 static const struct PaletteStructTemplate sDummyPaletteStructTemplate =
@@ -83,20 +89,71 @@ void LoadCompressedPalette(const u32 *src, u16 offset, u16 size)
     LZDecompressWram(src, gPaletteDecompressionBuffer);
     CpuCopy16(gPaletteDecompressionBuffer, &gPlttBufferUnfaded[offset], size);
     CpuCopy16(gPaletteDecompressionBuffer, &gPlttBufferFaded[offset], size);
+    MarkPlttBufferDirty(offset, size / 2);
 }
 
 void LoadPalette(const void *src, u16 offset, u16 size)
 {
     CpuCopy16(src, &gPlttBufferUnfaded[offset], size);
     CpuCopy16(src, &gPlttBufferFaded[offset], size);
+    MarkPlttBufferDirty(offset, size / 2);
 }
 
 void FillPalette(u16 value, u16 offset, u16 size)
 {
     CpuFill16(value, &gPlttBufferUnfaded[offset], size);
     CpuFill16(value, &gPlttBufferFaded[offset], size);
+    MarkPlttBufferDirty(offset, size / 2);
 }
 
+#if MODERN
+void MarkPlttBufferDirty(u16 offset, u16 count)
+{
+    u32 first, last;
+
+    if (count == 0)
+        return;
+
+    first = offset / 16;
+    last = (offset + count - 1) / 16;
+    if (last > 31)
+        last = 31;
+    if (first > last)
+        return;
+
+    gPlttBufferDirty |= (0xFFFFFFFF >> (31 - last)) & (0xFFFFFFFF << first);
+}
+
+// Copies each run of consecutive changed palettes with one DMA, instead of
+// the whole buffer every frame.
+void TransferPlttBuffer(void)
+{
+    if (!gPaletteFade.bufferTransferDisabled)
+    {
+        u32 dirty = gPlttBufferDirty;
+        u32 start = 0;
+
+        while (dirty != 0)
+        {
+            u32 count;
+
+            while (!(dirty & 1))
+            {
+                dirty >>= 1;
+                start++;
+            }
+            for (count = 0; dirty & 1; count++)
+                dirty >>= 1;
+            DmaCopy16(3, &gPlttBufferFaded[start * 16], (void *)(PLTT + start * 32), count * 32);
+            start += count;
+        }
+        gPlttBufferDirty = 0;
+        sPlttBufferTransferPending = FALSE;
+        if (gPaletteFade.mode == HARDWARE_FADE && gPaletteFade.active)
+            UpdateBlendRegisters();
+    }
+}
+#else
 void TransferPlttBuffer(void)
 {
     if (!gPaletteFade.bufferTransferDisabled)
@@ -109,6 +166,7 @@ void TransferPlttBuffer(void)
             UpdateBlendRegisters();
     }
 }
+#endif // MODERN
 
 u8 UpdatePaletteFade(void)
 {
@@ -134,6 +192,7 @@ void ResetPaletteFade(void)
     for (i = 0; i < NUM_PALETTE_STRUCTS; ++i)
         PaletteStruct_Reset(i);
     ResetPaletteFadeControl();
+    MarkPalettesDirty(PALETTES_ALL);
 }
 
 void ReadPlttIntoBuffers(void)
@@ -181,6 +240,9 @@ bool8 BeginNormalPaletteFade(u32 selectedPalettes, s8 delay, u8 startY, u8 targe
         temp = gPaletteFade.bufferTransferDisabled;
         gPaletteFade.bufferTransferDisabled = FALSE;
         CpuCopy32(gPlttBufferFaded, (void *)PLTT, PLTT_SIZE);
+#if MODERN
+        gPlttBufferDirty = 0;
+#endif // MODERN
         sPlttBufferTransferPending = FALSE;
         if (gPaletteFade.mode == HARDWARE_FADE && gPaletteFade.active)
             UpdateBlendRegisters();
@@ -268,6 +330,7 @@ static void PaletteStruct_Copy(struct PaletteStruct *palStruct, u32 *unkFlags)
         palStruct->srcIndex = 0;
     }
     *unkFlags |= 1 << (palStruct->baseDestOffset >> 4);
+    MarkPlttBufferDirty(palStruct->baseDestOffset, palStruct->template->size);
 }
 
 static void PaletteStruct_Blend(struct PaletteStruct *palStruct, u32 *unkFlags)
@@ -293,6 +356,7 @@ static void PaletteStruct_Blend(struct PaletteStruct *palStruct, u32 *unkFlags)
 
                     for (i = 0; i < palStruct->template->size; i++)
                         gPlttBufferFaded[palStruct->baseDestOffset + i] = palStruct->template->src[srcOffset + i];
+                    MarkPlttBufferDirty(palStruct->baseDestOffset, palStruct->template->size);
                 }
             }
         }
@@ -422,6 +486,9 @@ static u8 UpdateNormalPaletteFade(void)
             selectedPalettes = gPaletteFade_selectedPalettes >> 16;
             paletteOffset = 256;
         }
+#if MODERN
+        BlendPaletteRuns(selectedPalettes, paletteOffset, gPaletteFade.y, gPaletteFade.blendColor);
+#else
         while (selectedPalettes)
         {
             if (selectedPalettes & 1)
@@ -432,6 +499,7 @@ static u8 UpdateNormalPaletteFade(void)
             selectedPalettes >>= 1;
             paletteOffset += 16;
         }
+#endif // MODERN
         gPaletteFade.objPaletteToggle ^= 1;
         if (!gPaletteFade.objPaletteToggle)
         {
@@ -472,6 +540,8 @@ void InvertPlttBuffer(u32 selectedPalettes)
 {
     u16 paletteOffset = 0;
 
+    MarkPalettesDirty(selectedPalettes);
+
     while (selectedPalettes)
     {
         if (selectedPalettes & 1)
@@ -490,6 +560,8 @@ void TintPlttBuffer(u32 selectedPalettes, s8 r, s8 g, s8 b)
 {
     u16 paletteOffset = 0;
 
+    MarkPalettesDirty(selectedPalettes);
+
     while (selectedPalettes)
     {
         if (selectedPalettes & 1)
@@ -514,6 +586,8 @@ void UnfadePlttBuffer(u32 selectedPalettes)
 {
     u16 paletteOffset = 0;
 
+    MarkPalettesDirty(selectedPalettes);
+
     while (selectedPalettes)
     {
         if (selectedPalettes & 1)
@@ -544,6 +618,7 @@ static void BeginFastPaletteFadeInternal(u8 submode)
         CpuFill16(RGB_BLACK, gPlttBufferFaded, PLTT_SIZE);
     if (submode == FAST_FADE_IN_FROM_WHITE)
         CpuFill16(RGB_WHITE, gPlttBufferFaded, PLTT_SIZE);
+    MarkPalettesDirty(PALETTES_ALL);
     UpdatePaletteFade();
 }
 
@@ -649,6 +724,7 @@ static u8 UpdateFastPaletteFade(void)
             gPlttBufferFaded[i] = r | (g << 5) | (b << 10);
         }
     }
+    MarkPalettesDirty(paletteOffsetStart == 0 ? PALETTES_BG : PALETTES_OBJECTS);
     gPaletteFade.objPaletteToggle ^= 1;
     if (gPaletteFade.objPaletteToggle)
         // gPaletteFade.active cannot change since the last time it was checked. So this
@@ -673,6 +749,7 @@ static u8 UpdateFastPaletteFade(void)
             CpuFill32(0x00000000, gPlttBufferFaded, PLTT_SIZE);
             break;
         }
+        MarkPalettesDirty(PALETTES_ALL);
         gPaletteFade.mode = NORMAL_FADE;
         gPaletteFade.softwareFadeFinishing = TRUE;
     }
@@ -776,6 +853,32 @@ static bool8 IsSoftwarePaletteFadeFinishing(void)
     }
 }
 
+#if MODERN
+void BlendPalettes(u32 selectedPalettes, u8 coeff, u16 color)
+{
+    BlendPaletteRuns(selectedPalettes, 0, coeff, color);
+}
+
+// Blends each run of consecutive selected palettes with one call, which does
+// the same as blending them one at a time.
+static void BlendPaletteRuns(u32 selectedPalettes, u16 paletteOffset, u8 coeff, u16 color)
+{
+    while (selectedPalettes != 0)
+    {
+        u16 numEntries;
+
+        while (!(selectedPalettes & 1))
+        {
+            selectedPalettes >>= 1;
+            paletteOffset += 16;
+        }
+        for (numEntries = 0; selectedPalettes & 1; numEntries += 16)
+            selectedPalettes >>= 1;
+        BlendPalette(paletteOffset, numEntries, coeff, color);
+        paletteOffset += numEntries;
+    }
+}
+#else
 void BlendPalettes(u32 selectedPalettes, u8 coeff, u16 color)
 {
     u16 paletteOffset;
@@ -787,11 +890,13 @@ void BlendPalettes(u32 selectedPalettes, u8 coeff, u16 color)
         selectedPalettes >>= 1;
     }
 }
+#endif // MODERN
 
 void BlendPalettesUnfaded(u32 selectedPalettes, u8 coeff, u16 color)
 {
     // This copy is done via DMA in both RUBY and EMERALD
     CpuFastCopy(gPlttBufferUnfaded, gPlttBufferFaded, 0x400);
+    MarkPalettesDirty(PALETTES_ALL);
     BlendPalettes(selectedPalettes, coeff, color);
 }
 
@@ -95,6 +95,7 @@ static u8 RouletteFlash_FadePalette(struct RouletteFlashPalette *pal)
             break;
         }
     }
+    MarkPlttBufferDirty(pal->settings.paletteOffset, pal->settings.numColors);
     if ((u32)pal->fadeCycleCounter++ != pal->settings.numFadeCycles)
     {
         returnval = 0;
@@ -122,12 +123,14 @@ static u8 RouletteFlash_FlashPalette(struct RouletteFlashPalette *pal)
         // Flash to color
         for (i = 0; i < pal->settings.numColors; i++)
             gPlttBufferFaded[pal->settings.paletteOffset + i] = pal->settings.color;
+        MarkPlttBufferDirty(pal->settings.paletteOffset, pal->settings.numColors);
         pal->state++;
         break;
     case 2:
         // Restore to original color
         for (i = 0; i < pal->settings.numColors; i++)
             gPlttBufferFaded[pal->settings.paletteOffset + i] = gPlttBufferUnfaded[pal->settings.paletteOffset + i];
+        MarkPlttBufferDirty(pal->settings.paletteOffset, pal->settings.numColors);
         pal->state--;
         break;
     }
@@ -192,6 +195,7 @@ void RouletteFlash_Stop(struct RouletteFlashUtil *flash, u16 flags)
                     u16 *faded = &gPlttBufferFaded[offset];
                     u16 *unfaded = &gPlttBufferUnfaded[offset];
                     memcpy(faded, unfaded, flash->palettes[i].settings.numColors * 2);
+                    MarkPlttBufferDirty(offset, flash->palettes[i].settings.numColors);
                     flash->palettes[i].state = 0;
                     flash->palettes[i].fadeCycleCounter = 0;
                     flash->palettes[i].delayCounter = 0;
@@ -266,6 +270,7 @@ static void ClearPulseBlendPalettesSettings(struct PulseBlendPalette *pulseBlend
     {
         for (i = pulseBlendPalette->pulseBlendSettings.paletteOffset; i < pulseBlendPalette->pulseBlendSettings.paletteOffset + pulseBlendPalette->pulseBlendSettings.numColors; i++)
             gPlttBufferFaded[i] = gPlttBufferUnfaded[i];
+        MarkPlttBufferDirty(pulseBlendPalette->pulseBlendSettings.paletteOffset, pulseBlendPalette->pulseBlendSettings.numColors);
     }
 
     memset(&pulseBlendPalette->pulseBlendSettings, 0, sizeof(pulseBlendPalette->pulseBlendSettings));
@@ -340,6 +345,7 @@ void UnmarkUsedPulseBlendPalettes(struct PulseBlend *pulseBlend, u16 pulseBlendP
             {
                 for (i = pulseBlendPalette->pulseBlendSettings.paletteOffset; i < pulseBlendPalette->pulseBlendSettings.paletteOffset + pulseBlendPalette->pulseBlendSettings.numColors; i++)
                     gPlttBufferFaded[i] = gPlttBufferUnfaded[i];
+                MarkPlttBufferDirty(pulseBlendPalette->pulseBlendSettings.paletteOffset, pulseBlendPalette->pulseBlendSettings.numColors);
             }
 
             pulseBlendPalette->available = 1;
@@ -361,6 +367,7 @@ void UnmarkUsedPulseBlendPalettes(struct PulseBlend *pulseBlend, u16 pulseBlendP
                 {
                     for (i = pulseBlendPalette->pulseBlendSettings.paletteOffset; i < pulseBlendPalette->pulseBlendSettings.paletteOffset + pulseBlendPalette->pulseBlendSettings.numColors; i++)
                         gPlttBufferFaded[i] = gPlttBufferUnfaded[i];
+                    MarkPlttBufferDirty(pulseBlendPalette->pulseBlendSettings.paletteOffset, pulseBlendPalette->pulseBlendSettings.numColors);
                 }
 
                 pulseBlendPalette->available = 1;
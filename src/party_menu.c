@@ -705,6 +705,7 @@ static void PartyPaletteBufferCopy(u8 offset)
     offset *= 16;
     CpuCopy16(&gPlttBufferUnfaded[0x30], &gPlttBufferUnfaded[offset], 32);
     CpuCopy16(&gPlttBufferUnfaded[0x30], &gPlttBufferFaded[offset], 32);
+    MarkPlttBufferDirty(offset, 16);
 }
 
 static void FreePartyPointers(void)
@@ -118,6 +118,7 @@ static void Task_PCScreenEffect_TurnOff(u8 taskId)
     {
     case 0:
         gPlttBufferFaded[0] = 0;
+        MarkPlttBufferDirty(0, 1);
         break;
     case 1:
         task->tWin0Left = 0;
@@ -92,6 +92,16 @@ struct PokedexCategoryPage
 };
 
 EWRAM_DATA static struct PokedexScreenData * sPokedexScreenData = NULL;
+#if MODERN
+// The buffers made when the Pokedex opens all last until it closes, so they
+// come from one arena.
+EWRAM_DATA static struct HeapArena sDexScreenArena = {0};
+
+#define DEX_SCREEN_ARENA_SIZE (4 * BG_SCREEN_SIZE + sizeof(struct PokedexScreenData) + NATIONAL_DEX_COUNT * sizeof(struct ListMenuItem))
+#define DexScreen_Alloc(size) ArenaAlloc(&sDexScreenArena, size)
+#else
+#define DexScreen_Alloc(size) Alloc(size)
+#endif // MODERN
 
 static void Task_PokedexScreen(u8 taskId);
 static void DexScreen_InitGfxForTopMenu(void);
@@ -889,10 +899,13 @@ void DexScreen_LoadResources(void)
     ScanlineEffect_Stop();
     ResetBgsAndClearDma3BusyFlags(TRUE);
     InitBgsFromTemplates(0, sBgTemplates, NELEMS(sBgTemplates));
-    SetBgTilemapBuffer(3, (u16 *)Alloc(BG_SCREEN_SIZE));
-    SetBgTilemapBuffer(2, (u16 *)Alloc(BG_SCREEN_SIZE));
-    SetBgTilemapBuffer(1, (u16 *)Alloc(BG_SCREEN_SIZE));
-    SetBgTilemapBuffer(0, (u16 *)Alloc(BG_SCREEN_SIZE));
+#if MODERN
+    BeginHeapArena(&sDexScreenArena, DEX_SCREEN_ARENA_SIZE);
+#endif // MODERN
+    SetBgTilemapBuffer(3, (u16 *)DexScreen_Alloc(BG_SCREEN_SIZE));
+    SetBgTilemapBuffer(2, (u16 *)DexScreen_Alloc(BG_SCREEN_SIZE));
+    SetBgTilemapBuffer(1, (u16 *)DexScreen_Alloc(BG_SCREEN_SIZE));
+    SetBgTilemapBuffer(0, (u16 *)DexScreen_Alloc(BG_SCREEN_SIZE));
     if (natDex)
         DecompressAndLoadBgGfxUsingHeap(3, (void *)sNatDexTiles, BG_SCREEN_SIZE, 0, 0);
     else
@@ -903,10 +916,10 @@ void DexScreen_LoadResources(void)
     SetVBlankCallback(VBlankCB);
     EnableInterrupts(INTR_FLAG_VBLANK);
     taskId = CreateTask(Task_PokedexScreen, 0);
-    sPokedexScreenData = Alloc(sizeof(struct PokedexScreenData));
+    sPokedexScreenData = DexScreen_Alloc(sizeof(struct PokedexScreenData));
     *sPokedexScreenData = sDexScreenDataInitialState;
     sPokedexScreenData->taskId = taskId;
-    sPokedexScreenData->listItems = Alloc(NATIONAL_DEX_COUNT * sizeof(struct ListMenuItem));
+    sPokedexScreenData->listItems = DexScreen_Alloc(NATIONAL_DEX_COUNT * sizeof(struct ListMenuItem));
     sPokedexScreenData->numSeenNational = DexScreen_GetDexCount(FLAG_GET_SEEN, 1);
     sPokedexScreenData->numOwnedNational = DexScreen_GetDexCount(FLAG_GET_CAUGHT, 1);
     sPokedexScreenData->numSeenKanto = DexScreen_GetDexCount(FLAG_GET_SEEN, 0);
@@ -961,6 +974,10 @@ bool8 DoClosePokedex(void)
             UpdatePaletteFade();
         return FALSE;
     case 2:
+#if MODERN
+        FreeAllWindowBuffers();
+        EndHeapArena(&sDexScreenArena);
+#else
         FREE_IF_NOT_NULL(sPokedexScreenData->listItems);
         FREE_IF_NOT_NULL(sPokedexScreenData);
         FreeAllWindowBuffers();
@@ -968,6 +985,7 @@ bool8 DoClosePokedex(void)
         FREE_IF_NOT_NULL(GetBgTilemapBuffer(1));
         FREE_IF_NOT_NULL(GetBgTilemapBuffer(2));
         FREE_IF_NOT_NULL(GetBgTilemapBuffer(3));
+#endif // MODERN
         BGMVolumeMax_EnableHelpSystemReduction();
         break;
     }
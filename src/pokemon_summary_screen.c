@@ -2355,6 +2355,7 @@ static void PokeSum_Setup_InitGpu(void)
     DmaClearLarge16(3, (void *)VRAM, VRAM_SIZE, 0x1000);
     DmaClear32(3, (void *)OAM, OAM_SIZE);
     DmaClear16(3, (void *)PLTT, PLTT_SIZE);
+    MarkPalettesDirty(PALETTES_ALL);
 
     SetGpuReg(REG_OFFSET_DISPCNT, 0);
 
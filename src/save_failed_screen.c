@@ -55,6 +55,7 @@ bool32 RunSaveFailedScreen(void)
     case 2:
         RequestDma3Fill(0, (void *)BG_CHAR_ADDR(3), BG_CHAR_SIZE, DMA3_16BIT);
         RequestDma3Copy(sSaveFailedScreenPals, (void *)PLTT, 0x20, DMA3_16BIT);
+        MarkPalettesDirty(PALETTES_ALL);
         sSaveFailedScreenState = 3;
         break;
     case 3:
@@ -114,6 +115,7 @@ static void BlankPalettes(void)
         *((u16 *)(BG_PLTT + i)) = RGB_BLACK;
         *((u16 *)(OBJ_PLTT + i)) = RGB_BLACK;
     }
+    MarkPalettesDirty(PALETTES_ALL);
 }
 
 static void RequestDmaCopyFromScreenBuffer(void)
@@ -2428,6 +2428,7 @@ static void Task_FlashWinningLine(u8 taskId)
 
         for (i = 0; i < ARRAY_COUNT(sWinningLineFlashPalIdxs); i++)
             gPlttBufferFaded[sWinningLineFlashPalIdxs[i] + PALSLOT_LINE_MATCH * 16] = gPlttBufferUnfaded[sWinningLineFlashPalIdxs[i] + PALSLOT_LINE_MATCH * 16];
+        MarkPalettesDirty(1 << PALSLOT_LINE_MATCH);
         break;
     case 2:
         // Restore match lines to normal color 
@@ -14,6 +14,9 @@
     (sSpriteTileRanges + 1)[index * 2] = count;    \
 }
 
+// MODERN builds keep the tile bitmap in words, which puts each tile's bit in
+// the same place in memory, and work on whole runs of tiles at once instead.
+#if !MODERN
 #define ALLOC_SPRITE_TILE(n)                              \
 {                                                         \
     gSpriteTileAllocBitmap[(n) >> 3] |= (1 << ((n) & 7)); \
@@ -25,6 +28,7 @@
 }
 
 #define SPRITE_TILE_IS_ALLOCATED(n) ((gSpriteTileAllocBitmap[(n) >> 3] >> ((n) & 7)) & 1)
+#endif // !MODERN
 
 
 struct SpriteCopyRequest
@@ -49,6 +53,9 @@ static u8 CreateSpriteAt(u8 index, const struct SpriteTemplate *template, s16 x,
 static void ResetOamMatrices(void);
 static void ResetSprite(struct Sprite *sprite);
 s16 AllocSpriteTiles(u16 tileCount);
+#if MODERN
+static void SetSpriteTilesAllocated(u32 start, u32 end, bool32 allocated);
+#endif // MODERN
 static void RequestSpriteFrameImageCopy(u16 index, u16 tileNum, const struct SpriteFrameImage *images);
 static void ResetAllSprites(void);
 static void BeginAnim(struct Sprite *sprite);
@@ -281,12 +288,79 @@ EWRAM_DATA u8 gSpriteCopyRequestCount = 0;
 EWRAM_DATA struct SpriteCopyRequest gSpriteCopyRequests[MAX_SPRITES] = {0};
 EWRAM_DATA u8 gOamLimit = 0;
 EWRAM_DATA u16 gReservedSpriteTileCount = 0;
+#if MODERN
+EWRAM_DATA u32 gSpriteTileAllocBitmap[TOTAL_OBJ_TILE_COUNT / 32] = {0};
+#else
 EWRAM_DATA u8 gSpriteTileAllocBitmap[128] = {0};
+#endif // MODERN
 EWRAM_DATA s16 gSpriteCoordOffsetX = 0;
 EWRAM_DATA s16 gSpriteCoordOffsetY = 0;
 EWRAM_DATA struct OamMatrix gOamMatrices[OAM_MATRIX_COUNT] = {0};
 EWRAM_DATA bool8 gAffineAnimsDisabled = 0;
 
+#if MODERN
+// A bit for each slot that may hold a sprite in use, so that the per-frame
+// passes skip the empty ones. A slot's bit is set when a sprite is created in
+// it and cleared when it's reset, or when AnimateSprites finds that it's no
+// longer in use.
+static u32 sActiveSprites[MAX_SPRITES / 32];
+static u8 sNumActiveSprites;
+
+static void ActivateSprite(u32 spriteId)
+{
+    if (!(sActiveSprites[spriteId / 32] & (1u << (spriteId % 32))))
+    {
+        sActiveSprites[spriteId / 32] |= 1u << (spriteId % 32);
+        sNumActiveSprites++;
+    }
+}
+
+// Slots outside the set are still sorted, by the priority they had when they
+// left it, which is the one BuildSpritePriorities would keep computing.
+static void DeactivateSprite(u32 spriteId)
+{
+    struct Sprite *sprite = &gSprites[spriteId];
+
+    if (sActiveSprites[spriteId / 32] & (1u << (spriteId % 32)))
+    {
+        sActiveSprites[spriteId / 32] &= ~(1u << (spriteId % 32));
+        sNumActiveSprites--;
+    }
+    gSpritePriorities[spriteId] = sprite->subpriority | (sprite->oam.priority << 8);
+}
+
+static bool32 IsSpriteActive(u32 spriteId)
+{
+    return (sActiveSprites[spriteId / 32] >> (spriteId % 32)) & 1;
+}
+
+// With most slots in use, as in battles, checking every slot is faster than
+// walking the set.
+static bool32 AreMostSpritesActive(void)
+{
+    return sNumActiveSprites > MAX_SPRITES / 2;
+}
+
+static const u8 sLowestBitIndices[32] =
+{
+     0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+    31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9,
+};
+
+// Finds the lowest set bit of a nonzero value with a de Bruijn sequence,
+// since the ARM7 has no instruction for it.
+static inline u32 GetLowestBit(u32 bits)
+{
+    return sLowestBitIndices[((bits & -bits) * 0x077CB531u) >> 27];
+}
+
+void RegisterCopiedSprite(u8 spriteId)
+{
+    if (gSprites[spriteId].inUse)
+        ActivateSprite(spriteId);
+}
+#endif // MODERN
+
 void ResetSpriteData(void)
 {
     ResetOamRange(0, 128);
@@ -301,6 +375,56 @@ void ResetSpriteData(void)
     gSpriteCoordOffsetY = 0;
 }
 
+#if MODERN
+void AnimateSprites(void)
+{
+    u32 i, word;
+
+    if (AreMostSpritesActive())
+    {
+        for (i = 0; i < MAX_SPRITES; i++)
+        {
+            struct Sprite *sprite = &gSprites[i];
+
+            if (sprite->inUse)
+            {
+                sprite->callback(sprite);
+
+                if (sprite->inUse)
+                    AnimateSprite(sprite);
+            }
+        }
+        return;
+    }
+
+    for (word = 0; word < ARRAY_COUNT(sActiveSprites); word++)
+    {
+        u32 bits = sActiveSprites[word];
+
+        while (bits != 0)
+        {
+            u32 bit = GetLowestBit(bits);
+            struct Sprite *sprite = &gSprites[word * 32 + bit];
+
+            if (sprite->inUse)
+            {
+                sprite->callback(sprite);
+
+                if (sprite->inUse)
+                    AnimateSprite(sprite);
+            }
+            else
+            {
+                DeactivateSprite(word * 32 + bit);
+            }
+
+            // The callback may have created or destroyed sprites, so the rest
+            // of the slots come from the set as it is now.
+            bits = sActiveSprites[word] & ~((2u << bit) - 1);
+        }
+    }
+}
+#else
 void AnimateSprites(void)
 {
     u8 i;
@@ -317,6 +441,7 @@ void AnimateSprites(void)
         }
     }
 }
+#endif // MODERN
 
 void BuildOamBuffer(void)
 {
@@ -332,6 +457,61 @@ void BuildOamBuffer(void)
     gShouldProcessSpriteCopyRequests = TRUE;
 }
 
+#if MODERN
+static inline void UpdateSpriteOamCoords(struct Sprite *sprite)
+{
+    if (sprite->inUse && !sprite->invisible)
+    {
+        if (sprite->coordOffsetEnabled)
+        {
+            sprite->oam.x = sprite->x + sprite->x2 + sprite->centerToCornerVecX + gSpriteCoordOffsetX;
+            sprite->oam.y = sprite->y + sprite->y2 + sprite->centerToCornerVecY + gSpriteCoordOffsetY;
+        }
+        else
+        {
+            sprite->oam.x = sprite->x + sprite->x2 + sprite->centerToCornerVecX;
+            sprite->oam.y = sprite->y + sprite->y2 + sprite->centerToCornerVecY;
+        }
+    }
+}
+
+void UpdateOamCoords(void)
+{
+    u32 i, word, bits;
+
+    if (AreMostSpritesActive())
+    {
+        for (i = 0; i < MAX_SPRITES; i++)
+            UpdateSpriteOamCoords(&gSprites[i]);
+        return;
+    }
+
+    for (word = 0; word < ARRAY_COUNT(sActiveSprites); word++)
+        for (bits = sActiveSprites[word]; bits != 0; bits &= bits - 1)
+            UpdateSpriteOamCoords(&gSprites[word * 32 + GetLowestBit(bits)]);
+}
+
+void BuildSpritePriorities(void)
+{
+    u32 i, word, bits;
+
+    if (AreMostSpritesActive())
+    {
+        for (i = 0; i < MAX_SPRITES; i++)
+            gSpritePriorities[i] = gSprites[i].subpriority | (gSprites[i].oam.priority << 8);
+        return;
+    }
+
+    for (word = 0; word < ARRAY_COUNT(sActiveSprites); word++)
+    {
+        for (bits = sActiveSprites[word]; bits != 0; bits &= bits - 1)
+        {
+            i = word * 32 + GetLowestBit(bits);
+            gSpritePriorities[i] = gSprites[i].subpriority | (gSprites[i].oam.priority << 8);
+        }
+    }
+}
+#else
 void UpdateOamCoords(void)
 {
     u8 i;
@@ -364,7 +544,100 @@ void BuildSpritePriorities(void)
         gSpritePriorities[i] = priority;
     }
 }
+#endif // MODERN
+
+#if MODERN
+#define SPRITE_SORT_KEY_BITS 19
+#define SPRITE_SORT_RADIX_BITS 7
+#define SPRITE_SORT_RADIX (1 << SPRITE_SORT_RADIX_BITS)
+#define SPRITE_SORT_MAX_SHIFTS (MAX_SPRITES * 2)
 
+// Sprites are drawn in order of priority, then from the bottom of the screen
+// up. The Y position is adjusted for sprites that wrap around the top of the
+// screen, and ends up between -127 and DISPLAY_HEIGHT - 1.
+static u32 GetSpriteSortKey(struct Sprite *sprite, u16 priority)
+{
+    s32 y = sprite->oam.y;
+
+    if (y >= DISPLAY_HEIGHT)
+        y -= 256;
+
+    if (sprite->oam.affineMode == ST_OAM_AFFINE_DOUBLE
+     && sprite->oam.size == 3
+     && (sprite->oam.shape == ST_OAM_SQUARE || sprite->oam.shape == ST_OAM_V_RECTANGLE)
+     && y > 128)
+        y -= 256;
+
+    return (priority << 9) | (DISPLAY_HEIGHT - 1 - y);
+}
+
+// Sorts the previous frame's order, which is usually close to sorted already.
+// Both sorts are stable, so sprites that compare equal stay in the same order
+// as they did with the insertion sort below.
+void SortSprites(void)
+{
+    u32 keys[MAX_SPRITES];
+    u8 buffer[MAX_SPRITES];
+    u8 *order = gSpriteOrder;
+    u8 *sorted = buffer;
+    u32 shifts = 0;
+    u32 shift;
+    u32 i;
+
+    for (i = 0; i < MAX_SPRITES; i++)
+        keys[i] = GetSpriteSortKey(&gSprites[i], gSpritePriorities[i]);
+
+    // An insertion sort is quickest when only a few sprites moved past others.
+    // When that takes too many shifts, a radix sort finishes in fixed time.
+    for (i = 1; i < MAX_SPRITES && shifts <= SPRITE_SORT_MAX_SHIFTS; i++)
+    {
+        u8 spriteId = order[i];
+        u32 j = i;
+
+        while (j > 0 && keys[order[j - 1]] > keys[spriteId])
+        {
+            order[j] = order[j - 1];
+            j--;
+        }
+
+        order[j] = spriteId;
+        shifts += i - j;
+    }
+
+    if (i == MAX_SPRITES)
+        return;
+
+    for (shift = 0; shift < SPRITE_SORT_KEY_BITS; shift += SPRITE_SORT_RADIX_BITS)
+    {
+        u8 positions[SPRITE_SORT_RADIX] = {0};
+        u32 position = 0;
+        u8 *temp;
+
+        for (i = 0; i < MAX_SPRITES; i++)
+            positions[(keys[order[i]] >> shift) % SPRITE_SORT_RADIX]++;
+
+        if (positions[(keys[order[0]] >> shift) % SPRITE_SORT_RADIX] == MAX_SPRITES)
+            continue;
+
+        for (i = 0; i < SPRITE_SORT_RADIX; i++)
+        {
+            u32 count = positions[i];
+            positions[i] = position;
+            position += count;
+        }
+
+        for (i = 0; i < MAX_SPRITES; i++)
+            sorted[positions[(keys[order[i]] >> shift) % SPRITE_SORT_RADIX]++] = order[i];
+
+        temp = order;
+        order = sorted;
+        sorted = temp;
+    }
+
+    if (order != gSpriteOrder)
+        memcpy(gSpriteOrder, order, MAX_SPRITES);
+}
+#else
 void SortSprites(void)
 {
     u8 i;
@@ -457,6 +730,7 @@ void SortSprites(void)
         }
     }
 }
+#endif // MODERN
 
 void CopyMatricesToOamBuffer(void)
 {
@@ -475,11 +749,20 @@ void AddSpritesToOamBuffer(void)
 {
     int i = 0;
     u8 oamIndex = 0;
+#if MODERN
+    // Every slot's coordinates were updated if most were.
+    bool32 allSlots = AreMostSpritesActive();
+#endif // MODERN
 
     while (i < MAX_SPRITES)
     {
         struct Sprite *sprite = &gSprites[gSpriteOrder[i]];
+#if MODERN
+        if ((allSlots || IsSpriteActive(gSpriteOrder[i]))
+         && sprite->inUse && !sprite->invisible && AddSpriteToOamBuffer(sprite, &oamIndex))
+#else
         if (sprite->inUse && !sprite->invisible && AddSpriteToOamBuffer(sprite, &oamIndex))
+#endif // MODERN
             return;
         i++;
     }
@@ -536,6 +819,9 @@ u8 CreateSpriteAt(u8 index, const struct SpriteTemplate *template, s16 x, s16 y,
     ResetSprite(sprite);
 
     sprite->inUse = TRUE;
+#if MODERN
+    ActivateSprite(index);
+#endif // MODERN
     sprite->animBeginning = TRUE;
     sprite->affineAnimBeginning = TRUE;
     sprite->usingSheet = TRUE;
@@ -613,10 +899,14 @@ void DestroySprite(struct Sprite *sprite)
     {
         if (!sprite->usingSheet)
         {
+#if MODERN
+            SetSpriteTilesAllocated(sprite->oam.tileNum, (sprite->images->size / TILE_SIZE_4BPP) + sprite->oam.tileNum, FALSE);
+#else
             u16 i;
             u16 tileEnd = (sprite->images->size / TILE_SIZE_4BPP) + sprite->oam.tileNum;
             for (i = sprite->oam.tileNum; i < tileEnd; i++)
                 FREE_SPRITE_TILE(i);
+#endif // MODERN
         }
         ResetSprite(sprite);
     }
@@ -678,6 +968,11 @@ void SetOamMatrix(u8 matrixNum, u16 a, u16 b, u16 c, u16 d)
 void ResetSprite(struct Sprite *sprite)
 {
     *sprite = sDummySprite;
+#if MODERN
+    // ResetAllSprites also resets the sprite after the last slot.
+    if (sprite - gSprites < MAX_SPRITES)
+        DeactivateSprite(sprite - gSprites);
+#endif // MODERN
 }
 
 void CalcCenterToCornerVec(struct Sprite *sprite, u8 shape, u8 size, u8 affineMode)
@@ -695,6 +990,109 @@ void CalcCenterToCornerVec(struct Sprite *sprite, u8 shape, u8 size, u8 affineMo
     sprite->centerToCornerVecY = y;
 }
 
+#if MODERN
+// Sets the bits of the tiles from start up to end, or clears them, a word at
+// a time.
+static void SetSpriteTilesAllocated(u32 start, u32 end, bool32 allocated)
+{
+    if (end > TOTAL_OBJ_TILE_COUNT)
+        end = TOTAL_OBJ_TILE_COUNT;
+
+    while (start < end)
+    {
+        u32 shift = start % 32;
+        u32 count = min(32 - shift, end - start);
+        u32 mask = (count == 32) ? 0xFFFFFFFF : ((1u << count) - 1) << shift;
+
+        if (allocated)
+            gSpriteTileAllocBitmap[start / 32] |= mask;
+        else
+            gSpriteTileAllocBitmap[start / 32] &= ~mask;
+        start += count;
+    }
+}
+
+// Returns the first tile from tileNum on that's allocated, or free, or
+// TOTAL_OBJ_TILE_COUNT if there isn't one.
+static u32 FindSpriteTile(u32 tileNum, bool32 allocated)
+{
+    u32 invert = allocated ? 0 : 0xFFFFFFFF;
+
+    while (tileNum < TOTAL_OBJ_TILE_COUNT)
+    {
+        u32 bits = (gSpriteTileAllocBitmap[tileNum / 32] ^ invert) >> (tileNum % 32);
+
+        if (bits != 0)
+            return tileNum + GetLowestBit(bits);
+        tileNum = (tileNum | 31) + 1;
+    }
+
+    return TOTAL_OBJ_TILE_COUNT;
+}
+
+s16 AllocSpriteTiles(u16 tileCount)
+{
+    u32 start;
+    u32 end;
+
+    if (tileCount == 0)
+    {
+        // Free all unreserved tiles if the tile count is 0.
+        SetSpriteTilesAllocated(gReservedSpriteTileCount, TOTAL_OBJ_TILE_COUNT, FALSE);
+        return 0;
+    }
+
+    // Take the first run of free tiles that's long enough.
+    end = gReservedSpriteTileCount;
+    do
+    {
+        start = FindSpriteTile(end, FALSE);
+        if (start == TOTAL_OBJ_TILE_COUNT)
+            return -1;
+        end = FindSpriteTile(start, TRUE);
+    } while (end - start < tileCount);
+
+    SetSpriteTilesAllocated(start, start + tileCount, TRUE);
+    return start;
+}
+
+void GetSpriteTileAllocStats(struct SpriteTileAllocStats *stats)
+{
+    u32 start;
+    u32 end = gReservedSpriteTileCount;
+
+    stats->freeTiles = 0;
+    stats->freeRuns = 0;
+    stats->largestFreeRun = 0;
+    while ((start = FindSpriteTile(end, FALSE)) != TOTAL_OBJ_TILE_COUNT)
+    {
+        end = FindSpriteTile(start, TRUE);
+        stats->freeTiles += end - start;
+        stats->freeRuns++;
+        if (end - start > stats->largestFreeRun)
+            stats->largestFreeRun = end - start;
+    }
+
+    if (stats->freeTiles != 0)
+        stats->fragmentation = 100 - 100 * stats->largestFreeRun / stats->freeTiles;
+    else
+        stats->fragmentation = 0;
+}
+
+u8 SpriteTileAllocBitmapOp(u16 bit, u8 op)
+{
+    u32 mask = 1u << (bit % 32);
+
+    if (op == 0) // clear
+        gSpriteTileAllocBitmap[bit / 32] &= ~mask;
+    else if (op == 1) // set
+        gSpriteTileAllocBitmap[bit / 32] |= mask;
+    else // check
+        return ((gSpriteTileAllocBitmap[bit / 32] & mask) != 0) << (bit % 8);
+
+    return 0;
+}
+#else
 s16 AllocSpriteTiles(u16 tileCount)
 {
     u16 i;
@@ -773,16 +1171,21 @@ u8 SpriteTileAllocBitmapOp(u16 bit, u8 op)
 
     return retVal;
 }
+#endif // MODERN
 
 void FreeSpriteTilesIfNotUsingSheet(struct Sprite *sprite)
 {
     if (!sprite->usingSheet)
     {
+#if MODERN
+        SetSpriteTilesAllocated(sprite->oam.tileNum, (sprite->images[0].size / TILE_SIZE_4BPP) + sprite->oam.tileNum, FALSE);
+#else
         int i;
         int end = (sprite->images[0].size / TILE_SIZE_4BPP) + sprite->oam.tileNum;
 
         for (i = sprite->oam.tileNum; i < end; i++)
             FREE_SPRITE_TILE(i);
+#endif // MODERN
     }
 }
 
@@ -851,6 +1254,16 @@ void CopyToSprites(u8 *src)
         src++;
         dest++;
     }
+
+#if MODERN
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        if (gSprites[i].inUse)
+            ActivateSprite(i);
+        else
+            DeactivateSprite(i);
+    }
+#endif // MODERN
 }
 
 void ResetAllSprites(void)
@@ -1511,8 +1924,12 @@ void FreeSpriteTilesByTag(u16 tag)
         rangeCounts = sSpriteTileRanges + 1;
         count = rangeCounts[index * 2];
 
+#if MODERN
+        SetSpriteTilesAllocated(start, start + count, FALSE);
+#else
         for (i = start; i < start + count; i++)
             FREE_SPRITE_TILE(i);
+#endif // MODERN
 
         sSpriteTileRangeTags[index] = 0xFFFF;
     }
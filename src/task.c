@@ -6,8 +6,25 @@
 
 struct Task gTasks[NUM_TASKS];
 
+#if MODERN
+// The list's first task, the last task of each priority, which priorities
+// have tasks and which tasks are active are kept up to date, so that creating,
+// destroying and running tasks don't have to search for them.
+static u8 sFirstTask;
+static u8 sPriorityTails[256];
+static u32 sUsedPriorities[256 / 32];
+static u32 sActiveTasks;
+#endif // MODERN
+
 static void InsertTask(u8 newTaskId);
 static u8 FindFirstActiveTask();
+#if MODERN
+static void RemoveTaskFromLookups(u8 taskId);
+#endif // MODERN
+#ifdef TASK_PROFILE
+static void RunProfiledTask(u8 taskId);
+static void EndTaskProfileFrame(void);
+#endif // TASK_PROFILE
 
 void ResetTasks(void)
 {
@@ -25,8 +42,75 @@ void ResetTasks(void)
 
     gTasks[0].prev = HEAD_SENTINEL;
     gTasks[NUM_TASKS - 1].next = TAIL_SENTINEL;
+
+#if MODERN
+    sFirstTask = NUM_TASKS;
+    sActiveTasks = 0;
+    memset(sUsedPriorities, 0, sizeof(sUsedPriorities));
+#endif // MODERN
 }
 
+#if MODERN
+u8 CreateTask(TaskFunc func, u8 priority)
+{
+    u32 freeTasks = ~sActiveTasks & ((1 << NUM_TASKS) - 1);
+    u8 i;
+
+    if (freeTasks == 0)
+        return 0;
+
+    // The lowest free ID, as before.
+    i = __builtin_ctz(freeTasks);
+    gTasks[i].func = func;
+    gTasks[i].priority = priority;
+    InsertTask(i);
+    memset(gTasks[i].data, 0, sizeof(gTasks[i].data));
+    gTasks[i].isActive = TRUE;
+    sActiveTasks |= 1 << i;
+    return i;
+}
+
+// A new task goes after the last one whose priority is the same or lower,
+// which is the tail of the highest used priority up to its own.
+static void InsertTask(u8 newTaskId)
+{
+    u32 priority = gTasks[newTaskId].priority;
+    u32 word = priority / 32;
+    u32 used = sUsedPriorities[word] & ((2u << (priority % 32)) - 1);
+    u8 taskId;
+
+    while (used == 0 && word != 0)
+        used = sUsedPriorities[--word];
+
+    if (used == 0)
+    {
+        // The new task goes first.
+        gTasks[newTaskId].prev = HEAD_SENTINEL;
+        if (sFirstTask == NUM_TASKS)
+        {
+            gTasks[newTaskId].next = TAIL_SENTINEL;
+        }
+        else
+        {
+            gTasks[newTaskId].next = sFirstTask;
+            gTasks[sFirstTask].prev = newTaskId;
+        }
+        sFirstTask = newTaskId;
+    }
+    else
+    {
+        taskId = sPriorityTails[word * 32 + 31 - __builtin_clz(used)];
+        gTasks[newTaskId].prev = taskId;
+        gTasks[newTaskId].next = gTasks[taskId].next;
+        if (gTasks[taskId].next != TAIL_SENTINEL)
+            gTasks[gTasks[taskId].next].prev = newTaskId;
+        gTasks[taskId].next = newTaskId;
+    }
+
+    sPriorityTails[priority] = newTaskId;
+    sUsedPriorities[priority / 32] |= 1u << (priority % 32);
+}
+#else
 u8 CreateTask(TaskFunc func, u8 priority)
 {
     u8 i;
@@ -83,12 +167,16 @@ static void InsertTask(u8 newTaskId)
         taskId = gTasks[taskId].next;
     }
 }
+#endif // MODERN
 
 void DestroyTask(u8 taskId)
 {
     if (gTasks[taskId].isActive)
     {
         gTasks[taskId].isActive = FALSE;
+#if MODERN
+        RemoveTaskFromLookups(taskId);
+#endif // MODERN
 
         if (gTasks[taskId].prev == HEAD_SENTINEL)
         {
@@ -118,12 +206,45 @@ void RunTasks(void)
     {
         do
         {
+#ifdef TASK_PROFILE
+            RunProfiledTask(taskId);
+#else
             gTasks[taskId].func(taskId);
+#endif // TASK_PROFILE
             taskId = gTasks[taskId].next;
         } while (taskId != TAIL_SENTINEL);
     }
+
+#ifdef TASK_PROFILE
+    EndTaskProfileFrame();
+#endif // TASK_PROFILE
 }
 
+#if MODERN
+static u8 FindFirstActiveTask()
+{
+    return sFirstTask;
+}
+
+static void RemoveTaskFromLookups(u8 taskId)
+{
+    u8 priority = gTasks[taskId].priority;
+    u8 prev = gTasks[taskId].prev;
+
+    sActiveTasks &= ~(1 << taskId);
+
+    if (prev == HEAD_SENTINEL)
+        sFirstTask = gTasks[taskId].next == TAIL_SENTINEL ? NUM_TASKS : gTasks[taskId].next;
+
+    if (sPriorityTails[priority] == taskId)
+    {
+        if (prev != HEAD_SENTINEL && gTasks[prev].priority == priority)
+            sPriorityTails[priority] = prev;
+        else
+            sUsedPriorities[priority / 32] &= ~(1u << (priority % 32));
+    }
+}
+#else
 static u8 FindFirstActiveTask()
 {
     u8 taskId;
@@ -134,6 +255,172 @@ static u8 FindFirstActiveTask()
 
     return taskId;
 }
+#endif // MODERN
+
+#ifdef TASK_PROFILE
+// Profiling builds (make TASK_PROFILE=1) time every task function call.
+// After TASK_PROFILE_FRAMES calls to RunTasks, the functions are printed with
+// DebugPrintf, busiest first, and counting starts again. The times are in CPU
+// cycles, read from timer 2 in steps of 64 cycles, or from the host's clock
+// in the host build.
+//
+// Timers 0, 1 and 3 are kept by sound, RNG seeding and link for as long as
+// they run. Timer 2 belongs to the flash code only during a save operation,
+// which sets it up for the timeout and stops it afterwards, so the calls that
+// save are counted but their time is lost.
+
+#ifdef NDEBUG
+#error "TASK_PROFILE prints its report with DebugPrintf, which NDEBUG turns off"
+#endif
+
+#ifndef TASK_PROFILE_FRAMES
+#define TASK_PROFILE_FRAMES 600
+#endif
+
+// The last entry counts the functions that didn't get one of their own.
+#define MAX_PROFILED_TASK_FUNCS 48
+
+struct TaskProfileEntry
+{
+    TaskFunc func;
+    u32 calls;
+    u32 cycles;
+    u32 maxCycles;
+};
+
+static struct TaskProfileEntry sTaskProfile[MAX_PROFILED_TASK_FUNCS];
+static u8 sNumProfiledTaskFuncs;
+static u16 sTaskProfileFrames;
+static u32 sTaskProfileFrameCycles;
+static u32 sTaskProfileMaxFrameCycles;
+static u32 sTaskProfileUntimedCalls;
+
+#define TASK_PROFILE_TIMER_CONTROL (TIMER_ENABLE | TIMER_64CLK)
+
+static u32 ReadTaskProfileTimer(void)
+{
+#ifdef HOST_BUILD
+    return HostCycleCount();
+#else
+    if (!(REG_TM2CNT_H & TIMER_ENABLE))
+    {
+        REG_TM2CNT_L = 0;
+        REG_TM2CNT_H = TASK_PROFILE_TIMER_CONTROL;
+    }
+    return REG_TM2CNT_L;
+#endif // HOST_BUILD
+}
+
+// Returns FALSE if the flash code used timer 2 since it was last read.
+static bool32 IsTaskProfileTimerIntact(void)
+{
+#ifdef HOST_BUILD
+    return TRUE;
+#else
+    return REG_TM2CNT_H == TASK_PROFILE_TIMER_CONTROL;
+#endif // HOST_BUILD
+}
+
+static u32 GetTaskProfileCycles(u32 start, u32 end)
+{
+#ifdef HOST_BUILD
+    return end - start;
+#else
+    return (u16)(end - start) * 64;
+#endif // HOST_BUILD
+}
+
+static struct TaskProfileEntry *GetTaskProfileEntry(TaskFunc func)
+{
+    u8 i;
+
+    for (i = 0; i < sNumProfiledTaskFuncs; i++)
+        if (sTaskProfile[i].func == func)
+            return &sTaskProfile[i];
+
+    if (sNumProfiledTaskFuncs == MAX_PROFILED_TASK_FUNCS - 1)
+        return &sTaskProfile[MAX_PROFILED_TASK_FUNCS - 1];
+
+    sTaskProfile[i].func = func;
+    sNumProfiledTaskFuncs++;
+    return &sTaskProfile[i];
+}
+
+static void RunProfiledTask(u8 taskId)
+{
+    struct TaskProfileEntry *entry = GetTaskProfileEntry(gTasks[taskId].func);
+    u32 start = ReadTaskProfileTimer();
+    u32 cycles;
+
+    gTasks[taskId].func(taskId);
+
+    entry->calls++;
+    if (!IsTaskProfileTimerIntact())
+    {
+        sTaskProfileUntimedCalls++;
+        return;
+    }
+
+    cycles = GetTaskProfileCycles(start, ReadTaskProfileTimer());
+    entry->cycles += cycles;
+    if (entry->maxCycles < cycles)
+        entry->maxCycles = cycles;
+    sTaskProfileFrameCycles += cycles;
+}
+
+static void PrintTaskProfile(void)
+{
+    struct TaskProfileEntry temp;
+    u32 total = 0;
+    u32 numEntries = sNumProfiledTaskFuncs;
+    u32 i, j;
+
+    if (sTaskProfile[MAX_PROFILED_TASK_FUNCS - 1].calls != 0)
+        numEntries++;
+
+    for (i = 0; i < numEntries; i++)
+    {
+        total += sTaskProfile[i].cycles;
+        temp = sTaskProfile[i];
+        for (j = i; j > 0 && sTaskProfile[j - 1].cycles < temp.cycles; j--)
+            sTaskProfile[j] = sTaskProfile[j - 1];
+        sTaskProfile[j] = temp;
+    }
+
+    DebugPrintf("Task profile: %u frames, %u cycles/frame in tasks, worst frame %u\n",
+                TASK_PROFILE_FRAMES, total / TASK_PROFILE_FRAMES, sTaskProfileMaxFrameCycles);
+    if (sTaskProfileUntimedCalls != 0)
+        DebugPrintf("  %u calls saved to flash and weren't timed\n", sTaskProfileUntimedCalls);
+    DebugPrintf("  function  share  calls  cycles/frame  max cycles/call\n");
+    for (i = 0; i < numEntries; i++)
+    {
+        // A function address of 0 stands for all the functions that didn't fit.
+        DebugPrintf("  %08X  %3u%%  %5u  %12u  %u\n",
+                    (u32)sTaskProfile[i].func,
+                    total != 0 ? (u32)((u64)sTaskProfile[i].cycles * 100 / total) : 0,
+                    sTaskProfile[i].calls,
+                    sTaskProfile[i].cycles / TASK_PROFILE_FRAMES,
+                    sTaskProfile[i].maxCycles);
+    }
+}
+
+static void EndTaskProfileFrame(void)
+{
+    if (sTaskProfileMaxFrameCycles < sTaskProfileFrameCycles)
+        sTaskProfileMaxFrameCycles = sTaskProfileFrameCycles;
+    sTaskProfileFrameCycles = 0;
+
+    if (++sTaskProfileFrames < TASK_PROFILE_FRAMES)
+        return;
+
+    PrintTaskProfile();
+    memset(sTaskProfile, 0, sizeof(sTaskProfile));
+    sNumProfiledTaskFuncs = 0;
+    sTaskProfileFrames = 0;
+    sTaskProfileMaxFrameCycles = 0;
+    sTaskProfileUntimedCalls = 0;
+}
+#endif // TASK_PROFILE
 
 void TaskDummy(u8 taskId)
 {
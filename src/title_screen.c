@@ -358,6 +358,7 @@ void CB2_InitTitleScreen(void)
         DmaFill16(3, 0, (void *)VRAM, VRAM_SIZE);
         DmaFill32(3, 0, (void *)OAM, OAM_SIZE);
         DmaFill16(3, 0, (void *)PLTT, PLTT_SIZE);
+        MarkPalettesDirty(PALETTES_ALL);
         ResetBgsAndClearDma3BusyFlags(FALSE);
         InitBgsFromTemplates(0, sBgTemplates, NELEMS(sBgTemplates));
         SetGpuRegBits(REG_OFFSET_DISPCNT, DISPCNT_OBJ_1D_MAP | DISPCNT_OBJ_ON);
@@ -844,6 +845,7 @@ static void Task_TitleScreen_BlinkPressStart(u8 taskId)
                     gPlttBufferFaded[0xF1 + i] = gGraphics_TitleScreen_BackgroundPals[1 + i];
                 }
             }
+            MarkPlttBufferDirty(0xF1, 5);
             if (data[14])
             {
                 BlendPalettes(0x00008000, gPaletteFade.y, gPaletteFade.blendColor);
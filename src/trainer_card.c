@@ -992,6 +992,7 @@ static void DmaClearOam(void)
 static void DmaClearPltt(void)
 {
     DmaClear16(3, (void *)PLTT, PLTT_SIZE);
+    MarkPalettesDirty(PALETTES_ALL);
 }
 
 static void ResetBgRegs(void)
@@ -24,6 +24,11 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <limits.h>
+#include <pthread.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+#include "trace.h"
 
 /* extended.c */
 void ieee754_write_extended (double, uint8_t*);
@@ -57,6 +62,7 @@ typedef struct {
 	unsigned long loop_offset;
 	double sample_rate;
 	unsigned long real_num_samples;
+	unsigned long sample_data_offset;
 } AifData;
 
 struct Bytes {
@@ -72,6 +78,7 @@ struct Marker {
 
 struct Bytes *read_bytearray(const char *filename)
 {
+	uint64_t trace_start = TraceBegin();
 	struct Bytes *bytes = malloc(sizeof(struct Bytes));
 	FILE *f = fopen(filename, "rb");
 	if (!f)
@@ -88,11 +95,13 @@ struct Bytes *read_bytearray(const char *filename)
 	{
 		FATAL_ERROR("Failed to read data from '%s'!\n", filename);
 	}
+	TraceEnd("read", trace_start, filename);
 	return bytes;
 }
 
 void write_bytearray(const char *filename, struct Bytes *bytes)
 {
+	uint64_t trace_start = TraceBegin();
 	FILE *f = fopen(filename, "wb");
 	if (!f)
 	{
@@ -100,6 +109,7 @@ void write_bytearray(const char *filename, struct Bytes *bytes)
 	}
 	fwrite(bytes->data, bytes->length, 1, f);
 	fclose(f);
+	TraceEnd("write", trace_start, filename);
 }
 
 void free_bytearray(struct Bytes *bytes)
@@ -136,38 +146,52 @@ char *new_file_extension(char *filename, char *ext)
 	return new_filename;
 }
 
-void read_aif(struct Bytes *aif, AifData *aif_data)
+void read_file_bytes(FILE *f, const char *filename, void *buffer, unsigned long length)
+{
+	if (length != 0 && fread(buffer, length, 1, f) != 1)
+	{
+		FATAL_ERROR("Failed to read data from '%s'!\n", filename);
+	}
+}
+
+// Reads the chunks of an .aif file without loading the sound data. The position and
+// size of the sound data are recorded in aif_data so it can be streamed afterwards.
+void read_aif(FILE *f, const char *filename, AifData *aif_data)
 {
 	aif_data->has_loop = false;
 	aif_data->num_samples = 0;
 
-	unsigned long pos = 0;
+	uint8_t header[12];
 	char chunk_name[5]; chunk_name[4] = '\0';
 	char chunk_type[5]; chunk_type[4] = '\0';
 
+	fseek(f, 0, SEEK_END);
+	unsigned long file_length = ftell(f);
+	fseek(f, 0, SEEK_SET);
+
+	read_file_bytes(f, filename, header, sizeof(header));
+
 	// Check for FORM Chunk
-	memcpy(chunk_name, &aif->data[pos], 4);
-	pos += 4;
+	memcpy(chunk_name, &header[0], 4);
 	if (strcmp(chunk_name, "FORM") != 0)
 	{
 		FATAL_ERROR("Input .aif file has invalid header Chunk '%s'!\n", chunk_name);
 	}
 
 	// Read size of whole file.
-	unsigned long whole_chunk_size = aif->data[pos++] << 24;
-	whole_chunk_size |= (aif->data[pos++] << 16);
-	whole_chunk_size |= (aif->data[pos++] <<  8);
-	whole_chunk_size |= (uint8_t)aif->data[pos++];
+	unsigned long whole_chunk_size = header[4] << 24;
+	whole_chunk_size |= (header[5] << 16);
+	whole_chunk_size |= (header[6] <<  8);
+	whole_chunk_size |= header[7];
 
-	unsigned long expected_whole_chunk_size = aif->length - 8;
+	unsigned long expected_whole_chunk_size = file_length - 8;
 	if (whole_chunk_size != expected_whole_chunk_size)
 	{
 		FATAL_ERROR("FORM Chunk ckSize '%lu' doesn't match actual size '%lu'!\n", whole_chunk_size, expected_whole_chunk_size);
 	}
 
 	// Check for AIFF Form Type
-	memcpy(chunk_type, &aif->data[pos], 4);
-	pos += 4;
+	memcpy(chunk_type, &header[8], 4);
 	if (strcmp(chunk_type, "AIFF") != 0)
 	{
 		FATAL_ERROR("FORM Type is '%s', but it must be AIFF!", chunk_type);
@@ -176,47 +200,74 @@ void read_aif(struct Bytes *aif, AifData *aif_data)
 	struct Marker *markers = NULL;
 	unsigned short num_markers = 0, loop_start = 0, loop_end = 0;
 	unsigned long num_sample_frames = 0;
+	unsigned long pos = sizeof(header);
 
 	// Read all the Chunks to populate the AifData struct.
-	while ((pos + 8) < aif->length)
+	while ((pos + 8) < file_length)
 	{
+		uint8_t chunk_header[8];
+		read_file_bytes(f, filename, chunk_header, sizeof(chunk_header));
+		pos += 8;
+
 		// Read Chunk id
-		memcpy(chunk_name, &aif->data[pos], 4);
-		pos += 4;
+		memcpy(chunk_name, &chunk_header[0], 4);
 
-		unsigned long chunk_size = (aif->data[pos++] << 24);
-		chunk_size |= (aif->data[pos++] << 16);
-		chunk_size |= (aif->data[pos++] <<  8);
-		chunk_size |=  aif->data[pos++];
+		unsigned long chunk_size = (chunk_header[4] << 24);
+		chunk_size |= (chunk_header[5] << 16);
+		chunk_size |= (chunk_header[6] <<  8);
+		chunk_size |=  chunk_header[7];
 
-		if ((pos + chunk_size) > aif->length)
+		if ((pos + chunk_size) > file_length)
 		{
 			FATAL_ERROR("%s chunk at 0x%lx reached end of file before finishing\n", chunk_name, pos);
 		}
 
+		if (strcmp(chunk_name, "SSND") == 0)
+		{
+			// Skip offset and blockSize, and leave the sound data in the file.
+			aif_data->sample_data_offset = pos + 8;
+			aif_data->real_num_samples = chunk_size - 8;
+			pos += chunk_size;
+			fseek(f, pos, SEEK_SET);
+			continue;
+		}
+
+		if (strcmp(chunk_name, "COMM") != 0 && strcmp(chunk_name, "MARK") != 0 && strcmp(chunk_name, "INST") != 0)
+		{
+			// Skip over unsupported chunks.
+			pos += chunk_size;
+			fseek(f, pos, SEEK_SET);
+			continue;
+		}
+
+		// The remaining chunks are small, so read them whole.
+		uint8_t *data = malloc(chunk_size);
+		unsigned long i = 0;
+		read_file_bytes(f, filename, data, chunk_size);
+		pos += chunk_size;
+
 		if (strcmp(chunk_name, "COMM") == 0)
 		{
-			short num_channels = (aif->data[pos++] << 8);
-			num_channels |= (uint8_t)aif->data[pos++];
+			short num_channels = (data[i++] << 8);
+			num_channels |= (uint8_t)data[i++];
 			if (num_channels != 1)
 			{
 				FATAL_ERROR("numChannels (%d) in the COMM Chunk must be 1!\n", num_channels);
 			}
 
-			num_sample_frames =  (aif->data[pos++] << 24);
-			num_sample_frames |= (aif->data[pos++] << 16);
-			num_sample_frames |= (aif->data[pos++] <<  8);
-			num_sample_frames |=  (uint8_t)aif->data[pos++];
+			num_sample_frames =  (data[i++] << 24);
+			num_sample_frames |= (data[i++] << 16);
+			num_sample_frames |= (data[i++] <<  8);
+			num_sample_frames |=  (uint8_t)data[i++];
 
-			short sample_size = (aif->data[pos++] << 8);
-			sample_size |= (uint8_t)aif->data[pos++];
+			short sample_size = (data[i++] << 8);
+			sample_size |= (uint8_t)data[i++];
 			if (sample_size != 8)
 			{
 				FATAL_ERROR("sampleSize (%d) in the COMM Chunk must be 8!\n", sample_size);
 			}
 
-			double sample_rate = ieee754_read_extended((uint8_t*)(aif->data + pos));
-			pos += 10;
+			double sample_rate = ieee754_read_extended(data + i);
 
 			aif_data->sample_rate = sample_rate;
 
@@ -227,93 +278,67 @@ void read_aif(struct Bytes *aif, AifData *aif_data)
 		}
 		else if (strcmp(chunk_name, "MARK") == 0)
 		{
-			num_markers = (aif->data[pos++] << 8);
-			num_markers |= (uint8_t)aif->data[pos++];
+			num_markers = (data[i++] << 8);
+			num_markers |= (uint8_t)data[i++];
 
 			if (markers)
 			{
 				FATAL_ERROR("More than one MARK Chunk in file!\n");
 			}
-			
+
 			markers = calloc(num_markers, sizeof(struct Marker));
 
 			// Read each marker.
-			for (int i = 0; i < num_markers; i++)
+			for (int j = 0; j < num_markers; j++)
 			{
-				unsigned short marker_id = (aif->data[pos++] << 8);
-				marker_id |= (uint8_t)aif->data[pos++];
-
-				unsigned long marker_position = (aif->data[pos++] << 24);
-				marker_position |= (aif->data[pos++] << 16);
-				marker_position |= (aif->data[pos++] << 8);
-				marker_position |=  (uint8_t)aif->data[pos++];
-
-				// Marker name is a Pascal-style string.
-				uint8_t marker_name_size = aif->data[pos++];
-				// We don't actually need the marker name for anything anymore.
-				/*char *marker_name = (char *)malloc((marker_name_size + 1) * sizeof(char));
-				memcpy(marker_name, &aif->data[pos], marker_name_size);
-				marker_name[marker_name_size] = '\0';*/
-				pos += marker_name_size + !(marker_name_size & 1);
-
-				markers[i].id = marker_id;
-				markers[i].position = marker_position;
+				unsigned short marker_id = (data[i++] << 8);
+				marker_id |= (uint8_t)data[i++];
+
+				unsigned long marker_position = (data[i++] << 24);
+				marker_position |= (data[i++] << 16);
+				marker_position |= (data[i++] << 8);
+				marker_position |=  (uint8_t)data[i++];
+
+				// Marker name is a Pascal-style string. We don't need it.
+				uint8_t marker_name_size = data[i++];
+				i += marker_name_size + !(marker_name_size & 1);
+
+				markers[j].id = marker_id;
+				markers[j].position = marker_position;
 			}
 		}
 		else if (strcmp(chunk_name, "INST") == 0)
 		{
-			uint8_t midi_note = (uint8_t)aif->data[pos++];
+			uint8_t midi_note = (uint8_t)data[i++];
 
 			aif_data->midi_note = midi_note;
 
 			// Skip over data we don't need.
-			pos += 7;
+			i += 7;
 
-			unsigned short loop_type = (aif->data[pos++] << 8);
-			loop_type |= (uint8_t)aif->data[pos++];
+			unsigned short loop_type = (data[i++] << 8);
+			loop_type |= (uint8_t)data[i++];
 
 			if (loop_type)
 			{
-				loop_start = (aif->data[pos++] << 8);
-				loop_start |= (uint8_t)aif->data[pos++];
+				loop_start = (data[i++] << 8);
+				loop_start |= (uint8_t)data[i++];
 
-				loop_end = (aif->data[pos++] << 8);
-				loop_end |= (uint8_t)aif->data[pos++];
-			}
-			else
-			{
-				// Skip NoLooping sustain loop.
-				pos += 4;
+				loop_end = (data[i++] << 8);
+				loop_end |= (uint8_t)data[i++];
 			}
-			
-			// Skip release loop, we don't need it.
-			pos += 6;
-		}
-		else if (strcmp(chunk_name, "SSND") == 0)
-		{
-			// Skip offset and blockSize
-			pos += 8;
-
-			unsigned long num_samples = chunk_size - 8;
-			uint8_t *sample_data = (uint8_t *)malloc(num_samples * sizeof(uint8_t));
-			memcpy(sample_data, &aif->data[pos], num_samples);
 
-			aif_data->samples = sample_data;
-			aif_data->real_num_samples = num_samples;
-			pos += chunk_size - 8;
-		}
-		else
-		{
-			// Skip over unsupported chunks.
-			pos += chunk_size;
+			// The release loop isn't needed.
 		}
+
+		free(data);
 	}
-	
+
 	if (markers)
 	{
 		// Resolve loop points.
 		struct Marker *cur_marker = markers;
-	
+
 		// Grab loop start point.
 		for (int i = 0; i < num_markers; i++, cur_marker++)
 		{
@@ -438,73 +463,86 @@ int get_delta_index(uint8_t sample, uint8_t prev_sample)
 	return best_index;
 }
 
-struct Bytes *delta_compress(struct Bytes *pcm)
-{
-	struct Bytes *delta = malloc(sizeof(struct Bytes));
-	// estimate the length so we can malloc
-	int num_blocks = pcm->length / 64;
-	delta->length = num_blocks * 33;
+// Best delta index for every (sample, prev_sample) pair, indexed as [sample][prev_sample].
+static uint8_t gDeltaIndexTable[256][256];
+static bool gDeltaIndexTableReady = false;
 
-	int extra = pcm->length % 64;
-	if (extra)
-	{
-		delta->length += 1;
-		extra -= 1;
-	}
-	if (extra)
+void init_delta_index_table(void)
+{
+	if (gDeltaIndexTableReady)
 	{
-		delta->length += 1;
-		extra -= 1;
+		return;
 	}
-	if (extra)
+
+	for (int sample = 0; sample < 256; sample++)
 	{
-		delta->length += (extra + 1) / 2;
+		for (int prev_sample = 0; prev_sample < 256; prev_sample++)
+		{
+			gDeltaIndexTable[sample][prev_sample] = get_delta_index(sample, prev_sample);
+		}
 	}
 
-	delta->data = malloc(delta->length + 33);
+	gDeltaIndexTableReady = true;
+}
 
-	unsigned int i = 0;
-	unsigned int j = 0;
-	int k;
+// Compressed samples are stored in blocks of 64: the first sample as is, then the
+// delta index of the second sample in a byte of its own, then 31 bytes holding the
+// delta indices of the other 62 samples, high nibble first.
+struct DeltaEncoder {
 	uint8_t base;
-	int delta_index;
+	int block_pos;
+	uint8_t pending;
+};
 
-	while (i < pcm->length)
+void delta_encoder_init(struct DeltaEncoder *encoder)
+{
+	encoder->base = 0;
+	encoder->block_pos = 0;
+	encoder->pending = 0;
+	init_delta_index_table();
+}
+
+// Encodes the given samples, continuing from the encoder's state, and returns the number
+// of bytes written to out, which needs room for (length / 64 + 1) * 33 bytes.
+// A trailing sample left alone in the high nibble of a byte is dropped.
+unsigned long delta_compress(struct DeltaEncoder *encoder, const uint8_t *samples, unsigned long length, uint8_t *out)
+{
+	unsigned long j = 0;
+
+	for (unsigned long i = 0; i < length; i++)
 	{
-		base = pcm->data[i++];
-		delta->data[j++] = base;
+		uint8_t sample = samples[i];
+		int delta_index;
 
-		if (i >= pcm->length)
+		switch (encoder->block_pos)
 		{
+		case 0:
+			encoder->base = sample;
+			out[j++] = sample;
 			break;
-		}
-		delta_index = get_delta_index(pcm->data[i++], base);
-		base += gDeltaEncodingTable[delta_index];
-		delta->data[j++] = delta_index;
-
-		for (k = 0; k < 31; k++)
-		{
-			if (i >= pcm->length)
+		case 1:
+			delta_index = gDeltaIndexTable[sample][encoder->base];
+			encoder->base += gDeltaEncodingTable[delta_index];
+			out[j++] = delta_index;
+			break;
+		default:
+			delta_index = gDeltaIndexTable[sample][encoder->base];
+			encoder->base += gDeltaEncodingTable[delta_index];
+			if ((encoder->block_pos & 1) == 0)
 			{
-				break;
+				encoder->pending = delta_index << 4;
 			}
-			delta_index = get_delta_index(pcm->data[i++], base);
-			base += gDeltaEncodingTable[delta_index];
-			delta->data[j] = (delta_index << 4);
-
-			if (i >= pcm->length)
+			else
 			{
-				break;
+				out[j++] = encoder->pending | delta_index;
 			}
-			delta_index = get_delta_index(pcm->data[i++], base);
-			base += gDeltaEncodingTable[delta_index];
-			delta->data[j++] |= delta_index;
+			break;
 		}
-	}
 
-	delta->length = j;
+		encoder->block_pos = (encoder->block_pos + 1) % 64;
+	}
 
-	return delta;
+	return j;
 }
 
 #define STORE_U32_LE(dest, value) \
@@ -523,52 +561,81 @@ do { \
 	(var) |= (*((src) + 3) << 24); \
 } while (0)
 
+#define STREAM_BUFFER_SIZE 0x10000
+
 // Reads an .aif file and produces a .pcm file containing an array of 8-bit samples.
+// The sound data is streamed through a fixed-size buffer rather than loaded whole.
 void aif2pcm(const char *aif_filename, const char *pcm_filename, bool compress)
 {
-	struct Bytes *aif = read_bytearray(aif_filename);
-	AifData aif_data = {0,0,0,0,0,0,0};
-	read_aif(aif, &aif_data);
-
-	int header_size = 0x10;
-	struct Bytes *pcm;
-	struct Bytes output = {0,0};
-
-	if (compress)
+	FILE *aif = fopen(aif_filename, "rb");
+	if (!aif)
 	{
-		struct Bytes *input = malloc(sizeof(struct Bytes));
-		input->data = aif_data.samples;
-		input->length = aif_data.real_num_samples;
-		pcm = delta_compress(input);
-		free(input);
+		FATAL_ERROR("Failed to open '%s' for reading!\n", aif_filename);
 	}
-	else
+
+	AifData aif_data = {0,0,0,0,0,0,0,0};
+	uint64_t trace_start = TraceBegin();
+	read_aif(aif, aif_filename, &aif_data);
+	TraceEnd("parse", trace_start, aif_filename);
+
+	FILE *pcm = fopen(pcm_filename, "wb");
+	if (!pcm)
 	{
-		pcm = malloc(sizeof(struct Bytes));
-		pcm->data = aif_data.samples;
-		pcm->length = aif_data.real_num_samples;
+		FATAL_ERROR("Failed to open '%s' for writing!\n", pcm_filename);
 	}
-	output.length = header_size + pcm->length;
-	output.data = malloc(output.length);
 
+	uint8_t header[0x10];
 	uint32_t pitch_adjust = (uint32_t)(aif_data.sample_rate * 1024);
 	uint32_t loop_offset = (uint32_t)(aif_data.loop_offset);
 	uint32_t adjusted_num_samples = (uint32_t)(aif_data.num_samples - 1);
 	uint32_t flags = 0;
 	if (aif_data.has_loop) flags |= 0x40000000;
 	if (compress) flags |= 1;
-	STORE_U32_LE(output.data + 0, flags);
-	STORE_U32_LE(output.data + 4, pitch_adjust);
-	STORE_U32_LE(output.data + 8, loop_offset);
-	STORE_U32_LE(output.data + 12, adjusted_num_samples);
-	memcpy(&output.data[header_size], pcm->data, pcm->length);
-	write_bytearray(pcm_filename, &output);
+	STORE_U32_LE(header + 0, flags);
+	STORE_U32_LE(header + 4, pitch_adjust);
+	STORE_U32_LE(header + 8, loop_offset);
+	STORE_U32_LE(header + 12, adjusted_num_samples);
+	fwrite(header, sizeof(header), 1, pcm);
 
-	free(aif->data);
-	free(aif);
-	free(pcm);
-	free(output.data);
-	free(aif_data.samples);
+	uint8_t *buffer = malloc(STREAM_BUFFER_SIZE);
+	uint8_t *delta = compress ? malloc((STREAM_BUFFER_SIZE / 64 + 1) * 33) : NULL;
+	struct DeltaEncoder encoder;
+	unsigned long remaining = aif_data.real_num_samples;
+
+	if (compress)
+	{
+		delta_encoder_init(&encoder);
+	}
+
+	fseek(aif, aif_data.sample_data_offset, SEEK_SET);
+	trace_start = TraceBegin();
+
+	while (remaining > 0)
+	{
+		unsigned long length = remaining < STREAM_BUFFER_SIZE ? remaining : STREAM_BUFFER_SIZE;
+		read_file_bytes(aif, aif_filename, buffer, length);
+		remaining -= length;
+
+		if (compress)
+		{
+			unsigned long delta_length = delta_compress(&encoder, buffer, length, delta);
+			fwrite(delta, delta_length, 1, pcm);
+		}
+		else
+		{
+			fwrite(buffer, length, 1, pcm);
+		}
+	}
+
+	if (ferror(pcm) || fclose(pcm) != 0)
+	{
+		FATAL_ERROR("Failed to write data to '%s'!\n", pcm_filename);
+	}
+
+	TraceEnd("convert", trace_start, aif_filename);
+	fclose(aif);
+	free(buffer);
+	free(delta);
 }
 
 // Reads a .pcm file containing an array of 8-bit samples and produces an .aif file.
@@ -821,20 +888,161 @@ void pcm2aif(const char *pcm_filename, const char *aif_filename, uint32_t base_n
 	free(aif);
 }
 
+struct BatchState {
+	char **files;
+	int num_files;
+	int next_file;
+	int next_thread;
+	bool compress;
+	pthread_mutex_t lock;
+};
+
+void *batch_worker(void *arg)
+{
+	struct BatchState *state = arg;
+
+	pthread_mutex_lock(&state->lock);
+	TraceSetThread(++state->next_thread);
+	pthread_mutex_unlock(&state->lock);
+
+	for (;;)
+	{
+		pthread_mutex_lock(&state->lock);
+		int index = state->next_file++;
+		pthread_mutex_unlock(&state->lock);
+
+		if (index >= state->num_files)
+		{
+			break;
+		}
+
+		char *output_file = new_file_extension(state->files[index], "bin");
+		aif2pcm(state->files[index], output_file, state->compress);
+		free(output_file);
+	}
+
+	return NULL;
+}
+
+// Converts each .aif file to a .bin file next to it, spread over several threads.
+void aif2pcm_batch(char **files, int num_files, bool compress, int num_threads)
+{
+	struct BatchState state;
+	state.files = files;
+	state.num_files = num_files;
+	state.next_file = 0;
+	state.next_thread = 0;
+	state.compress = compress;
+	pthread_mutex_init(&state.lock, NULL);
+
+	for (int i = 0; i < num_files; i++)
+	{
+		char *extension = get_file_extension(files[i]);
+		if (!extension || (strcmp(extension, "aif") != 0 && strcmp(extension, "aiff") != 0))
+		{
+			FATAL_ERROR("Batch input file must be .aif: '%s'\n", files[i]);
+		}
+	}
+
+	// The table is shared by all workers, so fill it in before they start.
+	if (compress)
+	{
+		init_delta_index_table();
+	}
+
+	if (num_threads > num_files)
+	{
+		num_threads = num_files;
+	}
+
+	pthread_t *threads = malloc(num_threads * sizeof(pthread_t));
+
+	for (int i = 0; i < num_threads; i++)
+	{
+		if (pthread_create(&threads[i], NULL, batch_worker, &state) != 0)
+		{
+			FATAL_ERROR("Failed to create worker thread!\n");
+		}
+	}
+
+	for (int i = 0; i < num_threads; i++)
+	{
+		pthread_join(threads[i], NULL);
+	}
+
+	free(threads);
+	pthread_mutex_destroy(&state.lock);
+}
+
+int get_default_num_threads(void)
+{
+#ifdef _SC_NPROCESSORS_ONLN
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+	if (count > 0)
+	{
+		return count;
+	}
+#endif
+	return 4;
+}
+
 void usage(void)
 {
 	fprintf(stderr, "Usage: aif2pcm bin_file [aif_file]\n");
 	fprintf(stderr, "       aif2pcm aif_file [bin_file] [--compress]\n");
+	fprintf(stderr, "       aif2pcm --batch [--compress] [-j num_threads] aif_file...\n");
+}
+
+int batch_main(int argc, char **argv)
+{
+	bool compressed = false;
+	int num_threads = get_default_num_threads();
+	int i;
+
+	for (i = 0; i < argc && argv[i][0] == '-'; i++)
+	{
+		if (strcmp(argv[i], "--compress") == 0)
+		{
+			compressed = true;
+		}
+		else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+		{
+			num_threads = atoi(argv[++i]);
+			if (num_threads < 1)
+			{
+				FATAL_ERROR("Invalid thread count '%s'\n", argv[i]);
+			}
+		}
+		else
+		{
+			usage();
+			exit(1);
+		}
+	}
+
+	if (i < argc)
+	{
+		aif2pcm_batch(argv + i, argc - i, compressed, num_threads);
+	}
+
+	return 0;
 }
 
 int main(int argc, char **argv)
 {
+	TraceInit("aif2pcm", argc, argv);
+
 	if (argc < 2)
 	{
 		usage();
 		exit(1);
 	}
 
+	if (strcmp(argv[1], "--batch") == 0)
+	{
+		return batch_main(argc - 2, argv + 2);
+	}
+
 	char *input_file = argv[1];
 	char *extension = get_file_extension(input_file);
 	char *output_file;
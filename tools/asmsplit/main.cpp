@@ -0,0 +1,612 @@
+// Splits a large data assembly file into several files that can be assembled
+// in parallel and linked back together in order.
+//
+//   asmsplit INPUT.s OUTPUT_PREFIX COUNT
+//
+// writes OUTPUT_PREFIX_0.s ... OUTPUT_PREFIX_<COUNT-1>.s. Each part starts with
+// INPUT's preamble (everything up to its first .section directive), followed by
+// a run of its body with the .include directives expanded where a part boundary
+// falls inside an included file. Files are only rewritten when they change.
+//
+// Linking the parts in order gives the same bytes as the original file, since:
+//  - a part that starts in the middle of the original layout contains no
+//    alignment directives, or starts with one, so the linker's alignment of the
+//    part's section doesn't add padding the original didn't have;
+//  - local labels that are used from other parts are made global;
+//  - .set/.equ symbols and macros defined in the body are repeated in the later
+//    parts that use them.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+struct Line
+{
+    std::string text;
+    std::string code;      // the text without its comment
+    int depth;             // .if/.macro/.rept nesting before this line
+    bool isAlign;
+    std::string label;     // label defined at the start of the line, if any
+    bool isLocalLabel;
+    std::string setSymbol; // symbol defined by .set/.equ, if any
+    std::string macroName; // macro whose definition starts here, if any
+    int macroEnd;          // index after the matching .endm
+};
+
+struct IncludeSpan
+{
+    std::string path;
+    int start;
+    int end;
+};
+
+struct Part
+{
+    int start;
+    int end;
+};
+
+static std::vector<std::string> ReadLines(const std::string& path)
+{
+    std::ifstream file(path);
+
+    if (!file.is_open())
+        FATAL_ERROR("error: failed to open \"%s\" for reading\n", path.c_str());
+
+    std::vector<std::string> lines;
+    std::string line;
+
+    while (std::getline(file, line))
+        lines.push_back(line);
+
+    return lines;
+}
+
+static bool IsIdentChar(char c)
+{
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_' || c == '.' || c == '$';
+}
+
+static bool IsIdentStart(char c)
+{
+    return IsIdentChar(c) && !(c >= '0' && c <= '9');
+}
+
+// Removes the comment and blanks out string literals, which can't contain symbols.
+static std::string StripLine(const std::string& text)
+{
+    std::string code;
+    bool inString = false;
+
+    for (std::size_t i = 0; i < text.size(); i++)
+    {
+        char c = text[i];
+
+        if (inString)
+        {
+            if (c == '\\' && i + 1 < text.size())
+                i++;
+            else if (c == '"')
+                inString = false;
+            code += ' ';
+        }
+        else if (c == '"')
+        {
+            inString = true;
+            code += ' ';
+        }
+        else if (c == '@')
+        {
+            break;
+        }
+        else
+        {
+            code += c;
+        }
+    }
+
+    return code;
+}
+
+static std::vector<std::string> GetTokens(const std::string& code)
+{
+    std::vector<std::string> tokens;
+    std::size_t i = 0;
+
+    while (i < code.size())
+    {
+        if (IsIdentStart(code[i]) && (i == 0 || !IsIdentChar(code[i - 1])))
+        {
+            std::size_t start = i;
+
+            while (i < code.size() && IsIdentChar(code[i]))
+                i++;
+
+            tokens.push_back(code.substr(start, i - start));
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    return tokens;
+}
+
+static std::string FirstWord(const std::string& code)
+{
+    std::size_t start = code.find_first_not_of(" \t");
+
+    if (start == std::string::npos)
+        return "";
+
+    std::size_t end = start;
+
+    while (end < code.size() && (IsIdentChar(code[end]) || code[end] == '#'))
+        end++;
+
+    return code.substr(start, end - start);
+}
+
+static bool IsAlignDirective(const std::string& word)
+{
+    return word == ".align" || word == ".balign" || word == ".p2align";
+}
+
+// Finds the macros that emit alignment directives, so that uses of them
+// count as alignment too.
+static void FindAlignMacros(const std::vector<std::string>& lines, std::set<std::string>& alignMacros)
+{
+    std::string macro;
+
+    for (const std::string& text : lines)
+    {
+        std::string code = StripLine(text);
+        std::string word = FirstWord(code);
+
+        if (word == ".macro")
+        {
+            std::vector<std::string> tokens = GetTokens(code);
+            macro = tokens.size() > 1 ? tokens[1] : "";
+        }
+        else if (word == ".endm")
+        {
+            macro = "";
+        }
+        else if (!macro.empty() && (IsAlignDirective(word) || alignMacros.count(word)))
+        {
+            alignMacros.insert(macro);
+        }
+    }
+}
+
+// Minimum of a range of values, for finding the best place to end a part.
+class MinTree
+{
+public:
+    static const int None = 0x7FFFFFFF;
+
+    MinTree(int size) : m_size(size), m_nodes(2 * size, { None, 0 }) {}
+
+    int Get(int index) const { return m_nodes[index + m_size].first; }
+
+    void Set(int index, int value)
+    {
+        index += m_size;
+        m_nodes[index] = { value, -(index - m_size) };
+
+        for (index /= 2; index >= 1; index /= 2)
+            m_nodes[index] = std::min(m_nodes[2 * index], m_nodes[2 * index + 1]);
+    }
+
+    // Returns the smallest value from first to last inclusive, and in
+    // position where it is, preferring later positions.
+    int Min(int first, int last, int& position) const
+    {
+        std::pair<int, int> best = { None, 0 };
+
+        for (first += m_size, last += m_size + 1; first < last; first /= 2, last /= 2)
+        {
+            if (first & 1)
+                best = std::min(best, m_nodes[first++]);
+            if (last & 1)
+                best = std::min(best, m_nodes[--last]);
+        }
+
+        position = -best.second;
+        return best.first;
+    }
+private:
+    int m_size;
+    std::vector<std::pair<int, int>> m_nodes;
+};
+
+class Splitter
+{
+public:
+    Splitter(std::string inputPath);
+    void Split(int count);
+    void WriteParts(std::string prefix);
+private:
+    void AddFile(const std::string& path, const std::vector<std::string>& lines, std::size_t begin);
+    void AnalyzeLines();
+    std::vector<Part> SplitWithLimit(int maxLength) const;
+    std::string PartText(int index) const;
+    void AppendBody(std::ostringstream& out, int start, int end) const;
+
+    std::string m_inputPath;
+    std::vector<std::string> m_preamble;
+    std::vector<Line> m_lines;
+    std::vector<IncludeSpan> m_includes;
+    std::set<std::string> m_alignMacros;
+    std::vector<int> m_nextAlign;
+    std::vector<Part> m_parts;
+};
+
+Splitter::Splitter(std::string inputPath) : m_inputPath(inputPath)
+{
+    std::vector<std::string> lines = ReadLines(inputPath);
+    std::size_t bodyStart = lines.size();
+
+    for (std::size_t i = 0; i < lines.size(); i++)
+    {
+        std::string code = StripLine(lines[i]);
+        std::string word = FirstWord(code);
+
+        if (word == ".include")
+        {
+            std::size_t quote = lines[i].find('"');
+            std::size_t endQuote = lines[i].find('"', quote + 1);
+            if (quote != std::string::npos && endQuote != std::string::npos)
+                FindAlignMacros(ReadLines(lines[i].substr(quote + 1, endQuote - quote - 1)), m_alignMacros);
+        }
+
+        if (word == ".section")
+        {
+            bodyStart = i + 1;
+            break;
+        }
+    }
+
+    if (bodyStart == lines.size())
+        FATAL_ERROR("error: no .section directive found in \"%s\"\n", inputPath.c_str());
+
+    m_preamble.assign(lines.begin(), lines.begin() + bodyStart);
+    AddFile(inputPath, lines, bodyStart);
+    AnalyzeLines();
+}
+
+void Splitter::AddFile(const std::string& path, const std::vector<std::string>& lines, std::size_t begin)
+{
+    for (std::size_t i = begin; i < lines.size(); i++)
+    {
+        std::string code = StripLine(lines[i]);
+
+        if (FirstWord(code) == ".include")
+        {
+            std::size_t quote = lines[i].find('"');
+            std::size_t endQuote = lines[i].find('"', quote + 1);
+
+            if (quote == std::string::npos || endQuote == std::string::npos)
+                FATAL_ERROR("%s:%zu: error: bad .include directive\n", path.c_str(), i + 1);
+
+            std::string includePath = lines[i].substr(quote + 1, endQuote - quote - 1);
+            IncludeSpan span = { includePath, static_cast<int>(m_lines.size()), 0 };
+            std::size_t spanIndex = m_includes.size();
+
+            m_includes.push_back(span);
+            AddFile(includePath, ReadLines(includePath), 0);
+            m_includes[spanIndex].end = m_lines.size();
+        }
+        else
+        {
+            Line line = {};
+            line.text = lines[i];
+            line.code = code;
+            m_lines.push_back(line);
+        }
+    }
+}
+
+void Splitter::AnalyzeLines()
+{
+    int depth = 0;
+    std::vector<int> openMacros;
+
+    for (std::size_t i = 0; i < m_lines.size(); i++)
+    {
+        Line& line = m_lines[i];
+        std::string word = FirstWord(line.code);
+        std::vector<std::string> tokens = GetTokens(line.code);
+
+        line.depth = depth;
+        line.isAlign = IsAlignDirective(word) || m_alignMacros.count(word);
+
+        std::size_t start = line.code.find_first_not_of(" \t");
+
+        if (start != std::string::npos && IsIdentStart(line.code[start]))
+        {
+            std::size_t end = start;
+
+            while (end < line.code.size() && IsIdentChar(line.code[end]))
+                end++;
+
+            if (end < line.code.size() && line.code[end] == ':')
+            {
+                line.label = line.code.substr(start, end - start);
+                line.isLocalLabel = !(end + 1 < line.code.size() && line.code[end + 1] == ':');
+                word = FirstWord(line.code.substr(end + 1 + !line.isLocalLabel));
+                line.isAlign = line.isAlign || IsAlignDirective(word) || m_alignMacros.count(word);
+            }
+        }
+
+        if ((word == ".set" || word == ".equ") && tokens.size() > 1 && depth == 0)
+            line.setSymbol = tokens[1];
+
+        if (word == ".macro" || word == "#if" || word == "#ifdef" || word == "#ifndef" || word == ".rept"
+         || word == ".irp" || word == ".irpc" || word.compare(0, 3, ".if") == 0)
+        {
+            if (word == ".macro")
+            {
+                if (tokens.size() > 1 && depth == 0)
+                    line.macroName = tokens[1];
+                openMacros.push_back(i);
+            }
+            depth++;
+        }
+        else if (word == ".endm" || word == ".endif" || word == ".endr" || word == "#endif")
+        {
+            if (word == ".endm" && !openMacros.empty())
+            {
+                m_lines[openMacros.back()].macroEnd = i + 1;
+                openMacros.pop_back();
+            }
+            depth--;
+        }
+    }
+
+    if (depth != 0)
+        FATAL_ERROR("error: unbalanced conditional or macro in \"%s\"\n", m_inputPath.c_str());
+
+    // m_nextAlign[i] is the first line at or after i that aligns.
+    m_nextAlign.assign(m_lines.size() + 1, m_lines.size());
+
+    for (int i = m_lines.size() - 1; i >= 0; i--)
+        m_nextAlign[i] = m_lines[i].isAlign ? i : m_nextAlign[i + 1];
+}
+
+// Splits the body into as few parts as possible with none longer than
+// maxLength lines. A part after the first may start anywhere if it contains
+// no alignment, and otherwise has to start with an alignment directive.
+std::vector<Part> Splitter::SplitWithLimit(int maxLength) const
+{
+    int size = m_lines.size();
+    MinTree partsNeeded(size + 1);
+    std::vector<int> partEnd(size + 1, size);
+
+    partsNeeded.Set(size, 0);
+
+    for (int i = size - 1; i >= 0; i--)
+    {
+        if (i != 0 && m_lines[i].depth != 0)
+            continue;
+
+        int limit = std::min(size, i + maxLength);
+
+        if (i != 0 && !m_lines[i].isAlign)
+            limit = std::min(limit, m_nextAlign[i]);
+
+        int end;
+        int count = partsNeeded.Min(i + 1, limit, end);
+
+        if (count != MinTree::None)
+        {
+            partsNeeded.Set(i, count + 1);
+            partEnd[i] = end;
+        }
+    }
+
+    std::vector<Part> parts;
+
+    if (partsNeeded.Get(0) == MinTree::None)
+        return parts;
+
+    for (int start = 0; start < size; start = partEnd[start])
+        parts.push_back({ start, partEnd[start] });
+
+    return parts;
+}
+
+void Splitter::Split(int count)
+{
+    int size = m_lines.size();
+    int low = std::max(1, (size + count - 1) / count);
+    int high = std::max(1, size);
+
+    // The whole body always fits in one part, so search for the smallest
+    // limit that needs no more than count parts.
+    while (low < high)
+    {
+        int mid = low + (high - low) / 2;
+        std::vector<Part> parts = SplitWithLimit(mid);
+
+        if (!parts.empty() && static_cast<int>(parts.size()) <= count)
+            high = mid;
+        else
+            low = mid + 1;
+    }
+
+    m_parts = SplitWithLimit(low);
+
+    while (static_cast<int>(m_parts.size()) < count)
+        m_parts.push_back({ size, size });
+}
+
+// Writes the lines from start to end, keeping .include directives for the
+// files that lie wholly inside the range.
+void Splitter::AppendBody(std::ostringstream& out, int start, int end) const
+{
+    std::size_t include = 0;
+    int i = start;
+
+    while (i < end)
+    {
+        while (include < m_includes.size() && m_includes[include].start < i)
+            include++;
+
+        // The outermost include that starts here comes first.
+        if (include < m_includes.size() && m_includes[include].start == i && m_includes[include].end <= end
+         && m_includes[include].end > i)
+        {
+            out << "\t.include \"" << m_includes[include].path << "\"\n";
+            i = m_includes[include].end;
+            continue;
+        }
+
+        out << m_lines[i].text << "\n";
+        i++;
+    }
+}
+
+std::string Splitter::PartText(int index) const
+{
+    const Part& part = m_parts[index];
+    std::map<std::string, int> labelPart;
+    std::set<std::string> usedHere;
+    std::set<std::string> usedElsewhere;
+
+    for (int p = 0; p < static_cast<int>(m_parts.size()); p++)
+    {
+        for (int i = m_parts[p].start; i < m_parts[p].end; i++)
+        {
+            const Line& line = m_lines[i];
+
+            if (!line.label.empty() && line.isLocalLabel)
+                labelPart[line.label] = p;
+
+            for (const std::string& token : GetTokens(line.code))
+            {
+                if (p == index)
+                    usedHere.insert(token);
+                else
+                    usedElsewhere.insert(token);
+            }
+        }
+    }
+
+    std::ostringstream out;
+
+    out << "@ Part " << index + 1 << " of " << m_parts.size() << " of " << m_inputPath
+        << ", generated by asmsplit. Do not edit.\n";
+
+    for (const std::string& line : m_preamble)
+        out << line << "\n";
+
+    // Local labels defined here and used by another part.
+    for (const auto& entry : labelPart)
+    {
+        if (entry.second == index && usedElsewhere.count(entry.first))
+            out << "\t.global " << entry.first << "\n";
+    }
+
+    // Symbols and macros from earlier parts, as last defined before this part.
+    std::map<std::string, int> lastSet;
+    std::map<std::string, int> lastMacro;
+
+    for (int i = 0; i < part.start; i++)
+    {
+        if (!m_lines[i].setSymbol.empty())
+            lastSet[m_lines[i].setSymbol] = i;
+        if (!m_lines[i].macroName.empty())
+            lastMacro[m_lines[i].macroName] = i;
+    }
+
+    std::set<std::string> macrosHere;
+
+    for (int i = part.start; i < part.end; i++)
+    {
+        if (!m_lines[i].macroName.empty())
+            macrosHere.insert(m_lines[i].macroName);
+    }
+
+    // Macros can't be redefined, so they're only repeated if this part
+    // doesn't define them itself.
+    for (const auto& entry : lastMacro)
+    {
+        if (usedHere.count(entry.first) && !macrosHere.count(entry.first))
+        {
+            for (int i = entry.second; i < m_lines[entry.second].macroEnd; i++)
+                out << m_lines[i].text << "\n";
+        }
+    }
+
+    for (const auto& entry : lastSet)
+    {
+        if (usedHere.count(entry.first))
+            out << m_lines[entry.second].text << "\n";
+    }
+
+    AppendBody(out, part.start, part.end);
+    return out.str();
+}
+
+void Splitter::WriteParts(std::string prefix)
+{
+    for (int i = 0; i < static_cast<int>(m_parts.size()); i++)
+    {
+        std::string path = prefix + "_" + std::to_string(i) + ".s";
+        std::string text = PartText(i);
+        std::ifstream existing(path, std::ios::binary);
+
+        if (existing.is_open())
+        {
+            std::ostringstream contents;
+            contents << existing.rdbuf();
+
+            // Leave unchanged parts alone so that they aren't reassembled.
+            if (contents.str() == text)
+                continue;
+        }
+
+        std::ofstream file(path, std::ios::binary);
+
+        if (!file.is_open())
+            FATAL_ERROR("error: failed to open \"%s\" for writing\n", path.c_str());
+
+        file << text;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 4)
+    {
+        std::fprintf(stderr, "Usage: asmsplit INPUT.s OUTPUT_PREFIX COUNT\n");
+        return 1;
+    }
+
+    int count = std::atoi(argv[3]);
+
+    if (count < 1)
+        FATAL_ERROR("error: COUNT must be at least 1\n");
+
+    Splitter splitter(argv[1]);
+    splitter.Split(count);
+    splitter.WriteParts(argv[2]);
+
+    return 0;
+}
@@ -0,0 +1,640 @@
+// assetd keeps the asset converters resident between jobs. The server
+// listens on a Unix domain socket; the client is what the Makefile runs in
+// place of each tool, and it runs the tool directly whenever no server is
+// listening.
+//
+// Every job runs in a child forked from the server. The converters report
+// errors by calling exit() and keep their state in globals, so this gives
+// each job the same clean slate as a fresh process, minus the exec and the
+// dynamic linking. Jobs also get the client's environment, so settings such
+// as TOOLS_TRACE follow the build rather than the server. Shared inputs that a job parsed successfully (charmap.txt
+// for preproc, layouts.json for mapjson) are then parsed once more by the
+// server itself, and later children inherit the parsed copy.
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "assetd.h"
+#include "../preproc/charmap.h"
+#include "../mapjson/json11.h"
+
+extern char **environ;
+extern Charmap *g_charmap;
+extern const json11::Json *cached_layouts_data;
+
+// A parsed copy of a file, valid as long as the file is unchanged.
+struct FileStamp
+{
+    dev_t dev;
+    ino_t ino;
+    off_t size;
+    time_t mtime;
+    long mtimeNsec;
+
+    bool operator==(const FileStamp& other) const
+    {
+        return dev == other.dev && ino == other.ino && size == other.size
+            && mtime == other.mtime && mtimeNsec == other.mtimeNsec;
+    }
+};
+
+struct CacheEntry
+{
+    FileStamp stamp;
+    void *value;
+};
+
+struct HostedTool
+{
+    const char *name;
+    int (*main)(int argc, char **argv);
+    // Returns the shared input a job reads, if the tool caches one.
+    std::string (*sharedInput)(const std::vector<std::string>& args);
+    // Parses the shared input in the server. Returns nullptr on failure.
+    void *(*load)(const std::string& path);
+    // Hands a parsed copy to the tool, in the child.
+    void (*use)(void *value);
+};
+
+static std::string NoSharedInput(const std::vector<std::string>&)
+{
+    return std::string();
+}
+
+static std::string PreprocSharedInput(const std::vector<std::string>& args)
+{
+    return args.size() == 3 ? args[2] : std::string();
+}
+
+static void *LoadCharmap(const std::string& path)
+{
+    return new Charmap(path);
+}
+
+static void UseCharmap(void *value)
+{
+    g_charmap = static_cast<Charmap *>(value);
+}
+
+static std::string MapjsonSharedInput(const std::vector<std::string>& args)
+{
+    return (args.size() == 5 && args[1] == "map") ? args[4] : std::string();
+}
+
+static void *LoadLayouts(const std::string& path)
+{
+    std::ifstream file(path);
+
+    if (!file.is_open())
+        return nullptr;
+
+    std::stringstream text;
+    text << file.rdbuf();
+
+    std::string err;
+    json11::Json layouts = json11::Json::parse(text.str(), err);
+
+    if (layouts == json11::Json())
+        return nullptr;
+
+    return new json11::Json(layouts);
+}
+
+static void UseLayouts(void *value)
+{
+    cached_layouts_data = static_cast<const json11::Json *>(value);
+}
+
+static const HostedTool s_tools[] = {
+    { "gbagfx", gbagfx_main, NoSharedInput, nullptr, nullptr },
+    { "aif2pcm", aif2pcm_main, NoSharedInput, nullptr, nullptr },
+    { "mid2agb", mid2agb_main, NoSharedInput, nullptr, nullptr },
+    { "mapjson", mapjson_main, MapjsonSharedInput, LoadLayouts, UseLayouts },
+    { "jsonproc", jsonproc_main, NoSharedInput, nullptr, nullptr },
+    { "preproc", preproc_main, PreprocSharedInput, LoadCharmap, UseCharmap },
+};
+
+// Guards the cache and the set of open descriptors. It is held across
+// fork() so that a child never sees either half-updated.
+static std::mutex s_lock;
+static std::map<std::string, CacheEntry> s_cache;
+static std::set<int> s_openFds;
+
+static const HostedTool *FindTool(std::string path)
+{
+    std::size_t slash = path.find_last_of('/');
+
+    if (slash != std::string::npos)
+        path = path.substr(slash + 1);
+
+    if (path.size() > 4 && path.compare(path.size() - 4, 4, ".exe") == 0)
+        path = path.substr(0, path.size() - 4);
+
+    for (const HostedTool& tool : s_tools)
+    {
+        if (path == tool.name)
+            return &tool;
+    }
+
+    return nullptr;
+}
+
+static bool GetFileStamp(const std::string& path, FileStamp& stamp)
+{
+    struct stat st;
+
+    if (stat(path.c_str(), &st) != 0)
+        return false;
+
+    stamp.dev = st.st_dev;
+    stamp.ino = st.st_ino;
+    stamp.size = st.st_size;
+#ifdef __APPLE__
+    stamp.mtime = st.st_mtimespec.tv_sec;
+    stamp.mtimeNsec = st.st_mtimespec.tv_nsec;
+#else
+    stamp.mtime = st.st_mtim.tv_sec;
+    stamp.mtimeNsec = st.st_mtim.tv_nsec;
+#endif
+    return true;
+}
+
+static void InitSocketAddress(struct sockaddr_un& addr, const char *socketPath)
+{
+    if (std::strlen(socketPath) >= sizeof(addr.sun_path))
+        FATAL_ERROR("error: socket path \"%s\" is too long\n", socketPath);
+
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    std::strcpy(addr.sun_path, socketPath);
+}
+
+static bool WriteAll(int fd, const void *data, std::size_t size)
+{
+    const char *p = static_cast<const char *>(data);
+
+    while (size > 0)
+    {
+        ssize_t count = write(fd, p, size);
+
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0)
+            return false;
+
+        p += count;
+        size -= count;
+    }
+
+    return true;
+}
+
+static bool ReadAll(int fd, void *data, std::size_t size)
+{
+    char *p = static_cast<char *>(data);
+
+    while (size > 0)
+    {
+        ssize_t count = read(fd, p, size);
+
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0)
+            return false;
+
+        p += count;
+        size -= count;
+    }
+
+    return true;
+}
+
+// Requests are a 32-bit length followed by NUL-terminated strings: the
+// command, the client's working directory, the number of environment
+// variables, the client's environment and then the tool's argv. A "run"
+// request carries the client's stdin, stdout and stderr with the length.
+// The reply is the job's exit status as a 32-bit integer.
+static bool SendRequest(int sock, const std::vector<std::string>& strings, bool passStdio)
+{
+    std::string payload;
+
+    for (const std::string& s : strings)
+    {
+        payload += s;
+        payload += '\0';
+    }
+
+    std::uint32_t length = payload.size();
+    struct iovec iov = { &length, sizeof(length) };
+    struct msghdr msg;
+    int fds[3] = { STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO };
+    char control[CMSG_SPACE(sizeof(fds))];
+
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+
+    if (passStdio)
+    {
+        std::memset(control, 0, sizeof(control));
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+        std::memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+    }
+
+    if (sendmsg(sock, &msg, 0) != sizeof(length))
+        return false;
+
+    return WriteAll(sock, payload.data(), payload.size());
+}
+
+static bool ReceiveRequest(int sock, std::vector<std::string>& strings, std::vector<int>& fds)
+{
+    std::uint32_t length;
+    struct iovec iov = { &length, sizeof(length) };
+    struct msghdr msg;
+    char control[CMSG_SPACE(3 * sizeof(int))];
+
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    if (recvmsg(sock, &msg, MSG_WAITALL) != sizeof(length))
+        return false;
+
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS)
+        {
+            std::size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+            std::vector<int> received(count);
+
+            std::memcpy(received.data(), CMSG_DATA(cmsg), count * sizeof(int));
+            fds.insert(fds.end(), received.begin(), received.end());
+        }
+    }
+
+    if (length > (1u << 24))
+        return false;
+
+    std::string payload(length, '\0');
+
+    if (!ReadAll(sock, &payload[0], length))
+        return false;
+
+    std::size_t pos = 0;
+
+    while (pos < payload.size())
+    {
+        std::size_t end = payload.find('\0', pos);
+
+        if (end == std::string::npos)
+            return false;
+
+        strings.push_back(payload.substr(pos, end - pos));
+        pos = end + 1;
+    }
+
+    return true;
+}
+
+static void RunInChild(const HostedTool *tool, const std::string& cwd, std::vector<std::string>& env,
+    std::vector<std::string>& args, const std::vector<int>& fds, void *cachedValue)
+{
+    for (int i = 0; i < 3; i++)
+        dup2(fds[i], i);
+
+    for (int fd : s_openFds)
+        close(fd);
+
+    for (int fd : fds)
+        close(fd);
+
+    if (chdir(cwd.c_str()) != 0)
+    {
+        std::fprintf(stderr, "assetd: failed to change directory to \"%s\"\n", cwd.c_str());
+        _exit(127);
+    }
+
+    signal(SIGPIPE, SIG_DFL);
+
+    std::vector<char *> envp;
+
+    for (std::string& var : env)
+        envp.push_back(&var[0]);
+    envp.push_back(nullptr);
+    environ = envp.data();
+
+    if (cachedValue != nullptr)
+        tool->use(cachedValue);
+
+    std::vector<char *> argv;
+
+    for (std::string& arg : args)
+        argv.push_back(&arg[0]);
+    argv.push_back(nullptr);
+
+    std::exit(tool->main(args.size(), argv.data()));
+}
+
+static int RunJob(const std::string& cwd, std::vector<std::string>& env, std::vector<std::string>& args,
+    const std::vector<int>& fds)
+{
+    const HostedTool *tool = FindTool(args[0]);
+
+    if (tool == nullptr || fds.size() != 3)
+    {
+        const char *message = "assetd: bad request\n";
+
+        if (fds.size() == 3)
+            WriteAll(fds[2], message, std::strlen(message));
+        return 127;
+    }
+
+    std::string input = tool->sharedInput(args);
+
+    if (!input.empty() && input[0] != '/')
+        input = cwd + "/" + input;
+
+    FileStamp stamp = {};
+    bool haveStamp = !input.empty() && GetFileStamp(input, stamp);
+    void *cachedValue = nullptr;
+    pid_t pid;
+
+    {
+        std::lock_guard<std::mutex> lock(s_lock);
+
+        if (haveStamp)
+        {
+            auto it = s_cache.find(input);
+
+            if (it != s_cache.end() && it->second.stamp == stamp)
+                cachedValue = it->second.value;
+        }
+
+        pid = fork();
+
+        if (pid == 0)
+            RunInChild(tool, cwd, env, args, fds, cachedValue);
+    }
+
+    if (pid < 0)
+        return 127;
+
+    int status;
+
+    while (waitpid(pid, &status, 0) < 0)
+    {
+        if (errno != EINTR)
+            return 127;
+    }
+
+    int exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+
+    // The job accepted the file, so it's safe for the server to parse it.
+    // Older parsed copies are kept, since a running child may share them.
+    if (exitCode == 0 && haveStamp && cachedValue == nullptr && tool->load != nullptr)
+    {
+        FileStamp after;
+
+        if (GetFileStamp(input, after) && after == stamp)
+        {
+            void *value = tool->load(input);
+
+            if (value != nullptr)
+            {
+                std::lock_guard<std::mutex> lock(s_lock);
+                s_cache[input] = { stamp, value };
+            }
+        }
+    }
+
+    return exitCode;
+}
+
+static void ServeConnection(int conn, std::string socketPath)
+{
+    std::vector<std::string> strings;
+    std::vector<int> fds;
+    bool ok = ReceiveRequest(conn, strings, fds);
+
+    {
+        std::lock_guard<std::mutex> lock(s_lock);
+        s_openFds.insert(fds.begin(), fds.end());
+    }
+
+    if (ok && strings.size() == 1 && strings[0] == "stop")
+    {
+        unlink(socketPath.c_str());
+        std::exit(0);
+    }
+
+    if (ok && strings.size() >= 4 && strings[0] == "run")
+    {
+        std::size_t envCount = std::strtoul(strings[2].c_str(), nullptr, 10);
+
+        // There has to be at least the tool's name after the environment.
+        if (envCount < strings.size() - 3)
+        {
+            std::string cwd = strings[1];
+            std::vector<std::string> env(strings.begin() + 3, strings.begin() + 3 + envCount);
+            std::vector<std::string> args(strings.begin() + 3 + envCount, strings.end());
+            std::int32_t exitCode = RunJob(cwd, env, args, fds);
+            WriteAll(conn, &exitCode, sizeof(exitCode));
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(s_lock);
+
+    for (int fd : fds)
+    {
+        s_openFds.erase(fd);
+        close(fd);
+    }
+
+    s_openFds.erase(conn);
+    close(conn);
+}
+
+static int ConnectToServer(const char *socketPath)
+{
+    struct sockaddr_un addr;
+    InitSocketAddress(addr, socketPath);
+
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (sock < 0)
+        return -1;
+
+    if (connect(sock, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0)
+    {
+        close(sock);
+        return -1;
+    }
+
+    return sock;
+}
+
+static int Serve(const char *socketPath)
+{
+    int existing = ConnectToServer(socketPath);
+
+    if (existing >= 0)
+        FATAL_ERROR("error: a server is already listening on \"%s\"\n", socketPath);
+
+    // Nothing answered, so any socket file left behind is stale.
+    unlink(socketPath);
+
+    struct sockaddr_un addr;
+    InitSocketAddress(addr, socketPath);
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (listener < 0)
+        FATAL_ERROR("error: failed to create socket\n");
+
+    if (bind(listener, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0)
+        FATAL_ERROR("error: failed to bind \"%s\": %s\n", socketPath, std::strerror(errno));
+
+    if (listen(listener, 64) != 0)
+        FATAL_ERROR("error: failed to listen on \"%s\"\n", socketPath);
+
+    signal(SIGPIPE, SIG_IGN);
+    s_openFds.insert(listener);
+
+    for (;;)
+    {
+        int conn = accept(listener, nullptr, nullptr);
+
+        if (conn < 0)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            FATAL_ERROR("error: accept failed: %s\n", std::strerror(errno));
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(s_lock);
+            s_openFds.insert(conn);
+        }
+
+        std::thread(ServeConnection, conn, std::string(socketPath)).detach();
+    }
+}
+
+static int Stop(const char *socketPath)
+{
+    int sock = ConnectToServer(socketPath);
+
+    if (sock < 0)
+        FATAL_ERROR("error: no server is listening on \"%s\"\n", socketPath);
+
+    if (!SendRequest(sock, { "stop" }, false))
+        FATAL_ERROR("error: failed to send request to \"%s\"\n", socketPath);
+
+    // The server closes the connection as it exits.
+    char c;
+    while (read(sock, &c, 1) > 0)
+        ;
+
+    close(sock);
+    return 0;
+}
+
+static int RunDirectly(char **argv)
+{
+    execv(argv[0], argv);
+    std::fprintf(stderr, "error: failed to run \"%s\": %s\n", argv[0], std::strerror(errno));
+    return 127;
+}
+
+static int Run(const char *socketPath, int argc, char **argv)
+{
+    if (FindTool(argv[0]) == nullptr)
+        return RunDirectly(argv);
+
+    int sock = ConnectToServer(socketPath);
+
+    if (sock < 0)
+        return RunDirectly(argv);
+
+    char cwd[4096];
+
+    if (getcwd(cwd, sizeof(cwd)) == nullptr)
+        FATAL_ERROR("error: failed to get the working directory\n");
+
+    std::size_t envCount = 0;
+
+    while (environ[envCount] != nullptr)
+        envCount++;
+
+    std::vector<std::string> strings = { "run", cwd, std::to_string(envCount) };
+    strings.insert(strings.end(), environ, environ + envCount);
+    strings.insert(strings.end(), argv, argv + argc);
+
+    std::int32_t exitCode;
+
+    // If the server goes away before replying, the job is simply run again
+    // here. The converters only ever rewrite their outputs, so that's safe.
+    if (!SendRequest(sock, strings, true) || !ReadAll(sock, &exitCode, sizeof(exitCode)))
+    {
+        close(sock);
+        return RunDirectly(argv);
+    }
+
+    close(sock);
+    return exitCode;
+}
+
+static void PrintUsage()
+{
+    std::fprintf(stderr,
+        "Usage: assetd serve SOCKET\n"
+        "       assetd stop SOCKET\n"
+        "       assetd run SOCKET TOOL [ARGS...]\n"
+        "\n"
+        "run passes the job to the server listening on SOCKET, or runs TOOL\n"
+        "itself if there is none.\n");
+    std::exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+        PrintUsage();
+
+    std::string command = argv[1];
+
+    if (command == "serve" && argc == 3)
+        return Serve(argv[2]);
+    else if (command == "stop" && argc == 3)
+        return Stop(argv[2]);
+    else if (command == "run" && argc >= 4)
+        return Run(argv[2], argc - 3, argv + 3);
+
+    PrintUsage();
+    return 1;
+}
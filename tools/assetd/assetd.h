@@ -0,0 +1,23 @@
+#ifndef ASSETD_H
+#define ASSETD_H
+
+#include <cstdio>
+#include <cstdlib>
+
+#define FATAL_ERROR(format, ...)                 \
+do                                               \
+{                                                \
+    std::fprintf(stderr, format, ##__VA_ARGS__); \
+    std::exit(1);                                \
+} while (0)
+
+// Entry points of the converters built into assetd. Each tool's main() is
+// compiled under one of these names; see the Makefile.
+extern "C" int gbagfx_main(int argc, char **argv);
+extern "C" int aif2pcm_main(int argc, char **argv);
+int mid2agb_main(int argc, char **argv);
+int mapjson_main(int argc, char **argv);
+int jsonproc_main(int argc, char **argv);
+int preproc_main(int argc, char **argv);
+
+#endif // ASSETD_H
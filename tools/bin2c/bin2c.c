@@ -22,6 +22,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include "int_format.h"
 
 #ifdef _MSC_VER
 
@@ -69,25 +70,6 @@ unsigned char *ReadWholeFile(char *path, int *size)
     return buffer;
 }
 
-int ExtractData(unsigned char *buffer, int offset, int size)
-{
-    switch (size)
-    {
-    case 1:
-        return buffer[offset];
-    case 2:
-        return (buffer[offset + 1] << 8)
-             | buffer[offset];
-    case 4:
-        return (buffer[offset + 3] << 24)
-             | (buffer[offset + 2] << 16)
-             | (buffer[offset + 1] << 8)
-             | buffer[offset];
-    default:
-        FATAL_ERROR("Invalid size passed to ExtractData.\n");
-    }
-}
-
 int main(int argc, char **argv)
 {
     if (argc < 3)
@@ -96,12 +78,13 @@ int main(int argc, char **argv)
     int fileSize;
     unsigned char *buffer = ReadWholeFile(argv[1], &fileSize);
     char *var_name = argv[2];
-    int col = 1;
+    int col = 0;
     int pad = 0;
     int size = 1;
     bool isSigned = false;
     bool isStatic = false;
     bool isDecimal = false;
+    bool isString = false;
 
     for (int i = 3; i < argc; i++)
     {
@@ -148,6 +131,10 @@ int main(int argc, char **argv)
         {
             isDecimal = true;
         }
+        else if (!strcmp(argv[i], "-string"))
+        {
+            isString = true;
+        }
         else
         {
             FATAL_ERROR("Unrecognized option '%s'.\n", argv[i]);
@@ -157,6 +144,9 @@ int main(int argc, char **argv)
     if ((fileSize & (size - 1)) != 0)
         FATAL_ERROR("Size %d doesn't evenly divide file size %d.\n", size, fileSize);
 
+    if (isString && size != 1)
+        FATAL_ERROR("'-string' can only be used with a size of 1.\n");
+
     printf("// Generated file. Do not edit.\n\n");
 
     if (isStatic)
@@ -169,31 +159,30 @@ int main(int argc, char **argv)
     else
         printf("u%d ", 8 * size);
 
-    printf("%s[] =\n{", var_name);
-
-    int count = fileSize / size;
-    int offset = 0;
+    static struct TextBuffer output;
+    TextBufferInit(&output, stdout);
 
-    for (int i = 0; i < count; i++)
+    if (isString)
     {
-        if (i % col == 0)
-            printf("\n    ");
+        // The size is given so that the string's terminating null isn't included.
+        printf("%s[%d] =", var_name, fileSize);
+        WriteHexString(&output, buffer, fileSize, col);
+        TextBufferFlush(&output);
+        printf(";\n");
+        return 0;
+    }
 
-        int data = ExtractData(buffer, offset, size);
-        offset += size;
+    printf("%s[] =\n{", var_name);
 
-        if (isDecimal)
-        {
-            if (isSigned)
-                printf("%*d, ", pad, data);
-            else
-                printf("%*uu, ", pad, data);
-        }
-        else
-        {
-            printf("%#*xu, ", pad, data);
-        }
-    }
+    struct ArrayFormat format;
+    format.size = size;
+    format.style = isDecimal ? (isSigned ? INT_STYLE_SIGNED : INT_STYLE_UNSIGNED) : INT_STYLE_HEX;
+    format.width = pad;
+    format.columns = col > 0 ? col : 1;
+    format.separator = ", ";
+
+    WriteIntArray(&output, buffer, fileSize, &format);
+    TextBufferFlush(&output);
 
     printf("\n};\n");
 
@@ -0,0 +1,269 @@
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "int_format.h"
+
+// Longest text of one element: "-2147483648" or "0xffffffff", plus the 'u' suffix.
+#define MAX_ELEMENT_LENGTH 12
+
+#define LINE_START "\n    "
+
+#define MAX_STRING_COLUMNS 0x1000
+
+static const char sDecimalPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+#define HEX_ROW(high) \
+    high "0" high "1" high "2" high "3" high "4" high "5" high "6" high "7" \
+    high "8" high "9" high "a" high "b" high "c" high "d" high "e" high "f"
+
+static const char sHexPairs[] =
+    HEX_ROW("0") HEX_ROW("1") HEX_ROW("2") HEX_ROW("3")
+    HEX_ROW("4") HEX_ROW("5") HEX_ROW("6") HEX_ROW("7")
+    HEX_ROW("8") HEX_ROW("9") HEX_ROW("a") HEX_ROW("b")
+    HEX_ROW("c") HEX_ROW("d") HEX_ROW("e") HEX_ROW("f");
+
+void TextBufferInit(struct TextBuffer *buffer, FILE *fp)
+{
+    buffer->fp = fp;
+    buffer->length = 0;
+}
+
+void TextBufferFlush(struct TextBuffer *buffer)
+{
+    if (buffer->length != 0 && fwrite(buffer->data, buffer->length, 1, buffer->fp) != 1)
+    {
+        fprintf(stderr, "Failed to write output.\n");
+        exit(1);
+    }
+
+    buffer->length = 0;
+}
+
+// Returns space for at least size characters at the end of the buffer.
+static char *Reserve(struct TextBuffer *buffer, size_t size)
+{
+    if (TEXT_BUFFER_SIZE - buffer->length < size)
+        TextBufferFlush(buffer);
+
+    return buffer->data + buffer->length;
+}
+
+void TextBufferWrite(struct TextBuffer *buffer, const char *s, size_t length)
+{
+    while (length != 0)
+    {
+        size_t chunk = length < TEXT_BUFFER_SIZE ? length : TEXT_BUFFER_SIZE;
+        memcpy(Reserve(buffer, chunk), s, chunk);
+        buffer->length += chunk;
+        s += chunk;
+        length -= chunk;
+    }
+}
+
+static void WritePadding(struct TextBuffer *buffer, int count)
+{
+    static const char spaces[] = "                                ";
+
+    while (count > 0)
+    {
+        int chunk = count < (int)sizeof(spaces) - 1 ? count : (int)sizeof(spaces) - 1;
+        TextBufferWrite(buffer, spaces, chunk);
+        count -= chunk;
+    }
+}
+
+static char *FormatDecimal(char *dest, uint32_t value)
+{
+    char digits[10];
+    char *p = digits + sizeof(digits);
+
+    while (value >= 100)
+    {
+        const char *pair = &sDecimalPairs[(value % 100) * 2];
+        value /= 100;
+        *--p = pair[1];
+        *--p = pair[0];
+    }
+
+    if (value >= 10)
+    {
+        *--p = sDecimalPairs[value * 2 + 1];
+        *--p = sDecimalPairs[value * 2];
+    }
+    else
+    {
+        *--p = '0' + value;
+    }
+
+    size_t length = digits + sizeof(digits) - p;
+    memcpy(dest, p, length);
+    return dest + length;
+}
+
+static char *FormatHex(char *dest, uint32_t value)
+{
+    // printf's "%#x" leaves out the prefix for zero.
+    if (value == 0)
+    {
+        *dest++ = '0';
+        return dest;
+    }
+
+    *dest++ = '0';
+    *dest++ = 'x';
+
+    int shift = 24;
+
+    while (shift > 0 && (value >> shift) == 0)
+        shift -= 8;
+
+    const char *pair = &sHexPairs[((value >> shift) & 0xFF) * 2];
+
+    if (pair[0] != '0')
+        *dest++ = pair[0];
+    *dest++ = pair[1];
+
+    for (shift -= 8; shift >= 0; shift -= 8)
+    {
+        pair = &sHexPairs[((value >> shift) & 0xFF) * 2];
+        *dest++ = pair[0];
+        *dest++ = pair[1];
+    }
+
+    return dest;
+}
+
+static char *FormatElement(char *dest, uint32_t value, enum IntStyle style)
+{
+    switch (style)
+    {
+    case INT_STYLE_SIGNED:
+        if ((int32_t)value < 0)
+        {
+            *dest++ = '-';
+            value = 0u - value;
+        }
+        return FormatDecimal(dest, value);
+    case INT_STYLE_UNSIGNED:
+        dest = FormatDecimal(dest, value);
+        *dest++ = 'u';
+        return dest;
+    case INT_STYLE_HEX:
+        dest = FormatHex(dest, value);
+        *dest++ = 'u';
+        return dest;
+    }
+
+    return dest;
+}
+
+static uint32_t ReadElement(const unsigned char *data, int size)
+{
+    switch (size)
+    {
+    case 1:
+        return data[0];
+    case 2:
+        return data[0] | (data[1] << 8);
+    default:
+        return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24);
+    }
+}
+
+void WriteIntArray(struct TextBuffer *buffer, const unsigned char *data, size_t size, const struct ArrayFormat *format)
+{
+    size_t count = size / format->size;
+    size_t separatorLength = strlen(format->separator);
+    size_t maxLength = (sizeof(LINE_START) - 1) + MAX_ELEMENT_LENGTH + separatorLength;
+    bool padded = format->width > 0;
+    int column = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        char *start = Reserve(buffer, maxLength);
+        char *p = start;
+
+        if (format->columns > 0)
+        {
+            if (column == 0)
+            {
+                memcpy(p, LINE_START, sizeof(LINE_START) - 1);
+                p += sizeof(LINE_START) - 1;
+                column = format->columns;
+            }
+
+            column--;
+        }
+
+        uint32_t value = ReadElement(data + i * format->size, format->size);
+
+        if (padded)
+        {
+            // The padding goes before the number, so format it into a
+            // temporary copy first to find its length.
+            char text[MAX_ELEMENT_LENGTH];
+            char *end = FormatElement(text, value, format->style);
+            int numberLength = (end - text) - (format->style != INT_STYLE_SIGNED);
+
+            buffer->length += p - start;
+            WritePadding(buffer, format->width - numberLength);
+            TextBufferWrite(buffer, text, end - text);
+            TextBufferWrite(buffer, format->separator, separatorLength);
+            continue;
+        }
+
+        p = FormatElement(p, value, format->style);
+        memcpy(p, format->separator, separatorLength);
+        p += separatorLength;
+        buffer->length += p - start;
+    }
+}
+
+void WriteHexString(struct TextBuffer *buffer, const unsigned char *data, size_t size, int columns)
+{
+    if (columns <= 0)
+        columns = 16;
+
+    // A whole line has to fit in the buffer.
+    if (columns > MAX_STRING_COLUMNS)
+        columns = MAX_STRING_COLUMNS;
+
+    if (size == 0)
+    {
+        TextBufferWrite(buffer, LINE_START "\"\"", sizeof(LINE_START) + 1);
+        return;
+    }
+
+    for (size_t lineStart = 0; lineStart < size; lineStart += columns)
+    {
+        size_t lineEnd = lineStart + columns < size ? lineStart + columns : size;
+        char *start = Reserve(buffer, (sizeof(LINE_START) - 1) + 2 + 4 * columns);
+        char *p = start;
+
+        memcpy(p, LINE_START "\"", sizeof(LINE_START));
+        p += sizeof(LINE_START);
+
+        for (size_t i = lineStart; i < lineEnd; i++)
+        {
+            const char *pair = &sHexPairs[data[i] * 2];
+            p[0] = '\\';
+            p[1] = 'x';
+            p[2] = pair[0];
+            p[3] = pair[1];
+            p += 4;
+        }
+
+        *p++ = '"';
+        buffer->length += p - start;
+    }
+}
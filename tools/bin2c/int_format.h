@@ -0,0 +1,56 @@
+#ifndef INT_FORMAT_H
+#define INT_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Formatting of binary data as C array initializers, shared by bin2c and
+// preproc's INCBIN conversion. Numbers are formatted with lookup tables into
+// a large buffer instead of one printf call per element.
+
+#define TEXT_BUFFER_SIZE 0x10000
+
+struct TextBuffer
+{
+    FILE *fp;
+    size_t length;
+    char data[TEXT_BUFFER_SIZE];
+};
+
+enum IntStyle
+{
+    INT_STYLE_SIGNED,   // like printf's "%d"
+    INT_STYLE_UNSIGNED, // like printf's "%uu"
+    INT_STYLE_HEX,      // like printf's "%#xu"
+};
+
+struct ArrayFormat
+{
+    int size;              // bytes per element: 1, 2 or 4
+    enum IntStyle style;
+    int width;             // minimum field width, as in printf
+    int columns;           // elements per line, or 0 to not break lines
+    const char *separator; // written after every element
+};
+
+void TextBufferInit(struct TextBuffer *buffer, FILE *fp);
+void TextBufferWrite(struct TextBuffer *buffer, const char *s, size_t length);
+void TextBufferFlush(struct TextBuffer *buffer);
+
+// Writes the elements of data, which must be a multiple of format->size bytes long.
+void WriteIntArray(struct TextBuffer *buffer, const unsigned char *data, size_t size, const struct ArrayFormat *format);
+
+// Writes data as string literals of "\xNN" escapes, with columns bytes per line.
+// Like #embed, this is much faster for a compiler to read than a list of integers.
+void WriteHexString(struct TextBuffer *buffer, const unsigned char *data, size_t size, int columns);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // INT_FORMAT_H
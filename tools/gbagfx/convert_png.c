@@ -6,6 +6,7 @@
 #include "global.h"
 #include "convert_png.h"
 #include "gfx.h"
+#include "trace.h"
 
 static FILE *PngReadOpen(char *path, png_structp *pngStruct, png_infop *pngInfo)
 {
@@ -78,6 +79,7 @@ static unsigned char *ConvertBitDepth(unsigned char *src, int srcBitDepth, int d
 
 void ReadPng(char *path, struct Image *image)
 {
+    uint64_t traceStart = TraceBegin();
     png_structp png_ptr;
     png_infop info_ptr;
 
@@ -121,6 +123,7 @@ void ReadPng(char *path, struct Image *image)
 
     free(row_pointers);
     fclose(fp);
+    TraceEnd("read", traceStart, path);
 
     if (bit_depth != image->bitDepth && image->tilemap.data.affine == NULL)
     {
@@ -136,6 +139,7 @@ void ReadPng(char *path, struct Image *image)
 
 void ReadPngPalette(char *path, struct Palette *palette)
 {
+    uint64_t traceStart = TraceBegin();
     png_structp png_ptr;
     png_infop info_ptr;
     png_colorp colors;
@@ -162,6 +166,7 @@ void ReadPngPalette(char *path, struct Palette *palette)
     png_destroy_read_struct(&png_ptr, &info_ptr, NULL);
 
     fclose(fp);
+    TraceEnd("read", traceStart, path);
 }
 
 void SetPngPalette(png_structp png_ptr, png_infop info_ptr, struct Palette *palette)
@@ -184,6 +189,7 @@ void SetPngPalette(png_structp png_ptr, png_infop info_ptr, struct Palette *pale
 
 void WritePng(char *path, struct Image *image)
 {
+    uint64_t traceStart = TraceBegin();
     FILE *fp = fopen(path, "wb");
 
     if (fp == NULL)
@@ -248,4 +254,5 @@ void WritePng(char *path, struct Image *image)
 
     png_destroy_write_struct(&png_ptr, &info_ptr);
     free(row_pointers);
+    TraceEnd("write", traceStart, path);
 }
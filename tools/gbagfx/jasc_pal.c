@@ -5,6 +5,7 @@
 #include "global.h"
 #include "gfx.h"
 #include "util.h"
+#include "trace.h"
 
 // Read/write Paint Shop Pro palette files.
 
@@ -66,6 +67,7 @@ void ReadJascPaletteLine(FILE *fp, char *line)
 
 void ReadJascPalette(char *path, struct Palette *palette)
 {
+    uint64_t traceStart = TraceBegin();
     char line[MAX_LINE_LENGTH + 1];
 
     FILE *fp = fopen(path, "rb");
@@ -152,10 +154,12 @@ void ReadJascPalette(char *path, struct Palette *palette)
         FATAL_ERROR("Garbage after color data.\n");
 
     fclose(fp);
+    TraceEnd("read", traceStart, path);
 }
 
 void WriteJascPalette(char *path, struct Palette *palette)
 {
+    uint64_t traceStart = TraceBegin();
     FILE *fp = fopen(path, "wb");
 
     fputs("JASC-PAL\r\n", fp);
@@ -169,4 +173,5 @@ void WriteJascPalette(char *path, struct Palette *palette)
     }
 
     fclose(fp);
+    TraceEnd("write", traceStart, path);
 }
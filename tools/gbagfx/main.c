@@ -13,6 +13,7 @@
 #include "rl.h"
 #include "font.h"
 #include "huff.h"
+#include "trace.h"
 
 struct CommandHandler
 {
@@ -546,6 +547,8 @@ int main(int argc, char **argv)
 {
     char converted = 0;
 
+    TraceInit("gbagfx", argc, argv);
+
     if (argc < 3)
         FATAL_ERROR("Usage: gbagfx INPUT_PATH OUTPUT_PATH [options...]\n");
 
@@ -617,7 +620,9 @@ int main(int argc, char **argv)
         if ((handlers[i].inputFileExtension == NULL || strcmp(handlers[i].inputFileExtension, inputFileExtension) == 0)
             && (handlers[i].outputFileExtension == NULL || strcmp(handlers[i].outputFileExtension, outputFileExtension) == 0))
         {
+            uint64_t traceStart = TraceBegin();
             handlers[i].function(inputPath, outputPath, argc, argv);
+            TraceEnd("convert", traceStart, inputPath);
             converted = 1;
             break;
         }
@@ -8,6 +8,7 @@
 #include <limits.h>
 #include "global.h"
 #include "util.h"
+#include "trace.h"
 
 bool ParseNumber(char *s, char **end, int radix, int *intValue)
 {
@@ -67,6 +68,7 @@ char *GetFileExtensionAfterDot(char *path)
 
 unsigned char *ReadWholeFile(char *path, int *size)
 {
+	uint64_t traceStart = TraceBegin();
 	FILE *fp = fopen(path, "rb");
 
 	if (fp == NULL)
@@ -87,12 +89,14 @@ unsigned char *ReadWholeFile(char *path, int *size)
 		FATAL_ERROR("Failed to read \"%s\".\n", path);
 
 	fclose(fp);
+	TraceEnd("read", traceStart, path);
 
 	return buffer;
 }
 
 unsigned char *ReadWholeFileZeroPadded(char *path, int *size, int padAmount)
 {
+	uint64_t traceStart = TraceBegin();
 	FILE *fp = fopen(path, "rb");
 
 	if (fp == NULL)
@@ -113,12 +117,14 @@ unsigned char *ReadWholeFileZeroPadded(char *path, int *size, int padAmount)
 		FATAL_ERROR("Failed to read \"%s\".\n", path);
 
 	fclose(fp);
+	TraceEnd("read", traceStart, path);
 
 	return buffer;
 }
 
 void WriteWholeFile(char *path, void *buffer, int bufferSize)
 {
+	uint64_t traceStart = TraceBegin();
 	FILE *fp = fopen(path, "wb");
 
 	if (fp == NULL)
@@ -128,4 +134,5 @@ void WriteWholeFile(char *path, void *buffer, int bufferSize)
 		FATAL_ERROR("Failed to write to \"%s\".\n", path);
 
 	fclose(fp);
+	TraceEnd("write", traceStart, path);
 }
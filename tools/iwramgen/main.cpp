@@ -0,0 +1,255 @@
+// Chooses the functions a MODERN build runs from IWRAM, from a profile of
+// where the game spends its time.
+//
+//   iwramgen select ELF PROFILE BUDGET
+//
+// reads PROFILE, a sampled PC histogram taken while running the ROM built as
+// ELF, and prints the functions that cover the most samples per byte of IWRAM
+// without going over BUDGET bytes. Each line of PROFILE is a hex address,
+// optionally followed by the number of times it was sampled; "#" starts a
+// comment. Functions are compiled as ARM code in IWRAM, which takes about
+// twice the space of Thumb code, and their sizes are estimated that way.
+//
+//   iwramgen sed FUNCTIONS
+//
+// turns a list printed by "select" into a sed script for the preprocessed C.
+// It adds the attributes that move each function to IWRAM as ARM code to the
+// function's definition and declarations, wherever they start at the beginning
+// of a line, as they do in this codebase. A static function is moved in every
+// file that has one by that name.
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "ramscrgen.h"
+#include "elf.h"
+
+#define STT_FUNC 2
+
+struct Function
+{
+    std::string name;
+    std::uint32_t start;
+    std::uint32_t size;
+    bool isThumb;
+    std::uint64_t samples;
+};
+
+// Functions that run before AgbMain copies the IWRAM code into place.
+static const char *const s_startupFunctions[] = {
+    "AgbMain",
+};
+
+static bool IsStartupFunction(const std::string& name)
+{
+    for (const char *startupName : s_startupFunctions)
+        if (name == startupName)
+            return true;
+
+    return false;
+}
+
+static std::vector<Function> GetFunctions(const std::string& elfPath)
+{
+    std::vector<Function> functions;
+
+    for (const ElfSymbol& symbol : GetSymbols(elfPath))
+    {
+        if ((symbol.info & 0xF) != STT_FUNC || symbol.size == 0 || symbol.sectionIndex == SHN_UNDEF
+         || symbol.sectionIndex >= SHN_ABS)
+            continue;
+
+        // Thumb functions' addresses have bit 0 set.
+        functions.push_back({ symbol.name, symbol.value & ~1u, symbol.size, (symbol.value & 1) != 0, 0 });
+    }
+
+    std::sort(functions.begin(), functions.end(), [](const Function& a, const Function& b) { return a.start < b.start; });
+    return functions;
+}
+
+static Function *FindFunction(std::vector<Function>& functions, std::uint32_t address)
+{
+    auto it = std::upper_bound(functions.begin(), functions.end(), address,
+        [](std::uint32_t value, const Function& function) { return value < function.start; });
+
+    if (it == functions.begin())
+        return nullptr;
+
+    --it;
+    return address - it->start < it->size ? &*it : nullptr;
+}
+
+static std::uint64_t ReadProfile(const std::string& path, std::vector<Function>& functions)
+{
+    std::ifstream stream(path);
+
+    if (!stream.is_open())
+        FATAL_ERROR("error: failed to open \"%s\" for reading\n", path.c_str());
+
+    std::string line;
+    std::uint64_t total = 0;
+    int lineNum = 0;
+
+    while (std::getline(stream, line))
+    {
+        lineNum++;
+        line = line.substr(0, line.find('#'));
+
+        std::istringstream fields(line);
+        std::string address;
+        std::string countText;
+
+        if (!(fields >> address))
+            continue;
+
+        char *end;
+        unsigned long value = std::strtoul(address.c_str(), &end, 16);
+        bool isValid = (*end == '\0');
+        unsigned long long count = 1;
+
+        if (isValid && fields >> countText)
+        {
+            count = std::strtoull(countText.c_str(), &end, 10);
+            isValid = (*end == '\0');
+        }
+
+        if (!isValid)
+            FATAL_ERROR("%s:%d: error: expected an address and a count\n", path.c_str(), lineNum);
+
+        total += count;
+
+        Function *function = FindFunction(functions, value & ~1ul);
+
+        if (function != nullptr)
+            function->samples += count;
+    }
+
+    return total;
+}
+
+static std::uint32_t EstimateIwramSize(const Function& function)
+{
+    std::uint32_t size = function.isThumb ? function.size * 2 : function.size;
+    return (size + 3) & ~3u;
+}
+
+static void Select(const std::string& elfPath, const std::string& profilePath, std::uint32_t budget)
+{
+    std::vector<Function> functions = GetFunctions(elfPath);
+    std::uint64_t total = ReadProfile(profilePath, functions);
+    std::vector<const Function *> candidates;
+
+    for (const Function& function : functions)
+        if (function.samples != 0 && !IsStartupFunction(function.name))
+            candidates.push_back(&function);
+
+    // Take the functions with the most samples per byte first, and keep going
+    // with smaller ones once a larger one doesn't fit.
+    std::sort(candidates.begin(), candidates.end(), [](const Function *a, const Function *b) {
+        std::uint64_t left = a->samples * EstimateIwramSize(*b);
+        std::uint64_t right = b->samples * EstimateIwramSize(*a);
+        return left != right ? left > right : a->samples > b->samples;
+    });
+
+    std::uint32_t used = 0;
+    std::uint64_t covered = 0;
+    std::vector<const Function *> selected;
+
+    for (const Function *function : candidates)
+    {
+        std::uint32_t size = EstimateIwramSize(*function);
+
+        if (used + size > budget)
+            continue;
+
+        used += size;
+        covered += function->samples;
+        selected.push_back(function);
+    }
+
+    std::printf("# Functions to run from IWRAM, chosen by iwramgen from %s.\n", profilePath.c_str());
+    std::printf("# name\tsamples\testimated bytes\n");
+
+    for (const Function *function : selected)
+        std::printf("%s\t%llu\t%u\n", function->name.c_str(), static_cast<unsigned long long>(function->samples), EstimateIwramSize(*function));
+
+    std::fprintf(stderr, "iwramgen: %d functions, about %u of %u bytes, covering %.1f%% of %llu samples\n",
+        static_cast<int>(selected.size()), used, budget, total ? 100.0 * covered / total : 0.0,
+        static_cast<unsigned long long>(total));
+}
+
+static bool IsIdentifier(const std::string& name)
+{
+    if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0])))
+        return false;
+
+    for (char c : name)
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_')
+            return false;
+
+    return true;
+}
+
+static void WriteSedScript(const std::string& listPath)
+{
+    std::ifstream stream(listPath);
+
+    if (!stream.is_open())
+        FATAL_ERROR("error: failed to open \"%s\" for reading\n", listPath.c_str());
+
+    std::string line;
+    int lineNum = 0;
+
+    while (std::getline(stream, line))
+    {
+        lineNum++;
+        line = line.substr(0, line.find('#'));
+
+        std::istringstream fields(line);
+        std::string name;
+
+        if (!(fields >> name))
+            continue;
+
+        if (!IsIdentifier(name))
+            FATAL_ERROR("%s:%d: error: \"%s\" isn't a function name\n", listPath.c_str(), lineNum, name.c_str());
+
+        // long_call lets callers in ROM reach the function, and noinline
+        // keeps it from being copied into them.
+        std::printf("s/^\\([A-Za-z_][A-Za-z0-9_ *]*[ *]%s(\\)/"
+            "__attribute__((section(\".iwram_code\"), target(\"arm\"), long_call, noinline)) \\1/\n",
+            name.c_str());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc == 5 && std::strcmp(argv[1], "select") == 0)
+    {
+        char *end;
+        unsigned long budget = std::strtoul(argv[4], &end, 0);
+
+        if (*end != '\0')
+            FATAL_ERROR("error: bad budget \"%s\"\n", argv[4]);
+
+        Select(argv[2], argv[3], budget);
+        return 0;
+    }
+
+    if (argc == 3 && std::strcmp(argv[1], "sed") == 0)
+    {
+        WriteSedScript(argv[2]);
+        return 0;
+    }
+
+    std::fprintf(stderr,
+        "Usage: iwramgen select ELF PROFILE BUDGET\n"
+        "       iwramgen sed FUNCTIONS\n");
+    return 1;
+}
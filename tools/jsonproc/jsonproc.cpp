@@ -7,10 +7,15 @@
 #include <string>
 using std::string; using std::to_string;
 
+#include <fstream>
+using std::ofstream;
+
 #include <inja.hpp>
 using namespace inja;
 using json = nlohmann::json;
 
+#include "trace.h"
+
 std::map<string, string> customVars;
 
 void set_custom_var(string key, string value)
@@ -25,6 +30,8 @@ string get_custom_var(string key)
 
 int main(int argc, char *argv[])
 {
+    TraceInit("jsonproc", argc, argv);
+
     if (argc != 4)
         FATAL_ERROR("USAGE: jsonproc <json-filepath> <template-filepath> <output-filepath>\n");
 
@@ -119,7 +126,23 @@ int main(int argc, char *argv[])
 
     try
     {
-        env.write_with_json_file(templateFilepath, jsonfilepath, outputFilepath);
+        uint64_t traceStart = TraceBegin();
+        const json data = env.load_json(jsonfilepath);
+        TraceEnd("parse", traceStart, jsonfilepath.c_str());
+
+        traceStart = TraceBegin();
+        Template temp = env.parse_template(templateFilepath);
+        TraceEnd("parse", traceStart, templateFilepath.c_str());
+
+        traceStart = TraceBegin();
+        string output = env.render(temp, data);
+        TraceEnd("convert", traceStart, templateFilepath.c_str());
+
+        traceStart = TraceBegin();
+        ofstream file(outputFilepath);
+        file << output;
+        file.close();
+        TraceEnd("write", traceStart, outputFilepath.c_str());
     }
     catch (const std::exception& e)
     {
@@ -28,10 +28,15 @@ using std::numeric_limits;
 using json11::Json;
 
 #include "mapjson.h"
+#include "trace.h"
 
 string version;
 
+// Set by a host process (tools/assetd) that keeps the layouts file parsed between runs.
+const Json *cached_layouts_data = nullptr;
+
 string read_text_file(string filepath) {
+    uint64_t trace_start = TraceBegin();
     ifstream in_file(filepath);
 
     if (!in_file.is_open())
@@ -46,11 +51,13 @@ string read_text_file(string filepath) {
     in_file.read(&text[0], text.size());
 
     in_file.close();
+    TraceEnd("read", trace_start, filepath.c_str());
 
     return text;
 }
 
 void write_text_file(string filepath, string text) {
+    uint64_t trace_start = TraceBegin();
     ofstream out_file(filepath, std::ofstream::binary);
 
     if (!out_file.is_open())
@@ -59,6 +66,15 @@ void write_text_file(string filepath, string text) {
     out_file << text;
 
     out_file.close();
+    TraceEnd("write", trace_start, filepath.c_str());
+}
+
+Json parse_json(string text, string &err, string filepath) {
+    uint64_t trace_start = TraceBegin();
+    Json data = Json::parse(text, err);
+    TraceEnd("parse", trace_start, filepath.c_str());
+
+    return data;
 }
 
 
@@ -337,19 +353,28 @@ void process_map(string map_filepath, string layouts_filepath) {
     string mapdata_err, layouts_err;
 
     string mapdata_json_text = read_text_file(map_filepath);
-    string layouts_json_text = read_text_file(layouts_filepath);
 
-    Json map_data = Json::parse(mapdata_json_text, mapdata_err);
+    Json map_data = parse_json(mapdata_json_text, mapdata_err, map_filepath);
     if (map_data == Json())
         FATAL_ERROR("%s\n", mapdata_err.c_str());
 
-    Json layouts_data = Json::parse(layouts_json_text, layouts_err);
-    if (layouts_data == Json())
-        FATAL_ERROR("%s\n", layouts_err.c_str());
+    Json layouts_data;
+    if (cached_layouts_data != nullptr) {
+        layouts_data = *cached_layouts_data;
+    }
+    else {
+        string layouts_json_text = read_text_file(layouts_filepath);
+
+        layouts_data = parse_json(layouts_json_text, layouts_err, layouts_filepath);
+        if (layouts_data == Json())
+            FATAL_ERROR("%s\n", layouts_err.c_str());
+    }
 
+    uint64_t trace_start = TraceBegin();
     string header_text = generate_map_header_text(map_data, layouts_data);
     string events_text = generate_map_events_text(map_data);
     string connections_text = generate_map_connections_text(map_data);
+    TraceEnd("convert", trace_start, map_filepath.c_str());
 
     string files_dir = get_directory_name(map_filepath);
     write_text_file(files_dir + "header.inc", header_text);
@@ -465,7 +490,7 @@ string generate_map_constants_text(string groups_filepath, Json groups_data) {
         for (auto &map_name : groups_data[groupName].array_items()) {
             string header_filepath = file_dir + json_to_string(map_name) + dir_separator + "map.json";
             string err_str;
-            Json map_data = Json::parse(read_text_file(header_filepath), err_str);
+            Json map_data = parse_json(read_text_file(header_filepath), err_str, header_filepath);
             map_ids.push_back(map_data["id"]);
             string id = json_to_string(map_data, "id");
             if (id.length() > max_length)
@@ -491,16 +516,18 @@ string generate_map_constants_text(string groups_filepath, Json groups_data) {
 
 void process_groups(string groups_filepath) {
     string err;
-    Json groups_data = Json::parse(read_text_file(groups_filepath), err);
+    Json groups_data = parse_json(read_text_file(groups_filepath), err, groups_filepath);
 
     if (groups_data == Json())
         FATAL_ERROR("%s\n", err.c_str());
 
+    uint64_t trace_start = TraceBegin();
     string groups_text = generate_groups_text(groups_data);
     string connections_text = generate_connections_text(groups_data);
     string headers_text = generate_headers_text(groups_data);
     string events_text = generate_events_text(groups_data);
     string map_header_text = generate_map_constants_text(groups_filepath, groups_data);
+    TraceEnd("convert", trace_start, groups_filepath.c_str());
 
     string file_dir = get_directory_name(groups_filepath);
     char s = file_dir.back();
@@ -584,14 +611,16 @@ string generate_layouts_constants_text(Json layouts_data) {
 
 void process_layouts(string layouts_filepath) {
     string err;
-    Json layouts_data = Json::parse(read_text_file(layouts_filepath), err);
+    Json layouts_data = parse_json(read_text_file(layouts_filepath), err, layouts_filepath);
 
     if (layouts_data == Json())
         FATAL_ERROR("%s\n", err.c_str());
 
+    uint64_t trace_start = TraceBegin();
     string layout_headers_text = generate_layout_headers_text(layouts_data);
     string layouts_table_text = generate_layouts_table_text(layouts_data);
     string layouts_constants_text = generate_layouts_constants_text(layouts_data);
+    TraceEnd("convert", trace_start, layouts_filepath.c_str());
 
     string file_dir = get_directory_name(layouts_filepath);
     char s = file_dir.back();
@@ -602,6 +631,8 @@ void process_layouts(string layouts_filepath) {
 }
 
 int main(int argc, char *argv[]) {
+    TraceInit("mapjson", argc, argv);
+
     if (argc < 3)
         FATAL_ERROR("USAGE: mapjson <mode> <game-version> [options]\n");
 
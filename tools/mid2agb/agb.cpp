@@ -22,14 +22,56 @@
 #include <cstdio>
 #include <cstdarg>
 #include <cstring>
+#include <string>
 #include <vector>
 #include "agb.h"
 #include "main.h"
 #include "midi.h"
 #include "tables.h"
+#include "object.h"
+#include "error.h"
+
+// Command bytes, as defined in sound/MPlayDef.s.
+enum
+{
+    W00    = 0x80,
+    FINE   = 0xB1,
+    GOTO   = 0xB2,
+    PATT   = 0xB3,
+    PEND   = 0xB4,
+    MEMACC = 0xB9,
+    PRIO   = 0xBA,
+    TEMPO  = 0xBB,
+    KEYSH  = 0xBC,
+    VOICE  = 0xBD,
+    VOL    = 0xBE,
+    PAN    = 0xBF,
+    BEND   = 0xC0,
+    BENDR  = 0xC1,
+    LFOS   = 0xC2,
+    LFODL  = 0xC3,
+    MOD    = 0xC4,
+    MODT   = 0xC5,
+    TUNE   = 0xC8,
+    XCMD   = 0xCD,
+    EOT    = 0xCE,
+    TIE    = 0xCF,
+};
+
+enum
+{
+    xIECV = 0x08,
+    xIECL = 0x09,
+};
+
+#define REVERB_SET 0x80
+#define MAX_VOLUME 0x7F
+#define CENTER_VALUE 0x40
 
 int g_agbTrack;
 
+static ObjectWriter s_object(".rodata");
+
 static std::string s_lastOpName;
 static int s_blockNum;
 static bool s_keepLastOpName;
@@ -43,8 +85,39 @@ static int s_memaccOp;
 static int s_memaccParam1;
 static int s_memaccParam2;
 
+static std::string FormatString(const char *format, ...)
+{
+    char buffer[256];
+    std::va_list args;
+    va_start(args, format);
+    std::vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    return buffer;
+}
+
+static int LengthIndex(int length)
+{
+    for (int i = 0; i < g_lengthTableSize; i++)
+        if (g_lengthTable[i] == length)
+            return i;
+
+    RaiseError("no command for length %d", length);
+}
+
+static int VelocityValue(int velocity)
+{
+    // MPlayDef.s defines v069 as 79.
+    return velocity == 69 ? 79 : velocity;
+}
+
 void PrintAgbHeader()
 {
+    if (g_objectOutput)
+    {
+        s_object.SetGlobal(g_asmLabel);
+        return;
+    }
+
     std::fprintf(g_outputFile, "\t.include \"MPlayDef.s\"\n\n");
     std::fprintf(g_outputFile, "\t.equ\t%s_grp, voicegroup%03u\n", g_asmLabel.c_str(), g_voiceGroup);
     std::fprintf(g_outputFile, "\t.equ\t%s_pri, %u\n", g_asmLabel.c_str(), g_priority);
@@ -77,19 +150,47 @@ void ResetTrackVars()
     s_inPattern = false;
 }
 
+void PrintLabel(std::string label)
+{
+    if (g_objectOutput)
+        s_object.AddLabel(label);
+    else
+        std::fprintf(g_outputFile, "%s:\n", label.c_str());
+}
+
 void PrintWait(int wait)
 {
     if (wait > 0)
     {
-        std::fprintf(g_outputFile, "\t.byte\tW%02d\n", wait);
+        if (g_objectOutput)
+            s_object.AddByte(W00 + LengthIndex(wait));
+        else
+            std::fprintf(g_outputFile, "\t.byte\tW%02d\n", wait);
         s_velocityChanged = true;
         s_noteChanged = true;
         s_keepLastOpName = true;
     }
 }
 
-void PrintOp(int wait, std::string name, const char *format, ...)
+// The object output takes the command byte and its parameters directly;
+// the format only describes them for the assembly output.
+void PrintOp(int wait, std::string name, int command, std::vector<int> params, const char *format, ...)
 {
+    if (g_objectOutput)
+    {
+        if (format == nullptr || !g_compressionEnabled || s_lastOpName != name)
+        {
+            s_object.AddByte(command);
+            s_lastOpName = name;
+        }
+
+        for (int param : params)
+            s_object.AddByte(param);
+
+        PrintWait(wait);
+        return;
+    }
+
     std::va_list args;
     va_start(args, format);
     std::fprintf(g_outputFile, "\t.byte\t\t");
@@ -120,27 +221,34 @@ void PrintOp(int wait, std::string name, const char *format, ...)
     PrintWait(wait);
 }
 
-void PrintByte(const char *format, ...)
+void PrintByte(std::vector<int> bytes, const char *format, ...)
 {
-    std::va_list args;
-    va_start(args, format);
-    std::fprintf(g_outputFile, "\t.byte\t");
-    std::vfprintf(g_outputFile, format, args);
-    std::fprintf(g_outputFile, "\n");
+    if (g_objectOutput)
+    {
+        for (int byte : bytes)
+            s_object.AddByte(byte);
+    }
+    else
+    {
+        std::va_list args;
+        va_start(args, format);
+        std::fprintf(g_outputFile, "\t.byte\t");
+        std::vfprintf(g_outputFile, format, args);
+        std::fprintf(g_outputFile, "\n");
+        va_end(args);
+    }
+
     s_velocityChanged = true;
     s_noteChanged = true;
     s_keepLastOpName = true;
-    va_end(args);
 }
 
-void PrintWord(const char *format, ...)
+void PrintWord(std::string label)
 {
-    std::va_list args;
-    va_start(args, format);
-    std::fprintf(g_outputFile, "\t .word\t");
-    std::vfprintf(g_outputFile, format, args);
-    std::fprintf(g_outputFile, "\n");
-    va_end(args);
+    if (g_objectOutput)
+        s_object.AddWordRef(label);
+    else
+        std::fprintf(g_outputFile, "\t .word\t%s\n", label.c_str());
 }
 
 void PrintNote(const Event& event)
@@ -165,11 +273,18 @@ void PrintNote(const Event& event)
         gtpBuf[0] = 0;
 
     char opName[16];
+    int command;
 
     if (duration == -1)
+    {
         std::strcpy(opName, "TIE   ");
+        command = TIE;
+    }
     else
+    {
         std::snprintf(opName, sizeof(opName), "N%02u   ", duration);
+        command = TIE + LengthIndex(duration);
+    }
 
     bool noteChanged = true;
     bool velocityChanged = true;
@@ -189,6 +304,7 @@ void PrintNote(const Event& event)
     {
         s_lastNote = note;
 
+        std::vector<int> params = { note };
         char noteBuf[16];
 
         if (note >= 24)
@@ -201,6 +317,7 @@ void PrintNote(const Event& event)
         if (velocityChanged || (gateTimeParam > 0))
         {
             s_lastVelocity = velocity;
+            params.push_back(VelocityValue(velocity));
             std::snprintf(velocityBuf, sizeof(velocityBuf), ", v%03u", velocity);
         }
         else
@@ -208,11 +325,14 @@ void PrintNote(const Event& event)
             velocityBuf[0] = 0;
         }
 
-        PrintOp(event.time, opName, "%s%s%s", noteBuf, velocityBuf, gtpBuf);
+        if (gateTimeParam > 0)
+            params.push_back(gateTimeParam);
+
+        PrintOp(event.time, opName, command, params, "%s%s%s", noteBuf, velocityBuf, gtpBuf);
     }
     else
     {
-        PrintOp(event.time, opName, 0);
+        PrintOp(event.time, opName, command, {}, 0);
     }
 
     s_noteChanged = noteChanged;
@@ -229,15 +349,15 @@ void PrintEndOfTieOp(const Event& event)
 
     if (!noteChanged && g_compressionEnabled)
     {
-        PrintOp(event.time, "EOT   ", nullptr);
+        PrintOp(event.time, "EOT   ", EOT, {}, nullptr);
     }
     else
     {
         s_lastNote = note;
         if (note >= 24)
-            PrintOp(event.time, "EOT   ", g_noteTable[note % 12], note / 12 - 2);
+            PrintOp(event.time, "EOT   ", EOT, { note }, g_noteTable[note % 12], note / 12 - 2);
         else
-            PrintOp(event.time, "EOT   ", g_minusNoteTable[note % 12], note / -12 + 2);
+            PrintOp(event.time, "EOT   ", EOT, { note }, g_minusNoteTable[note % 12], note / -12 + 2);
     }
 
     s_noteChanged = noteChanged;
@@ -246,7 +366,7 @@ void PrintEndOfTieOp(const Event& event)
 void PrintSeqLoopLabel(const Event& event)
 {
     s_blockNum = event.param1 + 1;
-    std::fprintf(g_outputFile, "%s_%u_B%u:\n", g_asmLabel.c_str(), g_agbTrack, s_blockNum);
+    PrintLabel(FormatString("%s_%u_B%u", g_asmLabel.c_str(), g_agbTrack, s_blockNum));
     PrintWait(event.time);
     ResetTrackVars();
 }
@@ -256,22 +376,22 @@ void PrintMemAcc(const Event& event)
     switch (s_memaccOp)
     {
     case 0x00:
-        PrintByte("MEMACC, mem_set, 0x%02X, %u", s_memaccParam1, event.param2);
+        PrintByte({ MEMACC, 0, s_memaccParam1, event.param2 }, "MEMACC, mem_set, 0x%02X, %u", s_memaccParam1, event.param2);
         break;
     case 0x01:
-        PrintByte("MEMACC, mem_add, 0x%02X, %u", s_memaccParam1, event.param2);
+        PrintByte({ MEMACC, 1, s_memaccParam1, event.param2 }, "MEMACC, mem_add, 0x%02X, %u", s_memaccParam1, event.param2);
         break;
     case 0x02:
-        PrintByte("MEMACC, mem_sub, 0x%02X, %u", s_memaccParam1, event.param2);
+        PrintByte({ MEMACC, 2, s_memaccParam1, event.param2 }, "MEMACC, mem_sub, 0x%02X, %u", s_memaccParam1, event.param2);
         break;
     case 0x03:
-        PrintByte("MEMACC, mem_mem_set, 0x%02X, 0x%02X", s_memaccParam1, event.param2);
+        PrintByte({ MEMACC, 3, s_memaccParam1, event.param2 }, "MEMACC, mem_mem_set, 0x%02X, 0x%02X", s_memaccParam1, event.param2);
         break;
     case 0x04:
-        PrintByte("MEMACC, mem_mem_add, 0x%02X, 0x%02X", s_memaccParam1, event.param2);
+        PrintByte({ MEMACC, 4, s_memaccParam1, event.param2 }, "MEMACC, mem_mem_add, 0x%02X, 0x%02X", s_memaccParam1, event.param2);
         break;
     case 0x05:
-        PrintByte("MEMACC, mem_mem_sub, 0x%02X, 0x%02X", s_memaccParam1, event.param2);
+        PrintByte({ MEMACC, 5, s_memaccParam1, event.param2 }, "MEMACC, mem_mem_sub, 0x%02X, 0x%02X", s_memaccParam1, event.param2);
         break;
     // TODO: everything else
     case 0x06:
@@ -336,10 +456,10 @@ void PrintExtendedOp(const Event& event)
     switch (s_extendedCommand)
     {
     case 0x08:
-        PrintOp(event.time, "XCMD  ", "xIECV , %u", event.param2);
+        PrintOp(event.time, "XCMD  ", XCMD, { xIECV, event.param2 }, "xIECV , %u", event.param2);
         break;
     case 0x09:
-        PrintOp(event.time, "XCMD  ", "xIECL , %u", event.param2);
+        PrintOp(event.time, "XCMD  ", XCMD, { xIECL, event.param2 }, "xIECL , %u", event.param2);
         break;
     default:
         PrintWait(event.time);
@@ -352,13 +472,13 @@ void PrintControllerOp(const Event& event)
     switch (event.param1)
     {
     case 0x01:
-        PrintOp(event.time, "MOD   ", "%u", event.param2);
+        PrintOp(event.time, "MOD   ", MOD, { event.param2 }, "%u", event.param2);
         break;
     case 0x07:
-        PrintOp(event.time, "VOL   ", "%u*%s_mvl/mxv", event.param2, g_asmLabel.c_str());
+        PrintOp(event.time, "VOL   ", VOL, { event.param2 * g_masterVolume / MAX_VOLUME }, "%u*%s_mvl/mxv", event.param2, g_asmLabel.c_str());
         break;
     case 0x0A:
-        PrintOp(event.time, "PAN   ", "c_v%+d", event.param2 - 64);
+        PrintOp(event.time, "PAN   ", PAN, { CENTER_VALUE + event.param2 - 64 }, "c_v%+d", event.param2 - 64);
         break;
     case 0x0C:
     case 0x10:
@@ -377,24 +497,24 @@ void PrintControllerOp(const Event& event)
         PrintWait(event.time);
         break;
     case 0x11:
-        std::fprintf(g_outputFile, "%s_%u_L%u:\n", g_asmLabel.c_str(), g_agbTrack, event.param2);
+        PrintLabel(FormatString("%s_%u_L%u", g_asmLabel.c_str(), g_agbTrack, event.param2));
         PrintWait(event.time);
         ResetTrackVars();
         break;
     case 0x14:
-        PrintOp(event.time, "BENDR ", "%u", event.param2);
+        PrintOp(event.time, "BENDR ", BENDR, { event.param2 }, "%u", event.param2);
         break;
     case 0x15:
-        PrintOp(event.time, "LFOS  ", "%u", event.param2);
+        PrintOp(event.time, "LFOS  ", LFOS, { event.param2 }, "%u", event.param2);
         break;
     case 0x16:
-        PrintOp(event.time, "MODT  ", "%u", event.param2);
+        PrintOp(event.time, "MODT  ", MODT, { event.param2 }, "%u", event.param2);
         break;
     case 0x18:
-        PrintOp(event.time, "TUNE  ", "c_v%+d", event.param2 - 64);
+        PrintOp(event.time, "TUNE  ", TUNE, { CENTER_VALUE + event.param2 - 64 }, "c_v%+d", event.param2 - 64);
         break;
     case 0x1A:
-        PrintOp(event.time, "LFODL ", "%u", event.param2);
+        PrintOp(event.time, "LFODL ", LFODL, { event.param2 }, "%u", event.param2);
         break;
     case 0x1D:
     case 0x1F:
@@ -406,7 +526,7 @@ void PrintControllerOp(const Event& event)
         break;
     case 0x21:
     case 0x27:
-        PrintByte("PRIO  , %u", event.param2);
+        PrintByte({ PRIO, event.param2 }, "PRIO  , %u", event.param2);
         PrintWait(event.time);
         break;
     default:
@@ -417,8 +537,10 @@ void PrintControllerOp(const Event& event)
 
 void PrintAgbTrack(std::vector<Event>& events)
 {
-    std::fprintf(g_outputFile, "\n@**************** Track %u (Midi-Chn.%u) ****************@\n\n", g_agbTrack, g_midiChan + 1);
-    std::fprintf(g_outputFile, "%s_%u:\n", g_asmLabel.c_str(), g_agbTrack);
+    if (!g_objectOutput)
+        std::fprintf(g_outputFile, "\n@**************** Track %u (Midi-Chn.%u) ****************@\n\n", g_agbTrack, g_midiChan + 1);
+
+    PrintLabel(FormatString("%s_%u", g_asmLabel.c_str(), g_agbTrack));
 
     int wholeNoteCount = 0;
     int loopEndBlockNum = 0;
@@ -440,10 +562,10 @@ void PrintAgbTrack(std::vector<Event>& events)
     }
 
     if (!foundVolBeforeNote)
-        PrintByte("\tVOL   , 127*%s_mvl/mxv", g_asmLabel.c_str());
+        PrintByte({ VOL, 127 * g_masterVolume / MAX_VOLUME }, "\tVOL   , 127*%s_mvl/mxv", g_asmLabel.c_str());
 
     PrintWait(g_initialWait);
-    PrintByte("KEYSH , %s_key%+d", g_asmLabel.c_str(), 0);
+    PrintByte({ KEYSH, 0 }, "KEYSH , %s_key%+d", g_asmLabel.c_str(), 0);
 
     for (unsigned i = 0; events[i].type != EventType::EndOfTrack; i++)
     {
@@ -452,11 +574,11 @@ void PrintAgbTrack(std::vector<Event>& events)
         if (IsPatternBoundary(event.type))
         {
             if (s_inPattern)
-                PrintByte("PEND");
+                PrintByte({ PEND }, "PEND");
             s_inPattern = false;
         }
 
-        if (event.type == EventType::WholeNoteMark || event.type == EventType::Pattern)
+        if (!g_objectOutput && (event.type == EventType::WholeNoteMark || event.type == EventType::Pattern))
             std::fprintf(g_outputFile, "@ %03d   ----------------------------------------\n", wholeNoteCount++);
 
         switch (event.type)
@@ -471,13 +593,13 @@ void PrintAgbTrack(std::vector<Event>& events)
             PrintSeqLoopLabel(event);
             break;
         case EventType::LoopEnd:
-            PrintByte("GOTO");
-            PrintWord("%s_%u_B%u", g_asmLabel.c_str(), g_agbTrack, loopEndBlockNum);
+            PrintByte({ GOTO }, "GOTO");
+            PrintWord(FormatString("%s_%u_B%u", g_asmLabel.c_str(), g_agbTrack, loopEndBlockNum));
             PrintSeqLoopLabel(event);
             break;
         case EventType::LoopEndBegin:
-            PrintByte("GOTO");
-            PrintWord("%s_%u_B%u", g_asmLabel.c_str(), g_agbTrack, loopEndBlockNum);
+            PrintByte({ GOTO }, "GOTO");
+            PrintWord(FormatString("%s_%u_B%u", g_asmLabel.c_str(), g_agbTrack, loopEndBlockNum));
             PrintSeqLoopLabel(event);
             loopEndBlockNum = s_blockNum;
             break;
@@ -488,15 +610,15 @@ void PrintAgbTrack(std::vector<Event>& events)
         case EventType::WholeNoteMark:
             if (event.param2 & 0x80000000)
             {
-                std::fprintf(g_outputFile, "%s_%u_%03lu:\n", g_asmLabel.c_str(), g_agbTrack, (unsigned long)(event.param2 & 0x7FFFFFFF));
+                PrintLabel(FormatString("%s_%u_%03lu", g_asmLabel.c_str(), g_agbTrack, (unsigned long)(event.param2 & 0x7FFFFFFF)));
                 ResetTrackVars();
                 s_inPattern = true;
             }
             PrintWait(event.time);
             break;
         case EventType::Pattern:
-            PrintByte("PATT");
-            PrintWord("%s_%u_%03lu", g_asmLabel.c_str(), g_agbTrack, event.param2);
+            PrintByte({ PATT }, "PATT");
+            PrintWord(FormatString("%s_%u_%03lu", g_asmLabel.c_str(), g_agbTrack, event.param2));
 
             while (!IsPatternBoundary(events[i + 1].type))
                 i++;
@@ -504,14 +626,17 @@ void PrintAgbTrack(std::vector<Event>& events)
             ResetTrackVars();
             break;
         case EventType::Tempo:
-            PrintByte("TEMPO , %u*%s_tbs/2", static_cast<int>(round(60000000.0f / static_cast<float>(event.param2))), g_asmLabel.c_str());
+        {
+            int bpm = static_cast<int>(round(60000000.0f / static_cast<float>(event.param2)));
+            PrintByte({ TEMPO, bpm * g_clocksPerBeat / 2 }, "TEMPO , %u*%s_tbs/2", bpm, g_asmLabel.c_str());
             PrintWait(event.time);
             break;
+        }
         case EventType::InstrumentChange:
-            PrintOp(event.time, "VOICE ", "%u", event.param1);
+            PrintOp(event.time, "VOICE ", VOICE, { event.param1 }, "%u", event.param1);
             break;
         case EventType::PitchBend:
-            PrintOp(event.time, "BEND  ", "c_v%+d", event.param2 - 64);
+            PrintOp(event.time, "BEND  ", BEND, { CENTER_VALUE + event.param2 - 64 }, "c_v%+d", event.param2 - 64);
             break;
         case EventType::Controller:
             PrintControllerOp(event);
@@ -522,13 +647,30 @@ void PrintAgbTrack(std::vector<Event>& events)
         }
     }
 
-    PrintByte("FINE");
+    PrintByte({ FINE }, "FINE");
 }
 
 void PrintAgbFooter()
 {
     int trackCount = g_agbTrack - 1;
 
+    if (g_objectOutput)
+    {
+        s_object.Align(4);
+        s_object.AddLabel(g_asmLabel);
+        s_object.AddByte(trackCount);
+        s_object.AddByte(0);
+        s_object.AddByte(g_priority);
+        s_object.AddByte(g_reverb >= 0 ? REVERB_SET + g_reverb : 0);
+        s_object.AddWordRef(FormatString("voicegroup%03u", g_voiceGroup));
+
+        for (int i = 1; i <= trackCount; i++)
+            s_object.AddWordRef(FormatString("%s_%u", g_asmLabel.c_str(), i));
+
+        s_object.Write(g_outputFile);
+        return;
+    }
+
     std::fprintf(g_outputFile, "\n@******************************************************@\n");
     std::fprintf(g_outputFile, "\t.align\t2\n");
     std::fprintf(g_outputFile, "\n%s:\n", g_asmLabel.c_str());
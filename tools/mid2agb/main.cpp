@@ -28,6 +28,7 @@
 #include "main.h"
 #include "error.h"
 #include "midi.h"
+#include "trace.h"
 #include "agb.h"
 
 FILE* g_inputFile = nullptr;
@@ -41,6 +42,7 @@ int g_reverb = -1;
 int g_clocksPerBeat = 1;
 bool g_exactGateTime = false;
 bool g_compressionEnabled = true;
+bool g_objectOutput = false;
 
 [[noreturn]] static void PrintUsage()
 {
@@ -49,6 +51,7 @@ bool g_compressionEnabled = true;
         "\n"
         "    input_file  filename(.mid) of MIDI file\n"
         "   output_file  filename(.s) for AGB file (default:input_file)\n"
+        "                or filename(.o) for a linkable object\n"
         "\n"
         "options  -L???  label for assembler (default:output_file)\n"
         "         -V???  master volume (default:127)\n"
@@ -132,6 +135,8 @@ int main(int argc, char** argv)
     std::string inputFilename;
     std::string outputFilename;
 
+    TraceInit("mid2agb", argc, argv);
+
     for (int i = 1; i < argc; i++)
     {
         const char *option = argv[i];
@@ -205,8 +210,10 @@ int main(int argc, char** argv)
     if (outputFilename.empty())
         outputFilename = StripExtension(inputFilename) + ".s";
 
-    if (GetExtension(outputFilename) != "s")
-        RaiseError("output filename extension is not \"s\"");
+    if (GetExtension(outputFilename) == "o")
+        g_objectOutput = true;
+    else if (GetExtension(outputFilename) != "s")
+        RaiseError("output filename extension is not \"s\" or \"o\"");
 
     if (g_asmLabel.empty())
         g_asmLabel = BaseName(outputFilename);
@@ -216,18 +223,26 @@ int main(int argc, char** argv)
     if (g_inputFile == nullptr)
         RaiseError("failed to open \"%s\" for reading", inputFilename.c_str());
 
-    g_outputFile = std::fopen(outputFilename.c_str(), "w");
+    g_outputFile = std::fopen(outputFilename.c_str(), g_objectOutput ? "wb" : "w");
 
     if (g_outputFile == nullptr)
         RaiseError("failed to open \"%s\" for writing", outputFilename.c_str());
 
+    std::uint64_t traceStart = TraceBegin();
     ReadMidiFileHeader();
+    TraceEnd("parse", traceStart, inputFilename.c_str());
+
+    traceStart = TraceBegin();
     PrintAgbHeader();
     ReadMidiTracks();
     PrintAgbFooter();
+    TraceEnd("convert", traceStart, inputFilename.c_str());
 
     std::fclose(g_inputFile);
+
+    traceStart = TraceBegin();
     std::fclose(g_outputFile);
+    TraceEnd("write", traceStart, outputFilename.c_str());
 
     return 0;
 }
@@ -0,0 +1,241 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+#include "object.h"
+#include "error.h"
+
+// ELF constants. These are spelled out here rather than taken from <elf.h>,
+// which isn't available on every host.
+#define ET_REL          1
+#define EM_ARM          40
+#define EF_ARM_EABI_VER5 0x05000000
+#define SHT_PROGBITS    1
+#define SHT_SYMTAB      2
+#define SHT_STRTAB      3
+#define SHT_REL         9
+#define SHF_ALLOC       0x2
+#define SHF_INFO_LINK   0x40
+#define STB_LOCAL       0
+#define STB_GLOBAL      1
+#define STT_NOTYPE      0
+#define STT_SECTION     3
+#define R_ARM_ABS32     2
+
+#define ELF_HEADER_SIZE     52
+#define SECTION_HEADER_SIZE 40
+#define SYMBOL_SIZE         16
+#define REL_SIZE            8
+
+enum
+{
+    SECTION_NULL,
+    SECTION_DATA,
+    SECTION_REL,
+    SECTION_SYMTAB,
+    SECTION_STRTAB,
+    SECTION_SHSTRTAB,
+    SECTION_COUNT
+};
+
+static void Put16(std::vector<std::uint8_t>& buffer, std::uint32_t value)
+{
+    buffer.push_back(value & 0xFF);
+    buffer.push_back((value >> 8) & 0xFF);
+}
+
+static void Put32(std::vector<std::uint8_t>& buffer, std::uint32_t value)
+{
+    Put16(buffer, value & 0xFFFF);
+    Put16(buffer, value >> 16);
+}
+
+static void Set32(std::vector<std::uint8_t>& buffer, std::uint32_t offset, std::uint32_t value)
+{
+    buffer[offset] = value & 0xFF;
+    buffer[offset + 1] = (value >> 8) & 0xFF;
+    buffer[offset + 2] = (value >> 16) & 0xFF;
+    buffer[offset + 3] = (value >> 24) & 0xFF;
+}
+
+static void PadTo(std::vector<std::uint8_t>& buffer, int alignment)
+{
+    while (buffer.size() % alignment != 0)
+        buffer.push_back(0);
+}
+
+static std::uint32_t AddString(std::vector<std::uint8_t>& table, const std::string& s)
+{
+    std::uint32_t offset = table.size();
+    table.insert(table.end(), s.begin(), s.end());
+    table.push_back(0);
+    return offset;
+}
+
+static void PutSymbol(std::vector<std::uint8_t>& buffer, std::uint32_t name, std::uint32_t value, int bind, int type, int section)
+{
+    Put32(buffer, name);
+    Put32(buffer, value);
+    Put32(buffer, 0);
+    buffer.push_back((bind << 4) | type);
+    buffer.push_back(0);
+    Put16(buffer, section);
+}
+
+static void PutSectionHeader(std::vector<std::uint8_t>& buffer, std::uint32_t name, std::uint32_t type, std::uint32_t flags,
+    std::uint32_t offset, std::uint32_t size, std::uint32_t link, std::uint32_t info, std::uint32_t align, std::uint32_t entsize)
+{
+    Put32(buffer, name);
+    Put32(buffer, type);
+    Put32(buffer, flags);
+    Put32(buffer, 0);
+    Put32(buffer, offset);
+    Put32(buffer, size);
+    Put32(buffer, link);
+    Put32(buffer, info);
+    Put32(buffer, align);
+    Put32(buffer, entsize);
+}
+
+void ObjectWriter::AddByte(int value)
+{
+    m_data.push_back(value & 0xFF);
+}
+
+void ObjectWriter::AddWordRef(std::string symbol)
+{
+    m_relocations.push_back({ static_cast<std::uint32_t>(m_data.size()), symbol });
+    Put32(m_data, 0);
+}
+
+void ObjectWriter::AddLabel(std::string label)
+{
+    if (m_labels.count(label))
+        RaiseError("label \"%s\" is already defined", label.c_str());
+
+    m_labels[label] = m_data.size();
+    m_labelOrder.push_back(label);
+}
+
+void ObjectWriter::Align(int alignment)
+{
+    PadTo(m_data, alignment);
+}
+
+void ObjectWriter::SetGlobal(std::string label)
+{
+    m_globalLabel = label;
+}
+
+void ObjectWriter::Write(std::FILE* fp)
+{
+    if (!m_globalLabel.empty() && !m_labels.count(m_globalLabel))
+        RaiseError("global label \"%s\" is not defined", m_globalLabel.c_str());
+
+    std::vector<std::uint8_t> strtab(1, 0);
+    std::vector<std::uint8_t> symtab;
+    std::map<std::string, std::uint32_t> externs;
+
+    // Locals come first, as required by the symbol table's sh_info.
+    PutSymbol(symtab, 0, 0, STB_LOCAL, STT_NOTYPE, 0);
+    PutSymbol(symtab, 0, 0, STB_LOCAL, STT_SECTION, SECTION_DATA);
+
+    for (const std::string& label : m_labelOrder)
+    {
+        if (label != m_globalLabel)
+            PutSymbol(symtab, AddString(strtab, label), m_labels[label], STB_LOCAL, STT_NOTYPE, SECTION_DATA);
+    }
+
+    std::uint32_t firstGlobal = symtab.size() / SYMBOL_SIZE;
+    std::uint32_t globalIndex = 0;
+
+    if (!m_globalLabel.empty())
+    {
+        globalIndex = firstGlobal;
+        PutSymbol(symtab, AddString(strtab, m_globalLabel), m_labels[m_globalLabel], STB_GLOBAL, STT_NOTYPE, SECTION_DATA);
+    }
+
+    // References to local labels are resolved against the section symbol
+    // with the addend stored in place, as the assembler would do.
+    std::vector<std::uint8_t> rel;
+
+    for (const Relocation& reloc : m_relocations)
+    {
+        std::uint32_t symbolIndex;
+
+        if (reloc.symbol == m_globalLabel)
+        {
+            symbolIndex = globalIndex;
+        }
+        else if (m_labels.count(reloc.symbol))
+        {
+            symbolIndex = 1;
+            Set32(m_data, reloc.offset, m_labels[reloc.symbol]);
+        }
+        else
+        {
+            if (!externs.count(reloc.symbol))
+            {
+                externs[reloc.symbol] = symtab.size() / SYMBOL_SIZE;
+                PutSymbol(symtab, AddString(strtab, reloc.symbol), 0, STB_GLOBAL, STT_NOTYPE, 0);
+            }
+            symbolIndex = externs[reloc.symbol];
+        }
+
+        Put32(rel, reloc.offset);
+        Put32(rel, (symbolIndex << 8) | R_ARM_ABS32);
+    }
+
+    std::vector<std::uint8_t> shstrtab(1, 0);
+    std::uint32_t dataName = AddString(shstrtab, m_sectionName);
+    std::uint32_t relName = AddString(shstrtab, ".rel" + m_sectionName);
+    std::uint32_t symtabName = AddString(shstrtab, ".symtab");
+    std::uint32_t strtabName = AddString(shstrtab, ".strtab");
+    std::uint32_t shstrtabName = AddString(shstrtab, ".shstrtab");
+
+    std::vector<std::uint8_t> file(ELF_HEADER_SIZE, 0);
+
+    std::uint32_t dataOffset = file.size();
+    file.insert(file.end(), m_data.begin(), m_data.end());
+    PadTo(file, 4);
+    std::uint32_t relOffset = file.size();
+    file.insert(file.end(), rel.begin(), rel.end());
+    std::uint32_t symtabOffset = file.size();
+    file.insert(file.end(), symtab.begin(), symtab.end());
+    std::uint32_t strtabOffset = file.size();
+    file.insert(file.end(), strtab.begin(), strtab.end());
+    std::uint32_t shstrtabOffset = file.size();
+    file.insert(file.end(), shstrtab.begin(), shstrtab.end());
+    PadTo(file, 4);
+    std::uint32_t sectionHeadersOffset = file.size();
+
+    PutSectionHeader(file, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    PutSectionHeader(file, dataName, SHT_PROGBITS, SHF_ALLOC, dataOffset, m_data.size(), 0, 0, 4, 0);
+    PutSectionHeader(file, relName, SHT_REL, SHF_INFO_LINK, relOffset, rel.size(), SECTION_SYMTAB, SECTION_DATA, 4, REL_SIZE);
+    PutSectionHeader(file, symtabName, SHT_SYMTAB, 0, symtabOffset, symtab.size(), SECTION_STRTAB, firstGlobal, 4, SYMBOL_SIZE);
+    PutSectionHeader(file, strtabName, SHT_STRTAB, 0, strtabOffset, strtab.size(), 0, 0, 1, 0);
+    PutSectionHeader(file, shstrtabName, SHT_STRTAB, 0, shstrtabOffset, shstrtab.size(), 0, 0, 1, 0);
+
+    std::vector<std::uint8_t> header;
+    const std::uint8_t ident[16] = { 0x7F, 'E', 'L', 'F', 1, 1, 1 };
+    header.insert(header.end(), ident, ident + 16);
+    Put16(header, ET_REL);
+    Put16(header, EM_ARM);
+    Put32(header, 1);
+    Put32(header, 0);
+    Put32(header, 0);
+    Put32(header, sectionHeadersOffset);
+    Put32(header, EF_ARM_EABI_VER5);
+    Put16(header, ELF_HEADER_SIZE);
+    Put16(header, 0);
+    Put16(header, 0);
+    Put16(header, SECTION_HEADER_SIZE);
+    Put16(header, SECTION_COUNT);
+    Put16(header, SECTION_SHSTRTAB);
+    std::copy(header.begin(), header.end(), file.begin());
+
+    if (std::fwrite(file.data(), 1, file.size(), fp) != file.size())
+        RaiseError("failed to write object file");
+}
@@ -0,0 +1,37 @@
+#ifndef OBJECT_H
+#define OBJECT_H
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+// Builds a single-section ARM ELF relocatable object, so that songs can be
+// linked without running them through the assembler first.
+class ObjectWriter
+{
+public:
+    ObjectWriter(std::string sectionName) : m_sectionName(sectionName) {}
+    void AddByte(int value);
+    void AddWordRef(std::string symbol);
+    void AddLabel(std::string label);
+    void Align(int alignment);
+    void SetGlobal(std::string label);
+    void Write(std::FILE* fp);
+private:
+    struct Relocation
+    {
+        std::uint32_t offset;
+        std::string symbol;
+    };
+
+    std::string m_sectionName;
+    std::vector<std::uint8_t> m_data;
+    std::map<std::string, std::uint32_t> m_labels;
+    std::vector<std::string> m_labelOrder;
+    std::vector<Relocation> m_relocations;
+    std::string m_globalLabel;
+};
+
+#endif // OBJECT_H
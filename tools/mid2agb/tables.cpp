@@ -121,6 +121,17 @@ const int g_noteDurationLUT[] =
     96, // 96
 };
 
+// Lengths that have a Wxx and Nxx command, in command order.
+const int g_lengthTable[] =
+{
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 28,
+    30, 32, 36, 40, 42, 44, 48, 52, 54, 56, 60, 64, 66,
+    68, 72, 76, 78, 80, 84, 88, 90, 92, 96,
+};
+
+const int g_lengthTableSize = sizeof(g_lengthTable) / sizeof(g_lengthTable[0]);
+
 const int g_noteVelocityLUT[] =
 {
     0, // 0
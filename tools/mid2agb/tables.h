@@ -23,6 +23,8 @@
 
 extern const int g_noteDurationLUT[];
 extern const int g_noteVelocityLUT[];
+extern const int g_lengthTable[];
+extern const int g_lengthTableSize;
 extern const char* g_noteTable[];
 extern const char* g_minusNoteTable[];
 
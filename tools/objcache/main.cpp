@@ -0,0 +1,216 @@
+// Caches compiled objects by the hash of everything that went into them.
+//
+//   objcache get CACHE_DIR OUTPUT KEY...
+//   objcache put CACHE_DIR OUTPUT KEY...
+//
+// "get" copies the cached object for KEY to OUTPUT and exits with 0, or exits
+// with 1 if there is none. "put" stores OUTPUT as the object for KEY.
+// Each KEY argument is one of:
+//   -f FILE   the contents of FILE
+//   -t TOOL   the identity of the program TOOL (its path, size and mtime),
+//             looked up in PATH if it has no directory
+//   STRING    the string itself, e.g. a command line
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+#include "sha256.h"
+
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#define MakeDirectory(path) _mkdir(path)
+#define getpid _getpid
+#else
+#include <unistd.h>
+#define MakeDirectory(path) mkdir(path, 0777)
+#endif
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(2);                                \
+} while (0)
+
+static bool ReadWholeFile(const std::string& path, std::vector<char>& buffer)
+{
+    FILE *fp = std::fopen(path.c_str(), "rb");
+
+    if (fp == NULL)
+        return false;
+
+    std::fseek(fp, 0, SEEK_END);
+    long size = std::ftell(fp);
+    std::fseek(fp, 0, SEEK_SET);
+    buffer.resize(size);
+
+    bool ok = size == 0 || std::fread(buffer.data(), size, 1, fp) == 1;
+    std::fclose(fp);
+    return ok;
+}
+
+// Writes the file under a temporary name first, so that a concurrent reader
+// or an interrupted build never sees a partial file.
+static void WriteWholeFile(const std::string& path, const std::vector<char>& buffer)
+{
+    std::string tempPath = path + ".tmp" + std::to_string(getpid());
+    FILE *fp = std::fopen(tempPath.c_str(), "wb");
+
+    if (fp == NULL)
+        FATAL_ERROR("error: failed to open \"%s\" for writing\n", tempPath.c_str());
+
+    if (!buffer.empty() && std::fwrite(buffer.data(), buffer.size(), 1, fp) != 1)
+        FATAL_ERROR("error: failed to write \"%s\"\n", tempPath.c_str());
+
+    std::fclose(fp);
+
+#ifdef _WIN32
+    std::remove(path.c_str());
+#endif
+
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+        FATAL_ERROR("error: failed to rename \"%s\" to \"%s\"\n", tempPath.c_str(), path.c_str());
+}
+
+static std::string FindTool(const std::string& name)
+{
+    if (name.find('/') != std::string::npos)
+        return name;
+
+    const char *pathVar = std::getenv("PATH");
+
+    if (pathVar == NULL)
+        return name;
+
+    std::string paths = pathVar;
+    std::size_t start = 0;
+
+    while (start <= paths.size())
+    {
+        std::size_t end = paths.find(':', start);
+
+        if (end == std::string::npos)
+            end = paths.size();
+
+        std::string dir = paths.substr(start, end - start);
+        std::string candidate = (dir.empty() ? "." : dir) + "/" + name;
+        struct stat st;
+
+        if (stat(candidate.c_str(), &st) == 0 && S_ISREG(st.st_mode))
+            return candidate;
+
+        start = end + 1;
+    }
+
+    return name;
+}
+
+static void HashItem(Sha256& hash, char kind, const std::string& data)
+{
+    hash.Update(&kind, 1);
+    hash.Update(std::to_string(data.size()) + ":");
+    hash.Update(data);
+}
+
+static std::string ComputeKey(int argc, char **argv)
+{
+    Sha256 hash;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "-f") == 0 || std::strcmp(argv[i], "-t") == 0)
+        {
+            if (i + 1 >= argc)
+                FATAL_ERROR("error: missing argument after \"%s\"\n", argv[i]);
+
+            std::string path = argv[i + 1];
+
+            if (argv[i][1] == 'f')
+            {
+                std::vector<char> contents;
+
+                if (!ReadWholeFile(path, contents))
+                    FATAL_ERROR("error: failed to read \"%s\"\n", path.c_str());
+
+                HashItem(hash, 'f', std::string(contents.begin(), contents.end()));
+            }
+            else
+            {
+                // Tools are identified by their file metadata rather than
+                // their contents, which would mean hashing the compiler for
+                // every object. Rebuilding a tool changes its mtime.
+                std::string toolPath = FindTool(path);
+                struct stat st;
+                std::string identity = toolPath;
+
+                if (stat(toolPath.c_str(), &st) == 0)
+                    identity += ":" + std::to_string(st.st_size) + ":" + std::to_string(st.st_mtime);
+
+                HashItem(hash, 't', identity);
+            }
+
+            i++;
+        }
+        else
+        {
+            HashItem(hash, 's', argv[i]);
+        }
+    }
+
+    return hash.HexDigest();
+}
+
+static void PrintUsage(void)
+{
+    std::fprintf(stderr,
+        "Usage: objcache get CACHE_DIR OUTPUT KEY...\n"
+        "       objcache put CACHE_DIR OUTPUT KEY...\n"
+        "KEY is -f FILE, -t TOOL or a string.\n");
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 5)
+    {
+        PrintUsage();
+        return 2;
+    }
+
+    std::string command = argv[1];
+    std::string cacheDir = argv[2];
+    std::string outputPath = argv[3];
+    std::string key = ComputeKey(argc - 4, argv + 4);
+
+    // Objects are spread over 256 subdirectories, as ccache and git do.
+    std::string subdir = cacheDir + "/" + key.substr(0, 2);
+    std::string cachePath = subdir + "/" + key.substr(2) + ".o";
+    std::vector<char> contents;
+
+    if (command == "get")
+    {
+        if (!ReadWholeFile(cachePath, contents))
+            return 1;
+
+        WriteWholeFile(outputPath, contents);
+    }
+    else if (command == "put")
+    {
+        if (!ReadWholeFile(outputPath, contents))
+            FATAL_ERROR("error: failed to read \"%s\"\n", outputPath.c_str());
+
+        MakeDirectory(cacheDir.c_str());
+        MakeDirectory(subdir.c_str());
+        WriteWholeFile(cachePath, contents);
+    }
+    else
+    {
+        PrintUsage();
+        return 2;
+    }
+
+    return 0;
+}
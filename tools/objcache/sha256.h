@@ -0,0 +1,24 @@
+#ifndef SHA256_H
+#define SHA256_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class Sha256
+{
+public:
+    Sha256();
+    void Update(const void *data, std::size_t length);
+    void Update(const std::string& s) { Update(s.data(), s.size()); }
+    std::string HexDigest();
+private:
+    void ProcessBlock(const std::uint8_t *block);
+
+    std::uint32_t m_state[8];
+    std::uint8_t m_block[64];
+    std::size_t m_blockLength;
+    std::uint64_t m_totalLength;
+};
+
+#endif // SHA256_H
@@ -26,9 +26,11 @@
 #include "char_util.h"
 #include "utf8.h"
 #include "string_parser.h"
+#include "trace.h"
 
 AsmFile::AsmFile(std::string filename) : m_filename(filename)
 {
+    std::uint64_t traceStart = TraceBegin();
     FILE *fp = std::fopen(filename.c_str(), "rb");
 
     if (fp == NULL)
@@ -53,6 +55,7 @@ AsmFile::AsmFile(std::string filename) : m_filename(filename)
     m_buffer[m_size] = 0;
 
     std::fclose(fp);
+    TraceEnd("read", traceStart, filename.c_str());
 
     m_pos = 0;
     m_lineNum = 1;
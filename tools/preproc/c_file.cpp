@@ -28,9 +28,12 @@
 #include "char_util.h"
 #include "utf8.h"
 #include "string_parser.h"
+#include "trace.h"
+#include "int_format.h"
 
 CFile::CFile(std::string filename) : m_filename(filename)
 {
+    std::uint64_t traceStart = TraceBegin();
     FILE *fp = std::fopen(filename.c_str(), "rb");
 
     if (fp == NULL)
@@ -53,6 +56,7 @@ CFile::CFile(std::string filename) : m_filename(filename)
     m_buffer[m_size] = 0;
 
     std::fclose(fp);
+    TraceEnd("read", traceStart, filename.c_str());
 
     m_pos = 0;
     m_lineNum = 1;
@@ -271,24 +275,7 @@ std::unique_ptr<unsigned char[]> CFile::ReadWholeFile(const std::string& path, i
     return buffer;
 }
 
-int ExtractData(const std::unique_ptr<unsigned char[]>& buffer, int offset, int size)
-{
-    switch (size)
-    {
-    case 1:
-        return buffer[offset];
-    case 2:
-        return (buffer[offset + 1] << 8)
-            | buffer[offset];
-    case 4:
-        return (buffer[offset + 3] << 24)
-            | (buffer[offset + 2] << 16)
-            | (buffer[offset + 1] << 8)
-            | buffer[offset];
-    default:
-        FATAL_ERROR("Invalid size passed to ExtractData.\n");
-    }
-}
+static TextBuffer s_incbinOutput;
 
 void CFile::TryConvertIncbin()
 {
@@ -368,19 +355,16 @@ void CFile::TryConvertIncbin()
         if ((fileSize % size) != 0)
             RaiseError("Size %d doesn't evenly divide file size %d.\n", size, fileSize);
 
-        int count = fileSize / size;
-        int offset = 0;
+        ArrayFormat format;
+        format.size = size;
+        format.style = isSigned ? INT_STYLE_SIGNED : INT_STYLE_UNSIGNED;
+        format.width = 0;
+        format.columns = 0;
+        format.separator = ",";
 
-        for (int i = 0; i < count; i++)
-        {
-            int data = ExtractData(buffer, offset, size);
-            offset += size;
-
-            if (isSigned)
-                std::printf("%d,", data);
-            else
-                std::printf("%uu,", data);
-        }
+        TextBufferInit(&s_incbinOutput, stdout);
+        WriteIntArray(&s_incbinOutput, buffer.get(), fileSize, &format);
+        TextBufferFlush(&s_incbinOutput);
 
         SkipWhitespace();
 
@@ -24,6 +24,7 @@
 #include "asm_file.h"
 #include "c_file.h"
 #include "charmap.h"
+#include "trace.h"
 
 Charmap* g_charmap;
 
@@ -132,19 +133,29 @@ char* GetFileExtension(char* filename)
 
 int main(int argc, char **argv)
 {
+    TraceInit("preproc", argc, argv);
+
     if (argc != 3)
     {
         std::fprintf(stderr, "Usage: %s SRC_FILE CHARMAP_FILE", argv[0]);
         return 1;
     }
 
-    g_charmap = new Charmap(argv[2]);
+    // A host process (tools/assetd) may have loaded the charmap already.
+    if (g_charmap == nullptr)
+    {
+        std::uint64_t traceStart = TraceBegin();
+        g_charmap = new Charmap(argv[2]);
+        TraceEnd("parse", traceStart, argv[2]);
+    }
 
     char* extension = GetFileExtension(argv[1]);
 
     if (!extension)
         FATAL_ERROR("\"%s\" has no file extension.\n", argv[1]);
 
+    std::uint64_t traceStart = TraceBegin();
+
     if ((extension[0] == 's') && extension[1] == 0)
         PreprocAsmFile(argv[1]);
     else if ((extension[0] == 'c' || extension[0] == 'i') && extension[1] == 0)
@@ -152,5 +163,7 @@ int main(int argc, char **argv)
     else
         FATAL_ERROR("\"%s\" has an unknown file extension of \"%s\".\n", argv[1], extension);
 
+    TraceEnd("convert", traceStart, argv[1]);
+
     return 0;
 }
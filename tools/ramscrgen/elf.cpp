@@ -7,230 +7,267 @@
 #include "ramscrgen.h"
 #include "elf.h"
 
-#define SHN_COMMON 0xFFF2
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// A whole file mapped into memory. Where mmap isn't available, the file is
+// read into a buffer instead.
+class MappedFile
+{
+public:
+    MappedFile(std::string path);
+    MappedFile(const MappedFile&) = delete;
+    ~MappedFile();
+    const std::uint8_t *Data() const { return m_data; }
+    std::size_t Size() const { return m_size; }
+private:
+    const std::uint8_t *m_data;
+    std::size_t m_size;
+    bool m_mapped;
+    std::vector<std::uint8_t> m_buffer;
+};
 
-static std::string s_elfPath;
-static std::string s_archiveFilePath;
-static std::string s_archiveObjectPath;
+MappedFile::MappedFile(std::string path) : m_data(nullptr), m_size(0), m_mapped(false)
+{
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
 
-static FILE *s_file;
+    if (fd < 0)
+        FATAL_ERROR("error: failed to open \"%s\" for reading\n", path.c_str());
 
-static std::uint32_t s_sectionHeaderOffset;
-static int s_sectionHeaderEntrySize;
-static int s_sectionCount;
-static int s_shstrtabIndex;
+    struct stat st;
 
-static std::uint32_t s_symtabOffset;
-static std::uint32_t s_strtabOffset;
+    if (fstat(fd, &st) != 0)
+        FATAL_ERROR("error: failed to get size of \"%s\"\n", path.c_str());
 
-static std::uint32_t s_symbolCount;
-static std::uint32_t s_elfFileOffset;
+    m_size = st.st_size;
 
-struct Symbol
-{
-    std::uint32_t nameOffset;
-    std::uint32_t size;
-};
+    if (m_size != 0)
+    {
+        void *data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
 
-static void Seek(long offset)
-{
-    if (std::fseek(s_file, s_elfFileOffset + offset, SEEK_SET) != 0)
-        FATAL_ERROR("error: failed to seek to %ld in \"%s\"", offset, s_elfPath.c_str());
+        if (data == MAP_FAILED)
+            FATAL_ERROR("error: failed to map \"%s\"\n", path.c_str());
+
+        m_data = static_cast<const std::uint8_t *>(data);
+        m_mapped = true;
+    }
+
+    close(fd);
+#else
+    FILE *fp = std::fopen(path.c_str(), "rb");
+
+    if (fp == NULL)
+        FATAL_ERROR("error: failed to open \"%s\" for reading\n", path.c_str());
+
+    std::fseek(fp, 0, SEEK_END);
+    m_size = std::ftell(fp);
+    std::fseek(fp, 0, SEEK_SET);
+    m_buffer.resize(m_size);
+
+    if (m_size != 0 && std::fread(m_buffer.data(), m_size, 1, fp) != 1)
+        FATAL_ERROR("error: failed to read \"%s\"\n", path.c_str());
+
+    std::fclose(fp);
+    m_data = m_buffer.data();
+#endif
 }
 
-static void Skip(long offset)
+MappedFile::~MappedFile()
 {
-    if (std::fseek(s_file, offset, SEEK_CUR) != 0)
-        FATAL_ERROR("error: failed to skip %ld bytes in \"%s\"", offset, s_elfPath.c_str());
+#ifndef _WIN32
+    if (m_mapped)
+        munmap(const_cast<std::uint8_t *>(m_data), m_size);
+#endif
 }
 
-static std::uint32_t ReadInt8()
+// A bounds-checked view of one ELF file, either a whole file or an archive member.
+struct ElfView
 {
-    int c = std::fgetc(s_file);
-
-    if (c < 0)
-        FATAL_ERROR("error: unexpected EOF when reading ELF file \"%s\"\n", s_elfPath.c_str());
+    std::string path;
+    const std::uint8_t *data;
+    std::size_t size;
+};
 
-    return c;
+static void CheckBounds(const ElfView& elf, std::size_t offset, std::size_t length)
+{
+    if (offset > elf.size || length > elf.size - offset)
+        FATAL_ERROR("error: unexpected EOF when reading ELF file \"%s\"\n", elf.path.c_str());
 }
 
-static std::uint32_t ReadInt16()
+static std::uint32_t ReadInt16(const ElfView& elf, std::size_t offset)
 {
-    std::uint32_t val = 0;
-    val |= ReadInt8();
-    val |= ReadInt8() << 8;
-    return val;
+    CheckBounds(elf, offset, 2);
+    const std::uint8_t *p = elf.data + offset;
+    return p[0] | (p[1] << 8);
 }
 
-static std::uint32_t ReadInt32()
+static std::uint32_t ReadInt32(const ElfView& elf, std::size_t offset)
 {
-    std::uint32_t val = 0;
-    val |= ReadInt8();
-    val |= ReadInt8() << 8;
-    val |= ReadInt8() << 16;
-    val |= ReadInt8() << 24;
-    return val;
+    CheckBounds(elf, offset, 4);
+    const std::uint8_t *p = elf.data + offset;
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
 }
 
-static std::string ReadString()
+static std::string ReadString(const ElfView& elf, std::size_t offset)
 {
-    std::string s;
-    char c;
+    CheckBounds(elf, offset, 0);
+    const void *end = std::memchr(elf.data + offset, 0, elf.size - offset);
 
-    while ((c = ReadInt8()) != 0)
-        s += c;
+    if (end == nullptr)
+        FATAL_ERROR("error: unterminated string in ELF file \"%s\"\n", elf.path.c_str());
 
-    return s;
+    return std::string(reinterpret_cast<const char *>(elf.data + offset), static_cast<const std::uint8_t *>(end) - (elf.data + offset));
 }
 
-static void VerifyElfIdent()
+static void VerifyElfIdent(const ElfView& elf)
 {
-    char expectedMagic[4] = { 0x7F, 'E', 'L', 'F' };
-    char magic[4];
+    const std::uint8_t expectedMagic[4] = { 0x7F, 'E', 'L', 'F' };
 
-    if (std::fread(magic, 4, 1, s_file) != 1)
-        FATAL_ERROR("error: failed to read ELF magic from \"%s\"\n", s_elfPath.c_str());
+    if (elf.size < 0x34)
+        FATAL_ERROR("error: failed to read ELF header from \"%s\"\n", elf.path.c_str());
 
-    if (std::memcmp(magic, expectedMagic, 4) != 0)
-        FATAL_ERROR("error: ELF magic did not match in \"%s\"\n", s_elfPath.c_str());
+    if (std::memcmp(elf.data, expectedMagic, 4) != 0)
+        FATAL_ERROR("error: ELF magic did not match in \"%s\"\n", elf.path.c_str());
 
-    if (std::fgetc(s_file) != 1)
-        FATAL_ERROR("error: \"%s\" not 32-bit ELF\n", s_elfPath.c_str());
+    if (elf.data[4] != 1)
+        FATAL_ERROR("error: \"%s\" not 32-bit ELF\n", elf.path.c_str());
 
-    if (std::fgetc(s_file) != 1)
-        FATAL_ERROR("error: \"%s\" not little-endian ELF\n", s_elfPath.c_str());
+    if (elf.data[5] != 1)
+        FATAL_ERROR("error: \"%s\" not little-endian ELF\n", elf.path.c_str());
 }
 
-static void VerifyAr()
+static ElfView FindArObj(const MappedFile& archive, std::string archivePath, std::string objectPath, std::string elfPath)
 {
-    char expectedMagic[8] = {'!', '<', 'a', 'r', 'c', 'h', '>', '\n'};
-    char magic[8];
+    const char expectedMagic[8] = {'!', '<', 'a', 'r', 'c', 'h', '>', '\n'};
+    const char expectedEndMagic[2] = { 0x60, 0x0a };
+    const char *data = reinterpret_cast<const char *>(archive.Data());
+    std::size_t size = archive.Size();
 
-    if (std::fread(magic, 8, 1, s_file) != 1)
-        FATAL_ERROR("error: failed to read AR magic from \"%s\"\n", s_archiveFilePath.c_str());
+    if (size < 8)
+        FATAL_ERROR("error: failed to read AR magic from \"%s\"\n", archivePath.c_str());
 
-    if (std::memcmp(magic, expectedMagic, 8) != 0)
-        FATAL_ERROR("error: AR magic did not match in \"%s\"\n", s_archiveFilePath.c_str());
-}
+    if (std::memcmp(data, expectedMagic, 8) != 0)
+        FATAL_ERROR("error: AR magic did not match in \"%s\"\n", archivePath.c_str());
 
-static void ReadElfHeader()
-{
-    Seek(0x20);
-    s_sectionHeaderOffset = ReadInt32();
-    Seek(0x2E);
-    s_sectionHeaderEntrySize = ReadInt16();
-    s_sectionCount = ReadInt16();
-    s_shstrtabIndex = ReadInt16();
-}
+    std::size_t pos = 8;
 
-static void FindArObj()
-{
-    char file_ident[17] = {0};
-    char filesize_s[11] = {0};
-    char expectedEndMagic[2] = { 0x60, 0x0a };
-    char end_magic[2];
-    std::size_t filesize;
-
-    Seek(8);
-    while (!std::feof(s_file)) {
-        if (std::fread(file_ident, 16, 1, s_file) != 1)
-            FATAL_ERROR("error: failed to read file ident in \"%s\"\n", s_archiveFilePath.c_str());
-        Skip(32);
-        if (std::fread(filesize_s, 10, 1, s_file) != 1)
-            FATAL_ERROR("error: failed to read filesize in \"%s\"\n", s_archiveFilePath.c_str());
-        if (std::fread(end_magic, 2, 1, s_file) != 1)
-            FATAL_ERROR("error: failed to read end sentinel in \"%s\"\n", s_archiveFilePath.c_str());
-        if (std::memcmp(end_magic, expectedEndMagic, 2) != 0)
-            FATAL_ERROR("error: corrupted archive header in \"%s\" at \"%s\"\n", s_archiveFilePath.c_str(), file_ident);
+    while (pos < size)
+    {
+        // Each member header is 60 bytes: the name, unused fields, the size and an end sentinel.
+        if (size - pos < 60)
+            FATAL_ERROR("error: failed to read file ident in \"%s\"\n", archivePath.c_str());
+
+        char file_ident[17] = {0};
+        char filesize_s[11] = {0};
+        std::memcpy(file_ident, data + pos, 16);
+        std::memcpy(filesize_s, data + pos + 48, 10);
+
+        if (std::memcmp(data + pos + 58, expectedEndMagic, 2) != 0)
+            FATAL_ERROR("error: corrupted archive header in \"%s\" at \"%s\"\n", archivePath.c_str(), file_ident);
+
+        pos += 60;
 
         char * ptr = std::strchr(file_ident, '/');
         if (ptr != nullptr)
             *ptr = 0;
-        filesize = std::strtoul(filesize_s, nullptr, 10);
-        if (std::strncmp(s_archiveObjectPath.c_str(), file_ident, 16) == 0) {
-            s_elfFileOffset = std::ftell(s_file);
-            return;
-        }
-        Skip(filesize);
+        std::size_t filesize = std::strtoul(filesize_s, nullptr, 10);
+
+        if (filesize > size - pos)
+            FATAL_ERROR("error: member \"%s\" runs past the end of \"%s\"\n", file_ident, archivePath.c_str());
+
+        if (std::strncmp(objectPath.c_str(), file_ident, 16) == 0)
+            return { elfPath, archive.Data() + pos, filesize };
+
+        pos += filesize;
     }
 
-    FATAL_ERROR("error: could not find object \"%s\" in archive \"%s\"\n", s_archiveObjectPath.c_str(), s_archiveFilePath.c_str());
+    FATAL_ERROR("error: could not find object \"%s\" in archive \"%s\"\n", objectPath.c_str(), archivePath.c_str());
 }
 
-static std::string GetSectionName(std::uint32_t shstrtabOffset, int index)
+static std::vector<ElfSymbol> GetSymbols_Shared(const ElfView& elf)
 {
-    Seek(s_sectionHeaderOffset + s_sectionHeaderEntrySize * index);
-    std::uint32_t nameOffset = ReadInt32();
-    Seek(shstrtabOffset + nameOffset);
-    return ReadString();
-}
+    VerifyElfIdent(elf);
 
-static void FindTableOffsets()
-{
-    s_symtabOffset = 0;
-    s_strtabOffset = 0;
+    std::uint32_t sectionHeaderOffset = ReadInt32(elf, 0x20);
+    std::uint32_t sectionHeaderEntrySize = ReadInt16(elf, 0x2E);
+    std::uint32_t sectionCount = ReadInt16(elf, 0x30);
+    std::uint32_t shstrtabIndex = ReadInt16(elf, 0x32);
 
-    Seek(s_sectionHeaderOffset + s_sectionHeaderEntrySize * s_shstrtabIndex + 0x10);
-    std::uint32_t shstrtabOffset = ReadInt32();
+    CheckBounds(elf, sectionHeaderOffset, static_cast<std::size_t>(sectionHeaderEntrySize) * sectionCount);
 
-    for (int i = 0; i < s_sectionCount; i++)
+    std::uint32_t shstrtabOffset = ReadInt32(elf, sectionHeaderOffset + sectionHeaderEntrySize * shstrtabIndex + 0x10);
+    std::uint32_t symtabOffset = 0;
+    std::uint32_t symbolCount = 0;
+    std::uint32_t strtabOffset = 0;
+    std::vector<std::string> sectionNames(sectionCount);
+
+    for (std::uint32_t i = 0; i < sectionCount; i++)
     {
-        std::string name = GetSectionName(shstrtabOffset, i);
+        std::size_t header = sectionHeaderOffset + sectionHeaderEntrySize * i;
+        std::string name = ReadString(elf, shstrtabOffset + ReadInt32(elf, header));
 
         if (name == ".symtab")
         {
-            if (s_symtabOffset)
-                FATAL_ERROR("error: mutiple .symtab sections found in \"%s\"\n", s_elfPath.c_str());
-            Seek(s_sectionHeaderOffset + s_sectionHeaderEntrySize * i + 0x10);
-            s_symtabOffset = ReadInt32();
-            std::uint32_t size = ReadInt32();
-            s_symbolCount = size / 16;
+            if (symtabOffset)
+                FATAL_ERROR("error: mutiple .symtab sections found in \"%s\"\n", elf.path.c_str());
+            symtabOffset = ReadInt32(elf, header + 0x10);
+            symbolCount = ReadInt32(elf, header + 0x14) / 16;
         }
         else if (name == ".strtab")
         {
-            if (s_strtabOffset)
-                FATAL_ERROR("error: mutiple .strtab sections found in \"%s\"\n", s_elfPath.c_str());
-            Seek(s_sectionHeaderOffset + s_sectionHeaderEntrySize * i + 0x10);
-            s_strtabOffset = ReadInt32();
+            if (strtabOffset)
+                FATAL_ERROR("error: mutiple .strtab sections found in \"%s\"\n", elf.path.c_str());
+            strtabOffset = ReadInt32(elf, header + 0x10);
         }
+
+        sectionNames[i] = name;
     }
 
-    if (!s_symtabOffset)
-        FATAL_ERROR("error: couldn't find .symtab section in \"%s\"\n", s_elfPath.c_str());
+    if (!symtabOffset)
+        FATAL_ERROR("error: couldn't find .symtab section in \"%s\"\n", elf.path.c_str());
 
-    if (!s_strtabOffset)
-        FATAL_ERROR("error: couldn't find .strtab section in \"%s\"\n", s_elfPath.c_str());
-}
+    if (!strtabOffset)
+        FATAL_ERROR("error: couldn't find .strtab section in \"%s\"\n", elf.path.c_str());
 
-static std::map<std::string, std::uint32_t> GetCommonSymbols_Shared()
-{
-    VerifyElfIdent();
-    ReadElfHeader();
-    FindTableOffsets();
+    CheckBounds(elf, symtabOffset, static_cast<std::size_t>(symbolCount) * 16);
 
-    std::map<std::string, std::uint32_t> commonSymbols;
+    std::vector<ElfSymbol> symbols;
+
+    // Entry 0 is the reserved null symbol.
+    for (std::uint32_t i = 1; i < symbolCount; i++)
+    {
+        std::size_t sym = symtabOffset + 16 * i;
+        ElfSymbol symbol;
 
-    std::vector<Symbol> commonSymbolVec;
+        symbol.name = ReadString(elf, strtabOffset + ReadInt32(elf, sym));
+        symbol.value = ReadInt32(elf, sym + 4);
+        symbol.size = ReadInt32(elf, sym + 8);
+        symbol.info = elf.data[sym + 12];
+        symbol.other = elf.data[sym + 13];
+        symbol.sectionIndex = ReadInt16(elf, sym + 14);
 
-    Seek(s_symtabOffset);
+        if (symbol.sectionIndex < sectionCount)
+            symbol.sectionName = sectionNames[symbol.sectionIndex];
 
-    for (std::uint32_t i = 0; i < s_symbolCount; i++)
-    {
-        Symbol sym;
-        sym.nameOffset = ReadInt32();
-        Skip(4);
-        sym.size = ReadInt32();
-        Skip(2);
-        std::uint16_t sectionIndex = ReadInt16();
-        if (sectionIndex == SHN_COMMON)
-            commonSymbolVec.push_back(sym);
+        symbols.push_back(symbol);
     }
 
-    for (const Symbol& sym : commonSymbolVec)
+    return symbols;
+}
+
+static std::map<std::string, std::uint32_t> GetCommonSymbols_Shared(const ElfView& elf)
+{
+    std::map<std::string, std::uint32_t> commonSymbols;
+
+    for (const ElfSymbol& symbol : GetSymbols_Shared(elf))
     {
-        Seek(s_strtabOffset + sym.nameOffset);
-        std::string name = ReadString();
-        commonSymbols[name] = sym.size;
+        if (symbol.sectionIndex == SHN_COMMON)
+            commonSymbols[symbol.name] = symbol.size;
     }
 
     return commonSymbols;
@@ -240,33 +277,28 @@ std::map<std::string, std::uint32_t> GetCommonSymbolsFromLib(std::string sourceP
 {
     std::size_t colonPos = libpath.find(':');
     if (colonPos == std::string::npos)
-        FATAL_ERROR("error: missing colon separator in libfile \"%s\"\n", s_elfPath.c_str());
+        FATAL_ERROR("error: missing colon separator in libfile \"%s\"\n", libpath.c_str());
 
-    s_archiveObjectPath = libpath.substr(colonPos + 1);
-    s_archiveFilePath = sourcePath + "/" + libpath.substr(1, colonPos - 1);
-    s_elfPath = sourcePath + "/" + libpath.substr(1);
+    std::string archiveObjectPath = libpath.substr(colonPos + 1);
+    std::string archiveFilePath = sourcePath + "/" + libpath.substr(1, colonPos - 1);
+    std::string elfPath = sourcePath + "/" + libpath.substr(1);
 
-    s_file = std::fopen(s_archiveFilePath.c_str(), "rb");
-
-    if (s_file == NULL)
-        FATAL_ERROR("error: failed to open \"%s\" for reading\n", s_archiveFilePath.c_str());
-
-    VerifyAr();
-    FindArObj();
-    return GetCommonSymbols_Shared();
+    MappedFile archive(archiveFilePath);
+    return GetCommonSymbols_Shared(FindArObj(archive, archiveFilePath, archiveObjectPath, elfPath));
 }
 
 std::map<std::string, std::uint32_t> GetCommonSymbols(std::string sourcePath, std::string path)
 {
-    s_elfFileOffset = 0;
     if (path[0] == '*')
         return GetCommonSymbolsFromLib(sourcePath, path);
 
-    s_elfPath = sourcePath + "/" + path;
-    s_file = std::fopen(s_elfPath.c_str(), "rb");
-
-    if (s_file == NULL)
-        FATAL_ERROR("error: failed to open \"%s\" for reading\n", path.c_str());
+    std::string elfPath = sourcePath + "/" + path;
+    MappedFile file(elfPath);
+    return GetCommonSymbols_Shared({ elfPath, file.Data(), file.Size() });
+}
 
-    return GetCommonSymbols_Shared();
+std::vector<ElfSymbol> GetSymbols(std::string path)
+{
+    MappedFile file(path);
+    return GetSymbols_Shared({ path, file.Data(), file.Size() });
 }
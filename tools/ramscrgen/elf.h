@@ -24,7 +24,24 @@
 #include <cstdint>
 #include <map>
 #include <string>
+#include <vector>
 
+#define SHN_UNDEF  0
+#define SHN_ABS    0xFFF1
+#define SHN_COMMON 0xFFF2
+
+struct ElfSymbol
+{
+    std::string name;
+    std::uint32_t value;
+    std::uint32_t size;
+    std::uint8_t info;
+    std::uint8_t other;
+    std::uint16_t sectionIndex;
+    std::string sectionName;
+};
+
+std::vector<ElfSymbol> GetSymbols(std::string path);
 std::map<std::string, std::uint32_t> GetCommonSymbols(std::string sourcePath, std::string path);
 
 #endif // ELF_H
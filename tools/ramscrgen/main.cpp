@@ -20,14 +20,60 @@
 
 #include <cstdio>
 #include <cstring>
+#include <fstream>
+#include <future>
+#include <map>
+#include <sstream>
 #include <string>
 #include "ramscrgen.h"
 #include "sym_file.h"
 #include "elf.h"
+#include "trace.h"
 
-void HandleCommonInclude(std::string filename, std::string sourcePath, std::string symOrderPath, std::string lang)
+typedef std::map<std::string, std::uint32_t> CommonSymbolMap;
+
+// Starts reading the common symbols of every object included by the sym file,
+// each on its own thread. This is only a head start: the includes are found with
+// a quick scan, and anything missed here is read when the include is handled.
+std::map<std::string, std::shared_future<CommonSymbolMap>> LoadCommonSymbols(std::string filename, std::string lang, std::string sourcePath, std::string libSourcePath)
+{
+    std::map<std::string, std::shared_future<CommonSymbolMap>> commonSymbols;
+    std::ifstream file(filename);
+    std::string line;
+    bool skipping = false;
+
+    while (std::getline(file, line))
+    {
+        std::istringstream words(line);
+        std::string directive;
+        std::string arg;
+
+        words >> directive >> arg;
+
+        if (directive == "#begin")
+        {
+            skipping = (arg != lang);
+        }
+        else if (directive == "#end")
+        {
+            skipping = false;
+        }
+        else if (!skipping && directive == ".include" && arg.length() > 2 && arg.front() == '"' && arg.back() == '"')
+        {
+            std::string include = arg.substr(1, arg.length() - 2);
+            std::string path = include[0] == '*' ? libSourcePath : sourcePath;
+            std::string filePath = include[0] == '*' ? path + "/" + include.substr(1, include.find(':') - 1) : path + "/" + include;
+
+            if (commonSymbols.count(include) == 0 && std::ifstream(filePath).good())
+                commonSymbols[include] = std::async(std::launch::async, GetCommonSymbols, path, include).share();
+        }
+    }
+
+    return commonSymbols;
+}
+
+void HandleCommonInclude(std::string filename, CommonSymbolMap& commonSymbols, std::string symOrderPath, std::string lang)
 {
-    auto commonSymbols = GetCommonSymbols(sourcePath, filename);
     std::size_t dotIndex;
 
     if (filename[0] == '*') {
@@ -81,7 +127,16 @@ void HandleCommonInclude(std::string filename, std::string sourcePath, std::stri
 
 void ConvertSymFile(std::string filename, std::string sectionName, std::string lang, bool common, std::string sourcePath, std::string commonSymPath, std::string libSourcePath)
 {
+    std::map<std::string, std::shared_future<CommonSymbolMap>> commonSymbols;
+
+    if (common)
+        commonSymbols = LoadCommonSymbols(filename, lang, sourcePath, libSourcePath);
+
+    std::uint64_t traceStart = TraceBegin();
     SymFile symFile(filename);
+    TraceEnd("read", traceStart, filename.c_str());
+
+    traceStart = TraceBegin();
 
     while (!symFile.IsAtEnd())
     {
@@ -97,9 +152,15 @@ void ConvertSymFile(std::string filename, std::string sectionName, std::string l
             symFile.ExpectEmptyRestOfLine();
             printf(". = ALIGN(4);\n");
             if (common)
-                HandleCommonInclude(incFilename, incFilename[0] == '*' ? libSourcePath : sourcePath, commonSymPath, lang);
+            {
+                std::string path = incFilename[0] == '*' ? libSourcePath : sourcePath;
+                CommonSymbolMap symbols = commonSymbols.count(incFilename) ? commonSymbols[incFilename].get() : GetCommonSymbols(path, incFilename);
+                HandleCommonInclude(incFilename, symbols, commonSymPath, lang);
+            }
             else
+            {
                 printf("%s(%s);\n", incFilename.c_str(), sectionName.c_str());
+            }
             break;
         }
         case Directive::Space:
@@ -138,10 +199,14 @@ void ConvertSymFile(std::string filename, std::string sectionName, std::string l
         }
         }
     }
+
+    TraceEnd("convert", traceStart, filename.c_str());
 }
 
 int main(int argc, char **argv)
 {
+    TraceInit("ramscrgen", argc, argv);
+
     if (argc < 4)
     {
         fprintf(stderr, "Usage: %s SECTION_NAME SYM_FILE LANG [-c SRC_PATH,COMMON_SYM_PATH]", argv[0]);
@@ -0,0 +1,197 @@
+#include <cstring>
+#include "romlink.h"
+#include "elf.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::string& path) : m_data(nullptr), m_size(0), m_mapped(false)
+{
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+
+    if (fd < 0)
+        FATAL_ERROR("error: failed to open \"%s\" for reading\n", path.c_str());
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0)
+        FATAL_ERROR("error: failed to get size of \"%s\"\n", path.c_str());
+
+    m_size = st.st_size;
+
+    if (m_size != 0)
+    {
+        void *data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (data == MAP_FAILED)
+            FATAL_ERROR("error: failed to map \"%s\"\n", path.c_str());
+
+        m_data = static_cast<const std::uint8_t *>(data);
+        m_mapped = true;
+    }
+
+    close(fd);
+#else
+    FILE *fp = std::fopen(path.c_str(), "rb");
+
+    if (fp == NULL)
+        FATAL_ERROR("error: failed to open \"%s\" for reading\n", path.c_str());
+
+    std::fseek(fp, 0, SEEK_END);
+    m_size = std::ftell(fp);
+    std::fseek(fp, 0, SEEK_SET);
+    m_buffer.resize(m_size);
+
+    if (m_size != 0 && std::fread(m_buffer.data(), m_size, 1, fp) != 1)
+        FATAL_ERROR("error: failed to read \"%s\"\n", path.c_str());
+
+    std::fclose(fp);
+    m_data = m_buffer.data();
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#ifndef _WIN32
+    if (m_mapped)
+        munmap(const_cast<std::uint8_t *>(m_data), m_size);
+#endif
+}
+
+ElfFile::ElfFile(const std::string& path) : m_path(path), m_file(path)
+{
+    const std::uint8_t expectedMagic[4] = { 0x7F, 'E', 'L', 'F' };
+
+    if (m_file.Size() < 0x34 || std::memcmp(m_file.Data(), expectedMagic, 4) != 0)
+        FATAL_ERROR("error: \"%s\" isn't an ELF file\n", path.c_str());
+
+    if (m_file.Data()[4] != 1 || m_file.Data()[5] != 1)
+        FATAL_ERROR("error: \"%s\" isn't a 32-bit little-endian ELF file\n", path.c_str());
+
+    std::uint32_t programHeaderOffset = ReadInt32(0x1C);
+    std::uint32_t sectionHeaderOffset = ReadInt32(0x20);
+    std::uint32_t programHeaderEntrySize = ReadInt16(0x2A);
+    std::uint32_t programHeaderCount = ReadInt16(0x2C);
+    std::uint32_t sectionHeaderEntrySize = ReadInt16(0x2E);
+    std::uint32_t sectionCount = ReadInt16(0x30);
+    std::uint32_t shstrtabIndex = ReadInt16(0x32);
+
+    for (std::uint32_t i = 0; i < programHeaderCount; i++)
+    {
+        std::size_t header = programHeaderOffset + programHeaderEntrySize * i;
+        ElfSegment segment;
+
+        segment.type = ReadInt32(header);
+        segment.offset = ReadInt32(header + 0x04);
+        segment.virtualAddress = ReadInt32(header + 0x08);
+        segment.physicalAddress = ReadInt32(header + 0x0C);
+        segment.fileSize = ReadInt32(header + 0x10);
+        m_segments.push_back(segment);
+    }
+
+    if (shstrtabIndex >= sectionCount)
+        FATAL_ERROR("error: \"%s\" has no section name table\n", path.c_str());
+
+    std::uint32_t shstrtabOffset = ReadInt32(sectionHeaderOffset + sectionHeaderEntrySize * shstrtabIndex + 0x10);
+
+    for (std::uint32_t i = 0; i < sectionCount; i++)
+    {
+        std::size_t header = sectionHeaderOffset + sectionHeaderEntrySize * i;
+        ElfSection section;
+
+        section.name = ReadString(shstrtabOffset + ReadInt32(header));
+        section.type = ReadInt32(header + 0x04);
+        section.flags = ReadInt32(header + 0x08);
+        section.address = ReadInt32(header + 0x0C);
+        section.offset = ReadInt32(header + 0x10);
+        section.size = ReadInt32(header + 0x14);
+        section.link = ReadInt32(header + 0x18);
+        section.info = ReadInt32(header + 0x1C);
+
+        if (section.type != SHT_NOBITS)
+            CheckBounds(section.offset, section.size);
+
+        m_sections.push_back(section);
+    }
+
+    for (const ElfSection& section : m_sections)
+    {
+        if (section.type != SHT_SYMTAB)
+            continue;
+
+        if (section.link >= m_sections.size())
+            FATAL_ERROR("error: bad string table index in \"%s\"\n", path.c_str());
+
+        std::uint32_t strtabOffset = m_sections[section.link].offset;
+
+        for (std::uint32_t offset = 0; offset + 16 <= section.size; offset += 16)
+        {
+            std::size_t entry = section.offset + offset;
+            ElfSymbol symbol;
+
+            symbol.name = ReadString(strtabOffset + ReadInt32(entry));
+            symbol.value = ReadInt32(entry + 4);
+            symbol.size = ReadInt32(entry + 8);
+            symbol.binding = m_file.Data()[entry + 12] >> 4;
+            symbol.type = m_file.Data()[entry + 12] & 0xF;
+            symbol.sectionIndex = ReadInt16(entry + 14);
+            m_symbols.push_back(symbol);
+        }
+
+        break;
+    }
+}
+
+const std::uint8_t *ElfFile::SectionData(const ElfSection& section) const
+{
+    return m_file.Data() + section.offset;
+}
+
+std::vector<ElfRelocation> ElfFile::Relocations(const ElfSection& section) const
+{
+    std::vector<ElfRelocation> relocations;
+
+    for (std::uint32_t offset = 0; offset + 8 <= section.size; offset += 8)
+    {
+        std::uint32_t info = ReadInt32(section.offset + offset + 4);
+        relocations.push_back({ ReadInt32(section.offset + offset), info >> 8, static_cast<int>(info & 0xFF) });
+    }
+
+    return relocations;
+}
+
+void ElfFile::CheckBounds(std::size_t offset, std::size_t length) const
+{
+    if (offset > m_file.Size() || length > m_file.Size() - offset)
+        FATAL_ERROR("error: unexpected EOF when reading ELF file \"%s\"\n", m_path.c_str());
+}
+
+std::uint32_t ElfFile::ReadInt16(std::size_t offset) const
+{
+    CheckBounds(offset, 2);
+    const std::uint8_t *p = m_file.Data() + offset;
+    return p[0] | (p[1] << 8);
+}
+
+std::uint32_t ElfFile::ReadInt32(std::size_t offset) const
+{
+    CheckBounds(offset, 4);
+    const std::uint8_t *p = m_file.Data() + offset;
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+std::string ElfFile::ReadString(std::size_t offset) const
+{
+    CheckBounds(offset, 0);
+    const void *end = std::memchr(m_file.Data() + offset, 0, m_file.Size() - offset);
+
+    if (end == nullptr)
+        FATAL_ERROR("error: unterminated string in ELF file \"%s\"\n", m_path.c_str());
+
+    return std::string(reinterpret_cast<const char *>(m_file.Data() + offset), static_cast<const std::uint8_t *>(end) - (m_file.Data() + offset));
+}
@@ -0,0 +1,116 @@
+#ifndef ELF_H
+#define ELF_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#define SHT_PROGBITS 1
+#define SHT_SYMTAB   2
+#define SHT_RELA     4
+#define SHT_NOBITS   8
+#define SHT_REL      9
+
+#define SHF_ALLOC 0x2
+#define SHF_MERGE 0x10
+
+#define SHN_UNDEF  0
+#define SHN_ABS    0xFFF1
+#define SHN_COMMON 0xFFF2
+
+#define STB_LOCAL  0
+#define STB_GLOBAL 1
+#define STB_WEAK   2
+
+#define STT_FUNC    2
+#define STT_SECTION 3
+#define STT_FILE    4
+
+#define PT_LOAD 1
+
+#define R_ARM_NONE  0
+#define R_ARM_ABS32 2
+#define R_ARM_ABS16 5
+#define R_ARM_ABS8  8
+
+struct ElfSection
+{
+    std::string name;
+    std::uint32_t type;
+    std::uint32_t flags;
+    std::uint32_t address;
+    std::uint32_t offset;
+    std::uint32_t size;
+    std::uint32_t link;
+    std::uint32_t info;
+};
+
+struct ElfSegment
+{
+    std::uint32_t type;
+    std::uint32_t offset;
+    std::uint32_t virtualAddress;
+    std::uint32_t physicalAddress;
+    std::uint32_t fileSize;
+};
+
+struct ElfSymbol
+{
+    std::string name;
+    std::uint32_t value;
+    std::uint32_t size;
+    int binding;
+    int type;
+    std::uint16_t sectionIndex;
+};
+
+struct ElfRelocation
+{
+    std::uint32_t offset;
+    std::uint32_t symbolIndex;
+    int type;
+};
+
+// A whole file mapped into memory. Where mmap isn't available, the file is
+// read into a buffer instead.
+class MappedFile
+{
+public:
+    MappedFile(const std::string& path);
+    MappedFile(const MappedFile&) = delete;
+    ~MappedFile();
+    const std::uint8_t *Data() const { return m_data; }
+    std::size_t Size() const { return m_size; }
+private:
+    const std::uint8_t *m_data;
+    std::size_t m_size;
+    bool m_mapped;
+    std::vector<std::uint8_t> m_buffer;
+};
+
+// The parts of a 32-bit little-endian ELF file that romlink needs. Symbol 0 is
+// the reserved null symbol, as in the file.
+class ElfFile
+{
+public:
+    ElfFile(const std::string& path);
+    const std::string& Path() const { return m_path; }
+    const std::vector<ElfSection>& Sections() const { return m_sections; }
+    const std::vector<ElfSegment>& Segments() const { return m_segments; }
+    const std::vector<ElfSymbol>& Symbols() const { return m_symbols; }
+    const std::uint8_t *SectionData(const ElfSection& section) const;
+    std::vector<ElfRelocation> Relocations(const ElfSection& section) const;
+private:
+    std::string m_path;
+    MappedFile m_file;
+    std::vector<ElfSection> m_sections;
+    std::vector<ElfSegment> m_segments;
+    std::vector<ElfSymbol> m_symbols;
+
+    void CheckBounds(std::size_t offset, std::size_t length) const;
+    std::uint32_t ReadInt16(std::size_t offset) const;
+    std::uint32_t ReadInt32(std::size_t offset) const;
+    std::string ReadString(std::size_t offset) const;
+};
+
+#endif // ELF_H
@@ -0,0 +1,500 @@
+// Shortcuts for the last steps of the ROM build.
+//
+//   romlink binary ELF ROM PAD_TO
+//
+// writes the loadable sections of ELF to ROM at their load addresses, filling
+// the gaps with 0xFF and padding the file out to the address PAD_TO, like
+// "objcopy -O binary --gap-fill 0xFF --pad-to PAD_TO".
+//
+//   romlink patch ELF MAP OBJ_DIR OBJECT...
+//
+// copies the changed OBJECTs (paths relative to OBJ_DIR, as given to the
+// linker) into ELF without relinking it. This only works when each object's
+// sections are the same sizes and its symbols are at the same offsets as when
+// ELF was linked, and its relocations are plain data pointers, so that nothing
+// else in the ROM needs to move. MAP is the map file written by that link.
+// Exits with status 2, having changed nothing, if ELF has to be relinked.
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "romlink.h"
+#include "elf.h"
+#include "map_file.h"
+#include "trace.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+struct Patch
+{
+    std::uint32_t address;
+    std::vector<std::uint8_t> data;
+};
+
+// Thrown when an object can't be patched in and ELF has to be relinked.
+struct RelinkNeeded
+{
+    std::string reason;
+};
+
+static void WriteFilled(const std::string& path, std::size_t size, const std::vector<const ElfSection *>& sections,
+    const std::vector<std::uint32_t>& offsets, const ElfFile& elf)
+{
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666);
+
+    if (fd < 0)
+        FATAL_ERROR("error: failed to open \"%s\" for writing\n", path.c_str());
+
+    if (ftruncate(fd, size) != 0)
+        FATAL_ERROR("error: failed to resize \"%s\"\n", path.c_str());
+
+    void *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    if (mapping == MAP_FAILED)
+        FATAL_ERROR("error: failed to map \"%s\"\n", path.c_str());
+
+    std::uint8_t *data = static_cast<std::uint8_t *>(mapping);
+#else
+    std::vector<std::uint8_t> buffer(size);
+    std::uint8_t *data = buffer.data();
+#endif
+
+    std::memset(data, 0xFF, size);
+
+    for (std::size_t i = 0; i < sections.size(); i++)
+        std::memcpy(data + offsets[i], elf.SectionData(*sections[i]), sections[i]->size);
+
+#ifndef _WIN32
+    if (munmap(mapping, size) != 0 || close(fd) != 0)
+        FATAL_ERROR("error: failed to write \"%s\"\n", path.c_str());
+#else
+    FILE *fp = std::fopen(path.c_str(), "wb");
+
+    if (fp == NULL)
+        FATAL_ERROR("error: failed to open \"%s\" for writing\n", path.c_str());
+
+    if (std::fwrite(data, size, 1, fp) != 1)
+        FATAL_ERROR("error: failed to write \"%s\"\n", path.c_str());
+
+    std::fclose(fp);
+#endif
+}
+
+static void WriteBinary(const std::string& elfPath, const std::string& romPath, std::uint32_t padTo)
+{
+    std::uint64_t start = TraceBegin();
+    ElfFile elf(elfPath);
+    std::vector<const ElfSection *> sections;
+    std::vector<std::uint32_t> loadAddresses;
+
+    for (const ElfSection& section : elf.Sections())
+    {
+        if (!(section.flags & SHF_ALLOC) || section.type == SHT_NOBITS || section.size == 0)
+            continue;
+
+        // A section is loaded at the address of the segment containing it,
+        // which differs from the address it runs at when it's copied to RAM.
+        std::uint32_t loadAddress = section.address;
+
+        for (const ElfSegment& segment : elf.Segments())
+        {
+            if (segment.type == PT_LOAD && section.offset >= segment.offset
+             && section.offset + section.size <= segment.offset + segment.fileSize)
+            {
+                loadAddress = segment.physicalAddress + (section.offset - segment.offset);
+                break;
+            }
+        }
+
+        sections.push_back(&section);
+        loadAddresses.push_back(loadAddress);
+    }
+
+    if (sections.empty())
+        FATAL_ERROR("error: \"%s\" has nothing to load\n", elfPath.c_str());
+
+    std::uint32_t base = loadAddresses[0];
+    std::uint32_t end = padTo;
+
+    for (std::size_t i = 0; i < sections.size(); i++)
+    {
+        if (loadAddresses[i] < base)
+            base = loadAddresses[i];
+
+        if (loadAddresses[i] + sections[i]->size > end)
+            end = loadAddresses[i] + sections[i]->size;
+    }
+
+    for (std::uint32_t& address : loadAddresses)
+        address -= base;
+
+    TraceEnd("read", start, elfPath.c_str());
+    start = TraceBegin();
+    WriteFilled(romPath, end - base, sections, loadAddresses, elf);
+    TraceEnd("write", start, romPath.c_str());
+}
+
+// The addresses the linked ELF gives to global and local symbols.
+struct LinkedSymbols
+{
+    std::unordered_map<std::string, std::uint32_t> globals;
+    std::unordered_multimap<std::string, std::uint32_t> locals;
+    std::vector<std::pair<std::uint32_t, std::string>> globalsByAddress;
+};
+
+static LinkedSymbols GetLinkedSymbols(const ElfFile& elf)
+{
+    LinkedSymbols linked;
+
+    for (const ElfSymbol& symbol : elf.Symbols())
+    {
+        if (symbol.sectionIndex == SHN_UNDEF || symbol.name.empty() || symbol.type == STT_FILE || symbol.type == STT_SECTION)
+            continue;
+
+        if (symbol.binding == STB_LOCAL)
+        {
+            linked.locals.emplace(symbol.name, symbol.value);
+        }
+        else
+        {
+            linked.globals[symbol.name] = symbol.value;
+
+            if (symbol.sectionIndex != SHN_ABS)
+                linked.globalsByAddress.emplace_back(symbol.type == STT_FUNC ? symbol.value & ~1u : symbol.value, symbol.name);
+        }
+    }
+
+    return linked;
+}
+
+static bool IsLinkedLocal(const LinkedSymbols& linked, const std::string& name, std::uint32_t value)
+{
+    auto range = linked.locals.equal_range(name);
+
+    for (auto it = range.first; it != range.second; ++it)
+        if (it->second == value)
+            return true;
+
+    return false;
+}
+
+static std::uint32_t ReadLittleEndian(const std::uint8_t *p, int size)
+{
+    std::uint32_t value = 0;
+
+    for (int i = 0; i < size; i++)
+        value |= static_cast<std::uint32_t>(p[i]) << (8 * i);
+
+    return value;
+}
+
+static void ApplyRelocation(const ElfRelocation& relocation, std::uint32_t symbolAddress, std::vector<std::uint8_t>& data)
+{
+    int size;
+
+    switch (relocation.type)
+    {
+    case R_ARM_NONE:
+        return;
+    case R_ARM_ABS32:
+        size = 4;
+        break;
+    case R_ARM_ABS16:
+        size = 2;
+        break;
+    case R_ARM_ABS8:
+        size = 1;
+        break;
+    default:
+        throw RelinkNeeded{ "it has relocations other than data pointers" };
+    }
+
+    if (relocation.offset > data.size() || data.size() - relocation.offset < static_cast<std::size_t>(size))
+        throw RelinkNeeded{ "it has a relocation outside its section" };
+
+    std::uint8_t *p = data.data() + relocation.offset;
+    std::int64_t addend = ReadLittleEndian(p, size);
+
+    // The narrow relocations' addends are signed.
+    if (size < 4 && (addend & (1 << (8 * size - 1))))
+        addend -= 1 << (8 * size);
+
+    std::int64_t value = static_cast<std::int64_t>(symbolAddress) + addend;
+
+    if (size < 4 && (value < -(1 << (8 * size - 1)) || value >= (1 << (8 * size))))
+        throw RelinkNeeded{ "a relocation's value is out of range" };
+
+    for (int i = 0; i < size; i++)
+        p[i] = static_cast<std::uint32_t>(value) >> (8 * i);
+}
+
+// Works out the linked bytes of one object's sections, or throws if the object
+// can't simply be copied over its old contents.
+static void PatchObject(const std::string& objectPath, const std::vector<InputSection>& placements,
+    const LinkedSymbols& linked, std::vector<Patch>& patches)
+{
+    ElfFile object(objectPath);
+    const std::vector<ElfSection>& sections = object.Sections();
+    std::vector<bool> isPlaced(sections.size(), false);
+    std::vector<std::uint32_t> addresses(sections.size(), 0);
+    std::vector<bool> isUsed(placements.size(), false);
+
+    for (std::size_t i = 0; i < sections.size(); i++)
+    {
+        const ElfSection& section = sections[i];
+
+        if (section.name.compare(0, 6, ".debug") == 0)
+            throw RelinkNeeded{ "it has debug information" };
+
+        if (section.type == SHT_RELA)
+            throw RelinkNeeded{ "it has RELA relocations" };
+
+        if (!(section.flags & SHF_ALLOC) || section.size == 0)
+            continue;
+
+        if (section.flags & SHF_MERGE)
+            throw RelinkNeeded{ "the linker merges its section " + section.name };
+
+        std::size_t match = placements.size();
+
+        for (std::size_t j = 0; j < placements.size(); j++)
+        {
+            if (placements[j].name != section.name)
+                continue;
+
+            if (match != placements.size())
+                throw RelinkNeeded{ "its section " + section.name + " is placed more than once" };
+
+            match = j;
+        }
+
+        if (match == placements.size())
+            throw RelinkNeeded{ "its section " + section.name + " wasn't linked before" };
+
+        if (placements[match].size != section.size)
+            throw RelinkNeeded{ "its section " + section.name + " changed size" };
+
+        isPlaced[i] = true;
+        isUsed[match] = true;
+        addresses[i] = placements[match].address;
+    }
+
+    for (std::size_t j = 0; j < placements.size(); j++)
+        if (!isUsed[j] && placements[j].size != 0)
+            throw RelinkNeeded{ "its section " + placements[j].name + " was removed" };
+
+    // Other objects refer to this one by its global symbols, so those have to
+    // stay where they are. The local symbols are checked too, so that the
+    // symbol file stays right.
+    const std::vector<ElfSymbol>& symbols = object.Symbols();
+    std::vector<std::uint32_t> symbolAddresses(symbols.size(), 0);
+    std::unordered_set<std::string> globals;
+
+    for (std::size_t i = 1; i < symbols.size(); i++)
+    {
+        const ElfSymbol& symbol = symbols[i];
+
+        if (symbol.sectionIndex == SHN_COMMON)
+            throw RelinkNeeded{ "it has common symbols" };
+
+        if (symbol.sectionIndex == SHN_UNDEF)
+        {
+            auto it = linked.globals.find(symbol.name);
+
+            if (it != linked.globals.end())
+                symbolAddresses[i] = it->second;
+            continue;
+        }
+
+        if (symbol.sectionIndex == SHN_ABS)
+            symbolAddresses[i] = symbol.value;
+        else if (symbol.sectionIndex < sections.size() && isPlaced[symbol.sectionIndex])
+            symbolAddresses[i] = addresses[symbol.sectionIndex] + symbol.value;
+        else
+            continue;
+
+        if (symbol.type == STT_SECTION || symbol.type == STT_FILE || symbol.name.empty() || symbol.name[0] == '$')
+            continue;
+
+        if (symbol.binding == STB_LOCAL)
+        {
+            if (symbol.sectionIndex != SHN_ABS && !IsLinkedLocal(linked, symbol.name, symbolAddresses[i]))
+                throw RelinkNeeded{ "its symbol " + symbol.name + " moved" };
+            continue;
+        }
+
+        auto it = linked.globals.find(symbol.name);
+
+        if (it == linked.globals.end() || it->second != symbolAddresses[i])
+            throw RelinkNeeded{ "its symbol " + symbol.name + " moved" };
+
+        globals.insert(symbol.name);
+    }
+
+    for (const auto& global : linked.globalsByAddress)
+    {
+        for (std::size_t i = 0; i < sections.size(); i++)
+        {
+            if (isPlaced[i] && global.first >= addresses[i] && global.first - addresses[i] < sections[i].size
+             && globals.count(global.second) == 0)
+                throw RelinkNeeded{ "its symbol " + global.second + " was removed" };
+        }
+    }
+
+    std::vector<std::vector<std::uint8_t>> contents(sections.size());
+
+    for (std::size_t i = 0; i < sections.size(); i++)
+    {
+        if (isPlaced[i] && sections[i].type != SHT_NOBITS)
+        {
+            const std::uint8_t *data = object.SectionData(sections[i]);
+            contents[i].assign(data, data + sections[i].size);
+        }
+    }
+
+    for (const ElfSection& section : sections)
+    {
+        if (section.type != SHT_REL || section.info >= sections.size() || !isPlaced[section.info])
+            continue;
+
+        if (sections[section.info].type == SHT_NOBITS)
+            throw RelinkNeeded{ "it has relocations in " + sections[section.info].name };
+
+        for (const ElfRelocation& relocation : object.Relocations(section))
+        {
+            if (relocation.symbolIndex >= symbols.size())
+                throw RelinkNeeded{ "it has a relocation against a missing symbol" };
+
+            const ElfSymbol& symbol = symbols[relocation.symbolIndex];
+
+            if (symbol.sectionIndex == SHN_UNDEF && linked.globals.count(symbol.name) == 0)
+                throw RelinkNeeded{ "it refers to " + symbol.name + ", which wasn't linked before" };
+
+            if (symbol.sectionIndex != SHN_UNDEF && symbol.sectionIndex != SHN_ABS
+             && (symbol.sectionIndex >= sections.size() || !isPlaced[symbol.sectionIndex]))
+                throw RelinkNeeded{ "it has a relocation against an unlinked section" };
+
+            ApplyRelocation(relocation, symbolAddresses[relocation.symbolIndex], contents[section.info]);
+        }
+    }
+
+    for (std::size_t i = 0; i < sections.size(); i++)
+        if (isPlaced[i] && sections[i].type != SHT_NOBITS)
+            patches.push_back({ addresses[i], contents[i] });
+}
+
+static int PatchElf(const std::string& elfPath, const std::string& mapPath, const std::string& objDir,
+    const std::vector<std::string>& objects)
+{
+    std::uint64_t start = TraceBegin();
+    std::vector<Patch> patches;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> fileOffsets;
+
+    {
+        ElfFile elf(elfPath);
+        std::map<std::string, std::vector<InputSection>> placements = ReadMapFile(mapPath);
+        LinkedSymbols linked = GetLinkedSymbols(elf);
+
+        TraceEnd("read", start, elfPath.c_str());
+        start = TraceBegin();
+
+        for (const std::string& object : objects)
+        {
+            auto it = placements.find(object);
+
+            try
+            {
+                if (it == placements.end())
+                    throw RelinkNeeded{ "it wasn't linked before" };
+
+                PatchObject(objDir + "/" + object, it->second, linked, patches);
+            }
+            catch (const RelinkNeeded& relink)
+            {
+                std::printf("romlink: relinking, since %s can't be patched in: %s\n", object.c_str(), relink.reason.c_str());
+                return 2;
+            }
+        }
+
+        // Find where each patch goes in the ELF file before changing anything.
+        for (const Patch& patch : patches)
+        {
+            std::size_t i;
+
+            for (i = 0; i < elf.Sections().size(); i++)
+            {
+                const ElfSection& section = elf.Sections()[i];
+
+                if ((section.flags & SHF_ALLOC) && section.type == SHT_PROGBITS && patch.address >= section.address
+                 && patch.address - section.address + patch.data.size() <= section.size)
+                    break;
+            }
+
+            if (i == elf.Sections().size())
+            {
+                std::printf("romlink: relinking, since nothing in %s is at 0x%08X\n", elfPath.c_str(), patch.address);
+                return 2;
+            }
+
+            const ElfSection& section = elf.Sections()[i];
+            fileOffsets.emplace_back(section.offset + (patch.address - section.address), patch.data.size());
+        }
+    }
+
+    FILE *fp = std::fopen(elfPath.c_str(), "r+b");
+
+    if (fp == NULL)
+        FATAL_ERROR("error: failed to open \"%s\" for writing\n", elfPath.c_str());
+
+    for (std::size_t i = 0; i < patches.size(); i++)
+    {
+        if (fileOffsets[i].second == 0)
+            continue;
+
+        if (std::fseek(fp, fileOffsets[i].first, SEEK_SET) != 0
+         || std::fwrite(patches[i].data.data(), fileOffsets[i].second, 1, fp) != 1)
+            FATAL_ERROR("error: failed to write \"%s\"\n", elfPath.c_str());
+    }
+
+    std::fclose(fp);
+    TraceEnd("patch", start, elfPath.c_str());
+    std::printf("romlink: patched %d object%s into %s\n", static_cast<int>(objects.size()), objects.size() == 1 ? "" : "s", elfPath.c_str());
+    return 0;
+}
+
+static void PrintUsage()
+{
+    std::fprintf(stderr,
+        "Usage: romlink binary ELF ROM PAD_TO\n"
+        "       romlink patch ELF MAP OBJ_DIR OBJECT...\n");
+    std::exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    TraceInit("romlink", argc, argv);
+
+    if (argc < 2)
+        PrintUsage();
+
+    std::string command = argv[1];
+
+    if (command == "binary" && argc == 5)
+    {
+        WriteBinary(argv[2], argv[3], std::strtoul(argv[4], nullptr, 0));
+        return 0;
+    }
+
+    if (command == "patch" && argc >= 5)
+        return PatchElf(argv[2], argv[3], argv[4], std::vector<std::string>(argv + 5, argv + argc));
+
+    PrintUsage();
+}
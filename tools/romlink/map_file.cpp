@@ -0,0 +1,91 @@
+#include <fstream>
+#include <sstream>
+#include "romlink.h"
+#include "map_file.h"
+
+// Parses the "0xADDRESS 0xSIZE FILE" that follows an input section's name.
+static bool ParsePlacement(const std::string& text, InputSection& section, std::string& file)
+{
+    std::istringstream stream(text);
+    std::string address;
+    std::string size;
+
+    if (!(stream >> address >> size >> file))
+        return false;
+
+    if (address.compare(0, 2, "0x") != 0 || size.compare(0, 2, "0x") != 0)
+        return false;
+
+    section.address = std::stoul(address, nullptr, 16);
+    section.size = std::stoul(size, nullptr, 16);
+    return true;
+}
+
+std::map<std::string, std::vector<InputSection>> ReadMapFile(const std::string& path)
+{
+    std::ifstream stream(path);
+
+    if (!stream.is_open())
+        FATAL_ERROR("error: failed to open \"%s\" for reading\n", path.c_str());
+
+    std::map<std::string, std::vector<InputSection>> objects;
+    std::string line;
+    std::string pendingName;
+    bool inMemoryMap = false;
+
+    // The sections discarded by the linker are listed first, in the same
+    // format, so only the part after the memory map's heading is read.
+    while (std::getline(stream, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+
+        if (!inMemoryMap)
+        {
+            inMemoryMap = (line == "Linker script and memory map");
+            continue;
+        }
+
+        InputSection section;
+        std::string file;
+
+        // An input section's name is indented by one space. A long name is
+        // on a line of its own, with its placement on the next line. Lines
+        // echoing the linker script's statements look the same, but aren't
+        // followed by a placement.
+        if (!pendingName.empty())
+        {
+            bool isPlacement = ParsePlacement(line, section, file);
+
+            if (isPlacement)
+            {
+                section.name = pendingName;
+                objects[file].push_back(section);
+            }
+
+            pendingName.clear();
+
+            if (isPlacement)
+                continue;
+        }
+
+        if (line.size() < 2 || line[0] != ' ' || line[1] == ' ')
+            continue;
+
+        std::size_t nameEnd = line.find(' ', 1);
+
+        if (nameEnd == std::string::npos)
+        {
+            pendingName = line.substr(1);
+            continue;
+        }
+
+        if (ParsePlacement(line.substr(nameEnd), section, file))
+        {
+            section.name = line.substr(1, nameEnd - 1);
+            objects[file].push_back(section);
+        }
+    }
+
+    return objects;
+}
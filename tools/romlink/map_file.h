@@ -0,0 +1,20 @@
+#ifndef MAP_FILE_H
+#define MAP_FILE_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+struct InputSection
+{
+    std::string name;
+    std::uint32_t address;
+    std::uint32_t size;
+};
+
+// Reads where the linker placed each object's sections from a GNU ld map file.
+// The result is keyed by the object's path as the linker was given it.
+std::map<std::string, std::vector<InputSection>> ReadMapFile(const std::string& path);
+
+#endif // MAP_FILE_H
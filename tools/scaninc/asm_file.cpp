@@ -22,11 +22,13 @@
 #include <string>
 #include "scaninc.h"
 #include "asm_file.h"
+#include "trace.h"
 
 AsmFile::AsmFile(std::string path)
 {
     m_path = path;
 
+    std::uint64_t traceStart = TraceBegin();
     FILE *fp = std::fopen(path.c_str(), "rb");
 
     if (fp == NULL)
@@ -49,6 +51,7 @@ AsmFile::AsmFile(std::string path)
         FATAL_ERROR("Failed to read \"%s\".\n", path.c_str());
 
     std::fclose(fp);
+    TraceEnd("read", traceStart, path.c_str());
 
     m_pos = 0;
     m_lineNum = 1;
@@ -19,11 +19,13 @@
 // THE SOFTWARE.
 
 #include "c_file.h"
+#include "trace.h"
 
 CFile::CFile(std::string path)
 {
     m_path = path;
 
+    std::uint64_t traceStart = TraceBegin();
     FILE *fp = std::fopen(path.c_str(), "rb");
 
     if (fp == NULL)
@@ -42,6 +44,7 @@ CFile::CFile(std::string path)
         FATAL_ERROR("Failed to read \"%s\".\n", path.c_str());
 
     std::fclose(fp);
+    TraceEnd("read", traceStart, path.c_str());
 
     m_pos = 0;
     m_lineNum = 1;
@@ -26,6 +26,7 @@
 #include <string>
 #include "scaninc.h"
 #include "source_file.h"
+#include "trace.h"
 
 bool CanOpenFile(std::string path)
 {
@@ -47,6 +48,8 @@ int main(int argc, char **argv)
 
     std::vector<std::string> includeDirs;
 
+    TraceInit("scaninc", argc, argv);
+
     argc--;
     argv++;
 
@@ -87,7 +90,9 @@ int main(int argc, char **argv)
     while (!filesToProcess.empty())
     {
         std::string filePath = filesToProcess.front();
+        std::uint64_t traceStart = TraceBegin();
         SourceFile file(filePath);
+        TraceEnd("parse", traceStart, filePath.c_str());
         filesToProcess.pop();
 
         includeDirs.push_back(file.GetSrcDir());
@@ -121,8 +126,12 @@ int main(int argc, char **argv)
         includeDirs.pop_back();
     }
 
+    std::uint64_t traceStart = TraceBegin();
+
     for (const std::string &path : dependencies)
     {
         std::printf("%s\n", path.c_str());
     }
+
+    TraceEnd("write", traceStart, initialPath.c_str());
 }
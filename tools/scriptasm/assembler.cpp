@@ -0,0 +1,2013 @@
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include "assembler.h"
+#include "elf_writer.h"
+
+// GNU as allows macros to expand to other macros this deeply.
+static const std::size_t s_maxMacroNesting = 100;
+
+static std::string ToLower(std::string s)
+{
+    for (char& c : s)
+        c = std::tolower((unsigned char)c);
+    return s;
+}
+
+static void SkipSpaces(const std::string& s, std::size_t& pos)
+{
+    while (pos < s.size() && (s[pos] == ' ' || s[pos] == '\t'))
+        pos++;
+}
+
+static std::string ReadName(const std::string& s, std::size_t& pos)
+{
+    std::size_t start = pos;
+
+    if (pos < s.size() && IsSymbolStart(s[pos]))
+        while (pos < s.size() && IsSymbolChar(s[pos]))
+            pos++;
+
+    return s.substr(start, pos - start);
+}
+
+static std::string Trim(const std::string& s)
+{
+    std::size_t start = 0;
+    std::size_t end = s.size();
+
+    while (start < end && (s[start] == ' ' || s[start] == '\t'))
+        start++;
+    while (end > start && (s[end - 1] == ' ' || s[end - 1] == '\t'))
+        end--;
+
+    return s.substr(start, end - start);
+}
+
+// Copies the quoted string that starts at s[pos] to out, quotes included.
+static void CopyQuoted(const std::string& s, std::size_t& pos, std::string& out)
+{
+    out += s[pos++];
+
+    while (pos < s.size() && s[pos] != '"')
+    {
+        if (s[pos] == '\\' && pos + 1 < s.size())
+            out += s[pos++];
+        out += s[pos++];
+    }
+
+    if (pos < s.size())
+        out += s[pos++];
+}
+
+// Moves pos past the quoted string that starts at s[pos].
+static void SkipQuoted(const std::string& s, std::size_t& pos)
+{
+    pos++;
+
+    while (pos < s.size() && s[pos] != '"')
+        pos += s[pos] == '\\' ? 2 : 1;
+
+    if (pos < s.size())
+        pos++;
+}
+
+// Returns the length of line without its @ comment. "\@" is the macro counter
+// rather than a comment.
+static std::size_t CodeLength(const std::string& line)
+{
+    for (std::size_t i = 0; i < line.size(); i++)
+    {
+        char c = line[i];
+
+        if (c == '"')
+        {
+            SkipQuoted(line, i);
+            i--;
+        }
+        else if (c == '\'')
+        {
+            i++;
+        }
+        else if (c == '@' && (i == 0 || line[i - 1] != '\\'))
+        {
+            return i;
+        }
+    }
+
+    return line.size();
+}
+
+static bool KeepsSpace(char c)
+{
+    return IsSymbolChar(c) || c == '"' || c == '\'' || c == '\\';
+}
+
+static bool IsSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+}
+
+// Removes the whitespace in the first length characters of line that doesn't
+// separate two words, as GNU as's input scrubber does. This is what lets
+// "a + b" be a single macro argument while "a b" is two.
+static void Scrub(const std::string& line, std::size_t length, std::string& out)
+{
+    // The result is never longer than the input, so it can be written in place.
+    out.resize(length);
+
+    char *dest = &out[0];
+    std::size_t count = 0;
+    bool pendingSpace = false;
+
+    for (std::size_t i = 0; i < length;)
+    {
+        char c = line[i];
+
+        if (IsSpace(c))
+        {
+            pendingSpace = count != 0;
+            i++;
+            continue;
+        }
+
+        if (pendingSpace && KeepsSpace(dest[count - 1]) && KeepsSpace(c))
+            dest[count++] = ' ';
+
+        pendingSpace = false;
+        dest[count++] = line[i++];
+
+        if (c == '"')
+        {
+            while (i < length && line[i] != '"')
+            {
+                if (line[i] == '\\' && i + 1 < length)
+                    dest[count++] = line[i++];
+                dest[count++] = line[i++];
+            }
+
+            if (i < length)
+                dest[count++] = line[i++];
+        }
+        else if (c == '\'' && i < length)
+        {
+            dest[count++] = line[i++];
+        }
+    }
+
+    out.resize(count);
+}
+
+// Returns whether Scrub would change line, which is rare for lines that come
+// from a macro expansion, since the macro's body and arguments were scrubbed.
+static bool NeedsScrub(const std::string& line)
+{
+    for (std::size_t i = 0; i < line.size(); i++)
+    {
+        char c = line[i];
+
+        if (c == '"')
+        {
+            SkipQuoted(line, i);
+            i--;
+        }
+        else if (c == '\'')
+        {
+            i++;
+        }
+        else if (c == ' ')
+        {
+            if (i == 0 || i + 1 == line.size() || !KeepsSpace(line[i - 1]) || !KeepsSpace(line[i + 1]))
+                return true;
+        }
+        else if (IsSpace(c))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static std::vector<std::string> SplitStatements(const std::string& line)
+{
+    std::vector<std::string> statements;
+    std::string current;
+
+    for (std::size_t i = 0; i < line.size();)
+    {
+        if (line[i] == '"')
+        {
+            CopyQuoted(line, i, current);
+        }
+        else if (line[i] == ';')
+        {
+            statements.push_back(current);
+            current.clear();
+            i++;
+        }
+        else
+        {
+            current += line[i++];
+        }
+    }
+
+    statements.push_back(current);
+    return statements;
+}
+
+// Reads a decimal or hexadecimal number that makes up a whole operand, leaving
+// pos unchanged if the operand is anything else.
+static bool ReadPlainNumber(const std::string& s, std::size_t& pos, std::int64_t& value)
+{
+    std::size_t i = pos;
+    std::uint64_t number = 0;
+
+    if (s.compare(i, 2, "0x") == 0 || s.compare(i, 2, "0X") == 0)
+    {
+        for (i += 2; i < s.size(); i++)
+        {
+            char c = s[i];
+            int digit;
+
+            if (c >= '0' && c <= '9')
+                digit = c - '0';
+            else if (c >= 'a' && c <= 'f')
+                digit = c - 'a' + 10;
+            else if (c >= 'A' && c <= 'F')
+                digit = c - 'A' + 10;
+            else
+                break;
+
+            number = number * 16 + digit;
+        }
+
+        if (i == pos + 2)
+            return false;
+    }
+    else
+    {
+        // Numbers with a leading 0 are octal.
+        for (; i < s.size() && s[i] >= '0' && s[i] <= '9'; i++)
+            number = number * 10 + (s[i] - '0');
+
+        if (i == pos || (s[pos] == '0' && i != pos + 1))
+            return false;
+    }
+
+    if (i < s.size() && s[i] != ',')
+        return false;
+
+    pos = i;
+    value = number;
+    return true;
+}
+
+// Reads a macro argument: a quoted string, whose quotes are removed, or
+// everything up to the next top-level comma or space.
+static std::string ReadMacroArgument(const std::string& s, std::size_t& pos)
+{
+    std::string value;
+
+    if (pos < s.size() && s[pos] == '"')
+    {
+        CopyQuoted(s, pos, value);
+        return value.substr(1, value.size() - (value.size() > 1 && value.back() == '"' ? 2 : 1));
+    }
+
+    int depth = 0;
+
+    while (pos < s.size())
+    {
+        char c = s[pos];
+
+        if (depth == 0 && (c == ',' || c == ' '))
+            break;
+
+        if (c == '"')
+        {
+            CopyQuoted(s, pos, value);
+            continue;
+        }
+
+        if (c == '(')
+            depth++;
+        else if (c == ')')
+            depth--;
+
+        value += c;
+        pos++;
+    }
+
+    return value;
+}
+
+Assembler::Assembler(const std::vector<std::string>& includeDirs)
+    : m_includeDirs(includeDirs), m_block(Block::None), m_blockDepth(0), m_lineNum(0),
+      m_macroCount(0), m_exitMacro(false), m_ended(false), m_errorCount(0)
+{
+    GetSection(".text");
+    GetSection(".data");
+    GetSection(".bss");
+    m_section = m_sections[0].get();
+
+    static const struct
+    {
+        const char *name;
+        DirectiveHandler handler;
+    } directives[] = {
+        { ".byte", &Assembler::DirectiveData },
+        { ".2byte", &Assembler::DirectiveData },
+        { ".hword", &Assembler::DirectiveData },
+        { ".short", &Assembler::DirectiveData },
+        { ".4byte", &Assembler::DirectiveData },
+        { ".word", &Assembler::DirectiveData },
+        { ".long", &Assembler::DirectiveData },
+        { ".int", &Assembler::DirectiveData },
+        { ".space", &Assembler::DirectiveSpace },
+        { ".skip", &Assembler::DirectiveSpace },
+        { ".zero", &Assembler::DirectiveSpace },
+        { ".fill", &Assembler::DirectiveFill },
+        { ".ascii", &Assembler::DirectiveAscii },
+        { ".asciz", &Assembler::DirectiveAscii },
+        { ".string", &Assembler::DirectiveAscii },
+        { ".align", &Assembler::DirectiveAlign },
+        { ".p2align", &Assembler::DirectiveAlign },
+        { ".balign", &Assembler::DirectiveAlign },
+        { ".section", &Assembler::DirectiveSection },
+        { ".text", &Assembler::DirectiveSection },
+        { ".data", &Assembler::DirectiveSection },
+        { ".bss", &Assembler::DirectiveSection },
+        { ".global", &Assembler::DirectiveGlobal },
+        { ".globl", &Assembler::DirectiveGlobal },
+        { ".weak", &Assembler::DirectiveGlobal },
+        { ".type", &Assembler::DirectiveType },
+        { ".size", &Assembler::DirectiveSize },
+        { ".set", &Assembler::DirectiveSet },
+        { ".equ", &Assembler::DirectiveSet },
+        { ".equiv", &Assembler::DirectiveSet },
+        { ".macro", &Assembler::DirectiveMacro },
+        { ".endm", &Assembler::DirectiveEndBlock },
+        { ".exitm", &Assembler::DirectiveEndBlock },
+        { ".endr", &Assembler::DirectiveEndBlock },
+        { ".purgem", &Assembler::DirectivePurgeMacro },
+        { ".rept", &Assembler::DirectiveRepeat },
+        { ".irp", &Assembler::DirectiveRepeat },
+        { ".irpc", &Assembler::DirectiveRepeat },
+        { ".include", &Assembler::DirectiveInclude },
+        { ".incbin", &Assembler::DirectiveIncbin },
+        { ".error", &Assembler::DirectiveMessage },
+        { ".warning", &Assembler::DirectiveMessage },
+        { ".print", &Assembler::DirectiveMessage },
+        { ".end", &Assembler::DirectiveEnd },
+        // These only matter for instructions and debug information.
+        { ".arm", &Assembler::DirectiveIgnored },
+        { ".thumb", &Assembler::DirectiveIgnored },
+        { ".code", &Assembler::DirectiveIgnored },
+        { ".syntax", &Assembler::DirectiveIgnored },
+        { ".cpu", &Assembler::DirectiveIgnored },
+        { ".arch", &Assembler::DirectiveIgnored },
+        { ".fpu", &Assembler::DirectiveIgnored },
+        { ".file", &Assembler::DirectiveIgnored },
+        { ".ident", &Assembler::DirectiveIgnored },
+        { ".list", &Assembler::DirectiveIgnored },
+        { ".nolist", &Assembler::DirectiveIgnored },
+    };
+
+    for (const auto& directive : directives)
+        m_directives[directive.name] = directive.handler;
+}
+
+void Assembler::AssembleText(const std::string& text, const std::string& filename)
+{
+    std::string savedFilename = m_filename;
+    int savedLineNum = m_lineNum;
+
+    m_filename = filename;
+    m_lineNum = 0;
+
+    std::size_t start = 0;
+    std::string line;
+    std::string code;
+
+    while (start < text.size() && !m_ended)
+    {
+        std::size_t end = text.find('\n', start);
+
+        if (end == std::string::npos)
+            end = text.size();
+
+        line.assign(text, start, end - start);
+        ProcessLine(line, code);
+        start = end + 1;
+    }
+
+    m_filename = savedFilename;
+    m_lineNum = savedLineNum;
+}
+
+void Assembler::ProcessLine(const std::string& line, std::string& code)
+{
+    m_lineNum++;
+
+    // A line starting with # is a comment, or a line marker from the C
+    // preprocessor that gives the file and line of the next line.
+    if (!line.empty() && line[0] == '#')
+    {
+        std::size_t pos = 1;
+        SkipSpaces(line, pos);
+
+        if (pos < line.size() && std::isdigit((unsigned char)line[pos]))
+        {
+            int lineNum = std::atoi(line.c_str() + pos);
+
+            while (pos < line.size() && std::isdigit((unsigned char)line[pos]))
+                pos++;
+
+            SkipSpaces(line, pos);
+
+            if (pos < line.size() && line[pos] == '"')
+            {
+                std::size_t end = line.find('"', pos + 1);
+
+                if (end != std::string::npos)
+                    m_filename = line.substr(pos + 1, end - pos - 1);
+            }
+
+            m_lineNum = lineNum - 1;
+        }
+
+        return;
+    }
+
+    Scrub(line, CodeLength(line), code);
+
+    if (code.empty())
+        return;
+
+    if (code.find(';') == std::string::npos)
+    {
+        ProcessStatement(code);
+        return;
+    }
+
+    for (const std::string& statement : SplitStatements(code))
+        ProcessStatement(statement);
+}
+
+void Assembler::ProcessStatement(const std::string& statement)
+{
+    if (m_ended)
+        return;
+
+    std::size_t pos = 0;
+    std::vector<std::string> labels;
+    std::string mnemonic;
+
+    SkipSpaces(statement, pos);
+
+    for (;;)
+    {
+        std::string name = ReadName(statement, pos);
+
+        if (!name.empty() && pos < statement.size() && statement[pos] == ':')
+        {
+            labels.push_back(name);
+            pos++;
+            SkipSpaces(statement, pos);
+            continue;
+        }
+
+        mnemonic.swap(name);
+        break;
+    }
+
+    // Directives and macros are looked up without regard to case.
+    std::string lowered;
+    bool hasUpper = std::any_of(mnemonic.begin(), mnemonic.end(), [](char c) { return c >= 'A' && c <= 'Z'; });
+
+    if (hasUpper)
+        lowered = ToLower(mnemonic);
+
+    const std::string& lower = hasUpper ? lowered : mnemonic;
+
+    if (m_block != Block::None)
+    {
+        CollectBlockLine(statement, lower);
+        return;
+    }
+
+    SkipSpaces(statement, pos);
+    std::string operands = statement.substr(pos);
+
+    if (IsSkipping())
+    {
+        if (IsConditional(lower))
+            HandleConditional(lower, operands);
+        return;
+    }
+
+    for (const std::string& label : labels)
+        DefineLabel(label);
+
+    if (mnemonic.empty())
+    {
+        if (!operands.empty())
+            RaiseError("junk at start of statement: \"%s\"", operands.c_str());
+        return;
+    }
+
+    if (!operands.empty() && operands[0] == '=' && (operands.size() == 1 || operands[1] != '='))
+    {
+        SetSymbol(mnemonic, operands.substr(1), false);
+        return;
+    }
+
+    if (IsConditional(lower))
+    {
+        HandleConditional(lower, operands);
+        return;
+    }
+
+    if (lower[0] == '.')
+    {
+        auto it = m_directives.find(lower);
+
+        if (it == m_directives.end())
+            RaiseError("unknown directive \"%s\"", mnemonic.c_str());
+        else
+            (this->*it->second)(operands, lower);
+
+        return;
+    }
+
+    auto it = m_macros.find(lower);
+
+    if (it == m_macros.end())
+    {
+        RaiseError("unknown macro \"%s\" (instructions aren't supported)", mnemonic.c_str());
+        return;
+    }
+
+    ExpandMacro(it->second, operands);
+}
+
+void Assembler::CollectBlockLine(const std::string& statement, const std::string& mnemonic)
+{
+    if (m_block == Block::Macro)
+    {
+        if (mnemonic == ".macro")
+        {
+            m_blockDepth++;
+        }
+        else if (mnemonic == ".endm" && --m_blockDepth == 0)
+        {
+            DefineMacro();
+            return;
+        }
+    }
+    else
+    {
+        if (mnemonic == ".rept" || mnemonic == ".irp" || mnemonic == ".irpc")
+        {
+            m_blockDepth++;
+        }
+        else if (mnemonic == ".endr" && --m_blockDepth == 0)
+        {
+            ExpandRepeat();
+            return;
+        }
+    }
+
+    m_blockLines.push_back(statement);
+}
+
+bool Assembler::IsConditional(const std::string& mnemonic) const
+{
+    if (mnemonic.size() < 3 || mnemonic[0] != '.' || (mnemonic[1] != 'i' && mnemonic[1] != 'e'))
+        return false;
+
+    return mnemonic.compare(0, 3, ".if") == 0 || mnemonic == ".else" || mnemonic == ".elseif" || mnemonic == ".endif";
+}
+
+bool Assembler::IsSkipping() const
+{
+    return !m_conditionals.empty() && !m_conditionals.back().isActive;
+}
+
+void Assembler::HandleConditional(const std::string& mnemonic, const std::string& operands)
+{
+    if (mnemonic == ".endif" || mnemonic == ".else" || mnemonic == ".elseif")
+    {
+        if (m_conditionals.empty())
+        {
+            RaiseError("%s without .if", mnemonic.c_str());
+            return;
+        }
+
+        Conditional& conditional = m_conditionals.back();
+
+        if (mnemonic == ".endif")
+        {
+            m_conditionals.pop_back();
+        }
+        else if (!conditional.parentActive || conditional.isDone)
+        {
+            conditional.isActive = false;
+        }
+        else
+        {
+            conditional.isActive = mnemonic == ".else" || EvaluateCondition(".if", operands);
+            conditional.isDone = conditional.isActive;
+        }
+
+        return;
+    }
+
+    Conditional conditional;
+    conditional.parentActive = !IsSkipping();
+    conditional.isActive = conditional.parentActive && EvaluateCondition(mnemonic, operands);
+    conditional.isDone = conditional.isActive || !conditional.parentActive;
+    m_conditionals.push_back(conditional);
+}
+
+bool Assembler::EvaluateCondition(const std::string& mnemonic, const std::string& operands)
+{
+    if (mnemonic == ".ifdef" || mnemonic == ".ifndef" || mnemonic == ".ifnotdef")
+    {
+        auto it = m_symbolMap.find(Trim(operands));
+        bool isDefined = it != m_symbolMap.end() && it->second->state != SymbolState::Undefined;
+        return isDefined == (mnemonic == ".ifdef");
+    }
+
+    if (mnemonic == ".ifb" || mnemonic == ".ifnb")
+        return Trim(operands).empty() == (mnemonic == ".ifb");
+
+    if (mnemonic == ".ifc" || mnemonic == ".ifnc")
+    {
+        std::size_t pos = 0;
+        std::string a = ReadMacroArgument(operands, pos);
+
+        if (pos < operands.size() && operands[pos] == ',')
+            pos++;
+
+        std::string b = ReadMacroArgument(operands, pos);
+        return (a == b) == (mnemonic == ".ifc");
+    }
+
+    std::int64_t value = 0;
+    EvaluateAbsolute(operands, value);
+
+    if (mnemonic == ".if" || mnemonic == ".ifne")
+        return value != 0;
+    if (mnemonic == ".ifeq")
+        return value == 0;
+    if (mnemonic == ".ifgt")
+        return value > 0;
+    if (mnemonic == ".ifge")
+        return value >= 0;
+    if (mnemonic == ".iflt")
+        return value < 0;
+    if (mnemonic == ".ifle")
+        return value <= 0;
+
+    RaiseError("unknown directive \"%s\"", mnemonic.c_str());
+    return false;
+}
+
+void Assembler::ExpandMacro(const Macro& macro, const std::string& operands)
+{
+    std::size_t count = macro.parameters.size();
+    std::vector<std::string> values(count);
+    std::size_t next = 0;
+    std::size_t pos = 0;
+
+    while (pos < operands.size())
+    {
+        // A keyword argument, like "type=MSGBOX_SIGN", can be given in any order.
+        std::size_t start = pos;
+        std::string key = ReadName(operands, pos);
+        std::size_t index = count;
+
+        if (!key.empty() && pos < operands.size() && operands[pos] == '=' && (pos + 1 == operands.size() || operands[pos + 1] != '='))
+        {
+            for (std::size_t i = 0; i < count; i++)
+                if (macro.parameters[i].name == key)
+                    index = i;
+        }
+
+        if (index < count)
+        {
+            pos++;
+        }
+        else
+        {
+            pos = start;
+
+            if (next >= count)
+            {
+                RaiseError("too many arguments for macro \"%s\"", macro.name.c_str());
+                return;
+            }
+
+            index = next++;
+        }
+
+        if (macro.parameters[index].isVararg)
+        {
+            values[index] = operands.substr(pos);
+            pos = operands.size();
+        }
+        else
+        {
+            values[index] = ReadMacroArgument(operands, pos);
+        }
+
+        if (pos < operands.size() && operands[pos] == ' ')
+            pos++;
+        if (pos < operands.size() && operands[pos] == ',')
+            pos++;
+    }
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (!values[i].empty())
+            continue;
+
+        if (macro.parameters[i].isRequired)
+            RaiseError("missing value for required parameter \"%s\" of macro \"%s\"", macro.parameters[i].name.c_str(), macro.name.c_str());
+
+        values[i] = macro.parameters[i].defaultValue;
+    }
+
+    ProcessExpansion(macro.body, macro.name, macro.parameters, values, m_macroCount++);
+}
+
+void Assembler::ProcessExpansion(const std::vector<std::string>& lines, const std::string& name,
+    const std::vector<MacroParameter>& parameters, const std::vector<std::string>& values, int counter)
+{
+    if (m_macroStack.size() >= s_maxMacroNesting)
+    {
+        RaiseError("macros nested too deeply");
+        return;
+    }
+
+    m_macroStack.push_back(&name);
+
+    std::size_t conditionalDepth = m_conditionals.size();
+
+    // Each level of nesting reuses its own buffers for the expanded lines.
+    if (m_expansionBuffers.size() < 2 * m_macroStack.size())
+        m_expansionBuffers.resize(2 * m_macroStack.size());
+
+    std::string& substituted = m_expansionBuffers[2 * m_macroStack.size() - 2];
+    std::string& scrubbed = m_expansionBuffers[2 * m_macroStack.size() - 1];
+
+    for (const std::string& line : lines)
+    {
+        if (m_exitMacro || m_ended)
+            break;
+
+        const std::string *statement = &line;
+
+        if (line.find('\\') != std::string::npos)
+        {
+            Substitute(line, parameters, values, counter, substituted);
+            statement = &substituted;
+        }
+
+        if (NeedsScrub(*statement))
+        {
+            Scrub(*statement, statement->size(), scrubbed);
+            statement = &scrubbed;
+        }
+
+        ProcessStatement(*statement);
+    }
+
+    m_exitMacro = false;
+
+    if (m_block != Block::None)
+    {
+        RaiseError("missing %s in expansion of \"%s\"", m_block == Block::Macro ? ".endm" : ".endr", name.c_str());
+        m_block = Block::None;
+        m_blockLines.clear();
+    }
+
+    if (m_conditionals.size() > conditionalDepth)
+    {
+        RaiseError("missing .endif in expansion of \"%s\"", name.c_str());
+        m_conditionals.resize(conditionalDepth);
+    }
+
+    m_macroStack.pop_back();
+}
+
+// Replaces \name with the value of the parameter called name, \@ with the
+// number of macros expanded so far, and \() with nothing.
+void Assembler::Substitute(const std::string& line, const std::vector<MacroParameter>& parameters,
+    const std::vector<std::string>& values, int counter, std::string& out) const
+{
+    out.clear();
+
+    for (std::size_t i = 0; i < line.size();)
+    {
+        if (line[i] != '\\')
+        {
+            out += line[i++];
+            continue;
+        }
+
+        if (i + 1 < line.size() && line[i + 1] == '@')
+        {
+            out += std::to_string(counter);
+            i += 2;
+            continue;
+        }
+
+        if (line.compare(i, 3, "\\()") == 0)
+        {
+            i += 3;
+            continue;
+        }
+
+        std::size_t end = i + 1;
+
+        while (end < line.size() && IsSymbolChar(line[end]))
+            end++;
+
+        std::size_t length = end - i - 1;
+        std::size_t index = 0;
+
+        while (index < parameters.size()
+            && (parameters[index].name.size() != length || line.compare(i + 1, length, parameters[index].name) != 0))
+            index++;
+
+        if (length == 0 || index == parameters.size())
+        {
+            out += line[i++];
+            continue;
+        }
+
+        out += values[index];
+        i = end;
+    }
+}
+
+void Assembler::DefineMacro()
+{
+    const std::string& header = m_blockOperands;
+    std::size_t pos = 0;
+    Macro macro;
+
+    macro.name = ToLower(ReadName(header, pos));
+    macro.body.swap(m_blockLines);
+    m_block = Block::None;
+
+    if (macro.name.empty())
+    {
+        RaiseError("missing macro name");
+        return;
+    }
+
+    for (;;)
+    {
+        while (pos < header.size() && (header[pos] == ' ' || header[pos] == ','))
+            pos++;
+
+        if (pos == header.size())
+            break;
+
+        MacroParameter parameter;
+        parameter.name = ReadName(header, pos);
+        parameter.isRequired = false;
+        parameter.isVararg = false;
+
+        if (parameter.name.empty())
+        {
+            RaiseError("bad parameter list for macro \"%s\"", macro.name.c_str());
+            return;
+        }
+
+        if (pos < header.size() && header[pos] == ':')
+        {
+            pos++;
+
+            std::string qualifier = ReadName(header, pos);
+
+            if (qualifier == "req")
+                parameter.isRequired = true;
+            else if (qualifier == "vararg")
+                parameter.isVararg = true;
+            else
+                RaiseError("unknown qualifier \"%s\" for parameter \"%s\"", qualifier.c_str(), parameter.name.c_str());
+        }
+
+        if (pos < header.size() && header[pos] == '=')
+        {
+            pos++;
+            parameter.defaultValue = ReadMacroArgument(header, pos);
+        }
+
+        macro.parameters.push_back(parameter);
+    }
+
+    if (m_macros.count(macro.name) != 0)
+    {
+        RaiseError("macro \"%s\" is already defined", macro.name.c_str());
+        return;
+    }
+
+    m_macros[macro.name] = macro;
+}
+
+void Assembler::ExpandRepeat()
+{
+    std::vector<std::string> lines;
+    std::string directive = m_blockDirective;
+    std::string operands = m_blockOperands;
+
+    lines.swap(m_blockLines);
+    m_block = Block::None;
+
+    if (directive == ".rept")
+    {
+        std::int64_t count = 0;
+
+        if (!EvaluateAbsolute(operands, count))
+            return;
+
+        for (std::int64_t i = 0; i < count && !m_ended; i++)
+            ProcessExpansion(lines, directive, std::vector<MacroParameter>(), std::vector<std::string>(), m_macroCount);
+
+        return;
+    }
+
+    // .irp name, values... and .irpc name, characters expand the body once
+    // for each value.
+    std::size_t pos = 0;
+    std::vector<MacroParameter> parameters(1);
+
+    parameters[0].name = ReadName(operands, pos);
+
+    if (parameters[0].name.empty())
+    {
+        RaiseError("missing parameter name for %s", directive.c_str());
+        return;
+    }
+
+    if (pos < operands.size() && (operands[pos] == ',' || operands[pos] == ' '))
+        pos++;
+
+    std::vector<std::string> values;
+
+    if (directive == ".irpc")
+    {
+        std::string characters = ReadMacroArgument(operands, pos);
+
+        for (char c : characters)
+            values.push_back(std::string(1, c));
+    }
+    else
+    {
+        while (pos < operands.size())
+        {
+            values.push_back(ReadMacroArgument(operands, pos));
+
+            if (pos < operands.size() && operands[pos] == ' ')
+                pos++;
+            if (pos < operands.size() && operands[pos] == ',')
+                pos++;
+        }
+    }
+
+    for (const std::string& value : values)
+        ProcessExpansion(lines, directive, parameters, std::vector<std::string>(1, value), m_macroCount);
+}
+
+Symbol *Assembler::GetSymbol(const std::string& name)
+{
+    auto it = m_symbolMap.find(name);
+
+    if (it != m_symbolMap.end())
+        return it->second;
+
+    Symbol *symbol = new Symbol(name);
+    m_symbols.push_back(std::unique_ptr<Symbol>(symbol));
+    m_symbolMap[name] = symbol;
+    return symbol;
+}
+
+Symbol *Assembler::GetLocation()
+{
+    Symbol *symbol = new Symbol(".");
+    symbol->state = SymbolState::Label;
+    symbol->section = m_section;
+    symbol->value = m_section->Offset();
+    symbol->isInternal = true;
+    m_locations.push_back(std::unique_ptr<Symbol>(symbol));
+    return symbol;
+}
+
+Section *Assembler::GetSection(const std::string& name)
+{
+    for (const auto& section : m_sections)
+        if (section->name == name)
+            return section.get();
+
+    Section *section = new Section();
+    section->name = name;
+    section->type = SHT_PROGBITS;
+    section->flags = 0;
+    section->alignment = 0;
+    section->size = 0;
+    section->needsSymbol = false;
+
+    // The default attributes of the standard sections.
+    if (name.compare(0, 5, ".text") == 0)
+        section->flags = SHF_ALLOC | SHF_EXECINSTR;
+    else if (name.compare(0, 5, ".data") == 0)
+        section->flags = SHF_ALLOC | SHF_WRITE;
+    else if (name.compare(0, 7, ".rodata") == 0)
+        section->flags = SHF_ALLOC;
+    else if (name.compare(0, 4, ".bss") == 0)
+        section->flags = SHF_ALLOC | SHF_WRITE;
+
+    if (name.compare(0, 4, ".bss") == 0)
+        section->type = SHT_NOBITS;
+
+    m_sections.push_back(std::unique_ptr<Section>(section));
+    return section;
+}
+
+void Assembler::DefineLabel(const std::string& name)
+{
+    Symbol *symbol = GetSymbol(name);
+
+    if (symbol->state != SymbolState::Undefined)
+    {
+        RaiseError("symbol \"%s\" is already defined", name.c_str());
+        return;
+    }
+
+    symbol->state = SymbolState::Label;
+    symbol->section = m_section;
+    symbol->value = m_section->Offset();
+}
+
+void Assembler::SetSymbol(const std::string& name, const std::string& expression, bool mustBeNew)
+{
+    Symbol *symbol = GetSymbol(name);
+
+    if (symbol->state == SymbolState::Label || (mustBeNew && symbol->state != SymbolState::Undefined))
+    {
+        RaiseError("symbol \"%s\" is already defined", name.c_str());
+        return;
+    }
+
+    std::size_t pos = 0;
+    ExpressionPtr parsed = ParseOperand(expression, pos);
+
+    if (!parsed)
+        return;
+
+    if (pos != expression.size())
+    {
+        RaiseError("junk at end of expression: \"%s\"", expression.substr(pos).c_str());
+        return;
+    }
+
+    std::string error;
+    Value value = Evaluate(parsed, error);
+
+    if (!error.empty())
+        RaiseError("%s", error.c_str());
+
+    if (value.kind == ValueKind::Unresolved || (value.kind == ValueKind::Relocatable && value.symbol == symbol))
+    {
+        RaiseError("can't resolve the value of \"%s\"", name.c_str());
+        return;
+    }
+
+    symbol->state = SymbolState::Equate;
+    symbol->base = value.kind == ValueKind::Relocatable ? value.symbol : nullptr;
+    symbol->value = value.number;
+}
+
+ExpressionPtr Assembler::ParseOperand(const std::string& text, std::size_t& pos)
+{
+    std::string error;
+    ExpressionPtr expression = ParseExpression(text, pos, *this, error);
+
+    if (!expression)
+        RaiseError("%s in \"%s\"", error.c_str(), text.c_str());
+
+    SkipSpaces(text, pos);
+    return expression;
+}
+
+bool Assembler::EvaluateAbsolute(const std::string& text, std::int64_t& value)
+{
+    std::size_t pos = 0;
+    ExpressionPtr expression = ParseOperand(text, pos);
+
+    value = 0;
+
+    if (!expression)
+        return false;
+
+    if (pos != text.size())
+    {
+        RaiseError("junk at end of expression: \"%s\"", text.substr(pos).c_str());
+        return false;
+    }
+
+    std::string error;
+    Value result = Evaluate(expression, error);
+
+    if (!error.empty())
+    {
+        RaiseError("%s", error.c_str());
+        return false;
+    }
+
+    if (result.kind != ValueKind::Absolute)
+    {
+        RaiseError("expression must be constant: \"%s\"", text.c_str());
+        return false;
+    }
+
+    value = result.number;
+    return true;
+}
+
+std::vector<std::string> Assembler::SplitOperands(const std::string& operands) const
+{
+    std::vector<std::string> result;
+    std::string current;
+    int depth = 0;
+
+    if (Trim(operands).empty())
+        return result;
+
+    for (std::size_t i = 0; i < operands.size();)
+    {
+        char c = operands[i];
+
+        if (c == '"')
+        {
+            CopyQuoted(operands, i, current);
+            continue;
+        }
+
+        if (c == '(')
+            depth++;
+        else if (c == ')')
+            depth--;
+
+        if (c == ',' && depth == 0)
+        {
+            result.push_back(Trim(current));
+            current.clear();
+        }
+        else
+        {
+            current += c;
+        }
+
+        i++;
+    }
+
+    result.push_back(Trim(current));
+    return result;
+}
+
+std::string Assembler::ParseString(const std::string& text, std::size_t& pos)
+{
+    std::string value;
+
+    SkipSpaces(text, pos);
+
+    if (pos >= text.size() || text[pos] != '"')
+    {
+        RaiseError("expected a string in \"%s\"", text.c_str());
+        pos = text.size();
+        return value;
+    }
+
+    pos++;
+
+    while (pos < text.size() && text[pos] != '"')
+    {
+        char c = text[pos++];
+
+        if (c != '\\' || pos == text.size())
+        {
+            value += c;
+            continue;
+        }
+
+        c = text[pos++];
+
+        switch (c)
+        {
+        case 'b': value += '\b'; break;
+        case 'f': value += '\f'; break;
+        case 'n': value += '\n'; break;
+        case 'r': value += '\r'; break;
+        case 't': value += '\t'; break;
+        case 'x':
+        case 'X':
+        {
+            unsigned int number = 0;
+
+            while (pos < text.size() && std::isxdigit((unsigned char)text[pos]))
+            {
+                char digit = std::tolower((unsigned char)text[pos++]);
+                number = number * 16 + (std::isdigit((unsigned char)digit) ? digit - '0' : digit - 'a' + 10);
+            }
+
+            value += (char)number;
+            break;
+        }
+        default:
+            if (c >= '0' && c <= '7')
+            {
+                unsigned int number = c - '0';
+
+                for (int i = 0; i < 2 && pos < text.size() && text[pos] >= '0' && text[pos] <= '7'; i++)
+                    number = number * 8 + (text[pos++] - '0');
+
+                value += (char)number;
+            }
+            else
+            {
+                value += c;
+            }
+            break;
+        }
+    }
+
+    if (pos == text.size())
+        RaiseError("missing closing quote in \"%s\"", text.c_str());
+    else
+        pos++;
+
+    SkipSpaces(text, pos);
+    return value;
+}
+
+void Assembler::Emit(const std::uint8_t *data, std::size_t size)
+{
+    if (m_section->type == SHT_NOBITS)
+    {
+        for (std::size_t i = 0; i < size; i++)
+        {
+            if (data[i] != 0)
+            {
+                RaiseError("attempt to store non-zero data in section \"%s\"", m_section->name.c_str());
+                return;
+            }
+        }
+
+        m_section->size += size;
+        return;
+    }
+
+    m_section->data.insert(m_section->data.end(), data, data + size);
+}
+
+static void StoreNumber(std::uint8_t *dest, std::int64_t value, int size)
+{
+    for (int i = 0; i < size; i++)
+        dest[i] = (std::uint64_t)value >> (8 * i);
+}
+
+// Returns whether value doesn't fit in size bytes as either a signed or an
+// unsigned number, which GNU as warns about.
+static bool IsTruncated(std::int64_t value, int size)
+{
+    if (size >= 8)
+        return false;
+
+    std::uint64_t mask = ~0ULL << (8 * size);
+    return ((std::uint64_t)value & mask) != 0 && ((0 - (std::uint64_t)value) & mask) != 0;
+}
+
+void Assembler::EmitNumber(std::int64_t value, int size, bool checkRange)
+{
+    std::uint8_t bytes[8];
+
+    if (checkRange && IsTruncated(value, size))
+    {
+        std::uint64_t mask = ~0ULL >> (64 - 8 * size);
+        RaiseWarning("value 0x%llx truncated to 0x%llx", (unsigned long long)value, (unsigned long long)(value & mask));
+    }
+
+    StoreNumber(bytes, value, size);
+    Emit(bytes, size);
+}
+
+void Assembler::EmitFill(std::size_t count, std::uint8_t value)
+{
+    if (m_section->type == SHT_NOBITS)
+    {
+        if (value != 0)
+            RaiseError("attempt to store non-zero data in section \"%s\"", m_section->name.c_str());
+        else
+            m_section->size += count;
+        return;
+    }
+
+    m_section->data.insert(m_section->data.end(), count, value);
+}
+
+void Assembler::DirectiveData(const std::string& operands, const std::string& name)
+{
+    int size = 4;
+
+    if (name == ".byte")
+        size = 1;
+    else if (name == ".2byte" || name == ".hword" || name == ".short")
+        size = 2;
+
+    std::size_t pos = 0;
+
+    while (pos < operands.size())
+    {
+        // Most operands are plain numbers, which needn't be parsed into an
+        // expression.
+        std::int64_t number;
+
+        if (ReadPlainNumber(operands, pos, number))
+        {
+            EmitNumber(number, size, true);
+
+            if (pos < operands.size())
+                pos++;
+            continue;
+        }
+
+        ExpressionPtr expression = ParseOperand(operands, pos);
+
+        if (!expression)
+            return;
+
+        std::string error;
+        Value value = Evaluate(expression, error);
+
+        if (!error.empty())
+            RaiseError("%s", error.c_str());
+
+        if (value.kind == ValueKind::Absolute)
+        {
+            EmitNumber(value.number, size, true);
+        }
+        else
+        {
+            // Labels are only known once the file has been read, and their
+            // addresses only once it is linked.
+            if (m_fixupFilenames.empty() || m_fixupFilenames.back() != m_filename)
+                m_fixupFilenames.push_back(m_filename);
+
+            Fixup fixup = { m_section, m_section->Offset(), size, Fold(expression), m_fixupFilenames.size() - 1, m_lineNum };
+            m_fixups.push_back(std::move(fixup));
+            EmitNumber(0, size, false);
+        }
+
+        if (pos == operands.size())
+            break;
+
+        if (operands[pos] != ',')
+        {
+            RaiseError("junk at end of expression: \"%s\"", operands.substr(pos).c_str());
+            return;
+        }
+
+        pos++;
+    }
+}
+
+void Assembler::DirectiveSpace(const std::string& operands, const std::string& name)
+{
+    std::vector<std::string> args = SplitOperands(operands);
+    std::int64_t size = 0;
+    std::int64_t fill = 0;
+
+    if (args.empty() || args.size() > 2)
+    {
+        RaiseError("%s takes a size and an optional fill value", name.c_str());
+        return;
+    }
+
+    if (!EvaluateAbsolute(args[0], size) || (args.size() == 2 && !EvaluateAbsolute(args[1], fill)))
+        return;
+
+    if (size < 0)
+    {
+        RaiseError("negative size for %s", name.c_str());
+        return;
+    }
+
+    EmitFill(size, fill);
+}
+
+void Assembler::DirectiveFill(const std::string& operands, const std::string& name)
+{
+    std::vector<std::string> args = SplitOperands(operands);
+    std::int64_t repeat = 0;
+    std::int64_t size = 1;
+    std::int64_t value = 0;
+
+    if (args.empty() || args.size() > 3)
+    {
+        RaiseError(".fill takes a repeat count, an optional size and an optional value");
+        return;
+    }
+
+    if (!EvaluateAbsolute(args[0], repeat)
+     || (args.size() >= 2 && !EvaluateAbsolute(args[1], size))
+     || (args.size() == 3 && !EvaluateAbsolute(args[2], value)))
+        return;
+
+    if (repeat < 0 || size < 0)
+    {
+        RaiseError("negative size for .fill");
+        return;
+    }
+
+    // Like GNU as, only the low four bytes of each element come from the value.
+    if (size > 8)
+        size = 8;
+
+    std::uint8_t element[8] = {};
+    StoreNumber(element, value, size < 4 ? size : 4);
+
+    for (std::int64_t i = 0; i < repeat; i++)
+        Emit(element, size);
+}
+
+void Assembler::DirectiveAscii(const std::string& operands, const std::string& name)
+{
+    std::size_t pos = 0;
+
+    while (pos < operands.size())
+    {
+        std::string s = ParseString(operands, pos);
+
+        Emit((const std::uint8_t *)s.data(), s.size());
+
+        if (name != ".ascii")
+            EmitFill(1, 0);
+
+        if (pos < operands.size())
+        {
+            if (operands[pos] != ',')
+            {
+                RaiseError("junk after string: \"%s\"", operands.substr(pos).c_str());
+                return;
+            }
+
+            pos++;
+        }
+    }
+}
+
+void Assembler::DirectiveAlign(const std::string& operands, const std::string& name)
+{
+    std::vector<std::string> args = SplitOperands(operands);
+    std::int64_t amount = 0;
+    std::int64_t fill = 0;
+    std::int64_t max = 0;
+
+    if (args.empty() || args.size() > 3)
+    {
+        RaiseError("%s takes an alignment, an optional fill value and an optional maximum", name.c_str());
+        return;
+    }
+
+    if (!EvaluateAbsolute(args[0], amount)
+     || (args.size() >= 2 && !args[1].empty() && !EvaluateAbsolute(args[1], fill))
+     || (args.size() == 3 && !EvaluateAbsolute(args[2], max)))
+        return;
+
+    int log2 = 0;
+
+    // On ARM, .align takes a power of two, like .p2align.
+    if (name == ".balign")
+    {
+        if (amount < 0 || (amount & (amount - 1)) != 0)
+        {
+            RaiseError("alignment is not a power of 2");
+            return;
+        }
+
+        while ((1LL << log2) < amount)
+            log2++;
+    }
+    else
+    {
+        log2 = amount;
+    }
+
+    if (log2 < 0 || log2 > 15)
+    {
+        RaiseError("alignment too large");
+        return;
+    }
+
+    std::uint32_t padding = (0u - m_section->Offset()) & ((1u << log2) - 1);
+
+    if (max == 0 || padding <= max)
+        EmitFill(padding, fill);
+
+    m_section->alignment = std::max(m_section->alignment, log2);
+}
+
+void Assembler::DirectiveSection(const std::string& operands, const std::string& name)
+{
+    if (name != ".section")
+    {
+        if (!operands.empty())
+            RaiseError("subsections aren't supported");
+
+        m_section = GetSection(name);
+        return;
+    }
+
+    std::vector<std::string> args = SplitOperands(operands);
+
+    if (args.empty() || args[0].empty())
+    {
+        RaiseError("missing section name");
+        return;
+    }
+
+    std::string sectionName = args[0];
+
+    if (sectionName[0] == '"')
+    {
+        std::size_t pos = 0;
+        sectionName = ParseString(args[0], pos);
+    }
+
+    bool isNew = true;
+
+    for (const auto& section : m_sections)
+        if (section->name == sectionName)
+            isNew = false;
+
+    m_section = GetSection(sectionName);
+
+    // The attributes of a section are set where it first appears.
+    if (!isNew || args.size() < 2)
+        return;
+
+    std::size_t pos = 0;
+    std::string flags = ParseString(args[1], pos);
+
+    m_section->flags = 0;
+
+    for (char c : flags)
+    {
+        switch (c)
+        {
+        case 'a':
+            m_section->flags |= SHF_ALLOC;
+            break;
+        case 'w':
+            m_section->flags |= SHF_WRITE;
+            break;
+        case 'x':
+            m_section->flags |= SHF_EXECINSTR;
+            break;
+        default:
+            RaiseError("unsupported section flag '%c'", c);
+            break;
+        }
+    }
+
+    if (args.size() >= 3)
+    {
+        std::string type = args[2];
+
+        if (!type.empty() && (type[0] == '%' || type[0] == '@'))
+            type = type.substr(1);
+
+        if (type == "progbits")
+            m_section->type = SHT_PROGBITS;
+        else if (type == "nobits")
+            m_section->type = SHT_NOBITS;
+        else
+            RaiseError("unsupported section type \"%s\"", args[2].c_str());
+    }
+}
+
+void Assembler::DirectiveGlobal(const std::string& operands, const std::string& name)
+{
+    for (const std::string& symbolName : SplitOperands(operands))
+    {
+        Symbol *symbol = GetSymbol(symbolName);
+
+        if (name == ".weak")
+            symbol->isWeak = true;
+        else
+            symbol->isGlobal = true;
+    }
+}
+
+void Assembler::DirectiveType(const std::string& operands, const std::string& name)
+{
+    std::vector<std::string> args = SplitOperands(operands);
+
+    if (args.size() != 2)
+    {
+        RaiseError(".type takes a symbol and a type");
+        return;
+    }
+
+    std::string type = args[1];
+
+    if (!type.empty() && (type[0] == '%' || type[0] == '@' || type[0] == '#'))
+        type = type.substr(1);
+
+    Symbol *symbol = GetSymbol(args[0]);
+
+    if (type == "function" || type == "STT_FUNC")
+        symbol->type = STT_FUNC;
+    else if (type == "object" || type == "STT_OBJECT")
+        symbol->type = STT_OBJECT;
+    else if (type == "notype" || type == "STT_NOTYPE")
+        symbol->type = STT_NOTYPE;
+    else
+        RaiseError("unsupported symbol type \"%s\"", args[1].c_str());
+}
+
+void Assembler::DirectiveSize(const std::string& operands, const std::string& name)
+{
+    std::size_t comma = operands.find(',');
+
+    if (comma == std::string::npos)
+    {
+        RaiseError(".size takes a symbol and a size");
+        return;
+    }
+
+    std::int64_t size = 0;
+
+    if (EvaluateAbsolute(Trim(operands.substr(comma + 1)), size))
+        GetSymbol(Trim(operands.substr(0, comma)))->size = size;
+}
+
+void Assembler::DirectiveSet(const std::string& operands, const std::string& name)
+{
+    std::size_t comma = operands.find(',');
+
+    if (comma == std::string::npos)
+    {
+        RaiseError("%s takes a symbol and a value", name.c_str());
+        return;
+    }
+
+    SetSymbol(Trim(operands.substr(0, comma)), Trim(operands.substr(comma + 1)), name == ".equiv");
+}
+
+void Assembler::DirectiveMacro(const std::string& operands, const std::string& name)
+{
+    m_block = Block::Macro;
+    m_blockDepth = 1;
+    m_blockDirective = name;
+    m_blockOperands = operands;
+    m_blockLines.clear();
+}
+
+void Assembler::DirectiveEndBlock(const std::string& operands, const std::string& name)
+{
+    if (name != ".exitm")
+        RaiseError("%s without %s", name.c_str(), name == ".endm" ? ".macro" : ".rept");
+    else if (m_macroStack.empty())
+        RaiseError(".exitm outside of a macro");
+    else
+        m_exitMacro = true;
+}
+
+void Assembler::DirectivePurgeMacro(const std::string& operands, const std::string& name)
+{
+    for (const std::string& macroName : SplitOperands(operands))
+        if (m_macros.erase(ToLower(macroName)) == 0)
+            RaiseError("macro \"%s\" is not defined", macroName.c_str());
+}
+
+void Assembler::DirectiveRepeat(const std::string& operands, const std::string& name)
+{
+    m_block = Block::Repeat;
+    m_blockDepth = 1;
+    m_blockDirective = name;
+    m_blockOperands = operands;
+    m_blockLines.clear();
+}
+
+std::string Assembler::ReadFile(const std::string& path, bool& found)
+{
+    std::vector<std::string> candidates(1, path);
+
+    for (const std::string& dir : m_includeDirs)
+        candidates.push_back(dir + "/" + path);
+
+    for (const std::string& candidate : candidates)
+    {
+        FILE *fp = std::fopen(candidate.c_str(), "rb");
+
+        if (fp == NULL)
+            continue;
+
+        std::string contents;
+        char buffer[0x10000];
+        std::size_t count;
+
+        while ((count = std::fread(buffer, 1, sizeof(buffer), fp)) != 0)
+            contents.append(buffer, count);
+
+        std::fclose(fp);
+        found = true;
+        return contents;
+    }
+
+    RaiseError("can't open \"%s\"", path.c_str());
+    found = false;
+    return std::string();
+}
+
+void Assembler::DirectiveInclude(const std::string& operands, const std::string& name)
+{
+    std::size_t pos = 0;
+    std::string path = ParseString(operands, pos);
+    bool found;
+    std::string text = ReadFile(path, found);
+
+    if (found)
+        AssembleText(text, path);
+}
+
+void Assembler::DirectiveIncbin(const std::string& operands, const std::string& name)
+{
+    std::size_t pos = 0;
+    std::string path = ParseString(operands, pos);
+    std::int64_t skip = 0;
+    std::int64_t count = -1;
+
+    if (pos < operands.size())
+    {
+        std::vector<std::string> args = SplitOperands(operands.substr(pos + 1));
+
+        if ((args.size() >= 1 && !EvaluateAbsolute(args[0], skip))
+         || (args.size() >= 2 && !EvaluateAbsolute(args[1], count)))
+            return;
+    }
+
+    bool found;
+    std::string contents = ReadFile(path, found);
+
+    if (!found)
+        return;
+
+    if (skip < 0 || (std::size_t)skip > contents.size() || (count >= 0 && (std::size_t)(skip + count) > contents.size()))
+    {
+        RaiseError("range outside of \"%s\"", path.c_str());
+        return;
+    }
+
+    if (count < 0)
+        count = contents.size() - skip;
+
+    Emit((const std::uint8_t *)contents.data() + skip, count);
+}
+
+void Assembler::DirectiveMessage(const std::string& operands, const std::string& name)
+{
+    std::size_t pos = 0;
+    std::string message = ParseString(operands, pos);
+
+    if (name == ".error")
+        RaiseError("%s", message.c_str());
+    else if (name == ".warning")
+        RaiseWarning("%s", message.c_str());
+    else
+        std::printf("%s\n", message.c_str());
+}
+
+void Assembler::DirectiveEnd(const std::string& operands, const std::string& name)
+{
+    m_ended = true;
+}
+
+void Assembler::DirectiveIgnored(const std::string& operands, const std::string& name)
+{
+}
+
+void Assembler::Finish()
+{
+    if (m_block != Block::None)
+        RaiseError("missing %s", m_block == Block::Macro ? ".endm" : ".endr");
+
+    if (!m_conditionals.empty())
+        RaiseError("missing .endif");
+
+    for (const Fixup& fixup : m_fixups)
+    {
+        std::string error;
+        Value value = Evaluate(fixup.expression, error);
+        std::uint8_t *dest = fixup.section->data.data() + fixup.offset;
+
+        if (!error.empty())
+        {
+            std::fprintf(stderr, "%s: error: %s\n", Location(fixup).c_str(), error.c_str());
+            m_errorCount++;
+            continue;
+        }
+
+        if (value.kind == ValueKind::Absolute)
+        {
+            if (IsTruncated(value.number, fixup.size))
+                std::fprintf(stderr, "%s: warning: value 0x%llx truncated\n", Location(fixup).c_str(), (unsigned long long)value.number);
+
+            StoreNumber(dest, value.number, fixup.size);
+            continue;
+        }
+
+        if (value.kind == ValueKind::Unresolved || fixup.size == 8)
+        {
+            std::fprintf(stderr, "%s: error: expression can't be represented as a relocation\n", Location(fixup).c_str());
+            m_errorCount++;
+            continue;
+        }
+
+        // Relocations against local labels use the section's symbol instead,
+        // as GNU as does, so that the labels themselves needn't be exported.
+        Relocation relocation = { fixup.section, fixup.offset, 0, value.symbol, nullptr };
+        Symbol *symbol = value.symbol;
+        std::int64_t addend = value.number;
+
+        relocation.type = fixup.size == 1 ? R_ARM_ABS8 : fixup.size == 2 ? R_ARM_ABS16 : R_ARM_ABS32;
+
+        if (symbol->state == SymbolState::Label && !symbol->isGlobal && !symbol->isWeak)
+        {
+            relocation.symbol = nullptr;
+            relocation.target = symbol->section;
+            relocation.target->needsSymbol = true;
+            addend += symbol->value;
+        }
+
+        StoreNumber(dest, addend, fixup.size);
+        m_relocations.push_back(relocation);
+    }
+}
+
+void Assembler::WriteObject(const std::string& path)
+{
+    std::vector<const Section *> sections;
+    std::vector<ElfSymbol> locals;
+    std::vector<ElfSymbol> globals;
+    std::vector<Symbol *> localSymbols;
+    std::vector<Symbol *> globalSymbols;
+
+    for (const auto& section : m_sections)
+    {
+        sections.push_back(section.get());
+
+        if (section->needsSymbol)
+        {
+            ElfSymbol elfSymbol = { "", 0, 0, STB_LOCAL, STT_SECTION, section.get(), false };
+            locals.push_back(elfSymbol);
+            localSymbols.push_back(nullptr);
+        }
+    }
+
+    // ARM objects mark where data starts in each section with a mapping symbol.
+    for (const auto& section : m_sections)
+    {
+        if (section->type == SHT_PROGBITS && section->Offset() != 0)
+        {
+            ElfSymbol elfSymbol = { "$d", 0, 0, STB_LOCAL, STT_NOTYPE, section.get(), false };
+            locals.push_back(elfSymbol);
+            localSymbols.push_back(nullptr);
+        }
+    }
+
+    for (const auto& symbol : m_symbols)
+    {
+        // Symbols starting with .L are local labels that GNU as leaves out.
+        if (symbol->name.compare(0, 2, ".L") == 0)
+            continue;
+
+        int binding = symbol->isWeak ? STB_WEAK : symbol->isGlobal ? STB_GLOBAL : STB_LOCAL;
+        ElfSymbol elfSymbol = { symbol->name, 0, (std::uint32_t)symbol->size, binding, symbol->type, nullptr, false };
+
+        if (symbol->state == SymbolState::Undefined)
+        {
+            if (binding == STB_LOCAL)
+                elfSymbol.binding = STB_GLOBAL;
+        }
+        else if (symbol->state == SymbolState::Label)
+        {
+            elfSymbol.value = symbol->value;
+            elfSymbol.section = symbol->section;
+        }
+        else
+        {
+            // Equates of undefined symbols are left out, like GNU as does.
+            Value value = SymbolValue(symbol.get());
+
+            if (value.kind == ValueKind::Absolute)
+            {
+                elfSymbol.value = value.number;
+                elfSymbol.isAbsolute = true;
+            }
+            else if (value.kind == ValueKind::Relocatable && value.symbol->state == SymbolState::Label)
+            {
+                elfSymbol.value = value.symbol->value + value.number;
+                elfSymbol.section = value.symbol->section;
+            }
+            else
+            {
+                continue;
+            }
+        }
+
+        if (elfSymbol.binding == STB_LOCAL)
+        {
+            locals.push_back(elfSymbol);
+            localSymbols.push_back(symbol.get());
+        }
+        else
+        {
+            globals.push_back(elfSymbol);
+            globalSymbols.push_back(symbol.get());
+        }
+    }
+
+    std::map<const Section *, std::uint32_t> sectionSymbols;
+
+    for (std::size_t i = 0; i < locals.size(); i++)
+    {
+        if (localSymbols[i] != nullptr)
+            localSymbols[i]->index = i + 1;
+        else if (locals[i].type == STT_SECTION)
+            sectionSymbols[locals[i].section] = i + 1;
+    }
+
+    for (std::size_t i = 0; i < globals.size(); i++)
+        globalSymbols[i]->index = locals.size() + i + 1;
+
+    std::vector<std::vector<ElfRelocation>> relocations(sections.size());
+
+    for (const Relocation& relocation : m_relocations)
+    {
+        std::size_t sectionIndex = std::find(sections.begin(), sections.end(), relocation.section) - sections.begin();
+        std::uint32_t symbolIndex = relocation.symbol != nullptr ? relocation.symbol->index : sectionSymbols[relocation.target];
+        ElfRelocation elfRelocation = { relocation.offset, symbolIndex, relocation.type };
+        relocations[sectionIndex].push_back(elfRelocation);
+    }
+
+    std::size_t localCount = locals.size();
+    locals.insert(locals.end(), globals.begin(), globals.end());
+    WriteElfObject(path, sections, relocations, locals, localCount);
+}
+
+std::string Assembler::Location() const
+{
+    return m_filename + ":" + std::to_string(m_lineNum);
+}
+
+std::string Assembler::Location(const Fixup& fixup) const
+{
+    return m_fixupFilenames[fixup.filename] + ":" + std::to_string(fixup.lineNum);
+}
+
+void Assembler::ReportDiagnostic(const char *type, const char *format, std::va_list args)
+{
+    const int bufferSize = 1024;
+    char buffer[bufferSize];
+    std::vsnprintf(buffer, bufferSize, format, args);
+    std::fprintf(stderr, "%s: %s: %s\n", Location().c_str(), type, buffer);
+
+    for (auto it = m_macroStack.rbegin(); it != m_macroStack.rend(); ++it)
+        std::fprintf(stderr, "%s: note: in expansion of \"%s\"\n", Location().c_str(), (*it)->c_str());
+}
+
+void Assembler::RaiseError(const char *format, ...)
+{
+    std::va_list args;
+    va_start(args, format);
+    ReportDiagnostic("error", format, args);
+    va_end(args);
+    m_errorCount++;
+}
+
+void Assembler::RaiseWarning(const char *format, ...)
+{
+    std::va_list args;
+    va_start(args, format);
+    ReportDiagnostic("warning", format, args);
+    va_end(args);
+}
@@ -0,0 +1,157 @@
+#ifndef ASSEMBLER_H
+#define ASSEMBLER_H
+
+#include <cstdarg>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "scriptasm.h"
+#include "expression.h"
+
+struct MacroParameter
+{
+    std::string name;
+    std::string defaultValue;
+    bool isRequired;
+    bool isVararg;
+};
+
+struct Macro
+{
+    std::string name;
+    std::vector<MacroParameter> parameters;
+    std::vector<std::string> body;
+};
+
+// A data directive whose value wasn't known when it was assembled. It becomes
+// a number or a relocation once the whole file has been read.
+struct Fixup
+{
+    Section *section;
+    std::uint32_t offset;
+    int size;
+    ExpressionPtr expression;
+    std::size_t filename; // index into the assembler's list of fixup filenames
+    int lineNum;
+};
+
+struct Relocation
+{
+    Section *section;
+    std::uint32_t offset;
+    int type;
+    Symbol *symbol;   // NULL for a relocation against the section's own symbol
+    Section *target;
+};
+
+struct Conditional
+{
+    bool isActive;    // whether the current branch is being assembled
+    bool isDone;      // whether an earlier branch was taken
+    bool parentActive;
+};
+
+// Assembles the subset of GNU as that the data and script files use: labels,
+// symbols, data directives, sections, conditionals and macros. Instructions
+// aren't supported.
+class Assembler : public SymbolSource
+{
+public:
+    Assembler(const std::vector<std::string>& includeDirs);
+    void AssembleText(const std::string& text, const std::string& filename);
+    void Finish();
+    void WriteObject(const std::string& path);
+    int ErrorCount() const { return m_errorCount; }
+
+    Symbol *GetSymbol(const std::string& name) override;
+    Symbol *GetLocation() override;
+
+private:
+    enum class Block { None, Macro, Repeat };
+    typedef void (Assembler::*DirectiveHandler)(const std::string& operands, const std::string& name);
+
+    std::vector<std::string> m_includeDirs;
+    std::unordered_map<std::string, Symbol *> m_symbolMap;
+    std::vector<std::unique_ptr<Symbol>> m_symbols;
+    std::vector<std::unique_ptr<Symbol>> m_locations;
+    std::vector<std::unique_ptr<Section>> m_sections;
+    Section *m_section;
+    std::unordered_map<std::string, Macro> m_macros;
+    std::unordered_map<std::string, DirectiveHandler> m_directives;
+    std::vector<Conditional> m_conditionals;
+    std::vector<Fixup> m_fixups;
+    std::vector<std::string> m_fixupFilenames;
+    std::vector<Relocation> m_relocations;
+
+    Block m_block;
+    int m_blockDepth;
+    std::string m_blockDirective;
+    std::string m_blockOperands;
+    std::vector<std::string> m_blockLines;
+
+    std::string m_filename;
+    int m_lineNum;
+    std::vector<const std::string *> m_macroStack;
+    std::deque<std::string> m_expansionBuffers;
+    int m_macroCount;
+    bool m_exitMacro;
+    bool m_ended;
+    int m_errorCount;
+
+    void ProcessLine(const std::string& line, std::string& code);
+    void ProcessStatement(const std::string& statement);
+    void CollectBlockLine(const std::string& statement, const std::string& mnemonic);
+    void HandleConditional(const std::string& mnemonic, const std::string& operands);
+    bool IsConditional(const std::string& mnemonic) const;
+    bool IsSkipping() const;
+    bool EvaluateCondition(const std::string& mnemonic, const std::string& operands);
+    void ExpandMacro(const Macro& macro, const std::string& operands);
+    void ProcessExpansion(const std::vector<std::string>& lines, const std::string& name,
+        const std::vector<MacroParameter>& parameters, const std::vector<std::string>& values, int counter);
+    void Substitute(const std::string& line, const std::vector<MacroParameter>& parameters,
+        const std::vector<std::string>& values, int counter, std::string& out) const;
+    void DefineMacro();
+    void ExpandRepeat();
+
+    Section *GetSection(const std::string& name);
+    void DefineLabel(const std::string& name);
+    void SetSymbol(const std::string& name, const std::string& expression, bool mustBeNew);
+    ExpressionPtr ParseOperand(const std::string& text, std::size_t& pos);
+    bool EvaluateAbsolute(const std::string& text, std::int64_t& value);
+    std::vector<std::string> SplitOperands(const std::string& operands) const;
+    std::string ParseString(const std::string& text, std::size_t& pos);
+    void Emit(const std::uint8_t *data, std::size_t size);
+    void EmitNumber(std::int64_t value, int size, bool checkRange);
+    void EmitFill(std::size_t count, std::uint8_t value);
+    std::string ReadFile(const std::string& path, bool& found);
+    std::string Location() const;
+    std::string Location(const Fixup& fixup) const;
+    void RaiseError(const char *format, ...);
+    void RaiseWarning(const char *format, ...);
+    void ReportDiagnostic(const char *type, const char *format, std::va_list args);
+
+    void DirectiveData(const std::string& operands, const std::string& name);
+    void DirectiveSpace(const std::string& operands, const std::string& name);
+    void DirectiveFill(const std::string& operands, const std::string& name);
+    void DirectiveAscii(const std::string& operands, const std::string& name);
+    void DirectiveAlign(const std::string& operands, const std::string& name);
+    void DirectiveSection(const std::string& operands, const std::string& name);
+    void DirectiveGlobal(const std::string& operands, const std::string& name);
+    void DirectiveType(const std::string& operands, const std::string& name);
+    void DirectiveSize(const std::string& operands, const std::string& name);
+    void DirectiveSet(const std::string& operands, const std::string& name);
+    void DirectiveMacro(const std::string& operands, const std::string& name);
+    void DirectiveEndBlock(const std::string& operands, const std::string& name);
+    void DirectivePurgeMacro(const std::string& operands, const std::string& name);
+    void DirectiveRepeat(const std::string& operands, const std::string& name);
+    void DirectiveInclude(const std::string& operands, const std::string& name);
+    void DirectiveIncbin(const std::string& operands, const std::string& name);
+    void DirectiveMessage(const std::string& operands, const std::string& name);
+    void DirectiveEnd(const std::string& operands, const std::string& name);
+    void DirectiveIgnored(const std::string& operands, const std::string& name);
+};
+
+#endif // ASSEMBLER_H
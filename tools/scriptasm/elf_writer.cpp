@@ -0,0 +1,251 @@
+#include <cstring>
+#include <map>
+#include "elf_writer.h"
+
+#define EM_ARM 40
+#define EF_ARM_EABI_VER5 0x05000000
+
+#define SHN_UNDEF 0
+#define SHN_ABS   0xFFF1
+
+namespace {
+
+class ByteWriter
+{
+public:
+    std::vector<std::uint8_t> bytes;
+
+    void Put8(std::uint8_t value)
+    {
+        bytes.push_back(value);
+    }
+
+    void Put16(std::uint16_t value)
+    {
+        Put8(value & 0xFF);
+        Put8(value >> 8);
+    }
+
+    void Put32(std::uint32_t value)
+    {
+        Put16(value & 0xFFFF);
+        Put16(value >> 16);
+    }
+
+    void Put(const std::vector<std::uint8_t>& data)
+    {
+        bytes.insert(bytes.end(), data.begin(), data.end());
+    }
+
+    void Align(std::uint32_t alignment)
+    {
+        while (bytes.size() % alignment != 0)
+            Put8(0);
+    }
+};
+
+struct StringTable
+{
+    std::vector<std::uint8_t> data;
+
+    StringTable() : data(1, 0)
+    {
+    }
+
+    std::uint32_t Add(const std::string& s)
+    {
+        std::uint32_t offset = data.size();
+        data.insert(data.end(), s.begin(), s.end());
+        data.push_back(0);
+        return offset;
+    }
+};
+
+struct SectionHeader
+{
+    std::uint32_t name;
+    std::uint32_t type;
+    std::uint32_t flags;
+    std::uint32_t offset;
+    std::uint32_t size;
+    std::uint32_t link;
+    std::uint32_t info;
+    std::uint32_t alignment;
+    std::uint32_t entrySize;
+    const std::vector<std::uint8_t> *data;
+};
+
+} // namespace
+
+void WriteElfObject(const std::string& path, const std::vector<const Section *>& sections,
+    const std::vector<std::vector<ElfRelocation>>& relocations, const std::vector<ElfSymbol>& symbols, std::size_t localCount)
+{
+    StringTable sectionNames;
+    StringTable symbolNames;
+    std::vector<SectionHeader> headers(1, SectionHeader());
+    std::map<const Section *, std::uint32_t> sectionIndices;
+    std::vector<std::vector<std::uint8_t>> relocationData(sections.size());
+
+    for (std::size_t i = 0; i < sections.size(); i++)
+    {
+        const Section *section = sections[i];
+        SectionHeader header = {};
+
+        sectionIndices[section] = headers.size();
+        header.name = sectionNames.Add(section->name);
+        header.type = section->type;
+        header.flags = section->flags;
+        header.size = section->Offset();
+        header.alignment = 1u << section->alignment;
+        header.data = &section->data;
+        headers.push_back(header);
+
+        if (relocations[i].empty())
+            continue;
+
+        ByteWriter writer;
+
+        for (const ElfRelocation& relocation : relocations[i])
+        {
+            writer.Put32(relocation.offset);
+            writer.Put32((relocation.symbolIndex << 8) | relocation.type);
+        }
+
+        relocationData[i] = writer.bytes;
+
+        SectionHeader relHeader = {};
+        relHeader.name = sectionNames.Add(".rel" + section->name);
+        relHeader.type = SHT_REL;
+        relHeader.flags = SHF_INFO_LINK;
+        relHeader.size = relocationData[i].size();
+        relHeader.info = headers.size() - 1;
+        relHeader.alignment = 4;
+        relHeader.entrySize = 8;
+        relHeader.data = &relocationData[i];
+        headers.push_back(relHeader);
+    }
+
+    std::uint32_t symtabIndex = headers.size();
+
+    for (SectionHeader& header : headers)
+        if (header.type == SHT_REL)
+            header.link = symtabIndex;
+
+    ByteWriter symtab;
+
+    for (int i = 0; i < 16; i++)
+        symtab.Put8(0);
+
+    for (const ElfSymbol& symbol : symbols)
+    {
+        std::uint16_t sectionIndex = SHN_UNDEF;
+
+        if (symbol.isAbsolute)
+            sectionIndex = SHN_ABS;
+        else if (symbol.section != nullptr)
+            sectionIndex = sectionIndices[symbol.section];
+
+        symtab.Put32(symbol.type == STT_SECTION ? 0 : symbolNames.Add(symbol.name));
+        symtab.Put32(symbol.value);
+        symtab.Put32(symbol.size);
+        symtab.Put8((symbol.binding << 4) | symbol.type);
+        symtab.Put8(0);
+        symtab.Put16(sectionIndex);
+    }
+
+    SectionHeader symtabHeader = {};
+    symtabHeader.name = sectionNames.Add(".symtab");
+    symtabHeader.type = SHT_SYMTAB;
+    symtabHeader.size = symtab.bytes.size();
+    symtabHeader.link = symtabIndex + 1;
+    symtabHeader.info = localCount + 1;
+    symtabHeader.alignment = 4;
+    symtabHeader.entrySize = 16;
+    symtabHeader.data = &symtab.bytes;
+    headers.push_back(symtabHeader);
+
+    SectionHeader strtabHeader = {};
+    strtabHeader.name = sectionNames.Add(".strtab");
+    strtabHeader.type = SHT_STRTAB;
+    strtabHeader.size = symbolNames.data.size();
+    strtabHeader.alignment = 1;
+    strtabHeader.data = &symbolNames.data;
+    headers.push_back(strtabHeader);
+
+    SectionHeader shstrtabHeader = {};
+    shstrtabHeader.name = sectionNames.Add(".shstrtab");
+    shstrtabHeader.type = SHT_STRTAB;
+    shstrtabHeader.alignment = 1;
+    headers.push_back(shstrtabHeader);
+    headers.back().size = sectionNames.data.size();
+    headers.back().data = &sectionNames.data;
+
+    // The ELF header comes first and the section headers last, with the
+    // contents of the sections in between.
+    ByteWriter body;
+    const std::uint32_t elfHeaderSize = 52;
+
+    for (std::size_t i = 1; i < headers.size(); i++)
+    {
+        SectionHeader& header = headers[i];
+
+        if (header.type == SHT_NOBITS)
+        {
+            header.offset = elfHeaderSize + body.bytes.size();
+            continue;
+        }
+
+        body.Align(header.alignment);
+        header.offset = elfHeaderSize + body.bytes.size();
+        body.Put(*header.data);
+    }
+
+    body.Align(4);
+
+    ByteWriter file;
+    static const std::uint8_t ident[16] = { 0x7F, 'E', 'L', 'F', 1, 1, 1 };
+
+    for (std::uint8_t c : ident)
+        file.Put8(c);
+
+    file.Put16(1); // ET_REL
+    file.Put16(EM_ARM);
+    file.Put32(1);
+    file.Put32(0); // entry
+    file.Put32(0); // program headers
+    file.Put32(elfHeaderSize + body.bytes.size());
+    file.Put32(EF_ARM_EABI_VER5);
+    file.Put16(elfHeaderSize);
+    file.Put16(0);
+    file.Put16(0);
+    file.Put16(40);
+    file.Put16(headers.size());
+    file.Put16(headers.size() - 1);
+    file.Put(body.bytes);
+
+    for (std::size_t i = 0; i < headers.size(); i++)
+    {
+        const SectionHeader& header = headers[i];
+
+        file.Put32(header.name);
+        file.Put32(header.type);
+        file.Put32(header.flags);
+        file.Put32(0); // address
+        file.Put32(header.offset);
+        file.Put32(header.size);
+        file.Put32(header.link);
+        file.Put32(header.info);
+        file.Put32(header.alignment);
+        file.Put32(header.entrySize);
+    }
+
+    FILE *fp = std::fopen(path.c_str(), "wb");
+
+    if (fp == NULL)
+        FATAL_ERROR("error: failed to open \"%s\" for writing\n", path.c_str());
+
+    if (std::fwrite(file.bytes.data(), file.bytes.size(), 1, fp) != 1)
+        FATAL_ERROR("error: failed to write \"%s\"\n", path.c_str());
+
+    std::fclose(fp);
+}
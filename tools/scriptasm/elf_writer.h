@@ -0,0 +1,37 @@
+#ifndef ELF_WRITER_H
+#define ELF_WRITER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "scriptasm.h"
+
+#define STB_LOCAL  0
+#define STB_GLOBAL 1
+#define STB_WEAK   2
+
+struct ElfSymbol
+{
+    std::string name;
+    std::uint32_t value;
+    std::uint32_t size;
+    int binding;
+    int type;
+    const Section *section; // NULL for an undefined or absolute symbol
+    bool isAbsolute;
+};
+
+struct ElfRelocation
+{
+    std::uint32_t offset;
+    std::uint32_t symbolIndex;
+    int type;
+};
+
+// Writes a relocatable ARM object. Each section is followed by its relocations,
+// if it has any. The symbols are in symbol table order, starting at index 1,
+// with the first localCount of them local.
+void WriteElfObject(const std::string& path, const std::vector<const Section *>& sections,
+    const std::vector<std::vector<ElfRelocation>>& relocations, const std::vector<ElfSymbol>& symbols, std::size_t localCount);
+
+#endif // ELF_WRITER_H
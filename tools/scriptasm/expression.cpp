@@ -0,0 +1,609 @@
+#include <cctype>
+#include "expression.h"
+
+static Value Absolute(std::int64_t number);
+static Value SymbolValue(Symbol *symbol, int depth);
+static Value EvaluateUnary(Operator op, Value operand);
+static Value EvaluateBinary(Operator op, Value left, Value right, std::string& error);
+
+static ExpressionPtr MakeNumber(std::int64_t number)
+{
+    std::shared_ptr<Expression> e = std::make_shared<Expression>();
+    e->type = Expression::Type::Number;
+    e->number = number;
+    return e;
+}
+
+static ExpressionPtr MakeSymbol(Symbol *symbol)
+{
+    std::shared_ptr<Expression> e = std::make_shared<Expression>();
+    e->type = Expression::Type::Symbol;
+    e->symbol = symbol;
+    return e;
+}
+
+static ExpressionPtr MakeOperation(Operator op, ExpressionPtr left, ExpressionPtr right)
+{
+    std::shared_ptr<Expression> e = std::make_shared<Expression>();
+    e->type = right ? Expression::Type::Binary : Expression::Type::Unary;
+    e->op = op;
+    e->left = left;
+    e->right = right;
+    return e;
+}
+
+static int Rank(Operator op)
+{
+    switch (op)
+    {
+    case Operator::Multiply:
+    case Operator::Divide:
+    case Operator::Modulus:
+    case Operator::ShiftLeft:
+    case Operator::ShiftRight:
+        return 8;
+    case Operator::BitOr:
+    case Operator::BitOrNot:
+    case Operator::BitXor:
+    case Operator::BitAnd:
+        return 7;
+    case Operator::Add:
+    case Operator::Subtract:
+        return 5;
+    case Operator::Equal:
+    case Operator::NotEqual:
+    case Operator::Less:
+    case Operator::LessEqual:
+    case Operator::Greater:
+    case Operator::GreaterEqual:
+        return 4;
+    case Operator::LogicalAnd:
+        return 3;
+    case Operator::LogicalOr:
+        return 2;
+    default:
+        return 0;
+    }
+}
+
+namespace {
+
+// An operand while it's being parsed. Operations on numbers are done straight
+// away, so that constant expressions, like most of those in .if directives,
+// don't need to be built into a tree.
+struct Operand
+{
+    enum class Kind { Invalid, Number, Tree } kind;
+    std::int64_t number;
+    ExpressionPtr tree;
+};
+
+Operand NumberOperand(std::int64_t number)
+{
+    Operand operand = { Operand::Kind::Number, number, nullptr };
+    return operand;
+}
+
+Operand TreeOperand(ExpressionPtr tree)
+{
+    Operand operand = { Operand::Kind::Tree, 0, tree };
+    return operand;
+}
+
+ExpressionPtr ToTree(const Operand& operand)
+{
+    return operand.kind == Operand::Kind::Number ? MakeNumber(operand.number) : operand.tree;
+}
+
+Operand Combine(Operator op, const Operand& left, const Operand& right)
+{
+    if (left.kind == Operand::Kind::Number && right.kind == Operand::Kind::Number)
+    {
+        // Errors, like division by zero, are left to be reported when the
+        // expression is evaluated.
+        std::string error;
+        Value value = EvaluateBinary(op, Absolute(left.number), Absolute(right.number), error);
+
+        if (error.empty())
+            return NumberOperand(value.number);
+    }
+
+    return TreeOperand(MakeOperation(op, ToTree(left), ToTree(right)));
+}
+
+class Parser
+{
+public:
+    Parser(const std::string& text, std::size_t& pos, SymbolSource& symbols, std::string& error)
+        : m_text(text), m_pos(pos), m_symbols(symbols), m_error(error)
+    {
+    }
+
+    Operand ParseBinary(int minRank);
+
+private:
+    const std::string& m_text;
+    std::size_t& m_pos;
+    SymbolSource& m_symbols;
+    std::string& m_error;
+
+    char Peek(std::size_t offset = 0) const
+    {
+        return m_pos + offset < m_text.size() ? m_text[m_pos + offset] : '\0';
+    }
+
+    void SkipSpaces()
+    {
+        while (Peek() == ' ' || Peek() == '\t')
+            m_pos++;
+    }
+
+    bool PeekBinaryOperator(Operator& op, int& length);
+    Operand ParseUnary();
+    Operand ParseNumber();
+    Operand Fail(const std::string& message);
+};
+
+Operand Parser::Fail(const std::string& message)
+{
+    Operand operand = { Operand::Kind::Invalid, 0, nullptr };
+
+    if (m_error.empty())
+        m_error = message;
+    return operand;
+}
+
+bool Parser::PeekBinaryOperator(Operator& op, int& length)
+{
+    char c = Peek();
+    char next = Peek(1);
+
+    length = 1;
+
+    switch (c)
+    {
+    case '*':
+        op = Operator::Multiply;
+        return true;
+    case '/':
+        op = Operator::Divide;
+        return true;
+    case '%':
+        op = Operator::Modulus;
+        return true;
+    case '^':
+        op = Operator::BitXor;
+        return true;
+    case '+':
+        op = Operator::Add;
+        return true;
+    case '-':
+        op = Operator::Subtract;
+        return true;
+    case '<':
+        if (next == '<' || next == '=' || next == '>')
+            length = 2;
+        op = next == '<' ? Operator::ShiftLeft : next == '=' ? Operator::LessEqual : next == '>' ? Operator::NotEqual : Operator::Less;
+        return true;
+    case '>':
+        if (next == '>' || next == '=')
+            length = 2;
+        op = next == '>' ? Operator::ShiftRight : next == '=' ? Operator::GreaterEqual : Operator::Greater;
+        return true;
+    case '|':
+        if (next == '|')
+            length = 2;
+        op = next == '|' ? Operator::LogicalOr : Operator::BitOr;
+        return true;
+    case '&':
+        if (next == '&')
+            length = 2;
+        op = next == '&' ? Operator::LogicalAnd : Operator::BitAnd;
+        return true;
+    case '!':
+        if (next == '=')
+            length = 2;
+        op = next == '=' ? Operator::NotEqual : Operator::BitOrNot;
+        return true;
+    case '=':
+        if (next == '=')
+            length = 2;
+        op = Operator::Equal;
+        return true;
+    default:
+        return false;
+    }
+}
+
+Operand Parser::ParseBinary(int minRank)
+{
+    Operand left = ParseUnary();
+
+    if (left.kind == Operand::Kind::Invalid)
+        return left;
+
+    for (;;)
+    {
+        SkipSpaces();
+
+        Operator op;
+        int length;
+
+        if (!PeekBinaryOperator(op, length) || Rank(op) < minRank)
+            return left;
+
+        m_pos += length;
+
+        Operand right = ParseBinary(Rank(op) + 1);
+
+        if (right.kind == Operand::Kind::Invalid)
+            return right;
+
+        left = Combine(op, left, right);
+    }
+}
+
+Operand Parser::ParseUnary()
+{
+    SkipSpaces();
+
+    char c = Peek();
+
+    if (c == '-' || c == '~' || c == '!' || c == '+')
+    {
+        m_pos++;
+
+        Operand operand = ParseUnary();
+
+        if (operand.kind == Operand::Kind::Invalid || c == '+')
+            return operand;
+
+        Operator op = c == '-' ? Operator::Negate : c == '~' ? Operator::BitNot : Operator::LogicalNot;
+
+        if (operand.kind == Operand::Kind::Number)
+            return NumberOperand(EvaluateUnary(op, Absolute(operand.number)).number);
+
+        return TreeOperand(MakeOperation(op, operand.tree, nullptr));
+    }
+
+    if (c == '(')
+    {
+        m_pos++;
+
+        Operand inner = ParseBinary(0);
+
+        if (inner.kind == Operand::Kind::Invalid)
+            return inner;
+
+        SkipSpaces();
+
+        if (Peek() != ')')
+            return Fail("missing ')'");
+
+        m_pos++;
+        return inner;
+    }
+
+    if (std::isdigit((unsigned char)c))
+        return ParseNumber();
+
+    if (c == '\'')
+    {
+        // A character constant is a quote followed by the character, as in 'A.
+        char value = Peek(1);
+
+        if (value == '\0')
+            return Fail("missing character after '");
+
+        m_pos += 2;
+
+        if (value == '\\')
+        {
+            char escape = Peek();
+            m_pos++;
+
+            switch (escape)
+            {
+            case 'n': value = '\n'; break;
+            case 't': value = '\t'; break;
+            case 'r': value = '\r'; break;
+            case '0': value = '\0'; break;
+            default: value = escape; break;
+            }
+        }
+
+        return NumberOperand((unsigned char)value);
+    }
+
+    if (IsSymbolStart(c))
+    {
+        std::size_t start = m_pos;
+
+        while (IsSymbolChar(Peek()))
+            m_pos++;
+
+        if (m_pos == start + 1 && c == '.')
+            return TreeOperand(MakeSymbol(m_symbols.GetLocation()));
+
+        // Like GNU as, symbols that are already equal to a number are
+        // replaced by it.
+        Symbol *symbol = m_symbols.GetSymbol(m_text.substr(start, m_pos - start));
+        Value value = SymbolValue(symbol, 0);
+
+        if (value.kind == ValueKind::Absolute)
+            return NumberOperand(value.number);
+
+        return TreeOperand(MakeSymbol(symbol));
+    }
+
+    if (c == '\0' || c == ',')
+        return Fail("missing expression");
+
+    return Fail(std::string("unexpected character '") + c + "' in expression");
+}
+
+Operand Parser::ParseNumber()
+{
+    int radix = 10;
+
+    if (Peek() == '0' && (Peek(1) == 'x' || Peek(1) == 'X'))
+    {
+        radix = 16;
+        m_pos += 2;
+    }
+    else if (Peek() == '0' && (Peek(1) == 'b' || Peek(1) == 'B') && (Peek(2) == '0' || Peek(2) == '1'))
+    {
+        radix = 2;
+        m_pos += 2;
+    }
+    else if (Peek() == '0' && std::isdigit((unsigned char)Peek(1)))
+    {
+        radix = 8;
+        m_pos++;
+    }
+
+    std::uint64_t value = 0;
+    bool anyDigits = false;
+
+    for (;;)
+    {
+        char c = Peek();
+        int digit;
+
+        if (std::isdigit((unsigned char)c))
+            digit = c - '0';
+        else if (c >= 'a' && c <= 'f')
+            digit = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F')
+            digit = c - 'A' + 10;
+        else
+            break;
+
+        if (digit >= radix)
+            break;
+
+        value = value * radix + digit;
+        anyDigits = true;
+        m_pos++;
+    }
+
+    if (!anyDigits || IsSymbolChar(Peek()))
+        return Fail("bad number");
+
+    return NumberOperand((std::int64_t)value);
+}
+
+} // namespace
+
+ExpressionPtr ParseExpression(const std::string& text, std::size_t& pos, SymbolSource& symbols, std::string& error)
+{
+    Parser parser(text, pos, symbols, error);
+    Operand operand = parser.ParseBinary(0);
+
+    if (operand.kind == Operand::Kind::Invalid)
+        return nullptr;
+
+    return ToTree(operand);
+}
+
+static Value Absolute(std::int64_t number)
+{
+    Value value = { ValueKind::Absolute, number, nullptr };
+    return value;
+}
+
+static Value Unresolved()
+{
+    Value value = { ValueKind::Unresolved, 0, nullptr };
+    return value;
+}
+
+static Value SymbolValue(Symbol *symbol, int depth)
+{
+    // A chain of equates this long is a cycle, like ".set a, b; .set b, a".
+    if (depth > 100)
+        return Unresolved();
+
+    if (symbol->state != SymbolState::Equate)
+    {
+        Value value = { ValueKind::Relocatable, 0, symbol };
+        return value;
+    }
+
+    if (symbol->base == nullptr)
+        return Absolute(symbol->value);
+
+    Value value = SymbolValue(symbol->base, depth + 1);
+
+    if (value.kind != ValueKind::Unresolved)
+        value.number += symbol->value;
+
+    return value;
+}
+
+Value SymbolValue(Symbol *symbol)
+{
+    return SymbolValue(symbol, 0);
+}
+
+static Value EvaluateUnary(Operator op, Value operand)
+{
+    if (operand.kind != ValueKind::Absolute)
+        return Unresolved();
+
+    std::int64_t a = operand.number;
+
+    switch (op)
+    {
+    case Operator::Negate:
+        return Absolute((std::int64_t)(0 - (std::uint64_t)a));
+    case Operator::BitNot:
+        return Absolute(~a);
+    default:
+        return Absolute(!a);
+    }
+}
+
+static Value EvaluateBinary(Operator op, Value left, Value right, std::string& error)
+{
+    if (left.kind == ValueKind::Unresolved || right.kind == ValueKind::Unresolved)
+        return Unresolved();
+
+    if (left.kind == ValueKind::Relocatable || right.kind == ValueKind::Relocatable)
+    {
+        if (op == Operator::Add && right.kind == ValueKind::Absolute)
+        {
+            left.number += right.number;
+            return left;
+        }
+
+        if (op == Operator::Add && left.kind == ValueKind::Absolute)
+        {
+            right.number += left.number;
+            return right;
+        }
+
+        if (op == Operator::Subtract && right.kind == ValueKind::Absolute)
+        {
+            left.number -= right.number;
+            return left;
+        }
+
+        bool isComparison = op >= Operator::Equal && op <= Operator::GreaterEqual;
+
+        if ((op == Operator::Subtract || isComparison) && left.kind == ValueKind::Relocatable && right.kind == ValueKind::Relocatable)
+        {
+            // The distance between two labels in the same section is known.
+            Symbol *a = left.symbol;
+            Symbol *b = right.symbol;
+
+            if (a == b)
+                return EvaluateBinary(op, Absolute(left.number), Absolute(right.number), error);
+
+            if (a->state == SymbolState::Label && b->state == SymbolState::Label && a->section == b->section)
+                return EvaluateBinary(op, Absolute(a->value + left.number), Absolute(b->value + right.number), error);
+        }
+
+        // Like GNU as, a symbol is never equal to a number or to a symbol
+        // whose distance from it isn't known.
+        if (op == Operator::Equal || op == Operator::NotEqual)
+            return Absolute(op == Operator::Equal ? 0 : -1);
+
+        return Unresolved();
+    }
+
+    std::int64_t a = left.number;
+    std::int64_t b = right.number;
+    std::uint64_t ua = a;
+    std::uint64_t ub = b;
+
+    switch (op)
+    {
+    case Operator::Multiply:
+        return Absolute((std::int64_t)(ua * ub));
+    case Operator::Divide:
+    case Operator::Modulus:
+        if (b == 0)
+        {
+            error = "division by zero";
+            return Absolute(0);
+        }
+        if (b == -1)
+            return Absolute(op == Operator::Divide ? (std::int64_t)(0 - ua) : 0);
+        return Absolute(op == Operator::Divide ? a / b : a % b);
+    case Operator::ShiftLeft:
+        return Absolute(ub >= 64 ? 0 : (std::int64_t)(ua << ub));
+    case Operator::ShiftRight:
+        return Absolute(ub >= 64 ? 0 : (std::int64_t)(ua >> ub));
+    case Operator::BitOr:
+        return Absolute(a | b);
+    case Operator::BitOrNot:
+        return Absolute(a | ~b);
+    case Operator::BitXor:
+        return Absolute(a ^ b);
+    case Operator::BitAnd:
+        return Absolute(a & b);
+    case Operator::Add:
+        return Absolute((std::int64_t)(ua + ub));
+    case Operator::Subtract:
+        return Absolute((std::int64_t)(ua - ub));
+    case Operator::Equal:
+        return Absolute(a == b ? -1 : 0);
+    case Operator::NotEqual:
+        return Absolute(a != b ? -1 : 0);
+    case Operator::Less:
+        return Absolute(a < b ? -1 : 0);
+    case Operator::LessEqual:
+        return Absolute(a <= b ? -1 : 0);
+    case Operator::Greater:
+        return Absolute(a > b ? -1 : 0);
+    case Operator::GreaterEqual:
+        return Absolute(a >= b ? -1 : 0);
+    case Operator::LogicalAnd:
+        return Absolute(a && b);
+    case Operator::LogicalOr:
+        return Absolute(a || b);
+    default:
+        return Unresolved();
+    }
+}
+
+Value Evaluate(const ExpressionPtr& expression, std::string& error)
+{
+    switch (expression->type)
+    {
+    case Expression::Type::Number:
+        return Absolute(expression->number);
+    case Expression::Type::Symbol:
+        return SymbolValue(expression->symbol);
+    case Expression::Type::Unary:
+        return EvaluateUnary(expression->op, Evaluate(expression->left, error));
+    default:
+        return EvaluateBinary(expression->op, Evaluate(expression->left, error), Evaluate(expression->right, error), error);
+    }
+}
+
+ExpressionPtr Fold(const ExpressionPtr& expression)
+{
+    switch (expression->type)
+    {
+    case Expression::Type::Number:
+        return expression;
+    case Expression::Type::Symbol:
+    {
+        Value value = SymbolValue(expression->symbol);
+
+        if (value.kind == ValueKind::Absolute)
+            return MakeNumber(value.number);
+
+        if (value.kind == ValueKind::Unresolved || (value.symbol == expression->symbol && value.number == 0))
+            return expression;
+
+        return MakeOperation(Operator::Add, MakeSymbol(value.symbol), MakeNumber(value.number));
+    }
+    case Expression::Type::Unary:
+        return MakeOperation(expression->op, Fold(expression->left), nullptr);
+    default:
+        return MakeOperation(expression->op, Fold(expression->left), Fold(expression->right));
+    }
+}
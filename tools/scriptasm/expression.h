@@ -0,0 +1,87 @@
+#ifndef EXPRESSION_H
+#define EXPRESSION_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "scriptasm.h"
+
+// Operators, with GNU as's precedence rather than C's: for example "|" binds
+// more tightly than "+", and true comparisons are -1.
+enum class Operator
+{
+    Negate, BitNot, LogicalNot,
+    Multiply, Divide, Modulus, ShiftLeft, ShiftRight,
+    BitOr, BitOrNot, BitXor, BitAnd,
+    Add, Subtract,
+    Equal, NotEqual, Less, LessEqual, Greater, GreaterEqual,
+    LogicalAnd,
+    LogicalOr,
+};
+
+struct Expression;
+typedef std::shared_ptr<const Expression> ExpressionPtr;
+
+struct Expression
+{
+    enum class Type { Number, Symbol, Unary, Binary } type;
+    std::int64_t number;
+    ::Symbol *symbol;
+    Operator op;
+    ExpressionPtr left;
+    ExpressionPtr right;
+};
+
+enum class ValueKind
+{
+    Absolute,
+    Relocatable, // a label or undefined symbol plus a number
+    Unresolved,  // depends on symbols that aren't defined yet
+};
+
+struct Value
+{
+    ValueKind kind;
+    std::int64_t number;
+    ::Symbol *symbol;
+};
+
+// Looks up the symbols named in an expression.
+class SymbolSource
+{
+public:
+    virtual ::Symbol *GetSymbol(const std::string& name) = 0;
+    // Returns a symbol for the current location, ".".
+    virtual ::Symbol *GetLocation() = 0;
+protected:
+    ~SymbolSource() {}
+};
+
+// Parses the expression that starts at pos in text, which must have been
+// scrubbed of comments and extra spaces. Parsing stops at a top-level comma or
+// at the end of the text. On failure, returns NULL and sets error.
+ExpressionPtr ParseExpression(const std::string& text, std::size_t& pos, SymbolSource& symbols, std::string& error);
+
+// Evaluates an expression with the symbols' current definitions. The error is
+// set for operations that can never succeed, such as division by zero.
+Value Evaluate(const ExpressionPtr& expression, std::string& error);
+
+// Returns a copy of the expression with the symbols whose values are known
+// replaced by those values, so that later redefinitions don't change it.
+ExpressionPtr Fold(const ExpressionPtr& expression);
+
+// The value of a symbol, following equates to the label or undefined symbol
+// they are based on.
+Value SymbolValue(::Symbol *symbol);
+
+inline bool IsSymbolStart(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == '.' || c == '$';
+}
+
+inline bool IsSymbolChar(char c)
+{
+    return IsSymbolStart(c) || (c >= '0' && c <= '9');
+}
+
+#endif // EXPRESSION_H
@@ -0,0 +1,117 @@
+// Assembles the event, battle and battle animation script files, which are
+// nothing but macros, labels and data, without starting a general purpose
+// assembler for each one. Accepts the options the Makefile passes to as:
+//
+//   scriptasm [-o OUTPUT] [--defsym NAME=VALUE]... [-I DIR]... [INPUT]...
+//
+// Reads standard input if no inputs are given. -m options are accepted and
+// ignored, since no instructions are assembled.
+
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "scriptasm.h"
+#include "assembler.h"
+#include "trace.h"
+
+static void Usage(const char *program)
+{
+    FATAL_ERROR("Usage: %s [-o OUTPUT] [--defsym NAME=VALUE]... [-I DIR]... [INPUT]...\n", program);
+}
+
+static std::string ReadInput(const std::string& path)
+{
+    if (path == "-")
+        return std::string(std::istreambuf_iterator<char>(std::cin), std::istreambuf_iterator<char>());
+
+    FILE *fp = std::fopen(path.c_str(), "rb");
+
+    if (fp == NULL)
+        FATAL_ERROR("error: failed to open \"%s\" for reading\n", path.c_str());
+
+    std::string contents;
+    char buffer[0x10000];
+    std::size_t count;
+
+    while ((count = std::fread(buffer, 1, sizeof(buffer), fp)) != 0)
+        contents.append(buffer, count);
+
+    std::fclose(fp);
+    return contents;
+}
+
+int main(int argc, char **argv)
+{
+    std::string outputPath = "a.out";
+    std::vector<std::string> defsyms;
+    std::vector<std::string> includeDirs;
+    std::vector<std::string> inputs;
+
+    TraceInit("scriptasm", argc, argv);
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+
+        if (arg == "-o" || arg == "--defsym" || arg == "-I")
+        {
+            if (i + 1 >= argc)
+                Usage(argv[0]);
+
+            std::string value = argv[++i];
+
+            if (arg == "-o")
+                outputPath = value;
+            else if (arg == "--defsym")
+                defsyms.push_back(value);
+            else
+                includeDirs.push_back(value);
+        }
+        else if (arg.compare(0, 2, "-I") == 0)
+        {
+            includeDirs.push_back(arg.substr(2));
+        }
+        else if (arg.compare(0, 2, "-m") == 0)
+        {
+        }
+        else if (arg.size() > 1 && arg[0] == '-')
+        {
+            Usage(argv[0]);
+        }
+        else
+        {
+            inputs.push_back(arg);
+        }
+    }
+
+    if (inputs.empty())
+        inputs.push_back("-");
+
+    std::uint64_t traceStart = TraceBegin();
+    Assembler assembler(includeDirs);
+
+    for (const std::string& defsym : defsyms)
+    {
+        if (defsym.find('=') == std::string::npos)
+            FATAL_ERROR("error: --defsym expects NAME=VALUE, not \"%s\"\n", defsym.c_str());
+
+        assembler.AssembleText(defsym, "--defsym");
+    }
+
+    for (const std::string& input : inputs)
+        assembler.AssembleText(ReadInput(input), input == "-" ? "{standard input}" : input);
+
+    assembler.Finish();
+    TraceEnd("assemble", traceStart, inputs[0].c_str());
+
+    if (assembler.ErrorCount() != 0)
+        return 1;
+
+    traceStart = TraceBegin();
+    assembler.WriteObject(outputPath);
+    TraceEnd("write", traceStart, outputPath.c_str());
+
+    return 0;
+}
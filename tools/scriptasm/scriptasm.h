@@ -0,0 +1,78 @@
+#ifndef SCRIPTASM_H
+#define SCRIPTASM_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#define FATAL_ERROR(format, ...)                 \
+do                                               \
+{                                                \
+    std::fprintf(stderr, format, ##__VA_ARGS__); \
+    std::exit(1);                                \
+} while (0)
+
+// ELF values used by the assembler and the object writer.
+#define SHT_PROGBITS 1
+#define SHT_SYMTAB   2
+#define SHT_STRTAB   3
+#define SHT_NOBITS   8
+#define SHT_REL      9
+
+#define SHF_WRITE     0x1
+#define SHF_ALLOC     0x2
+#define SHF_EXECINSTR 0x4
+#define SHF_INFO_LINK 0x40
+
+#define STT_NOTYPE  0
+#define STT_OBJECT  1
+#define STT_FUNC    2
+#define STT_SECTION 3
+
+#define R_ARM_ABS32 2
+#define R_ARM_ABS16 5
+#define R_ARM_ABS8  8
+
+struct Section
+{
+    std::string name;
+    std::uint32_t type;
+    std::uint32_t flags;
+    int alignment;          // log2 of the largest alignment in the section
+    std::vector<std::uint8_t> data;
+    std::uint32_t size;     // the size of a SHT_NOBITS section, which has no data
+    bool needsSymbol;       // whether relocations refer to the section's symbol
+
+    std::uint32_t Offset() const { return type == SHT_NOBITS ? size : data.size(); }
+};
+
+enum class SymbolState
+{
+    Undefined,
+    Label,  // defined at an offset in a section
+    Equate, // defined by .set or =, either to a number or to another symbol plus a number
+};
+
+struct Symbol
+{
+    std::string name;
+    SymbolState state;
+    Section *section;   // for labels
+    std::int64_t value; // the offset of a label, or the number of an equate
+    Symbol *base;       // for equates of another symbol
+    bool isGlobal;
+    bool isWeak;
+    bool isInternal;    // a location made for ".", which is never written out
+    int type;
+    std::int64_t size;
+    int index;          // in the object's symbol table
+
+    Symbol(const std::string& name) : name(name), state(SymbolState::Undefined), section(nullptr), value(0), base(nullptr),
+        isGlobal(false), isWeak(false), isInternal(false), type(STT_NOTYPE), size(0), index(0)
+    {
+    }
+};
+
+#endif // SCRIPTASM_H
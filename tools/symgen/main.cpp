@@ -0,0 +1,205 @@
+// Writes the symbol map for a linked ROM. The output matches what
+//   objdump -t rom.elf | sort -u | grep -E "^0[2389]" | perl -p -e '...'
+// used to produce: one "address binding size name" line per symbol in EWRAM,
+// IWRAM or ROM, ordered the way sort(1) orders objdump's lines in the C locale.
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "ramscrgen.h"
+#include "elf.h"
+
+#define STB_LOCAL  0
+#define STB_GLOBAL 1
+#define STB_WEAK   2
+#define STB_GNU_UNIQUE 10
+
+#define STT_OBJECT  1
+#define STT_FUNC    2
+#define STT_SECTION 3
+#define STT_FILE    4
+#define STT_GNU_IFUNC 10
+
+struct SymLine
+{
+    std::string objdumpLine;
+    std::string output;
+};
+
+// binutils hides ARM mapping and tagging symbols ($a, $t, $d, ...) from
+// objdump -t unless --special-syms is given.
+static bool IsArmSpecialSymbol(const std::string& name)
+{
+    return name.size() >= 2 && name[0] == '$' && name[1] >= 'a' && name[1] <= 'z'
+        && (name.size() == 2 || name[2] == '.');
+}
+
+static std::string FormatObjdumpLine(const ElfSymbol& symbol, std::uint32_t value)
+{
+    int bind = symbol.info >> 4;
+    int type = symbol.info & 0xF;
+    char flags[8] = "       ";
+
+    if (bind == STB_LOCAL)
+        flags[0] = 'l';
+    else if (bind == STB_GLOBAL)
+        flags[0] = 'g';
+    else if (bind == STB_GNU_UNIQUE)
+        flags[0] = 'u';
+    else if (bind == STB_WEAK)
+        flags[1] = 'w';
+
+    if (type == STT_GNU_IFUNC)
+        flags[4] = 'i';
+
+    if (type == STT_SECTION || type == STT_FILE)
+        flags[5] = 'd';
+
+    if (type == STT_FUNC)
+        flags[6] = 'F';
+    else if (type == STT_FILE)
+        flags[6] = 'f';
+    else if (type == STT_OBJECT)
+        flags[6] = 'O';
+
+    std::string sectionName;
+
+    if (symbol.sectionIndex == SHN_UNDEF)
+        sectionName = "*UND*";
+    else if (symbol.sectionIndex == SHN_ABS)
+        sectionName = "*ABS*";
+    else if (symbol.sectionIndex == SHN_COMMON)
+        sectionName = "*COM*";
+    else
+        sectionName = symbol.sectionName;
+
+    // Section symbols have no name of their own; objdump shows the section's.
+    std::string name = (type == STT_SECTION && symbol.name.empty()) ? sectionName : symbol.name;
+
+    char visibility[16] = "";
+
+    switch (symbol.other)
+    {
+    case 0: break;
+    case 1: std::snprintf(visibility, sizeof(visibility), " .internal"); break;
+    case 2: std::snprintf(visibility, sizeof(visibility), " .hidden"); break;
+    case 3: std::snprintf(visibility, sizeof(visibility), " .protected"); break;
+    default: std::snprintf(visibility, sizeof(visibility), " 0x%02x", symbol.other); break;
+    }
+
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%08x %s ", value, flags);
+    std::string line = buffer;
+    line += sectionName;
+    std::snprintf(buffer, sizeof(buffer), "\t%08x", symbol.size);
+    line += buffer;
+    line += visibility;
+    line += " ";
+    line += name;
+    return line;
+}
+
+static bool IsWordChar(char c)
+{
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+// The old pipeline's perl expression,
+//   s/^(\w{8}) (\w).{6} \S+\t(\w{8}) (\S+)$/\1 \2 \3 \4/
+// which leaves lines it doesn't match (weak or hidden symbols) untouched.
+static std::string ShortenLine(const std::string& line)
+{
+    std::size_t tab = line.find('\t');
+
+    if (tab == std::string::npos || tab < 18 || line[8] != ' ' || line[16] != ' ' || !IsWordChar(line[9]))
+        return line;
+
+    for (int i = 0; i < 8; i++)
+    {
+        if (!IsWordChar(line[i]))
+            return line;
+    }
+
+    for (std::size_t i = 17; i < tab; i++)
+    {
+        if (line[i] == ' ')
+            return line;
+    }
+
+    std::string rest = line.substr(tab + 1);
+
+    if (rest.size() < 10 || rest[8] != ' ')
+        return line;
+
+    for (int i = 0; i < 8; i++)
+    {
+        if (!IsWordChar(rest[i]))
+            return line;
+    }
+
+    std::string name = rest.substr(9);
+
+    if (name.empty() || name.find(' ') != std::string::npos)
+        return line;
+
+    return line.substr(0, 8) + " " + line[9] + " " + rest.substr(0, 8) + " " + name;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 2)
+    {
+        std::fprintf(stderr, "Usage: symgen ELF_FILE\n");
+        return 1;
+    }
+
+    std::vector<ElfSymbol> symbols = GetSymbols(argv[1]);
+    std::vector<SymLine> lines;
+
+    lines.reserve(symbols.size());
+
+    for (const ElfSymbol& symbol : symbols)
+    {
+        if (IsArmSpecialSymbol(symbol.name))
+            continue;
+
+        std::uint32_t value = symbol.value;
+
+        // BFD strips the Thumb bit from function addresses.
+        if ((symbol.info & 0xF) == STT_FUNC)
+            value &= ~1u;
+
+        switch (value >> 24)
+        {
+        case 0x02:
+        case 0x03:
+        case 0x08:
+        case 0x09:
+            break;
+        default:
+            continue;
+        }
+
+        std::string line = FormatObjdumpLine(symbol, value);
+        lines.push_back({ line, ShortenLine(line) });
+    }
+
+    std::sort(lines.begin(), lines.end(), [](const SymLine& a, const SymLine& b) {
+        return a.objdumpLine < b.objdumpLine;
+    });
+
+    FILE *fp = stdout;
+    const std::string *previous = nullptr;
+
+    for (const SymLine& line : lines)
+    {
+        if (previous != nullptr && *previous == line.objdumpLine)
+            continue;
+        previous = &line.objdumpLine;
+        std::fputs(line.output.c_str(), fp);
+        std::fputc('\n', fp);
+    }
+
+    return 0;
+}
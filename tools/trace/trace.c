@@ -0,0 +1,217 @@
+// Appends Chrome trace events ("ph":"X") to the file named by TOOLS_TRACE.
+// The file is a JSON array left open at the end, which chrome://tracing and
+// Perfetto both accept, so any number of tools can add to it. Each event is
+// written with a single write() under an fcntl lock, which keeps processes
+// apart, and a mutex, which keeps a tool's threads apart.
+
+#if !defined(_GNU_SOURCE) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#include "trace.h"
+
+#define TRACE_ENV_VAR "TOOLS_TRACE"
+
+#ifndef _WIN32
+
+static int sTraceFd = -1;
+static pthread_mutex_t sTraceMutex = PTHREAD_MUTEX_INITIALIZER;
+static int sTraceLockFailed;
+static int sPid;
+static uint64_t sStartTime;
+static char sToolName[64];
+static char sCommandLine[1024];
+
+#ifdef __cplusplus
+static thread_local int sThread;
+#else
+static _Thread_local int sThread;
+#endif
+
+static uint64_t GetTimeMicroseconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Copies src into dest as the body of a JSON string, truncating if needed.
+static void EscapeJson(char *dest, size_t destSize, const char *src)
+{
+    size_t len = 0;
+
+    for (; *src != 0 && len + 7 < destSize; src++)
+    {
+        unsigned char c = *src;
+
+        if (c == '"' || c == '\\')
+        {
+            dest[len++] = '\\';
+            dest[len++] = c;
+        }
+        else if (c < 0x20)
+        {
+            len += snprintf(dest + len, destSize - len, "\\u%04x", c);
+        }
+        else
+        {
+            dest[len++] = c;
+        }
+    }
+
+    dest[len] = 0;
+}
+
+// Returns 0 and stops tracing if the lock can't be taken or released, e.g.
+// on a file system without locks. The file stays open, since other threads
+// may be using it, and is closed at exit. Once threads may be running, this is
+// called with sTraceMutex held.
+static int LockTraceFile(short type)
+{
+    struct flock lock;
+
+    memset(&lock, 0, sizeof(lock));
+    lock.l_type = type;
+    lock.l_whence = SEEK_SET;
+
+    while (fcntl(sTraceFd, F_SETLKW, &lock) != 0)
+    {
+        if (errno != EINTR)
+        {
+            fprintf(stderr, "warning: failed to lock trace file (%s), not tracing\n", strerror(errno));
+            sTraceLockFailed = 1;
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static void WriteEvent(const char *name, const char *category, uint64_t start, uint64_t end, int thread, const char *argName, const char *argValue)
+{
+    char escapedValue[1024];
+    char event[2048];
+
+    EscapeJson(escapedValue, sizeof(escapedValue), argValue != NULL ? argValue : "");
+
+    int length = snprintf(event, sizeof(event),
+        "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%llu,\"pid\":%d,\"tid\":%d,\"args\":{\"%s\":\"%s\"}},\n",
+        name, category, (unsigned long long)start, (unsigned long long)(end - start), sPid, thread, argName, escapedValue);
+
+    if (length < 0 || length >= (int)sizeof(event))
+        return;
+
+    pthread_mutex_lock(&sTraceMutex);
+    if (!sTraceLockFailed && LockTraceFile(F_WRLCK))
+    {
+        if (write(sTraceFd, event, length) != length)
+            fprintf(stderr, "warning: failed to write to trace file\n");
+        LockTraceFile(F_UNLCK);
+    }
+    pthread_mutex_unlock(&sTraceMutex);
+}
+
+static void TraceExit(void)
+{
+    WriteEvent(sToolName, "tool", sStartTime, GetTimeMicroseconds(), 0, "cmd", sCommandLine);
+    close(sTraceFd);
+    sTraceFd = -1;
+}
+
+void TraceInit(const char *toolName, int argc, char **argv)
+{
+    const char *path = getenv(TRACE_ENV_VAR);
+
+    if (path == NULL || path[0] == 0 || sTraceFd >= 0)
+        return;
+
+    sTraceFd = open(path, O_WRONLY | O_CREAT | O_APPEND, 0644);
+
+    if (sTraceFd < 0)
+    {
+        fprintf(stderr, "warning: failed to open trace file \"%s\"\n", path);
+        return;
+    }
+
+    sPid = getpid();
+    sStartTime = GetTimeMicroseconds();
+    EscapeJson(sToolName, sizeof(sToolName), toolName);
+
+    size_t len = 0;
+
+    for (int i = 0; i < argc && len + 1 < sizeof(sCommandLine); i++)
+        len += snprintf(sCommandLine + len, sizeof(sCommandLine) - len, i == 0 ? "%s" : " %s", argv[i]);
+
+    // Whoever creates the file opens the array. No other thread can be using
+    // the file yet, so if locking it fails it can be closed here.
+    if (LockTraceFile(F_WRLCK))
+    {
+        if (lseek(sTraceFd, 0, SEEK_END) == 0 && write(sTraceFd, "[\n", 2) != 2)
+            fprintf(stderr, "warning: failed to write to trace file\n");
+        LockTraceFile(F_UNLCK);
+    }
+
+    if (sTraceLockFailed)
+    {
+        close(sTraceFd);
+        sTraceFd = -1;
+        return;
+    }
+
+    atexit(TraceExit);
+}
+
+uint64_t TraceBegin(void)
+{
+    return sTraceFd >= 0 ? GetTimeMicroseconds() : 0;
+}
+
+void TraceEnd(const char *phase, uint64_t start, const char *file)
+{
+    if (sTraceFd >= 0)
+        WriteEvent(phase, sToolName, start, GetTimeMicroseconds(), sThread, "file", file);
+}
+
+void TraceSetThread(int thread)
+{
+    sThread = thread;
+}
+
+#else
+
+void TraceInit(const char *toolName, int argc, char **argv)
+{
+    (void)toolName;
+    (void)argc;
+    (void)argv;
+}
+
+uint64_t TraceBegin(void)
+{
+    return 0;
+}
+
+void TraceEnd(const char *phase, uint64_t start, const char *file)
+{
+    (void)phase;
+    (void)start;
+    (void)file;
+}
+
+void TraceSetThread(int thread)
+{
+    (void)thread;
+}
+
+#endif // _WIN32
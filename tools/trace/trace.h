@@ -0,0 +1,24 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Opt-in build tracing shared by the host tools. When the TOOLS_TRACE
+// environment variable names a file, each invocation appends Chrome
+// trace events for itself and for the phases it reports with
+// TraceBegin/TraceEnd. Otherwise all of these do nothing.
+void TraceInit(const char *toolName, int argc, char **argv);
+uint64_t TraceBegin(void);
+void TraceEnd(const char *phase, uint64_t start, const char *file);
+// Tools that convert on several threads give each one its own track.
+void TraceSetThread(int thread);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TRACE_H